@@ -49,6 +49,10 @@ $Arguments = @(
     "-e QUIC_STATISTICS_V2_SIZE_2" # Inconsistent definitions across platforms
     "-e QUIC_STATISTICS_V2_SIZE_3" # Inconsistent definitions across platforms
     "-e QUIC_STATISTICS_V2_SIZE_4" # Inconsistent definitions across platforms
+    "-e QUIC_STATISTICS_V2_SIZE_5" # Inconsistent definitions across platforms
+    "-e QUIC_STATISTICS_V2_SIZE_6" # Inconsistent definitions across platforms
+    "-e QUIC_STATISTICS_V2_SIZE_7" # Inconsistent definitions across platforms
+    "-e QUIC_STATISTICS_V2_SIZE_8" # Inconsistent definitions across platforms
 )
 
 $FullArgs = $Arguments -join " "
@@ -1903,6 +1903,9 @@ MsQuicDatagramSend(
     SendRequest->Flags = Flags;
     SendRequest->TotalLength = TotalLength;
     SendRequest->ClientContext = ClientSendContext;
+    SendRequest->ExpirationTime = 0;
+    SendRequest->PriorityClass =
+        (Flags & QUIC_SEND_FLAG_DGRAM_PRIORITY) ? QUIC_DATAGRAM_PRIORITY_CLASS_MAX : 0;
 
     Status = QuicDatagramQueueSend(&Connection->Datagram, SendRequest);
 
@@ -1916,6 +1919,108 @@ Error:
     return Status;
 }
 
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_STATUS
+QUIC_API
+MsQuicDatagramSendBatch(
+    _In_ _Pre_defensive_ HQUIC Handle,
+    _In_reads_(DatagramCount) _Pre_defensive_
+        const QUIC_DATAGRAM_SEND_INFO* const Datagrams,
+    _In_ uint32_t DatagramCount
+    )
+{
+    QUIC_STATUS Status;
+    QUIC_CONNECTION* Connection;
+    QUIC_SEND_REQUEST* SendRequests = NULL;
+    QUIC_SEND_REQUEST** SendRequestsTail = &SendRequests;
+
+    QuicTraceEvent(
+        ApiEnter,
+        "[ api] Enter %u (%p).",
+        QUIC_TRACE_API_DATAGRAM_SEND_BATCH,
+        Handle);
+
+    if (!IS_CONN_HANDLE(Handle) ||
+        Datagrams == NULL ||
+        DatagramCount == 0) {
+        Status = QUIC_STATUS_INVALID_PARAMETER;
+        goto Error;
+    }
+
+#pragma prefast(suppress: __WARNING_25024, "Pointer cast already validated.")
+    Connection = (QUIC_CONNECTION*)Handle;
+
+    CXPLAT_TEL_ASSERT(!Connection->State.Freed);
+
+    const uint64_t TimeNow = CxPlatTimeUs64();
+    for (uint32_t i = 0; i < DatagramCount; ++i) {
+        const QUIC_DATAGRAM_SEND_INFO* Datagram = &Datagrams[i];
+        if (Datagram->Buffers == NULL ||
+            Datagram->BufferCount == 0 ||
+            Datagram->PriorityClass > QUIC_DATAGRAM_PRIORITY_CLASS_MAX) {
+            Status = QUIC_STATUS_INVALID_PARAMETER;
+            goto Error;
+        }
+
+        uint64_t TotalLength = 0;
+        for (uint32_t j = 0; j < Datagram->BufferCount; ++j) {
+            TotalLength += Datagram->Buffers[j].Length;
+        }
+
+        if (TotalLength > UINT16_MAX) {
+            QuicTraceEvent(
+                ConnError,
+                "[conn][%p] ERROR, %s.",
+                Connection,
+                "Send request total length exceeds max");
+            Status = QUIC_STATUS_INVALID_PARAMETER;
+            goto Error;
+        }
+
+#pragma prefast(suppress: __WARNING_6014, "Memory is correctly freed (...).")
+        QUIC_SEND_REQUEST* SendRequest =
+            CxPlatPoolAlloc(&Connection->Partition->SendRequestPool);
+        if (SendRequest == NULL) {
+            Status = QUIC_STATUS_OUT_OF_MEMORY;
+            goto Error;
+        }
+
+        SendRequest->Next = NULL;
+        SendRequest->Buffers = Datagram->Buffers;
+        SendRequest->BufferCount = Datagram->BufferCount;
+        SendRequest->Flags = Datagram->Flags;
+        SendRequest->TotalLength = TotalLength;
+        SendRequest->ClientContext = Datagram->ClientSendContext;
+        SendRequest->ExpirationTime =
+            Datagram->LifetimeMs != 0 ?
+                TimeNow + MS_TO_US((uint64_t)Datagram->LifetimeMs) : 0;
+        SendRequest->PriorityClass =
+            (Datagram->Flags & QUIC_SEND_FLAG_DGRAM_PRIORITY) ?
+                QUIC_DATAGRAM_PRIORITY_CLASS_MAX : Datagram->PriorityClass;
+
+        *SendRequestsTail = SendRequest;
+        SendRequestsTail = &SendRequest->Next;
+    }
+
+    Status = QuicDatagramQueueSend(&Connection->Datagram, SendRequests);
+    SendRequests = NULL;
+
+Error:
+
+    while (SendRequests != NULL) {
+        QUIC_SEND_REQUEST* SendRequest = SendRequests;
+        SendRequests = SendRequests->Next;
+        CxPlatPoolFree(SendRequest);
+    }
+
+    QuicTraceEvent(
+        ApiExitStatus,
+        "[ api] Exit %u",
+        Status);
+
+    return Status;
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 QUIC_STATUS
 QUIC_API
@@ -326,6 +326,16 @@ MsQuicDatagramSend(
     _In_opt_ void* ClientSendContext
     );
 
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_STATUS
+QUIC_API
+MsQuicDatagramSendBatch(
+    _In_ _Pre_defensive_ HQUIC Handle,
+    _In_reads_(DatagramCount) _Pre_defensive_
+        const QUIC_DATAGRAM_SEND_INFO* const Datagrams,
+    _In_ uint32_t DatagramCount
+    );
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 QUIC_STATUS
 QUIC_API
@@ -14,27 +14,30 @@ Abstract:
 #include "bbr.c.clog.h"
 #endif
 
-typedef enum BBR_STATE {
+typedef enum RECOVERY_STATE {
 
-    BBR_STATE_STARTUP,
+    RECOVERY_STATE_NOT_RECOVERY = 0,
 
-    BBR_STATE_DRAIN,
+    RECOVERY_STATE_CONSERVATIVE = 1,
 
-    BBR_STATE_PROBE_BW,
+    RECOVERY_STATE_GROWTH = 2,
 
-    BBR_STATE_PROBE_RTT
+} RECOVERY_STATE;
 
-} BBR_STATE;
+//
+// The phases of the BBRv3 PROBE_BW cycle
+//
+typedef enum BBR3_PROBE_BW_PHASE {
 
-typedef enum RECOVERY_STATE {
+    BBR3_PROBE_BW_DOWN,
 
-    RECOVERY_STATE_NOT_RECOVERY = 0,
+    BBR3_PROBE_BW_CRUISE,
 
-    RECOVERY_STATE_CONSERVATIVE = 1,
+    BBR3_PROBE_BW_REFILL,
 
-    RECOVERY_STATE_GROWTH = 2,
+    BBR3_PROBE_BW_UP
 
-} RECOVERY_STATE;
+} BBR3_PROBE_BW_PHASE;
 
 //
 // Bandwidth is measured as (bytes / BW_UNIT) per second
@@ -109,8 +112,61 @@ const uint32_t kBbrMaxBandwidthFilterLen = 10;
 
 const uint32_t kBbrMaxAckHeightFilterLen = 10;
 
+//
+// BBRv3 gains. STARTUP paces at 4*ln(2) with a cwnd gain of 2 and DRAIN paces
+// at 0.35 to drain the queue built in STARTUP within about one round trip.
+//
+const uint32_t kBbr3StartupPacingGain = GAIN_UNIT * 277 / 100;
+
+const uint32_t kBbr3StartupCwndGain = GAIN_UNIT * 2;
+
+const uint32_t kBbr3DrainPacingGain = GAIN_UNIT * 35 / 100;
+
+const uint32_t kBbr3ProbeDownPacingGain = GAIN_UNIT * 9 / 10;
+
+const uint32_t kBbr3ProbeUpPacingGain = GAIN_UNIT * 5 / 4;
+
+const uint32_t kBbr3ProbeUpCwndGain = GAIN_UNIT * 9 / 4;
+
+const uint32_t kBbr3ProbeRttCwndGain = GAIN_UNIT / 2;
+
+//
+// The maximum loss rate (2%) and ECN-CE mark fraction (50%) tolerated while
+// probing for bandwidth before the inflight is considered too high
+//
+const uint32_t kBbr3LossThresh = GAIN_UNIT * 2 / 100;
+
+const uint32_t kBbr3EcnThresh = GAIN_UNIT / 2;
+
+//
+// The multiplicative decrease applied to the inflight and bandwidth bounds on
+// loss, and the fraction of EcnAlpha applied to InflightLo on ECN-CE marks
+//
+const uint32_t kBbr3Beta = GAIN_UNIT * 7 / 10;
+
+const uint32_t kBbr3EcnFactor = GAIN_UNIT / 3;
+
+//
+// The fraction of InflightHi left unused while cruising, so other flows can
+// grab bandwidth
+//
+const uint32_t kBbr3Headroom = GAIN_UNIT * 15 / 100;
+
+//
+// The next bandwidth probe starts after a random 2-3 seconds, or after as many
+// round trips as Reno would take to grow by one BDP (capped), whichever is first
+//
+const uint64_t kBbr3ProbeWaitBaseInUs = S_TO_US(2);
+
+const uint64_t kBbr3ProbeWaitRandInUs = S_TO_US(1);
+
+const uint64_t kBbr3MaxRenoProbeRounds = 63;
+
+//
+// Returns the max delivery rate sampled from this ACK.
+//
 _IRQL_requires_max_(DISPATCH_LEVEL)
-void
+uint64_t
 BbrBandwidthFilterOnPacketAcked(
     _In_ BBR_BANDWIDTH_FILTER* b,
     _In_ const QUIC_ACK_EVENT* AckEvent,
@@ -122,6 +178,7 @@ BbrBandwidthFilterOnPacketAcked(
     }
 
     uint64_t TimeNow = AckEvent->TimeNow;
+    uint64_t MaxDeliveryRate = 0;
 
     QUIC_SENT_PACKET_METADATA* AckedPacketsIterator = AckEvent->AckedPackets;
     while (AckedPacketsIterator != NULL) {
@@ -172,6 +229,9 @@ BbrBandwidthFilterOnPacketAcked(
         }
 
         uint64_t DeliveryRate = CXPLAT_MIN(SendRate, AckRate);
+        if (DeliveryRate > MaxDeliveryRate) {
+            MaxDeliveryRate = DeliveryRate;
+        }
 
         QUIC_SLIDING_WINDOW_EXTREMUM_ENTRY Entry = (QUIC_SLIDING_WINDOW_EXTREMUM_ENTRY) { .Value = 0, .Time = 0 };
         QUIC_STATUS Status = QuicSlidingWindowExtremumGet(&b->WindowedMaxFilter, &Entry);
@@ -185,11 +245,13 @@ BbrBandwidthFilterOnPacketAcked(
             QuicSlidingWindowExtremumUpdateMax(&b->WindowedMaxFilter, DeliveryRate, RttCounter);
         }
     }
+
+    return MaxDeliveryRate;
 }
 
 _IRQL_requires_max_(DISPATCH_LEVEL)
 uint64_t
-BbrCongestionControlGetBandwidth(
+BbrCongestionControlGetMaxBandwidth(
     _In_ const QUIC_CONGESTION_CONTROL* Cc
     )
 {
@@ -201,6 +263,72 @@ BbrCongestionControlGetBandwidth(
     return 0;
 }
 
+//
+// The bandwidth used for pacing and the BDP. For BBRv3 this is the max
+// bandwidth bounded by BandwidthLo.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint64_t
+BbrCongestionControlGetBandwidth(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    uint64_t Bandwidth = BbrCongestionControlGetMaxBandwidth(Cc);
+    if (Cc->Bbr.IsBbr3 && Cc->Bbr.BandwidthLo < Bandwidth) {
+        Bandwidth = Cc->Bbr.BandwidthLo;
+    }
+    return Bandwidth;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint32_t
+BbrCongestionControlGetTargetCwnd(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint32_t Gain
+    )
+{
+    const QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+
+    uint64_t BandwidthEst = BbrCongestionControlGetBandwidth(Cc);
+
+    if (!BandwidthEst || Bbr->MinRtt == UINT32_MAX) {
+        return (uint64_t)(Gain) * Bbr->InitialCongestionWindow / GAIN_UNIT;
+    }
+
+    uint64_t Bdp = BandwidthEst * Bbr->MinRtt / kMicroSecsInSec / BW_UNIT;
+    uint64_t TargetCwnd = (Bdp * Gain / GAIN_UNIT) + (kQuantaFactor * Bbr->SendQuantum);
+    return (uint32_t)TargetCwnd;
+}
+
+//
+// BBRv3: InflightHi less the headroom left for other flows while cruising.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint32_t
+BbrCongestionControlGetInflightWithHeadroom(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    const QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+    const QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+
+    if (Bbr->InflightHi == UINT32_MAX) {
+        return UINT32_MAX;
+    }
+
+    const uint16_t DatagramPayloadLength =
+        QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+
+    uint32_t Headroom = CXPLAT_MAX(
+        (uint32_t)((uint64_t)Bbr->InflightHi * kBbr3Headroom / GAIN_UNIT),
+        (uint32_t)DatagramPayloadLength);
+    uint32_t MinCongestionWindow = kMinCwndInMss * DatagramPayloadLength;
+
+    return
+        Bbr->InflightHi > Headroom + MinCongestionWindow ?
+            Bbr->InflightHi - Headroom : MinCongestionWindow;
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 BOOLEAN
 BbrCongestionControlInRecovery(
@@ -225,6 +353,15 @@ BbrCongestionControlGetCongestionWindow(
     uint32_t MinCongestionWindow = kMinCwndInMss * DatagramPayloadLength;
 
     if (Bbr->BbrState == BBR_STATE_PROBE_RTT) {
+        if (Bbr->IsBbr3) {
+            //
+            // BBRv3 only halves the BDP while probing for the min RTT.
+            //
+            uint32_t ProbeRttCwnd = CXPLAT_MIN(
+                BbrCongestionControlGetTargetCwnd(Cc, kBbr3ProbeRttCwndGain),
+                BbrCongestionControlGetInflightWithHeadroom(Cc));
+            return CXPLAT_MAX(ProbeRttCwnd, MinCongestionWindow);
+        }
         return MinCongestionWindow;
     }
 
@@ -235,6 +372,114 @@ BbrCongestionControlGetCongestionWindow(
     return Bbr->CongestionWindow;
 }
 
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+BbrCongestionControlResetLowerBounds(
+    _In_ QUIC_CONGESTION_CONTROL_BBR* Bbr
+    )
+{
+    Bbr->BandwidthLo = UINT64_MAX;
+    Bbr->InflightLo = UINT32_MAX;
+}
+
+//
+// BBRv3: Grows InflightHi exponentially faster each round spent in Up: by 1,
+// 2, 4, ... packets per round.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+BbrCongestionControlRaiseInflightHiSlope(
+    _In_ QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+
+    const uint16_t DatagramPayloadLength =
+        QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+
+    uint32_t Growth = 1u << Bbr->ProbeUpRounds;
+    Bbr->ProbeUpRounds = CXPLAT_MIN(Bbr->ProbeUpRounds + 1, 30);
+    Bbr->ProbeUpCount =
+        CXPLAT_MAX(Bbr->CongestionWindow / Growth, (uint32_t)DatagramPayloadLength);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+BbrCongestionControlStartProbeBwDown(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint64_t TimeNow
+    )
+{
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+
+    Bbr->ProbeBwPhase = BBR3_PROBE_BW_DOWN;
+    Bbr->PacingGain = kBbr3ProbeDownPacingGain;
+    Bbr->CwndGain = kCwndGain;
+    Bbr->BwProbeSamples = FALSE;
+    Bbr->RoundsSinceBwProbe = 0;
+
+    uint32_t RandomValue = 0;
+    CxPlatRandom(sizeof(uint32_t), &RandomValue);
+    Bbr->BwProbeWait = kBbr3ProbeWaitBaseInUs + RandomValue % kBbr3ProbeWaitRandInUs;
+
+    Bbr->CycleStart = TimeNow;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+BbrCongestionControlStartProbeBwCruise(
+    _In_ QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    Cc->Bbr.ProbeBwPhase = BBR3_PROBE_BW_CRUISE;
+    Cc->Bbr.PacingGain = GAIN_UNIT;
+}
+
+//
+// BBRv3: Refill the pipe for one round at the estimated bandwidth, with the
+// short-term bounds lifted, so the following probe measures the path rather
+// than the queue.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+BbrCongestionControlStartProbeBwRefill(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint64_t LargestSentPacketNumber
+    )
+{
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+
+    BbrCongestionControlResetLowerBounds(Bbr);
+    Bbr->ProbeUpRounds = 0;
+    Bbr->ProbeUpAcked = 0;
+    Bbr->BwProbeSamples = TRUE;
+
+    Bbr->ProbeBwPhase = BBR3_PROBE_BW_REFILL;
+    Bbr->PacingGain = GAIN_UNIT;
+    Bbr->CwndGain = kCwndGain;
+
+    Bbr->EndOfRoundTripValid = TRUE;
+    Bbr->EndOfRoundTrip = LargestSentPacketNumber;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+BbrCongestionControlStartProbeBwUp(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint64_t TimeNow
+    )
+{
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+
+    Bbr->ProbeBwPhase = BBR3_PROBE_BW_UP;
+    Bbr->PacingGain = kBbr3ProbeUpPacingGain;
+    Bbr->CwndGain = kBbr3ProbeUpCwndGain;
+    Bbr->CycleStart = TimeNow;
+
+    BbrCongestionControlRaiseInflightHiSlope(Cc);
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 void
 BbrCongestionControlTransitToProbeBw(
@@ -247,6 +492,11 @@ BbrCongestionControlTransitToProbeBw(
     Bbr->BbrState = BBR_STATE_PROBE_BW;
     Bbr->CwndGain = kCwndGain;
 
+    if (Bbr->IsBbr3) {
+        BbrCongestionControlStartProbeBwDown(Cc, CongestionEventTime);
+        return;
+    }
+
     uint32_t RandomValue = 0;
     CxPlatRandom(sizeof(uint32_t), &RandomValue);
     Bbr->PacingCycleIndex = (RandomValue % (GAIN_CYCLE_LENGTH - 1) + 2) % GAIN_CYCLE_LENGTH;
@@ -263,8 +513,14 @@ BbrCongestionControlTransitToStartup(
     )
 {
     Cc->Bbr.BbrState = BBR_STATE_STARTUP;
-    Cc->Bbr.PacingGain = kHighGain;
-    Cc->Bbr.CwndGain = kHighGain;
+    if (Cc->Bbr.IsBbr3) {
+        Cc->Bbr.PacingGain = kBbr3StartupPacingGain;
+        Cc->Bbr.CwndGain = kBbr3StartupCwndGain;
+        Cc->Bbr.BwProbeSamples = TRUE;
+    } else {
+        Cc->Bbr.PacingGain = kHighGain;
+        Cc->Bbr.CwndGain = kHighGain;
+    }
 }
 
 _IRQL_requires_max_(DISPATCH_LEVEL)
@@ -543,6 +799,10 @@ BbrCongestionControlHandleAckInProbeRtt(
             Bbr->MinRttTimestamp = AckTime;
             Bbr->MinRttTimestampValid = TRUE;
 
+            if (Bbr->IsBbr3) {
+                BbrCongestionControlResetLowerBounds(Bbr);
+            }
+
             if (Bbr->BtlbwFound) {
                 BbrCongestionControlTransitToProbeBw(Cc, AckTime);
             } else {
@@ -593,26 +853,6 @@ BbrCongestionControlUpdateAckAggregation(
     return Bbr->AggregatedAckBytes - ExpectedAckBytes;
 }
 
-_IRQL_requires_max_(DISPATCH_LEVEL)
-uint32_t
-BbrCongestionControlGetTargetCwnd(
-    _In_ QUIC_CONGESTION_CONTROL* Cc,
-    _In_ uint32_t Gain
-    )
-{
-    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
-
-    uint64_t BandwidthEst = BbrCongestionControlGetBandwidth(Cc);
-
-    if (!BandwidthEst || Bbr->MinRtt == UINT32_MAX) {
-        return (uint64_t)(Gain) * Bbr->InitialCongestionWindow / GAIN_UNIT;
-    }
-
-    uint64_t Bdp = BandwidthEst * Bbr->MinRtt / kMicroSecsInSec / BW_UNIT;
-    uint64_t TargetCwnd = (Bdp * Gain / GAIN_UNIT) + (kQuantaFactor * Bbr->SendQuantum);
-    return (uint32_t)TargetCwnd;
-}
-
 _IRQL_requires_max_(DISPATCH_LEVEL)
 uint32_t
 BbrCongestionControlGetSendAllowance(
@@ -651,12 +891,22 @@ BbrCongestionControlGetSendAllowance(
         // spread out over the RTT. Calculate the current send allowance (chunk
         // size) as the time since the last send times the pacing rate (CWND / RTT).
         //
+        // Pacing over more than an RTT would allow more than the window
+        // anyway, so clamp the time since the last send. Otherwise, the
+        // product below can overflow after a long idle period.
+        //
+        if (TimeSinceLastSend > Bbr->MinRtt) {
+            TimeSinceLastSend = Bbr->MinRtt;
+        }
+        const uint64_t PacingRate = // Bytes per second
+            BandwidthEst / BW_UNIT * Bbr->PacingGain / GAIN_UNIT;
+        uint64_t PacedBytes = PacingRate * TimeSinceLastSend / kMicroSecsInSec;
         if (Bbr->BbrState == BBR_STATE_STARTUP) {
             SendAllowance = (uint32_t)CXPLAT_MAX(
-                BandwidthEst * Bbr->PacingGain * TimeSinceLastSend / GAIN_UNIT,
-                CongestionWindow * Bbr->PacingGain / GAIN_UNIT - Bbr->BytesInFlight);
+                CXPLAT_MIN(PacedBytes, UINT32_MAX),
+                (uint64_t)CongestionWindow * Bbr->PacingGain / GAIN_UNIT - Bbr->BytesInFlight);
         } else {
-            SendAllowance = (uint32_t)(BandwidthEst * Bbr->PacingGain * TimeSinceLastSend / GAIN_UNIT);
+            SendAllowance = (uint32_t)CXPLAT_MIN(PacedBytes, UINT32_MAX);
         }
 
         if (SendAllowance > CongestionWindow - Bbr->BytesInFlight) {
@@ -695,8 +945,13 @@ BbrCongestionControlTransitToDrain(
     )
 {
     Cc->Bbr.BbrState = BBR_STATE_DRAIN;
-    Cc->Bbr.PacingGain = kDrainGain;
-    Cc->Bbr.CwndGain = kHighGain;
+    if (Cc->Bbr.IsBbr3) {
+        Cc->Bbr.PacingGain = kBbr3DrainPacingGain;
+        Cc->Bbr.CwndGain = kBbr3StartupCwndGain;
+    } else {
+        Cc->Bbr.PacingGain = kDrainGain;
+        Cc->Bbr.CwndGain = kHighGain;
+    }
 }
 
 _IRQL_requires_max_(DISPATCH_LEVEL)
@@ -724,6 +979,253 @@ BbrCongestionControlSetSendQuantum(
     }
 }
 
+//
+// BBRv3: The cap on the congestion window from the loss and ECN bounds.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint32_t
+BbrCongestionControlGetInflightCap(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    const QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+
+    uint32_t InflightCap = UINT32_MAX;
+    if (Bbr->BbrState == BBR_STATE_PROBE_BW) {
+        InflightCap =
+            Bbr->ProbeBwPhase == BBR3_PROBE_BW_CRUISE ?
+                BbrCongestionControlGetInflightWithHeadroom(Cc) :
+                Bbr->InflightHi;
+    }
+
+    return CXPLAT_MIN(InflightCap, Bbr->InflightLo);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+BbrCongestionControlIsProbingBw(
+    _In_ const QUIC_CONGESTION_CONTROL_BBR* Bbr
+    )
+{
+    return
+        Bbr->BbrState == BBR_STATE_STARTUP ||
+        (Bbr->BbrState == BBR_STATE_PROBE_BW &&
+         (Bbr->ProbeBwPhase == BBR3_PROBE_BW_REFILL ||
+          Bbr->ProbeBwPhase == BBR3_PROBE_BW_UP));
+}
+
+//
+// BBRv3: Called when a bandwidth probe (or STARTUP) sees excessive loss or
+// ECN marks. Bounds the inflight at the level that caused the congestion; the
+// probe itself ends on the next ACK.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+BbrCongestionControlHandleInflightTooHigh(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint32_t InflightAtSignal
+    )
+{
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+
+    Bbr->BwProbeSamples = FALSE;
+
+    if (!BbrCongestionControlIsAppLimited(Cc)) {
+        uint32_t TargetInflight = CXPLAT_MIN(
+            BbrCongestionControlGetTargetCwnd(Cc, GAIN_UNIT), Bbr->CongestionWindow);
+        Bbr->InflightHi = CXPLAT_MAX(
+            InflightAtSignal,
+            (uint32_t)((uint64_t)TargetInflight * kBbr3Beta / GAIN_UNIT));
+    }
+
+    if (Bbr->BbrState == BBR_STATE_STARTUP) {
+        Bbr->BtlbwFound = TRUE;
+    }
+}
+
+//
+// BBRv3: Adapts the short-term bounds to the loss and ECN marks seen in the
+// last round trip. Skipped while probing, since probing is expected to cause
+// some congestion and reacts via InflightHi instead.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+BbrCongestionControlAdaptLowerBounds(
+    _In_ QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+
+    if (BbrCongestionControlIsProbingBw(Bbr)) {
+        return;
+    }
+
+    if (Bbr->LossInRound) {
+        if (Bbr->BandwidthLo == UINT64_MAX) {
+            Bbr->BandwidthLo = BbrCongestionControlGetMaxBandwidth(Cc);
+        }
+        if (Bbr->InflightLo == UINT32_MAX) {
+            Bbr->InflightLo = Bbr->CongestionWindow;
+        }
+        Bbr->BandwidthLo = CXPLAT_MAX(
+            Bbr->BandwidthLatest, Bbr->BandwidthLo * kBbr3Beta / GAIN_UNIT);
+        Bbr->InflightLo = CXPLAT_MAX(
+            Bbr->InflightLatest,
+            (uint32_t)((uint64_t)Bbr->InflightLo * kBbr3Beta / GAIN_UNIT));
+    }
+
+    if (Bbr->EcnInRound && Bbr->EcnAlpha > 0) {
+        if (Bbr->InflightLo == UINT32_MAX) {
+            Bbr->InflightLo = Bbr->CongestionWindow;
+        }
+        Bbr->InflightLo -= (uint32_t)(
+            (uint64_t)Bbr->InflightLo * Bbr->EcnAlpha / GAIN_UNIT * kBbr3EcnFactor / GAIN_UNIT);
+    }
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+BbrCongestionControlOnRoundEnd(
+    _In_ QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+
+    if (Bbr->RoundAckedPackets > 0) {
+        uint32_t CeRatio =
+            CXPLAT_MIN(Bbr->RoundCePackets, Bbr->RoundAckedPackets) * GAIN_UNIT /
+            Bbr->RoundAckedPackets;
+        Bbr->EcnAlpha = (Bbr->EcnAlpha * 15 + CeRatio) / 16;
+    }
+
+    BbrCongestionControlAdaptLowerBounds(Cc);
+
+    Bbr->LossInRound = FALSE;
+    Bbr->EcnInRound = FALSE;
+    Bbr->BandwidthLatest = 0;
+    Bbr->InflightLatest = 0;
+    Bbr->RoundLostBytes = 0;
+    Bbr->RoundAckedPackets = 0;
+    Bbr->RoundCePackets = 0;
+    Bbr->RoundsSinceBwProbe++;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+BbrCongestionControlIsTimeToProbeBw(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint64_t TimeNow
+    )
+{
+    const QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+    const QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+
+    if (CxPlatTimeDiff64(Bbr->CycleStart, TimeNow) > Bbr->BwProbeWait) {
+        return TRUE;
+    }
+
+    //
+    // Probe at least as often as Reno would grow its window by one BDP, so
+    // competing loss-based flows don't starve us (and vice versa).
+    //
+    const uint16_t DatagramPayloadLength =
+        QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+    uint64_t RenoRounds = CXPLAT_MIN(
+        BbrCongestionControlGetTargetCwnd(Cc, GAIN_UNIT) / DatagramPayloadLength,
+        kBbr3MaxRenoProbeRounds);
+
+    return Bbr->RoundsSinceBwProbe >= RenoRounds;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+BbrCongestionControlProbeInflightHiUpward(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint32_t AckedBytes,
+    _In_ BOOLEAN IsCwndLimited,
+    _In_ BOOLEAN NewRoundTrip
+    )
+{
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+
+    if (!IsCwndLimited || Bbr->CongestionWindow < Bbr->InflightHi) {
+        return; // Not fully using InflightHi, so don't grow it.
+    }
+
+    const uint16_t DatagramPayloadLength =
+        QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+
+    Bbr->ProbeUpAcked += AckedBytes;
+    if (Bbr->ProbeUpAcked >= Bbr->ProbeUpCount) {
+        uint32_t Delta = Bbr->ProbeUpAcked / Bbr->ProbeUpCount;
+        Bbr->ProbeUpAcked -= Delta * Bbr->ProbeUpCount;
+        Bbr->InflightHi += Delta * DatagramPayloadLength;
+    }
+
+    if (NewRoundTrip) {
+        BbrCongestionControlRaiseInflightHiSlope(Cc);
+    }
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+BbrCongestionControlUpdateProbeBwPhase(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_ACK_EVENT* AckEvent,
+    _In_ BOOLEAN NewRoundTrip,
+    _In_ uint32_t PrevInflightBytes
+    )
+{
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+
+    switch (Bbr->ProbeBwPhase) {
+    case BBR3_PROBE_BW_DOWN:
+        if (BbrCongestionControlIsTimeToProbeBw(Cc, AckEvent->TimeNow)) {
+            BbrCongestionControlStartProbeBwRefill(Cc, AckEvent->LargestSentPacketNumber);
+        } else if (
+            Bbr->BytesInFlight <= BbrCongestionControlGetInflightWithHeadroom(Cc) &&
+            Bbr->BytesInFlight <= BbrCongestionControlGetTargetCwnd(Cc, GAIN_UNIT)) {
+            BbrCongestionControlStartProbeBwCruise(Cc);
+        }
+        break;
+
+    case BBR3_PROBE_BW_CRUISE:
+        if (BbrCongestionControlIsTimeToProbeBw(Cc, AckEvent->TimeNow)) {
+            BbrCongestionControlStartProbeBwRefill(Cc, AckEvent->LargestSentPacketNumber);
+        }
+        break;
+
+    case BBR3_PROBE_BW_REFILL:
+        if (NewRoundTrip) {
+            BbrCongestionControlStartProbeBwUp(Cc, AckEvent->TimeNow);
+        }
+        break;
+
+    case BBR3_PROBE_BW_UP: {
+        const uint16_t DatagramPayloadLength =
+            QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+        BOOLEAN IsCwndLimited =
+            PrevInflightBytes + DatagramPayloadLength >= BbrCongestionControlGetCongestionWindow(Cc);
+
+        BbrCongestionControlProbeInflightHiUpward(
+            Cc, AckEvent->NumRetransmittableBytes, IsCwndLimited, NewRoundTrip);
+
+        //
+        // Stop probing once the probe saw too much loss or ECN marks, or after
+        // at least a min RTT with the inflight above the probe target.
+        //
+        if (!Bbr->BwProbeSamples ||
+            (CxPlatTimeDiff64(Bbr->CycleStart, AckEvent->TimeNow) > Bbr->MinRtt &&
+             PrevInflightBytes > BbrCongestionControlGetTargetCwnd(Cc, kBbr3ProbeUpPacingGain))) {
+            BbrCongestionControlStartProbeBwDown(Cc, AckEvent->TimeNow);
+        }
+        break;
+    }
+    }
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 void
 BbrCongestionControlUpdateCongestionWindow(
@@ -762,6 +1264,10 @@ BbrCongestionControlUpdateCongestionWindow(
         CongestionWindow += (uint32_t)AckedBytes;
     }
 
+    if (Bbr->IsBbr3) {
+        CongestionWindow = CXPLAT_MIN(CongestionWindow, BbrCongestionControlGetInflightCap(Cc));
+    }
+
     Bbr->CongestionWindow = CXPLAT_MAX(CongestionWindow, MinCongestionWindow);
 
     QuicConnLogBbr(QuicCongestionControlGetConnection(Cc));
@@ -816,7 +1322,8 @@ BbrCongestionControlOnDataAcknowledged(
     BOOLEAN LastAckedPacketAppLimited =
         AckEvent->AckedPackets == NULL ? FALSE : AckEvent->IsLargestAckedPacketAppLimited;
 
-    BbrBandwidthFilterOnPacketAcked(&Bbr->BandwidthFilter, AckEvent, Bbr->RoundTripCounter);
+    uint64_t DeliveryRate =
+        BbrBandwidthFilterOnPacketAcked(&Bbr->BandwidthFilter, AckEvent, Bbr->RoundTripCounter);
 
     if (BbrCongestionControlInRecovery(Cc)) {
         CXPLAT_DBG_ASSERT(Bbr->EndOfRecoveryValid);
@@ -836,7 +1343,33 @@ BbrCongestionControlOnDataAcknowledged(
 
     BbrCongestionControlUpdateAckAggregation(Cc, AckEvent);
 
-    if (Bbr->BbrState == BBR_STATE_PROBE_BW) {
+    if (Bbr->IsBbr3) {
+        Bbr->BandwidthLatest = CXPLAT_MAX(Bbr->BandwidthLatest, DeliveryRate);
+        Bbr->InflightLatest += AckEvent->NumRetransmittableBytes;
+        for (QUIC_SENT_PACKET_METADATA* Packet = AckEvent->AckedPackets;
+             Packet != NULL;
+             Packet = Packet->Next) {
+            Bbr->RoundAckedPackets++;
+        }
+
+        if (Bbr->BwProbeSamples &&
+            Bbr->EcnInRound &&
+            Bbr->RoundAckedPackets >= kMinCwndInMss &&
+            (uint64_t)Bbr->RoundCePackets * GAIN_UNIT >
+                (uint64_t)Bbr->RoundAckedPackets * kBbr3EcnThresh) {
+            BbrCongestionControlHandleInflightTooHigh(Cc, PrevInflightBytes);
+        }
+
+        if (NewRoundTrip) {
+            BbrCongestionControlOnRoundEnd(Cc);
+        }
+
+        if (Bbr->BbrState == BBR_STATE_PROBE_BW) {
+            BbrCongestionControlUpdateProbeBwPhase(Cc, AckEvent, NewRoundTrip, PrevInflightBytes);
+        }
+    }
+
+    if (Bbr->BbrState == BBR_STATE_PROBE_BW && !Bbr->IsBbr3) {
         BOOLEAN ShouldAdvancePacingGainCycle = CxPlatTimeDiff64(AckEvent->TimeNow, Bbr->CycleStart) > Bbr->MinRtt;
 
         if (Bbr->PacingGain > GAIN_UNIT && !AckEvent->HasLoss &&
@@ -860,7 +1393,7 @@ BbrCongestionControlOnDataAcknowledged(
 
     if (!Bbr->BtlbwFound && NewRoundTrip && !LastAckedPacketAppLimited) {
         uint64_t BandwidthTarget = (uint64_t)(Bbr->LastEstimatedStartupBandwidth * kStartupGrowthTarget / GAIN_UNIT);
-        uint64_t CurrentBandwidth = BbrCongestionControlGetBandwidth(Cc);
+        uint64_t CurrentBandwidth = BbrCongestionControlGetMaxBandwidth(Cc);
 
         if (CurrentBandwidth >= BandwidthTarget) {
             Bbr->LastEstimatedStartupBandwidth = CurrentBandwidth;
@@ -929,9 +1462,21 @@ BbrCongestionControlOnDataLost(
     Bbr->EndOfRecoveryValid = TRUE;
     Bbr->EndOfRecovery = LossEvent->LargestSentPacketNumber;
 
+    uint32_t InflightAtLoss = Bbr->BytesInFlight;
+
     CXPLAT_DBG_ASSERT(Bbr->BytesInFlight >= LossEvent->NumRetransmittableBytes);
     Bbr->BytesInFlight -= LossEvent->NumRetransmittableBytes;
 
+    if (Bbr->IsBbr3) {
+        Bbr->LossInRound = TRUE;
+        Bbr->RoundLostBytes += LossEvent->NumRetransmittableBytes;
+        if (Bbr->BwProbeSamples &&
+            (uint64_t)Bbr->RoundLostBytes * GAIN_UNIT >
+                (uint64_t)InflightAtLoss * kBbr3LossThresh) {
+            BbrCongestionControlHandleInflightTooHigh(Cc, InflightAtLoss);
+        }
+    }
+
     uint32_t RecoveryWindow = Bbr->RecoveryWindow;
     uint32_t MinCongestionWindow = kMinCwndInMss * DatagramPayloadLength;
 
@@ -964,6 +1509,32 @@ BbrCongestionControlOnDataLost(
     QuicConnLogBbr(QuicCongestionControlGetConnection(Cc));
 }
 
+//
+// Only used by BBRv3; the marks are accounted per round trip.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+BbrCongestionControlOnEcn(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_ECN_EVENT* EcnEvent
+    )
+{
+    QUIC_CONGESTION_CONTROL_BBR *Bbr = &Cc->Bbr;
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+
+    if (!Bbr->EcnInRound) {
+        QuicTraceEvent(
+            ConnCongestionV2,
+            "[conn][%p] Congestion event: IsEcn=%hu",
+            Connection,
+            TRUE);
+        Connection->Stats.Send.EcnCongestionCount++;
+        Bbr->EcnInRound = TRUE;
+    }
+
+    Bbr->RoundCePackets += EcnEvent->CePacketCount;
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 BOOLEAN
 BbrCongestionControlOnSpuriousCongestionEvent(
@@ -1018,10 +1589,8 @@ BbrCongestionControlReset(
     Bbr->Exemptions = 0;
 
     Bbr->RecoveryState = RECOVERY_STATE_NOT_RECOVERY;
-    Bbr->BbrState = BBR_STATE_STARTUP;
+    BbrCongestionControlTransitToStartup(Cc);
     Bbr->RoundTripCounter = 0;
-    Bbr->CwndGain = kHighGain;
-    Bbr->PacingGain = kHighGain;
     Bbr->BtlbwFound = FALSE;
     Bbr->SendQuantum = 0;
     Bbr->SlowStartupRoundCounter = 0 ;
@@ -1058,6 +1627,23 @@ BbrCongestionControlReset(
     Bbr->BandwidthFilter.AppLimited = FALSE;
     Bbr->BandwidthFilter.AppLimitedExitTarget = 0;
 
+    Bbr->ProbeBwPhase = BBR3_PROBE_BW_DOWN;
+    BbrCongestionControlResetLowerBounds(Bbr);
+    Bbr->InflightHi = UINT32_MAX;
+    Bbr->LossInRound = FALSE;
+    Bbr->EcnInRound = FALSE;
+    Bbr->BandwidthLatest = 0;
+    Bbr->InflightLatest = 0;
+    Bbr->RoundLostBytes = 0;
+    Bbr->RoundAckedPackets = 0;
+    Bbr->RoundCePackets = 0;
+    Bbr->EcnAlpha = 0;
+    Bbr->ProbeUpCount = 0;
+    Bbr->ProbeUpAcked = 0;
+    Bbr->ProbeUpRounds = 0;
+    Bbr->RoundsSinceBwProbe = 0;
+    Bbr->BwProbeWait = 0;
+
     BbrCongestionControlLogOutFlowStatus(Cc);
     QuicConnLogBbr(Connection);
 }
@@ -1095,6 +1681,13 @@ BbrCongestionControlInitialize(
 
     QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
 
+    Bbr->IsBbr3 =
+        Settings->CongestionControlAlgorithm == QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3;
+    if (Bbr->IsBbr3) {
+        Cc->Name = "BBRv3";
+        Cc->QuicCongestionControlOnEcn = BbrCongestionControlOnEcn;
+    }
+
     QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
 
     const uint16_t DatagramPayloadLength =
@@ -1111,10 +1704,8 @@ BbrCongestionControlInitialize(
     Bbr->Exemptions = 0;
 
     Bbr->RecoveryState = RECOVERY_STATE_NOT_RECOVERY;
-    Bbr->BbrState = BBR_STATE_STARTUP;
+    BbrCongestionControlTransitToStartup(Cc);
     Bbr->RoundTripCounter = 0;
-    Bbr->CwndGain = kHighGain;
-    Bbr->PacingGain = kHighGain;
     Bbr->BtlbwFound = FALSE;
     Bbr->SendQuantum = 0;
     Bbr->SlowStartupRoundCounter = 0 ;
@@ -1155,6 +1746,23 @@ BbrCongestionControlInitialize(
         .AppLimitedExitTarget = 0,
     };
 
+    Bbr->ProbeBwPhase = BBR3_PROBE_BW_DOWN;
+    BbrCongestionControlResetLowerBounds(Bbr);
+    Bbr->InflightHi = UINT32_MAX;
+    Bbr->LossInRound = FALSE;
+    Bbr->EcnInRound = FALSE;
+    Bbr->BandwidthLatest = 0;
+    Bbr->InflightLatest = 0;
+    Bbr->RoundLostBytes = 0;
+    Bbr->RoundAckedPackets = 0;
+    Bbr->RoundCePackets = 0;
+    Bbr->EcnAlpha = 0;
+    Bbr->ProbeUpCount = 0;
+    Bbr->ProbeUpAcked = 0;
+    Bbr->ProbeUpRounds = 0;
+    Bbr->RoundsSinceBwProbe = 0;
+    Bbr->BwProbeWait = 0;
+
     QuicConnLogOutFlowStats(Connection);
     QuicConnLogBbr(Connection);
 }
@@ -15,6 +15,18 @@
 extern "C" {
 #endif
 
+typedef enum BBR_STATE {
+
+    BBR_STATE_STARTUP,
+
+    BBR_STATE_DRAIN,
+
+    BBR_STATE_PROBE_BW,
+
+    BBR_STATE_PROBE_RTT
+
+} BBR_STATE;
+
 typedef struct BBR_BANDWIDTH_FILTER {
 
     //
@@ -83,6 +95,29 @@ typedef struct QUIC_CONGESTION_CONTROL_BBR {
     //
     BOOLEAN MinRttTimestampValid: 1;
 
+    //
+    // If TRUE, the BBRv3 model is used: inflight is bounded by loss and ECN
+    // signals (InflightHi/InflightLo/BandwidthLo) and ProbeBw runs the
+    // Down/Cruise/Refill/Up cycle instead of the fixed gain cycle
+    //
+    BOOLEAN IsBbr3 : 1;
+
+    //
+    // BBRv3: If TRUE, loss was detected in the current round trip
+    //
+    BOOLEAN LossInRound : 1;
+
+    //
+    // BBRv3: If TRUE, ECN-CE marks were reported in the current round trip
+    //
+    BOOLEAN EcnInRound : 1;
+
+    //
+    // BBRv3: If TRUE, the current bandwidth probe hasn't yet reacted to an
+    // excessive loss or ECN signal
+    //
+    BOOLEAN BwProbeSamples : 1;
+
     //
     // The size of the initial congestion window in packets
     //
@@ -162,7 +197,7 @@ typedef struct QUIC_CONGESTION_CONTROL_BBR {
     uint32_t RecoveryState;
 
     //
-    // Current state of BBR state machine
+    // Current state of BBR state machine (BBR_STATE)
     //
     uint32_t BbrState;
 
@@ -217,6 +252,65 @@ typedef struct QUIC_CONGESTION_CONTROL_BBR {
     //
     BBR_BANDWIDTH_FILTER BandwidthFilter;
 
+    //
+    // BBRv3: Current phase of the ProbeBw cycle
+    //
+    uint32_t ProbeBwPhase;
+
+    //
+    // BBRv3: Long-term upper bound on inflight, learned from the inflight
+    // level at which the last bandwidth probe saw excessive loss or ECN marks.
+    // UINT32_MAX when unbounded.
+    //
+    uint32_t InflightHi; // bytes
+
+    //
+    // BBRv3: Short-term lower bound on inflight, reduced on rounds with loss
+    // or ECN marks while not probing. UINT32_MAX when unbounded.
+    //
+    uint32_t InflightLo; // bytes
+
+    //
+    // BBRv3: Short-term lower bound on the bandwidth estimate, reduced on
+    // rounds with loss while not probing. UINT64_MAX when unbounded.
+    //
+    uint64_t BandwidthLo;
+
+    //
+    // BBRv3: Max delivery rate and bytes delivered in the current round trip
+    //
+    uint64_t BandwidthLatest;
+    uint32_t InflightLatest; // bytes
+
+    //
+    // BBRv3: Bytes lost, packets acknowledged and packets reported as ECN-CE
+    // marked in the current round trip
+    //
+    uint32_t RoundLostBytes;
+    uint32_t RoundAckedPackets;
+    uint32_t RoundCePackets;
+
+    //
+    // BBRv3: EWMA of the per-round fraction of ECN-CE marked packets
+    //
+    uint32_t EcnAlpha; // GAIN_UNIT scaled
+
+    //
+    // BBRv3: Bytes that must be acknowledged while cwnd limited in ProbeBw Up
+    // before InflightHi grows by another packet, the acknowledged bytes counted
+    // so far, and the number of rounds spent growing InflightHi
+    //
+    uint32_t ProbeUpCount;
+    uint32_t ProbeUpAcked;
+    uint32_t ProbeUpRounds;
+
+    //
+    // BBRv3: Round trips since the last bandwidth probe and the randomized
+    // time to wait before the next one
+    //
+    uint64_t RoundsSinceBwProbe;
+    uint64_t BwProbeWait; // microseconds
+
 } QUIC_CONGESTION_CONTROL_BBR;
 
 _IRQL_requires_max_(DISPATCH_LEVEL)
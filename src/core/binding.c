@@ -42,15 +42,18 @@ QuicBindingInitialize(
 {
     QUIC_STATUS Status;
     QUIC_BINDING* Binding;
-    BOOLEAN HashTableInitialized = FALSE;
+    uint16_t ShardsInitialized = 0;
+    const uint16_t ShardCount = MsQuicLib.PartitionCount;
+    const size_t BindingSize =
+        sizeof(QUIC_BINDING) + ShardCount * sizeof(QUIC_STATELESS_OPER_SHARD);
 
-    Binding = CXPLAT_ALLOC_NONPAGED(sizeof(QUIC_BINDING), QUIC_POOL_BINDING);
+    Binding = CXPLAT_ALLOC_NONPAGED(BindingSize, QUIC_POOL_BINDING);
     if (Binding == NULL) {
         QuicTraceEvent(
             AllocFailure,
             "Allocation of '%s' failed. (%llu bytes)",
             "QUIC_BINDING",
-            sizeof(QUIC_BINDING));
+            BindingSize);
         Status = QUIC_STATUS_OUT_OF_MEMORY;
         goto Error;
     }
@@ -63,20 +66,29 @@ QuicBindingInitialize(
     if (Binding->Partitioned) {
         Binding->PartitionIndex = UdpConfig->PartitionIndex;
     }
-    Binding->StatelessOperCount = 0;
+    Binding->StatelessOperShardCount = ShardCount;
+    Binding->StatelessOperShards = (QUIC_STATELESS_OPER_SHARD*)(Binding + 1);
     CxPlatDispatchRwLockInitialize(&Binding->RwLock);
-    CxPlatDispatchLockInitialize(&Binding->StatelessOperLock);
+    CxPlatDispatchLockInitialize(&Binding->PathMtuCacheLock);
+    CxPlatZeroMemory(Binding->PathMtuCache, sizeof(Binding->PathMtuCache));
+    QuicSourceLimiterInitialize(&Binding->InitialLimiter);
     CxPlatListInitializeHead(&Binding->Listeners);
+    Binding->ListenerAlpnTable = NULL;
+    Binding->NextListenerSequence = 0;
     QuicLookupInitialize(&Binding->Lookup);
 #if DEBUG
     QuicLibraryTrackDbgObject(QUIC_DBG_OBJECT_TYPE_BINDING, &Binding->DbgObjectLink);
 #endif
-    if (!CxPlatHashtableInitializeEx(&Binding->StatelessOperTable, CXPLAT_HASH_MIN_SIZE)) {
-        Status = QUIC_STATUS_OUT_OF_MEMORY;
-        goto Error;
+    for (; ShardsInitialized < ShardCount; ++ShardsInitialized) {
+        QUIC_STATELESS_OPER_SHARD* Shard = &Binding->StatelessOperShards[ShardsInitialized];
+        if (!CxPlatHashtableInitializeEx(&Shard->Table, CXPLAT_HASH_MIN_SIZE)) {
+            Status = QUIC_STATUS_OUT_OF_MEMORY;
+            goto Error;
+        }
+        CxPlatDispatchLockInitialize(&Shard->Lock);
+        CxPlatListInitializeHead(&Shard->List);
+        Shard->Count = 0;
     }
-    HashTableInitialized = TRUE;
-    CxPlatListInitializeHead(&Binding->StatelessOperList);
 
     //
     // Random reserved version number for version negotation.
@@ -179,13 +191,15 @@ Error:
     if (QUIC_FAILED(Status)) {
         if (Binding != NULL) {
             QuicLookupUninitialize(&Binding->Lookup);
-            if (HashTableInitialized) {
-                CxPlatHashtableUninitialize(&Binding->StatelessOperTable);
+            for (uint16_t i = 0; i < ShardsInitialized; ++i) {
+                CxPlatHashtableUninitialize(&Binding->StatelessOperShards[i].Table);
+                CxPlatDispatchLockUninitialize(&Binding->StatelessOperShards[i].Lock);
             }
 #if DEBUG
             QuicLibraryUntrackDbgObject(QUIC_DBG_OBJECT_TYPE_BINDING, &Binding->DbgObjectLink);
 #endif
-            CxPlatDispatchLockUninitialize(&Binding->StatelessOperLock);
+            QuicSourceLimiterUninitialize(&Binding->InitialLimiter);
+            CxPlatDispatchLockUninitialize(&Binding->PathMtuCacheLock);
             CxPlatDispatchRwLockUninitialize(&Binding->RwLock);
             CXPLAT_FREE(Binding, QUIC_POOL_BINDING);
         }
@@ -217,26 +231,35 @@ QuicBindingUninitialize(
     //
     // Clean up any leftover stateless operations being tracked.
     //
-    while (!CxPlatListIsEmpty(&Binding->StatelessOperList)) {
-        QUIC_STATELESS_CONTEXT* StatelessCtx =
-            CXPLAT_CONTAINING_RECORD(
-                CxPlatListRemoveHead(&Binding->StatelessOperList),
-                QUIC_STATELESS_CONTEXT,
-                ListEntry);
-        Binding->StatelessOperCount--;
-        CxPlatHashtableRemove(
-            &Binding->StatelessOperTable,
-            &StatelessCtx->TableEntry,
-            NULL);
-        CXPLAT_DBG_ASSERT(StatelessCtx->IsProcessed);
-        CxPlatPoolFree(StatelessCtx);
+    for (uint16_t i = 0; i < Binding->StatelessOperShardCount; ++i) {
+        QUIC_STATELESS_OPER_SHARD* Shard = &Binding->StatelessOperShards[i];
+        while (!CxPlatListIsEmpty(&Shard->List)) {
+            QUIC_STATELESS_CONTEXT* StatelessCtx =
+                CXPLAT_CONTAINING_RECORD(
+                    CxPlatListRemoveHead(&Shard->List),
+                    QUIC_STATELESS_CONTEXT,
+                    ListEntry);
+            Shard->Count--;
+            CxPlatHashtableRemove(
+                &Shard->Table,
+                &StatelessCtx->TableEntry,
+                NULL);
+            CXPLAT_DBG_ASSERT(StatelessCtx->IsProcessed);
+            CxPlatPoolFree(StatelessCtx);
+        }
+        CXPLAT_DBG_ASSERT(Shard->Count == 0);
+        CXPLAT_DBG_ASSERT(Shard->Table.NumEntries == 0);
+        CxPlatDispatchLockUninitialize(&Shard->Lock);
+        CxPlatHashtableUninitialize(&Shard->Table);
     }
-    CXPLAT_DBG_ASSERT(Binding->StatelessOperCount == 0);
-    CXPLAT_DBG_ASSERT(Binding->StatelessOperTable.NumEntries == 0);
 
+    if (Binding->ListenerAlpnTable != NULL) {
+        CXPLAT_DBG_ASSERT(Binding->ListenerAlpnTable->NumEntries == 0);
+        CxPlatHashtableUninitialize(Binding->ListenerAlpnTable);
+    }
     QuicLookupUninitialize(&Binding->Lookup);
-    CxPlatDispatchLockUninitialize(&Binding->StatelessOperLock);
-    CxPlatHashtableUninitialize(&Binding->StatelessOperTable);
+    QuicSourceLimiterUninitialize(&Binding->InitialLimiter);
+    CxPlatDispatchLockUninitialize(&Binding->PathMtuCacheLock);
 #if DEBUG
     QuicLibraryUntrackDbgObject(QUIC_DBG_OBJECT_TYPE_BINDING, &Binding->DbgObjectLink);
 #endif
@@ -312,6 +335,90 @@ QuicBindingGetRemoteAddress(
 #endif
 }
 
+//
+// Returns the path MTU cache entry for the remote address. Entries are only
+// keyed on the IP, as the port doesn't affect the path.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+_Requires_lock_held_(Binding->PathMtuCacheLock)
+static
+QUIC_PATH_MTU_CACHE_ENTRY*
+QuicBindingGetPathMtuCacheEntry(
+    _In_ QUIC_BINDING* Binding,
+    _In_ const QUIC_ADDR* RemoteAddress
+    )
+{
+    QUIC_ADDR Address = *RemoteAddress;
+    QuicAddrSetPort(&Address, 0);
+    return
+        &Binding->PathMtuCache[
+            QuicAddrHash(&Address) % QUIC_DPLPMTUD_PATH_CACHE_SIZE];
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicBindingGetPathMtu(
+    _In_ QUIC_BINDING* Binding,
+    _In_ const QUIC_ADDR* RemoteAddress,
+    _In_ uint64_t Lifetime,
+    _Out_ uint16_t* Mtu,
+    _Out_ BOOLEAN* IsCeiling
+    )
+{
+    BOOLEAN Found = FALSE;
+    *Mtu = 0;
+    *IsCeiling = FALSE;
+
+    CxPlatDispatchLockAcquire(&Binding->PathMtuCacheLock);
+    const QUIC_PATH_MTU_CACHE_ENTRY* Entry =
+        QuicBindingGetPathMtuCacheEntry(Binding, RemoteAddress);
+    if (Entry->Mtu != 0 &&
+        QuicAddrGetFamily(&Entry->RemoteAddress) == QuicAddrGetFamily(RemoteAddress) &&
+        QuicAddrCompareIp(&Entry->RemoteAddress, RemoteAddress) &&
+        CxPlatTimeDiff64(Entry->TimeUs, CxPlatTimeUs64()) < Lifetime) {
+        *Mtu = Entry->Mtu;
+        *IsCeiling = Entry->IsCeiling;
+        Found = TRUE;
+    }
+    CxPlatDispatchLockRelease(&Binding->PathMtuCacheLock);
+
+    return Found;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicBindingSetPathMtu(
+    _In_ QUIC_BINDING* Binding,
+    _In_ const QUIC_ADDR* RemoteAddress,
+    _In_ uint16_t Mtu,
+    _In_ BOOLEAN IsCeiling
+    )
+{
+    CxPlatDispatchLockAcquire(&Binding->PathMtuCacheLock);
+    QUIC_PATH_MTU_CACHE_ENTRY* Entry =
+        QuicBindingGetPathMtuCacheEntry(Binding, RemoteAddress);
+    BOOLEAN SameAddress =
+        Entry->Mtu != 0 &&
+        QuicAddrGetFamily(&Entry->RemoteAddress) == QuicAddrGetFamily(RemoteAddress) &&
+        QuicAddrCompareIp(&Entry->RemoteAddress, RemoteAddress);
+    if (Mtu == 0) {
+        if (SameAddress) {
+            Entry->Mtu = 0;
+        }
+    } else if (!SameAddress || Entry->Mtu != Mtu || Entry->IsCeiling != IsCeiling) {
+        //
+        // Collisions just replace the older entry. An unchanged entry keeps
+        // its original time, so that connections started from it don't keep
+        // it alive forever and the path eventually gets searched again.
+        //
+        Entry->RemoteAddress = *RemoteAddress;
+        Entry->TimeUs = CxPlatTimeUs64();
+        Entry->Mtu = Mtu;
+        Entry->IsCeiling = IsCeiling;
+    }
+    CxPlatDispatchLockRelease(&Binding->PathMtuCacheLock);
+}
+
 //
 // Returns TRUE if there are any registered listeners on this binding.
 //
@@ -324,6 +431,88 @@ QuicBindingHasListenerRegistered(
     return !CxPlatListIsEmpty(&Binding->Listeners);
 }
 
+//
+// Hash of a length prefixed ALPN, for the binding's ALPN index.
+//
+QUIC_INLINE
+uint32_t
+QuicBindingAlpnHash(
+    _In_ const uint8_t* Alpn
+    )
+{
+    return CxPlatHashSimple(Alpn[0], Alpn + 1);
+}
+
+QUIC_INLINE
+BOOLEAN
+QuicBindingAlpnEquals(
+    _In_ const uint8_t* Alpn1,
+    _In_ const uint8_t* Alpn2
+    )
+{
+    return Alpn1[0] == Alpn2[0] && memcmp(Alpn1 + 1, Alpn2 + 1, Alpn1[0]) == 0;
+}
+
+//
+// Returns TRUE if the listener accepts connections on the local address.
+//
+QUIC_INLINE
+BOOLEAN
+QuicBindingListenerMatchesAddress(
+    _In_ const QUIC_LISTENER* Listener,
+    _In_ const QUIC_ADDR* Addr
+    )
+{
+    const QUIC_ADDRESS_FAMILY ListenerFamily = QuicAddrGetFamily(&Listener->LocalAddress);
+    return
+        ListenerFamily == QUIC_ADDRESS_FAMILY_UNSPEC ||
+        (ListenerFamily == QuicAddrGetFamily(Addr) &&
+         (Listener->WildCard || QuicAddrCompareIp(Addr, &Listener->LocalAddress)));
+}
+
+//
+// Returns TRUE if the two listeners are on the same address, and so can't
+// share an ALPN.
+//
+QUIC_INLINE
+BOOLEAN
+QuicBindingListenersShareAddress(
+    _In_ const QUIC_LISTENER* Listener1,
+    _In_ const QUIC_LISTENER* Listener2
+    )
+{
+    const QUIC_ADDRESS_FAMILY Family = QuicAddrGetFamily(&Listener1->LocalAddress);
+    return
+        Family == QuicAddrGetFamily(&Listener2->LocalAddress) &&
+        Listener1->WildCard == Listener2->WildCard &&
+        (Family == QUIC_ADDRESS_FAMILY_UNSPEC ||
+         QuicAddrCompareIp(&Listener1->LocalAddress, &Listener2->LocalAddress));
+}
+
+//
+// Returns TRUE if Listener1 comes before Listener2 in the binding's list of
+// listeners. The list is sorted by family first, in decending order {AF_INET6,
+// AF_INET, AF_UNSPEC}, then specific addresses followed by wild card addresses,
+// and then by the order the listeners were registered.
+//
+QUIC_INLINE
+BOOLEAN
+QuicBindingListenerPrecedes(
+    _In_ const QUIC_LISTENER* Listener1,
+    _In_ const QUIC_LISTENER* Listener2
+    )
+{
+    const QUIC_ADDRESS_FAMILY Family1 = QuicAddrGetFamily(&Listener1->LocalAddress);
+    const QUIC_ADDRESS_FAMILY Family2 = QuicAddrGetFamily(&Listener2->LocalAddress);
+    if (Family1 != Family2) {
+        return Family1 > Family2;
+    }
+    if (Listener1->WildCard != Listener2->WildCard) {
+        return !Listener1->WildCard;
+    }
+    return Listener1->BindingSequence < Listener2->BindingSequence;
+}
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 QUIC_STATUS
 QuicBindingRegisterListener(
@@ -334,69 +523,104 @@ QuicBindingRegisterListener(
     QUIC_STATUS Status = QUIC_STATUS_SUCCESS;
     BOOLEAN MaximizeLookup = FALSE;
 
-    const QUIC_ADDR* NewAddr = &NewListener->LocalAddress;
-    const BOOLEAN NewWildCard = NewListener->WildCard;
-    const QUIC_ADDRESS_FAMILY NewFamily = QuicAddrGetFamily(NewAddr);
-
-    CxPlatDispatchRwLockAcquireExclusive(&Binding->RwLock, PrevIrql);
-
     //
-    // For a single binding, listeners are saved in a linked list, sorted by
-    // family first, in decending order {AF_INET6, AF_INET, AF_UNSPEC}, and then
-    // specific addresses followed by wild card addresses. Insertion of a new
-    // listener with a given IP/ALPN go at the end of the existing family group,
-    // only if there isn't a direct match prexisting in the list.
+    // Build the listener's entries for the binding's ALPN index, one per ALPN.
     //
+    uint16_t AlpnEntryCount = 0;
+    for (uint16_t Offset = 0;
+        Offset < NewListener->AlpnListLength;
+        Offset += 1 + NewListener->AlpnList[Offset]) {
+        AlpnEntryCount++;
+    }
+    CXPLAT_DBG_ASSERT(AlpnEntryCount != 0);
 
-    CXPLAT_LIST_ENTRY* Link;
-    for (Link = Binding->Listeners.Flink;
-        Link != &Binding->Listeners;
-        Link = Link->Flink) {
-
-        const QUIC_LISTENER* ExistingListener =
-            CXPLAT_CONTAINING_RECORD(Link, QUIC_LISTENER, Link);
-        const QUIC_ADDR* ExistingAddr = &ExistingListener->LocalAddress;
-        const BOOLEAN ExistingWildCard = ExistingListener->WildCard;
-        const QUIC_ADDRESS_FAMILY ExistingFamily = QuicAddrGetFamily(ExistingAddr);
-
-        if (NewFamily > ExistingFamily) {
-            break; // End of possible family matches. Done searching.
-        }
-
-        if (NewFamily != ExistingFamily) {
-            continue;
-        }
+    QUIC_LISTENER_ALPN_ENTRY* AlpnEntries =
+        CXPLAT_ALLOC_NONPAGED(
+            AlpnEntryCount * sizeof(QUIC_LISTENER_ALPN_ENTRY),
+            QUIC_POOL_LISTENER_ALPN);
+    if (AlpnEntries == NULL) {
+        QuicTraceEvent(
+            AllocFailure,
+            "Allocation of '%s' failed. (%llu bytes)",
+            "listener ALPN entries",
+            AlpnEntryCount * sizeof(QUIC_LISTENER_ALPN_ENTRY));
+        return QUIC_STATUS_OUT_OF_MEMORY;
+    }
 
-        if (!NewWildCard && ExistingWildCard) {
-            break; // End of specific address matches. Done searching.
-        }
+    const uint8_t* Alpn = NewListener->AlpnList;
+    for (uint16_t i = 0; i < AlpnEntryCount; ++i) {
+        AlpnEntries[i].Listener = NewListener;
+        AlpnEntries[i].Alpn = Alpn;
+        Alpn += 1 + Alpn[0];
+    }
 
-        if (NewWildCard != ExistingWildCard) {
-            continue;
-        }
+    CxPlatDispatchRwLockAcquireExclusive(&Binding->RwLock, PrevIrql);
 
-        if (NewFamily != QUIC_ADDRESS_FAMILY_UNSPEC && !QuicAddrCompareIp(NewAddr, ExistingAddr)) {
-            continue;
-        }
+    //
+    // Most bindings are only used by clients, so the index is only created
+    // once the first listener is registered.
+    //
+    if (Binding->ListenerAlpnTable == NULL &&
+        !CxPlatHashtableInitialize(&Binding->ListenerAlpnTable, CXPLAT_HASH_MIN_SIZE)) {
+        QuicTraceEvent(
+            AllocFailure,
+            "Allocation of '%s' failed. (%llu bytes)",
+            "listener ALPN table",
+            sizeof(CXPLAT_HASHTABLE));
+        Status = QUIC_STATUS_OUT_OF_MEMORY;
+    }
 
-        if (QuicListenerHasAlpnOverlap(NewListener, ExistingListener)) {
-            QuicTraceLogWarning(
-                BindingListenerAlreadyRegistered,
-                "[bind][%p] Listener (%p) already registered on ALPN",
-                Binding, ExistingListener);
-            Status = QUIC_STATUS_ALPN_IN_USE;
-            break;
+    //
+    // A listener can't share an ALPN with another listener on the same address.
+    //
+    for (uint16_t i = 0; i < AlpnEntryCount && Status == QUIC_STATUS_SUCCESS; ++i) {
+        CXPLAT_HASHTABLE_LOOKUP_CONTEXT Context;
+        CXPLAT_HASHTABLE_ENTRY* TableEntry =
+            CxPlatHashtableLookup(
+                Binding->ListenerAlpnTable,
+                QuicBindingAlpnHash(AlpnEntries[i].Alpn),
+                &Context);
+        while (TableEntry != NULL) {
+            const QUIC_LISTENER_ALPN_ENTRY* ExistingEntry =
+                CXPLAT_CONTAINING_RECORD(TableEntry, QUIC_LISTENER_ALPN_ENTRY, TableEntry);
+            if (QuicBindingAlpnEquals(ExistingEntry->Alpn, AlpnEntries[i].Alpn) &&
+                QuicBindingListenersShareAddress(NewListener, ExistingEntry->Listener)) {
+                QuicTraceLogWarning(
+                    BindingListenerAlreadyRegistered,
+                    "[bind][%p] Listener (%p) already registered on ALPN",
+                    Binding, ExistingEntry->Listener);
+                Status = QUIC_STATUS_ALPN_IN_USE;
+                break;
+            }
+            TableEntry =
+                CxPlatHashtableLookupNext(Binding->ListenerAlpnTable, &Context);
         }
     }
 
     if (Status == QUIC_STATUS_SUCCESS) {
         MaximizeLookup = CxPlatListIsEmpty(&Binding->Listeners);
+        NewListener->BindingSequence = Binding->NextListenerSequence++;
+
+        //
+        // Keep the list sorted (see QuicBindingListenerPrecedes). The new
+        // listener has the latest sequence, so it goes at the end of its
+        // family and address group.
+        //
+        CXPLAT_LIST_ENTRY* Link;
+        for (Link = Binding->Listeners.Flink;
+            Link != &Binding->Listeners;
+            Link = Link->Flink) {
+            const QUIC_LISTENER* ExistingListener =
+                CXPLAT_CONTAINING_RECORD(Link, QUIC_LISTENER, Link);
+            if (QuicBindingListenerPrecedes(NewListener, ExistingListener)) {
+                break;
+            }
+        }
 
         //
         // If we search all the way back to the head of the list, just insert
-        // the new listener at the end of the list. Otherwise, we terminated
-        // prematurely based on sort order. Insert the new listener right before
-        // the current Link.
+        // the new listener at the end of the list. Otherwise, insert the new
+        // listener right before the current Link.
         //
         if (Link == &Binding->Listeners) {
             CxPlatListInsertTail(&Binding->Listeners, &NewListener->Link);
@@ -406,10 +630,25 @@ QuicBindingRegisterListener(
             NewListener->Link.Blink->Flink = &NewListener->Link;
             Link->Blink = &NewListener->Link;
         }
+
+        for (uint16_t i = 0; i < AlpnEntryCount; ++i) {
+            CxPlatHashtableInsert(
+                Binding->ListenerAlpnTable,
+                &AlpnEntries[i].TableEntry,
+                QuicBindingAlpnHash(AlpnEntries[i].Alpn),
+                NULL);
+        }
+        NewListener->AlpnEntryCount = AlpnEntryCount;
+        NewListener->AlpnEntries = AlpnEntries;
+        AlpnEntries = NULL;
     }
 
     CxPlatDispatchRwLockReleaseExclusive(&Binding->RwLock, PrevIrql);
 
+    if (AlpnEntries != NULL) {
+        CXPLAT_FREE(AlpnEntries, QUIC_POOL_LISTENER_ALPN);
+    }
+
     if (MaximizeLookup &&
         !QuicLookupMaximizePartitioning(&Binding->Lookup)) {
         QuicBindingUnregisterListener(Binding, NewListener);
@@ -431,45 +670,68 @@ QuicBindingGetListener(
     QUIC_LISTENER* Listener = NULL;
 
     const QUIC_ADDR* Addr = Info->LocalAddress;
-    const QUIC_ADDRESS_FAMILY Family = QuicAddrGetFamily(Addr);
 
     BOOLEAN FailedAlpnMatch = FALSE;
-    BOOLEAN FailedAddrMatch = TRUE;
+    BOOLEAN FailedAddrMatch = FALSE;
 
     CxPlatDispatchRwLockAcquireShared(&Binding->RwLock, PrevIrql);
 
-    for (CXPLAT_LIST_ENTRY* Link = Binding->Listeners.Flink;
-        Link != &Binding->Listeners;
-        Link = Link->Flink) {
-
-        QUIC_LISTENER* ExistingListener =
-            CXPLAT_CONTAINING_RECORD(Link, QUIC_LISTENER, Link);
-        const QUIC_ADDR* ExistingAddr = &ExistingListener->LocalAddress;
-        const BOOLEAN ExistingWildCard = ExistingListener->WildCard;
-        const QUIC_ADDRESS_FAMILY ExistingFamily = QuicAddrGetFamily(ExistingAddr);
-        FailedAlpnMatch = FALSE;
-
-        if (ExistingFamily != QUIC_ADDRESS_FAMILY_UNSPEC) {
-            if (Family != ExistingFamily ||
-                (!ExistingWildCard && !QuicAddrCompareIp(Addr, ExistingAddr))) {
-                FailedAddrMatch = TRUE;
-                continue; // No IP match.
+    //
+    // Look up each of the client's ALPNs in the index, and keep whichever
+    // listener on the local address comes first in the list.
+    //
+    const uint8_t* ClientAlpn = Info->ClientAlpnList;
+    uint16_t ClientAlpnListLength =
+        Binding->ListenerAlpnTable == NULL ? 0 : Info->ClientAlpnListLength;
+    while (ClientAlpnListLength != 0) {
+        CXPLAT_DBG_ASSERT(ClientAlpn[0] + 1 <= ClientAlpnListLength);
+        CXPLAT_HASHTABLE_LOOKUP_CONTEXT Context;
+        CXPLAT_HASHTABLE_ENTRY* TableEntry =
+            CxPlatHashtableLookup(
+                Binding->ListenerAlpnTable,
+                QuicBindingAlpnHash(ClientAlpn),
+                &Context);
+        while (TableEntry != NULL) {
+            const QUIC_LISTENER_ALPN_ENTRY* Entry =
+                CXPLAT_CONTAINING_RECORD(TableEntry, QUIC_LISTENER_ALPN_ENTRY, TableEntry);
+            if (QuicBindingAlpnEquals(Entry->Alpn, ClientAlpn) &&
+                (Listener == NULL || QuicBindingListenerPrecedes(Entry->Listener, Listener)) &&
+                QuicBindingListenerMatchesAddress(Entry->Listener, Addr)) {
+                Listener = Entry->Listener;
             }
+            TableEntry =
+                CxPlatHashtableLookupNext(Binding->ListenerAlpnTable, &Context);
         }
-        FailedAddrMatch = FALSE;
+        ClientAlpnListLength -= ClientAlpn[0] + 1;
+        ClientAlpn += ClientAlpn[0] + 1;
+    }
 
-        if (QuicListenerMatchesAlpn(ExistingListener, Info)) {
-            if (CxPlatRefIncrementNonZero(&ExistingListener->StartRefCount, 1)) {
-                Listener = ExistingListener;
+    if (Listener != NULL) {
+        //
+        // Negotiate the listener's most preferred ALPN that the client offered,
+        // which isn't necessarily the one it was found by.
+        //
+        if (!QuicListenerMatchesAlpn(Listener, Info) ||
+            !CxPlatRefIncrementNonZero(&Listener->StartRefCount, 1)) {
+            Listener = NULL;
+        }
+    } else {
+        //
+        // Find out what didn't match, for tracing.
+        //
+        FailedAddrMatch = TRUE;
+        for (CXPLAT_LIST_ENTRY* Link = Binding->Listeners.Flink;
+            Link != &Binding->Listeners;
+            Link = Link->Flink) {
+            if (QuicBindingListenerMatchesAddress(
+                    CXPLAT_CONTAINING_RECORD(Link, QUIC_LISTENER, Link), Addr)) {
+                FailedAddrMatch = FALSE;
+                FailedAlpnMatch = TRUE;
+                break;
             }
-            goto Done;
-        } else {
-            FailedAlpnMatch = TRUE;
         }
     }
 
-Done:
-
     CxPlatDispatchRwLockReleaseShared(&Binding->RwLock, PrevIrql);
 
     if (FailedAddrMatch) {
@@ -499,7 +761,17 @@ QuicBindingUnregisterListener(
 {
     CxPlatDispatchRwLockAcquireExclusive(&Binding->RwLock, PrevIrql);
     CxPlatListEntryRemove(&Listener->Link);
+    for (uint16_t i = 0; i < Listener->AlpnEntryCount; ++i) {
+        CxPlatHashtableRemove(
+            Binding->ListenerAlpnTable,
+            &Listener->AlpnEntries[i].TableEntry,
+            NULL);
+    }
     CxPlatDispatchRwLockReleaseExclusive(&Binding->RwLock, PrevIrql);
+
+    CXPLAT_FREE(Listener->AlpnEntries, QUIC_POOL_LISTENER_ALPN);
+    Listener->AlpnEntries = NULL;
+    Listener->AlpnEntryCount = 0;
 }
 
 _IRQL_requires_max_(PASSIVE_LEVEL)
@@ -671,24 +943,27 @@ QuicBindingOnConnectionHandshakeConfirmed(
 
 //
 // This attempts to add a new stateless operation (for a given remote endpoint)
-// to the tracking structures in the binding. It first ages out any old
-// operations that might have expired. Then it adds the new operation only if
-// the remote address isn't already in the table.
+// to the tracking structures in the binding's shard for that endpoint. It first
+// ages out any old operations that might have expired. Then it adds the new
+// operation only if the remote address isn't already in the table and the
+// worker's partition hasn't exceeded its stateless operation rate.
 //
 _IRQL_requires_max_(DISPATCH_LEVEL)
 QUIC_STATELESS_CONTEXT*
 QuicBindingCreateStatelessOperation(
     _In_ QUIC_BINDING* Binding,
     _In_ QUIC_WORKER* Worker,
+    _In_ uint16_t ShardIndex,
+    _In_ uint32_t Hash,
     _In_ QUIC_RX_PACKET* Packet
     )
 {
     uint32_t TimeMs = CxPlatTimeMs32();
     const QUIC_ADDR* RemoteAddress = &Packet->Route->RemoteAddress;
-    uint32_t Hash = QuicAddrHash(RemoteAddress);
+    QUIC_STATELESS_OPER_SHARD* Shard = &Binding->StatelessOperShards[ShardIndex];
     QUIC_STATELESS_CONTEXT* StatelessCtx = NULL;
 
-    CxPlatDispatchLockAcquire(&Binding->StatelessOperLock);
+    CxPlatDispatchLockAcquire(&Shard->Lock);
 
     if (Binding->RefCount == 0) {
         goto Exit;
@@ -697,10 +972,10 @@ QuicBindingCreateStatelessOperation(
     //
     // Age out all expired operation contexts.
     //
-    while (!CxPlatListIsEmpty(&Binding->StatelessOperList)) {
+    while (!CxPlatListIsEmpty(&Shard->List)) {
         QUIC_STATELESS_CONTEXT* OldStatelessCtx =
             CXPLAT_CONTAINING_RECORD(
-                Binding->StatelessOperList.Flink,
+                Shard->List.Flink,
                 QUIC_STATELESS_CONTEXT,
                 ListEntry);
 
@@ -714,11 +989,11 @@ QuicBindingCreateStatelessOperation(
         //
         OldStatelessCtx->IsExpired = TRUE;
         CxPlatHashtableRemove(
-            &Binding->StatelessOperTable,
+            &Shard->Table,
             &OldStatelessCtx->TableEntry,
             NULL);
         CxPlatListEntryRemove(&OldStatelessCtx->ListEntry);
-        Binding->StatelessOperCount--;
+        Shard->Count--;
 
         //
         // If it's also processed, free it.
@@ -728,7 +1003,18 @@ QuicBindingCreateStatelessOperation(
         }
     }
 
-    if (Binding->StatelessOperCount >= (uint32_t)MsQuicLib.Settings.MaxBindingStatelessOperations) {
+    //
+    // The limit is for the whole binding, so each shard gets an equal part of
+    // it (but always room for at least one operation).
+    //
+    uint32_t ShardLimit =
+        (uint32_t)MsQuicLib.Settings.MaxBindingStatelessOperations /
+        Binding->StatelessOperShardCount;
+    if (ShardLimit == 0) {
+        ShardLimit = 1;
+    }
+
+    if (Shard->Count >= ShardLimit) {
         QuicPacketLogDrop(Binding, Packet, "Max binding operations reached");
         goto Exit;
     }
@@ -739,7 +1025,7 @@ QuicBindingCreateStatelessOperation(
 
     CXPLAT_HASHTABLE_LOOKUP_CONTEXT Context;
     CXPLAT_HASHTABLE_ENTRY* TableEntry =
-        CxPlatHashtableLookup(&Binding->StatelessOperTable, Hash, &Context);
+        CxPlatHashtableLookup(&Shard->Table, Hash, &Context);
 
     while (TableEntry != NULL) {
         const QUIC_STATELESS_CONTEXT* ExistingCtx =
@@ -751,7 +1037,12 @@ QuicBindingCreateStatelessOperation(
         }
 
         TableEntry =
-            CxPlatHashtableLookupNext(&Binding->StatelessOperTable, &Context);
+            CxPlatHashtableLookupNext(&Shard->Table, &Context);
+    }
+
+    if (!QuicPartitionTryConsumeStatelessOperToken(Worker->Partition, TimeMs)) {
+        QuicPacketLogDrop(Binding, Packet, "Partition stateless operation rate reached");
+        goto Exit;
     }
 
     //
@@ -769,27 +1060,28 @@ QuicBindingCreateStatelessOperation(
     StatelessCtx->Worker = Worker;
     StatelessCtx->Packet = Packet;
     StatelessCtx->CreationTimeMs = TimeMs;
+    StatelessCtx->ShardIndex = ShardIndex;
     StatelessCtx->HasBindingRef = FALSE;
     StatelessCtx->IsProcessed = FALSE;
     StatelessCtx->IsExpired = FALSE;
     CxPlatCopyMemory(&StatelessCtx->RemoteAddress, RemoteAddress, sizeof(QUIC_ADDR));
 
     CxPlatHashtableInsert(
-        &Binding->StatelessOperTable,
+        &Shard->Table,
         &StatelessCtx->TableEntry,
         Hash,
         NULL); // TODO - Context?
 
     CxPlatListInsertTail(
-        &Binding->StatelessOperList,
+        &Shard->List,
         &StatelessCtx->ListEntry
         );
 
-    Binding->StatelessOperCount++;
+    Shard->Count++;
 
 Exit:
 
-    CxPlatDispatchLockRelease(&Binding->StatelessOperLock);
+    CxPlatDispatchLockRelease(&Shard->Lock);
 
     return StatelessCtx;
 }
@@ -807,15 +1099,27 @@ QuicBindingQueueStatelessOperation(
         return FALSE;
     }
 
-    QUIC_WORKER* Worker = QuicLibraryGetWorker(Packet);
+    //
+    // The remote address picks both the tracking shard and the worker, so that
+    // all operations for a peer are tracked in one place, while the operations
+    // for different peers are spread over all the stateless workers, whichever
+    // processor received them.
+    //
+    const uint32_t Hash = QuicAddrHash(&Packet->Route->RemoteAddress);
+    const uint16_t ShardIndex =
+        (uint16_t)(((uint64_t)Hash * Binding->StatelessOperShardCount) >> 32);
+    QUIC_WORKER_POOL* WorkerPool = MsQuicLib.StatelessRegistration->WorkerPool;
+    QUIC_WORKER* Worker = &WorkerPool->Workers[ShardIndex % WorkerPool->WorkerCount];
     if (QuicWorkerIsOverloaded(Worker)) {
         QuicPacketLogDrop(Binding, Packet, "Stateless worker overloaded (stateless oper)");
+        QuicPerfCounterIncrement(Worker->Partition, QUIC_PERF_COUNTER_STATELESS_OPER_DROPPED);
         return FALSE;
     }
 
     QUIC_STATELESS_CONTEXT* Context =
-        QuicBindingCreateStatelessOperation(Binding, Worker, Packet);
+        QuicBindingCreateStatelessOperation(Binding, Worker, ShardIndex, Hash, Packet);
     if (Context == NULL) {
+        QuicPerfCounterIncrement(Worker->Partition, QUIC_PERF_COUNTER_STATELESS_OPER_DROPPED);
         return FALSE;
     }
 
@@ -827,6 +1131,7 @@ QuicBindingQueueStatelessOperation(
             "stateless operation",
             sizeof(QUIC_OPERATION));
         QuicPacketLogDrop(Binding, Packet, "Alloc failure for stateless operation");
+        QuicPerfCounterIncrement(Worker->Partition, QUIC_PERF_COUNTER_STATELESS_OPER_DROPPED);
         QuicBindingReleaseStatelessOperation(Context, FALSE);
         return FALSE;
     }
@@ -846,8 +1151,7 @@ QuicBindingProcessStatelessOperation(
 {
     QUIC_BINDING* Binding = StatelessCtx->Binding;
     QUIC_RX_PACKET* RecvPacket = StatelessCtx->Packet;
-    QUIC_PARTITION* Partition =
-        &MsQuicLib.Partitions[StatelessCtx->Packet->PartitionIndex];
+    QUIC_PARTITION* Partition = StatelessCtx->Worker->Partition;
     QUIC_BUFFER* SendDatagram = NULL;
 
     CXPLAT_DBG_ASSERT(RecvPacket->ValidatedHeaderInv);
@@ -1043,35 +1347,7 @@ QuicBindingProcessStatelessOperation(
         CxPlatCopyMemory(Token.Encrypted.OrigConnId, RecvPacket->DestCid, RecvPacket->DestCidLen);
         Token.Encrypted.OrigConnIdLength = RecvPacket->DestCidLen;
 
-        uint8_t Iv[CXPLAT_MAX_IV_LENGTH];
-        if (MsQuicLib.CidTotalLength >= CXPLAT_IV_LENGTH) {
-            CxPlatCopyMemory(Iv, NewDestCid, CXPLAT_IV_LENGTH);
-            for (uint8_t i = CXPLAT_IV_LENGTH; i < MsQuicLib.CidTotalLength; ++i) {
-                Iv[i % CXPLAT_IV_LENGTH] ^= NewDestCid[i];
-            }
-        } else {
-            CxPlatZeroMemory(Iv, CXPLAT_IV_LENGTH);
-            CxPlatCopyMemory(Iv, NewDestCid, MsQuicLib.CidTotalLength);
-        }
-
-        CxPlatDispatchLockAcquire(&Partition->StatelessRetryKeysLock);
-
-        CXPLAT_KEY* StatelessRetryKey =
-            QuicPartitionGetCurrentStatelessRetryKey(Partition);
-        if (StatelessRetryKey == NULL) {
-            CxPlatDispatchLockRelease(&Partition->StatelessRetryKeysLock);
-            goto Exit;
-        }
-
-        QUIC_STATUS Status =
-            CxPlatEncrypt(
-                StatelessRetryKey,
-                Iv,
-                sizeof(Token.Authenticated), (uint8_t*) &Token.Authenticated,
-                sizeof(Token.Encrypted) + sizeof(Token.EncryptionTag), (uint8_t*)&(Token.Encrypted));
-
-        CxPlatDispatchLockRelease(&Partition->StatelessRetryKeysLock);
-        if (QUIC_FAILED(Status)) {
+        if (!QuicRetryTokenEncrypt(Partition, NewDestCid, &Token)) {
             goto Exit;
         }
 
@@ -1114,6 +1390,7 @@ QuicBindingProcessStatelessOperation(
         SendDatagram->Length,
         1);
     SendData = NULL;
+    QuicPerfCounterIncrement(Partition, QUIC_PERF_COUNTER_STATELESS_OPER_COMPLETED);
 
 Exit:
 
@@ -1136,12 +1413,14 @@ QuicBindingReleaseStatelessOperation(
     }
     StatelessCtx->Packet = NULL;
 
-    CxPlatDispatchLockAcquire(&Binding->StatelessOperLock);
+    QUIC_STATELESS_OPER_SHARD* Shard =
+        &Binding->StatelessOperShards[StatelessCtx->ShardIndex];
+    CxPlatDispatchLockAcquire(&Shard->Lock);
 
     StatelessCtx->IsProcessed = TRUE;
     uint8_t FreeCtx = StatelessCtx->IsExpired;
 
-    CxPlatDispatchLockRelease(&Binding->StatelessOperLock);
+    CxPlatDispatchLockRelease(&Shard->Lock);
 
     if (StatelessCtx->HasBindingRef) {
         QuicLibraryReleaseBinding(Binding);
@@ -1262,37 +1541,18 @@ QuicBindingPreprocessPacket(
 _IRQL_requires_max_(DISPATCH_LEVEL)
 BOOLEAN
 QuicBindingShouldRetryConnection(
-    _In_ const QUIC_BINDING* const Binding,
-    _In_ QUIC_RX_PACKET* Packet,
-    _In_ uint16_t TokenLength,
-    _In_reads_(TokenLength)
-        const uint8_t* Token,
-    _Inout_ BOOLEAN* DropPacket
+    _In_ const QUIC_BINDING* const Binding
     )
 {
     //
-    // This is only called once we've determined we can create a new connection.
-    // If there is a token, it validates the token. If there is no token, then
-    // the function checks to see if the binding currently has too many
-    // connections in the handshake state already. If so, it requests the client
-    // to retry its connection attempt to prove source address ownership.
+    // This is only called once we've determined we can create a new connection
+    // and the client didn't provide a token (tokens are validated in batches by
+    // QuicBindingValidateRetryTokenBatch). It checks to see if the binding
+    // currently has too many connections in the handshake state already. If
+    // so, it requests the client to retry its connection attempt to prove
+    // source address ownership.
     //
-
-    if (TokenLength != 0) {
-        //
-        // Must always validate the token when provided by the client. Failure
-        // to validate retry tokens is fatal. Failure to validate NEW_TOKEN
-        // tokens is not.
-        //
-        if (QuicPacketValidateInitialToken(
-                Binding, Packet, TokenLength, Token, DropPacket)) {
-            Packet->ValidToken = TRUE;
-            return FALSE;
-        }
-        if (*DropPacket) {
-            return FALSE;
-        }
-    }
+    UNREFERENCED_PARAMETER(Binding);
 
     uint64_t CurrentMemoryLimit =
         (MsQuicLib.Settings.RetryMemoryLimit * CxPlatTotalMemory) / UINT16_MAX;
@@ -1313,6 +1573,24 @@ QuicBindingCreateConnection(
     // QuicLookupAddRemoteHash.
     //
 
+    //
+    // Limit the rate new connections can be created from a single source
+    // prefix, before any connection state is allocated for them.
+    //
+    const uint32_t InitialRateLimit = MsQuicLib.Settings.InitialRateLimit;
+    if (InitialRateLimit != 0 &&
+        !QuicSourceLimiterTryAcquire(
+            &Binding->InitialLimiter,
+            &Packet->Route->RemoteAddress,
+            InitialRateLimit,
+            CxPlatTimeMs32())) {
+        QuicPacketLogDrop(Binding, Packet, "Source prefix Initial rate limit reached");
+        QuicPerfCounterIncrement(
+            &MsQuicLib.Partitions[Packet->PartitionIndex],
+            QUIC_PERF_COUNTER_CONN_INITIAL_RATE_LIMITED);
+        return NULL;
+    }
+
     //
     // Pick a stateless worker to process the client hello and if successful,
     // the connection will later be moved to the correct registration's worker.
@@ -1465,23 +1743,91 @@ QuicBindingDropBlockedSourcePorts(
     return FALSE;
 }
 
+//
+// Validates the retry tokens of the batch together, and creates connections
+// for the packets with valid tokens.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+void
+QuicBindingValidateRetryTokenBatch(
+    _In_ QUIC_BINDING* Binding,
+    _Inout_ QUIC_RETRY_TOKEN_BATCH* Batch
+    )
+{
+    if (Batch->Count == 0) {
+        return;
+    }
+
+    //
+    // All the datagrams of a receive batch are from the same partition.
+    //
+    QUIC_TOKEN_CONTENTS Tokens[QUIC_RETRY_TOKEN_BATCH_SIZE];
+    BOOLEAN Decrypted[QUIC_RETRY_TOKEN_BATCH_SIZE];
+    QuicRetryTokenDecryptBatch(
+        &MsQuicLib.Partitions[Batch->Packets[0]->PartitionIndex],
+        Batch->Count,
+        Batch->Packets,
+        Batch->Tokens,
+        Tokens,
+        Decrypted);
+
+    for (uint32_t i = 0; i < Batch->Count; ++i) {
+        QUIC_RX_PACKET* Packets = Batch->Packets[i];
+        QUIC_CONNECTION* Connection = NULL;
+
+        if (!Decrypted[i]) {
+            QuicPacketLogDrop(Binding, Packets, "Retry Token Decryption Failure");
+        } else if (QuicPacketValidateRetryTokenContents(Binding, Packets, &Tokens[i])) {
+            Packets->ValidToken = TRUE;
+            Connection = QuicBindingCreateConnection(Binding, Packets);
+        }
+
+        if (Connection == NULL) {
+            *Batch->ReleaseChainTail = (CXPLAT_RECV_DATA*)Packets;
+            while (*Batch->ReleaseChainTail != NULL) {
+                Batch->ReleaseChainTail = &(*Batch->ReleaseChainTail)->Next;
+            }
+        } else {
+            QuicConnQueueRecvPackets(
+                Connection,
+                Packets,
+                Batch->PacketChainLengths[i],
+                Batch->PacketChainByteLengths[i]);
+            QuicConnRelease(Connection, QUIC_CONN_REF_LOOKUP_RESULT);
+        }
+    }
+
+    Batch->Count = 0;
+}
+
 //
 // Looks up or creates a connection to handle a chain of packets.
-// Returns TRUE if the packets were delivered, and FALSE if they should be
-// dropped.
+// Returns TRUE if the packets were delivered (or added to the retry token
+// batch), and FALSE if they should be dropped.
 //
 _IRQL_requires_max_(DISPATCH_LEVEL)
-_Function_class_(CXPLAT_DATAPATH_RECEIVE_CALLBACK)
 BOOLEAN
 QuicBindingDeliverPackets(
     _In_ QUIC_BINDING* Binding,
     _In_ QUIC_RX_PACKET* Packets,
     _In_ uint32_t PacketChainLength,
-    _In_ uint32_t PacketChainByteLength
+    _In_ uint32_t PacketChainByteLength,
+    _Inout_ QUIC_RETRY_TOKEN_BATCH* TokenBatch
     )
 {
     CXPLAT_DBG_ASSERT(Packets->ValidatedHeaderInv);
 
+    if (TokenBatch->Count != 0 &&
+        Packets->Invariant->IsLongHeader &&
+        !QuicPacketIsHandshake(Packets->Invariant)) {
+        //
+        // 0-RTT packets may be for a connection that is only created once its
+        // Initial's retry token is validated, so finish the batch first.
+        //
+        QuicBindingValidateRetryTokenBatch(Binding, TokenBatch);
+    }
+
     //
     // For client owned bindings (for which we always control the CID) or for
     // short header packets for server owned bindings, the packet's destination
@@ -1620,17 +1966,35 @@ QuicBindingDeliverPackets(
 
         CXPLAT_DBG_ASSERT(Binding->ServerOwned);
 
-        BOOLEAN DropPacket = FALSE;
-        if (QuicBindingShouldRetryConnection(
-                Binding, Packets, TokenLength, Token, &DropPacket)) {
+        if (TokenLength != 0) {
+            //
+            // Must always validate the token when provided by the client.
+            // Retry tokens are validated in batches, taking the partition's
+            // retry key lock once for all the Initials of a receive batch.
+            //
+            if (!QuicPacketValidateRetryTokenFormat(
+                    Binding, Packets, TokenLength, Token)) {
+                return FALSE;
+            }
+
+            const uint32_t Index = TokenBatch->Count++;
+            TokenBatch->Packets[Index] = Packets;
+            TokenBatch->PacketChainLengths[Index] = PacketChainLength;
+            TokenBatch->PacketChainByteLengths[Index] = PacketChainByteLength;
+            TokenBatch->Tokens[Index] = Token;
+            if (TokenBatch->Count == QUIC_RETRY_TOKEN_BATCH_SIZE) {
+                QuicBindingValidateRetryTokenBatch(Binding, TokenBatch);
+            }
+            return TRUE;
+        }
+
+        if (QuicBindingShouldRetryConnection(Binding)) {
             return
                 QuicBindingQueueStatelessOperation(
                     Binding, QUIC_OPER_TYPE_RETRY, Packets);
         }
 
-        if (!DropPacket) {
-            Connection = QuicBindingCreateConnection(Binding, Packets);
-        }
+        Connection = QuicBindingCreateConnection(Binding, Packets);
     }
 
     if (Connection == NULL) {
@@ -1667,6 +2031,10 @@ QuicBindingReceive(
     uint32_t SubChainBytes = 0;
     uint32_t TotalChainLength = 0;
     uint32_t TotalDatagramBytes = 0;
+    QUIC_RETRY_TOKEN_BATCH TokenBatch;
+    TokenBatch.Count = 0;
+    TokenBatch.ReleaseChain = NULL;
+    TokenBatch.ReleaseChainTail = &TokenBatch.ReleaseChain;
 
     CXPLAT_DBG_ASSERT(Socket == Binding->Socket);
 
@@ -1760,7 +2128,7 @@ QuicBindingReceive(
             QUIC_RX_PACKET* SubChainPacket = (QUIC_RX_PACKET*)SubChain;
             if ((Packet->DestCidLen != SubChainPacket->DestCidLen ||
                  memcmp(Packet->DestCid, SubChainPacket->DestCid, Packet->DestCidLen) != 0)) {
-                if (!QuicBindingDeliverPackets(Binding, (QUIC_RX_PACKET*)SubChain, SubChainLength, SubChainBytes)) {
+                if (!QuicBindingDeliverPackets(Binding, (QUIC_RX_PACKET*)SubChain, SubChainLength, SubChainBytes, &TokenBatch)) {
                     *ReleaseChainTail = SubChain;
                     ReleaseChainTail = SubChainDataTail;
                 }
@@ -1802,15 +2170,20 @@ QuicBindingReceive(
         //
         // Deliver the last subchain.
         //
-        if (!QuicBindingDeliverPackets(Binding, (QUIC_RX_PACKET*)SubChain, SubChainLength, SubChainBytes)) {
+        if (!QuicBindingDeliverPackets(Binding, (QUIC_RX_PACKET*)SubChain, SubChainLength, SubChainBytes, &TokenBatch)) {
             *ReleaseChainTail = SubChain;
             ReleaseChainTail = SubChainTail; // cppcheck-suppress unreadVariable; NOLINT
         }
     }
 
+    QuicBindingValidateRetryTokenBatch(Binding, &TokenBatch);
+
     if (ReleaseChain != NULL) {
         CxPlatRecvDataReturn(ReleaseChain);
     }
+    if (TokenBatch.ReleaseChain != NULL) {
+        CxPlatRecvDataReturn(TokenBatch.ReleaseChain);
+    }
 
     QuicPerfCounterAdd(Partition, QUIC_PERF_COUNTER_UDP_RECV, TotalChainLength);
     QuicPerfCounterAdd(Partition, QUIC_PERF_COUNTER_UDP_RECV_BYTES, TotalDatagramBytes);
@@ -5,6 +5,10 @@
 
 --*/
 
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
 typedef struct QUIC_PARTITIONED_HASHTABLE QUIC_PARTITIONED_HASHTABLE;
 typedef struct QUIC_STATELESS_CONTEXT QUIC_STATELESS_CONTEXT;
 
@@ -65,6 +69,12 @@ typedef struct QUIC_RX_PACKET {
         const struct QUIC_SHORT_HEADER_V1* SH;
     };
 
+    //
+    // Where the tail of the payload, starting at DecryptRedirectOffset, was
+    // decrypted to if it was written straight into a stream's receive buffer.
+    //
+    uint8_t* DecryptRedirectBuffer;
+
     //
     // Destination connection ID.
     //
@@ -90,6 +100,11 @@ typedef struct QUIC_RX_PACKET {
     //
     uint16_t PayloadLength;
 
+    //
+    // Payload offset of the data in DecryptRedirectBuffer.
+    //
+    uint16_t DecryptRedirectOffset;
+
     //
     // Lengths of the destination and source connection IDs
     //
@@ -171,6 +186,49 @@ typedef struct QUIC_RX_PACKET {
 
 } QUIC_RX_PACKET;
 
+//
+// A path MTU previously discovered to a remote address.
+//
+typedef struct QUIC_PATH_MTU_CACHE_ENTRY {
+
+    //
+    // The remote address the MTU applies to. Only the IP is significant.
+    //
+    QUIC_ADDR RemoteAddress;
+
+    //
+    // The time (in us) the entry was last updated.
+    //
+    uint64_t TimeUs;
+
+    //
+    // The discovered MTU. Zero if the entry is unused.
+    //
+    uint16_t Mtu;
+
+    //
+    // Indicates a larger probe failed, so the MTU is the maximum for the
+    // path and not just the maximum allowed by the connection that found it.
+    //
+    BOOLEAN IsCeiling;
+
+} QUIC_PATH_MTU_CACHE_ENTRY;
+
+//
+// One shard of a binding's stateless operation tracking structures. Remote
+// addresses are assigned to shards (and so to stateless workers) by hash, so
+// that a flood of stateless operations is spread over all the workers instead
+// of contending on a single lock.
+//
+typedef struct QUIC_STATELESS_OPER_SHARD {
+
+    CXPLAT_DISPATCH_LOCK Lock;
+    CXPLAT_HASHTABLE Table;
+    CXPLAT_LIST_ENTRY List;
+    uint32_t Count;
+
+} QUIC_STATELESS_OPER_SHARD;
+
 typedef enum QUIC_BINDING_LOOKUP_TYPE {
 
     QUIC_BINDING_LOOKUP_SINGLE,         // Single connection
@@ -255,19 +313,42 @@ typedef struct QUIC_BINDING {
     //
     CXPLAT_LIST_ENTRY Listeners;
 
+    //
+    // Index of the registered listeners by ALPN (QUIC_LISTENER_ALPN_ENTRY), so
+    // that the listeners for a new connection can be found without walking the
+    // whole list. Created when the first listener is registered.
+    //
+    CXPLAT_HASHTABLE* ListenerAlpnTable;
+
+    //
+    // The BindingSequence for the next listener registered.
+    //
+    uint64_t NextListenerSequence;
+
     //
     // Lookup tables for connection IDs.
     //
     QUIC_LOOKUP Lookup;
 
     //
-    // Stateless operation tracking structures.
+    // Stateless operation tracking structures, one shard per partition. The
+    // shards are allocated along with the binding.
+    //
+    uint16_t StatelessOperShardCount;
+    _Field_size_(StatelessOperShardCount)
+    QUIC_STATELESS_OPER_SHARD* StatelessOperShards;
+
+    //
+    // Rate limits new connections per source address prefix.
     //
-    CXPLAT_DISPATCH_LOCK StatelessOperLock;
-    CXPLAT_HASHTABLE StatelessOperTable;
-    CXPLAT_LIST_ENTRY StatelessOperList;
-    CXPLAT_POOL StatelessOperCtxPool;
-    uint32_t StatelessOperCount;
+    QUIC_SOURCE_LIMITER InitialLimiter;
+
+    //
+    // Path MTUs discovered by connections on this binding, so that new
+    // connections to the same remote address can start probing there.
+    //
+    CXPLAT_DISPATCH_LOCK PathMtuCacheLock;
+    QUIC_PATH_MTU_CACHE_ENTRY PathMtuCache[QUIC_DPLPMTUD_PATH_CACHE_SIZE];
 
     struct {
 
@@ -342,8 +423,36 @@ QuicBindingGetRemoteAddress(
     );
 
 //
-// Looks up the listener based on the ALPN list. Optionally, outputs the
-// first ALPN that matches.
+// Looks up the path MTU previously discovered to the remote address. Returns
+// FALSE if there is no entry, or it is older than Lifetime (in us).
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicBindingGetPathMtu(
+    _In_ QUIC_BINDING* Binding,
+    _In_ const QUIC_ADDR* RemoteAddress,
+    _In_ uint64_t Lifetime,
+    _Out_ uint16_t* Mtu,
+    _Out_ BOOLEAN* IsCeiling
+    );
+
+//
+// Records the path MTU discovered to the remote address. An Mtu of zero
+// removes any existing entry.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicBindingSetPathMtu(
+    _In_ QUIC_BINDING* Binding,
+    _In_ const QUIC_ADDR* RemoteAddress,
+    _In_ uint16_t Mtu,
+    _In_ BOOLEAN IsCeiling
+    );
+
+//
+// Looks up the listener based on the local address and ALPN list, and outputs
+// the ALPN to negotiate with it. If several listeners match, the first one in
+// the binding's list wins.
 //
 _IRQL_requires_max_(PASSIVE_LEVEL)
 _Success_(return != NULL)
@@ -504,46 +613,97 @@ QuicBindingHandleDosModeStateChange(
     );
 
 //
-// Decrypts the retry token.
+// Computes the IV for a retry token from the CID the server picked for the
+// connection (the destination CID of the client's retried Initial).
+//
+QUIC_INLINE
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicRetryTokenComputeIv(
+    _In_reads_(MsQuicLib.CidTotalLength)
+        const uint8_t* Cid,
+    _Out_writes_(CXPLAT_IV_LENGTH)
+        uint8_t* Iv
+    )
+{
+    if (MsQuicLib.CidTotalLength >= CXPLAT_IV_LENGTH) {
+        CxPlatCopyMemory(Iv, Cid, CXPLAT_IV_LENGTH);
+        for (uint8_t i = CXPLAT_IV_LENGTH; i < MsQuicLib.CidTotalLength; ++i) {
+            Iv[i % CXPLAT_IV_LENGTH] ^= Cid[i];
+        }
+    } else {
+        CxPlatZeroMemory(Iv, CXPLAT_IV_LENGTH);
+        CxPlatCopyMemory(Iv, Cid, MsQuicLib.CidTotalLength);
+    }
+}
+
+//
+// Encrypts a retry token with the partition's current retry key. The IV is
+// computed from the new CID picked for the connection.
 //
 QUIC_INLINE
 _IRQL_requires_max_(DISPATCH_LEVEL)
 BOOLEAN
-QuicRetryTokenDecrypt(
-    _In_ const QUIC_RX_PACKET* const Packet,
+QuicRetryTokenEncrypt(
+    _In_ QUIC_PARTITION* Partition,
+    _In_reads_(MsQuicLib.CidTotalLength)
+        const uint8_t* NewDestCid,
+    _Inout_ QUIC_TOKEN_CONTENTS* Token
+    )
+{
+    uint8_t Iv[CXPLAT_MAX_IV_LENGTH];
+    QuicRetryTokenComputeIv(NewDestCid, Iv);
+
+    CxPlatDispatchLockAcquire(&Partition->StatelessRetryKeysLock);
+
+    CXPLAT_KEY* StatelessRetryKey =
+        QuicPartitionGetCurrentStatelessRetryKey(Partition);
+    if (StatelessRetryKey == NULL) {
+        CxPlatDispatchLockRelease(&Partition->StatelessRetryKeysLock);
+        return FALSE;
+    }
+
+    QUIC_STATUS Status =
+        CxPlatEncrypt(
+            StatelessRetryKey,
+            Iv,
+            sizeof(Token->Authenticated),
+            (uint8_t*) &Token->Authenticated,
+            sizeof(Token->Encrypted) + sizeof(Token->EncryptionTag),
+            (uint8_t*)&Token->Encrypted);
+
+    CxPlatDispatchLockRelease(&Partition->StatelessRetryKeysLock);
+    return QUIC_SUCCEEDED(Status);
+}
+
+//
+// Decrypts a retry token. The caller holds the partition's retry key lock.
+//
+QUIC_INLINE
+_IRQL_requires_max_(DISPATCH_LEVEL)
+_Requires_lock_held_(Partition->StatelessRetryKeysLock)
+BOOLEAN
+QuicRetryTokenDecryptLocked(
+    _In_ QUIC_PARTITION* Partition,
+    _In_reads_(MsQuicLib.CidTotalLength)
+        const uint8_t* DestCid,
     _In_reads_(sizeof(QUIC_TOKEN_CONTENTS))
         const uint8_t* TokenBuffer,
     _Out_ QUIC_TOKEN_CONTENTS* Token
     )
 {
-#ifdef __cplusplus
-    QUIC_PARTITION* Partition = &MsQuicLib.Partitions[Packet->_.PartitionIndex];
-#else
-    QUIC_PARTITION* Partition = &MsQuicLib.Partitions[Packet->PartitionIndex];
-#endif
     //
     // Copy the token locally so as to not effect the original packet buffer,
     //
     CxPlatCopyMemory(Token, TokenBuffer, sizeof(QUIC_TOKEN_CONTENTS));
 
     uint8_t Iv[CXPLAT_MAX_IV_LENGTH];
-    if (MsQuicLib.CidTotalLength >= CXPLAT_IV_LENGTH) {
-        CxPlatCopyMemory(Iv, Packet->DestCid, CXPLAT_IV_LENGTH);
-        for (uint8_t i = CXPLAT_IV_LENGTH; i < MsQuicLib.CidTotalLength; ++i) {
-            Iv[i % CXPLAT_IV_LENGTH] ^= Packet->DestCid[i];
-        }
-    } else {
-        CxPlatZeroMemory(Iv, CXPLAT_IV_LENGTH);
-        CxPlatCopyMemory(Iv, Packet->DestCid, MsQuicLib.CidTotalLength);
-    }
-
-    CxPlatDispatchLockAcquire(&Partition->StatelessRetryKeysLock);
+    QuicRetryTokenComputeIv(DestCid, Iv);
 
     CXPLAT_KEY* StatelessRetryKey =
         QuicPartitionGetStatelessRetryKeyForTimestamp(
             Partition, (int64_t)Token->Authenticated.Timestamp);
     if (StatelessRetryKey == NULL) {
-        CxPlatDispatchLockRelease(&Partition->StatelessRetryKeysLock);
         return FALSE;
     }
 
@@ -556,10 +716,84 @@ QuicRetryTokenDecrypt(
             sizeof(Token->Encrypted) + sizeof(Token->EncryptionTag),
             (uint8_t*)&Token->Encrypted);
 
-    CxPlatDispatchLockRelease(&Partition->StatelessRetryKeysLock);
     return QUIC_SUCCEEDED(Status);
 }
 
+//
+// Decrypts the retry token.
+//
+QUIC_INLINE
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicRetryTokenDecrypt(
+    _In_ const QUIC_RX_PACKET* const Packet,
+    _In_reads_(sizeof(QUIC_TOKEN_CONTENTS))
+        const uint8_t* TokenBuffer,
+    _Out_ QUIC_TOKEN_CONTENTS* Token
+    )
+{
+#ifdef __cplusplus
+    QUIC_PARTITION* Partition = &MsQuicLib.Partitions[Packet->_.PartitionIndex];
+#else
+    QUIC_PARTITION* Partition = &MsQuicLib.Partitions[Packet->PartitionIndex];
+#endif
+
+    CxPlatDispatchLockAcquire(&Partition->StatelessRetryKeysLock);
+    BOOLEAN Result =
+        QuicRetryTokenDecryptLocked(
+            Partition, Packet->DestCid, TokenBuffer, Token);
+    CxPlatDispatchLockRelease(&Partition->StatelessRetryKeysLock);
+
+    return Result;
+}
+
+//
+// Decrypts the retry tokens of a batch of packets received on the partition.
+// The retry key lock is only taken once for the batch, and all the tokens are
+// decrypted with the partition's cached keys.
+//
+QUIC_INLINE
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicRetryTokenDecryptBatch(
+    _In_ QUIC_PARTITION* Partition,
+    _In_range_(1, QUIC_RETRY_TOKEN_BATCH_SIZE) uint32_t Count,
+    _In_reads_(Count) QUIC_RX_PACKET* const* Packets,
+    _In_reads_(Count) const uint8_t* const* TokenBuffers,
+    _Out_writes_(Count) QUIC_TOKEN_CONTENTS* Tokens,
+    _Out_writes_(Count) BOOLEAN* Decrypted
+    )
+{
+    CxPlatDispatchLockAcquire(&Partition->StatelessRetryKeysLock);
+    for (uint32_t i = 0; i < Count; ++i) {
+        Decrypted[i] =
+            QuicRetryTokenDecryptLocked(
+                Partition, Packets[i]->DestCid, TokenBuffers[i], &Tokens[i]);
+    }
+    CxPlatDispatchLockRelease(&Partition->StatelessRetryKeysLock);
+}
+
+//
+// Initial packets, from one receive batch, whose retry tokens are still to be
+// validated. Each entry is the subchain of packets that would create a new
+// connection.
+//
+typedef struct QUIC_RETRY_TOKEN_BATCH {
+
+    uint32_t Count;
+    QUIC_RX_PACKET* Packets[QUIC_RETRY_TOKEN_BATCH_SIZE];
+    uint32_t PacketChainLengths[QUIC_RETRY_TOKEN_BATCH_SIZE];
+    uint32_t PacketChainByteLengths[QUIC_RETRY_TOKEN_BATCH_SIZE];
+    const uint8_t* Tokens[QUIC_RETRY_TOKEN_BATCH_SIZE];
+
+    //
+    // Subchains dropped after validation, to be returned to the datapath.
+    //
+    CXPLAT_RECV_DATA* ReleaseChain;
+    CXPLAT_RECV_DATA** ReleaseChainTail;
+
+} QUIC_RETRY_TOKEN_BATCH;
+
 //
 // Helper to get the owning QUIC_BINDING for the lookup module.
 //
@@ -572,3 +806,7 @@ QuicLookupGetBinding(
 {
     return CXPLAT_CONTAINING_RECORD(Lookup, QUIC_BINDING, Lookup);
 }
+
+#if defined(__cplusplus)
+}
+#endif
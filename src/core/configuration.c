@@ -327,6 +327,8 @@ MsQuicConfigurationLoadCredentialComplete(
     if (QUIC_SUCCEEDED(Status)) {
         CXPLAT_DBG_ASSERT(SecurityConfig);
         Configuration->SecurityConfig = SecurityConfig;
+        Configuration->IndicateCertificateReceived =
+            !!(CredConfig->Flags & QUIC_CREDENTIAL_FLAG_INDICATE_CERTIFICATE_RECEIVED);
     } else {
         CXPLAT_DBG_ASSERT(SecurityConfig == NULL);
     }
@@ -368,6 +370,10 @@ MsQuicConfigurationLoadCredential(
             Configuration->Settings.ServerResumptionLevel == QUIC_SERVER_NO_RESUME) {
             TlsCredFlags |= CXPLAT_TLS_CREDENTIAL_FLAG_DISABLE_RESUMPTION;
         }
+        if (!(CredConfig->Flags & QUIC_CREDENTIAL_FLAG_CLIENT) &&
+            Configuration->Settings.KeySharePoolEnabled) {
+            TlsCredFlags |= CXPLAT_TLS_CREDENTIAL_FLAG_KEY_SHARE_POOL;
+        }
 
         QuicConfigurationAddRef(Configuration, QUIC_CONF_REF_LOAD_CRED);
 
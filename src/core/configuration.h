@@ -66,6 +66,12 @@ typedef struct QUIC_CONFIGURATION {
     //
     CXPLAT_SEC_CONFIG* SecurityConfig;
 
+    //
+    // Indicates the credential has QUIC_CREDENTIAL_FLAG_INDICATE_CERTIFICATE_RECEIVED
+    // set, so TLS indicates the peer certificate while it processes data.
+    //
+    BOOLEAN IndicateCertificateReceived;
+
 #ifdef QUIC_COMPARTMENT_ID
     //
     // The network compartment ID.
@@ -17,6 +17,96 @@ Abstract:
 #include "congestion_control.c.clog.h"
 #endif
 
+//
+// Creates an algorithm's state in the connection's congestion control.
+// Returns FALSE if the algorithm isn't available.
+//
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+(QUIC_CONGESTION_CONTROL_PROVIDER_INITIALIZE_FN)(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_SETTINGS_INTERNAL* Settings
+    );
+
+static QUIC_CONGESTION_CONTROL_PROVIDER_INITIALIZE_FN QuicCongestionControlProviderCubic;
+static QUIC_CONGESTION_CONTROL_PROVIDER_INITIALIZE_FN QuicCongestionControlProviderBbr;
+static QUIC_CONGESTION_CONTROL_PROVIDER_INITIALIZE_FN QuicCongestionControlProviderPrague;
+static QUIC_CONGESTION_CONTROL_PROVIDER_INITIALIZE_FN QuicCongestionControlProviderCustom;
+
+//
+// The provider for each QUIC_CONGESTION_CONTROL_ALGORITHM. The built-in
+// algorithms and the application supplied one are all selected through this
+// table.
+//
+static QUIC_CONGESTION_CONTROL_PROVIDER_INITIALIZE_FN* const
+QuicCongestionControlProviders[] = {
+    QuicCongestionControlProviderCubic,     // QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC
+    QuicCongestionControlProviderBbr,       // QUIC_CONGESTION_CONTROL_ALGORITHM_BBR
+    QuicCongestionControlProviderBbr,       // QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3
+    QuicCongestionControlProviderPrague,    // QUIC_CONGESTION_CONTROL_ALGORITHM_PRAGUE
+    QuicCongestionControlProviderCustom,    // QUIC_CONGESTION_CONTROL_ALGORITHM_CUSTOM
+};
+
+CXPLAT_STATIC_ASSERT(
+    ARRAYSIZE(QuicCongestionControlProviders) == QUIC_CONGESTION_CONTROL_ALGORITHM_MAX,
+    "Every congestion control algorithm needs a provider");
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+BOOLEAN
+QuicCongestionControlProviderCubic(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_SETTINGS_INTERNAL* Settings
+    )
+{
+    CubicCongestionControlInitialize(Cc, Settings);
+    return TRUE;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+BOOLEAN
+QuicCongestionControlProviderBbr(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_SETTINGS_INTERNAL* Settings
+    )
+{
+    BbrCongestionControlInitialize(Cc, Settings);
+    return TRUE;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+BOOLEAN
+QuicCongestionControlProviderPrague(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_SETTINGS_INTERNAL* Settings
+    )
+{
+    PragueCongestionControlInitialize(Cc, Settings);
+    return TRUE;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+BOOLEAN
+QuicCongestionControlProviderCustom(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_SETTINGS_INTERNAL* Settings
+    )
+{
+    UNREFERENCED_PARAMETER(Settings);
+    if (CustomCongestionControlInitialize(Cc, &MsQuicLib.CongestionControlProvider)) {
+        return TRUE;
+    }
+    QuicTraceLogConnWarning(
+        CustomCongestionControlUnavailable,
+        QuicCongestionControlGetConnection(Cc),
+        "Custom congestion control unavailable, fallback to Cubic");
+    return FALSE;
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 void
 QuicCongestionControlInitialize(
@@ -26,19 +116,19 @@ QuicCongestionControlInitialize(
 {
     CXPLAT_DBG_ASSERT(Settings->CongestionControlAlgorithm < QUIC_CONGESTION_CONTROL_ALGORITHM_MAX);
 
-    switch (Settings->CongestionControlAlgorithm) {
-    default:
+    QuicCongestionControlUninitialize(Cc);
+
+    uint16_t Algorithm = Settings->CongestionControlAlgorithm;
+    if (Algorithm >= QUIC_CONGESTION_CONTROL_ALGORITHM_MAX) {
         QuicTraceLogConnWarning(
             InvalidCongestionControlAlgorithm,
             QuicCongestionControlGetConnection(Cc),
             "Unknown congestion control algorithm: %hu, fallback to Cubic",
             Settings->CongestionControlAlgorithm);
-        __fallthrough;
-    case QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC:
-        CubicCongestionControlInitialize(Cc, Settings);
-        break;
-    case QUIC_CONGESTION_CONTROL_ALGORITHM_BBR:
-        BbrCongestionControlInitialize(Cc, Settings);
-        break;
+        Algorithm = QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC;
+    }
+
+    if (!QuicCongestionControlProviders[Algorithm](Cc, Settings)) {
+        QuicCongestionControlProviderCubic(Cc, Settings);
     }
 }
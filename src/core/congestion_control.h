@@ -7,6 +7,12 @@
 
 #include "bbr.h"
 #include "cubic.h"
+#include "prague.h"
+#include "custom_cc.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
 
 typedef struct QUIC_ACK_EVENT {
 
@@ -73,6 +79,11 @@ typedef struct QUIC_ECN_EVENT {
 
     uint64_t LargestSentPacketNumber;
 
+    //
+    // Number of packets newly reported as ECN-CE marked by the peer.
+    //
+    uint32_t CePacketCount;
+
 } QUIC_ECN_EVENT;
 
 typedef struct QUIC_CONGESTION_CONTROL {
@@ -82,6 +93,12 @@ typedef struct QUIC_CONGESTION_CONTROL {
     //
     const char* Name;
 
+    //
+    // TRUE if the algorithm reacts to CE marks in proportion to their extent
+    // (L4S) and so sends its packets with ECT(1) rather than ECT(0).
+    //
+    BOOLEAN UseEct1;
+
     BOOLEAN (*QuicCongestionControlCanSend)(
         _In_ struct QUIC_CONGESTION_CONTROL* Cc
         );
@@ -161,12 +178,21 @@ typedef struct QUIC_CONGESTION_CONTROL {
         _Out_ struct QUIC_NETWORK_STATISTICS* NetworkStatistics
         );
 
+    //
+    // Optional. Releases any resources held by the algorithm.
+    //
+    void (*QuicCongestionControlUninitialize)(
+        _In_ struct QUIC_CONGESTION_CONTROL* Cc
+        );
+
     //
     // Algorithm specific state.
     //
     union {
         QUIC_CONGESTION_CONTROL_CUBIC Cubic;
         QUIC_CONGESTION_CONTROL_BBR Bbr;
+        QUIC_CONGESTION_CONTROL_PRAGUE Prague;
+        QUIC_CONGESTION_CONTROL_CUSTOM Custom;
     };
 
 } QUIC_CONGESTION_CONTROL;
@@ -217,6 +243,22 @@ QuicCongestionControlInitialize(
     _In_ const QUIC_SETTINGS_INTERNAL* Settings
     );
 
+//
+// Releases any resources held by the algorithm.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_INLINE
+void
+QuicCongestionControlUninitialize(
+    _In_ QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    if (Cc->QuicCongestionControlUninitialize) {
+        Cc->QuicCongestionControlUninitialize(Cc);
+        Cc->QuicCongestionControlUninitialize = NULL;
+    }
+}
+
 //
 // Returns TRUE if more bytes can be sent on the network.
 //
@@ -412,3 +454,7 @@ QuicCongestionControlSetAppLimited(
 {
     Cc->QuicCongestionControlSetAppLimited(Cc);
 }
+
+#if defined(__cplusplus)
+}
+#endif
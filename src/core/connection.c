@@ -83,6 +83,7 @@ QuicConnAlloc(
 
     CxPlatZeroMemory(Connection, sizeof(QUIC_CONNECTION));
     Connection->Partition = Partition;
+    Connection->Paths = &Connection->InitialPath;
 
 #if DEBUG
     InterlockedIncrement(&MsQuicLib.ConnectionCount);
@@ -325,6 +326,7 @@ QuicConnFree(
     CXPLAT_TEL_ASSERT(CxPlatListIsEmpty(&Connection->Streams.ClosedStreams));
     QuicRangeUninitialize(&Connection->DecodedAckRanges);
     QuicCryptoUninitialize(&Connection->Crypto);
+    QuicCongestionControlUninitialize(&Connection->CongestionControl);
     QuicLossDetectionUninitialize(&Connection->LossDetection);
     QuicSendUninitialize(&Connection->Send);
     for (uint32_t i = 0; i < ARRAYSIZE(Connection->Packets); i++) {
@@ -370,6 +372,10 @@ QuicConnFree(
             Connection->Paths[i].Binding = NULL;
         }
     }
+    if (Connection->Paths != &Connection->InitialPath) {
+        CXPLAT_FREE(Connection->Paths, QUIC_POOL_PATHS);
+        Connection->Paths = &Connection->InitialPath;
+    }
     CxPlatDispatchLockUninitialize(&Connection->ReceiveQueueLock);
     QuicOperationQueueUninitialize(&Connection->OperQ);
     QuicStreamSetUninitialize(&Connection->Streams);
@@ -497,6 +503,7 @@ QuicConnUnregister(
     )
 {
     if (Connection->State.Registered) {
+        QuicSendBufferReleaseBudget(Connection);
         CxPlatDispatchLockAcquire(&Connection->Registration->ConnectionLock);
         CxPlatListEntryRemove(&Connection->RegistrationLink);
         CxPlatDispatchLockRelease(&Connection->Registration->ConnectionLock);
@@ -791,6 +798,24 @@ QuicConnQueueHighestPriorityOper(
     }
 }
 
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicConnResumeHeldOperations(
+    _In_ QUIC_CONNECTION* Connection,
+    _In_ QUIC_OPERATION* Oper
+    )
+{
+    //
+    // The held queue is still marked as actively processing, so enqueuing
+    // never indicates the connection needs to be queued. Always queue it.
+    //
+    (void)QuicOperationEnqueueFront(
+        &Connection->OperQ,
+        Connection->Partition,
+        Oper);
+    QuicWorkerQueuePriorityConnection(Connection->Worker, Connection);
+}
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 void
 QuicConnUpdateRtt(
@@ -1320,7 +1345,9 @@ QuicConnTimerSetEx(
     uint64_t NewEarliestExpirationTime  = QuicGetEarliestExpirationTime(Connection);
     if (NewEarliestExpirationTime != Connection->EarliestExpirationTime) {
         Connection->EarliestExpirationTime = NewEarliestExpirationTime;
-        QuicTimerWheelUpdateConnection(&Connection->Worker->TimerWheel, Connection);
+        if (!Connection->Crypto.TlsOffloadPending) { // Out of the timer wheel until complete
+            QuicTimerWheelUpdateConnection(&Connection->Worker->TimerWheel, Connection);
+        }
     }
 }
 
@@ -1353,7 +1380,9 @@ QuicConnTimerCancel(
             // We've either found a new earliest expiration time, or there will be no timers scheduled.
             //
             Connection->EarliestExpirationTime = NewEarliestExpirationTime;
-            QuicTimerWheelUpdateConnection(&Connection->Worker->TimerWheel, Connection);
+            if (!Connection->Crypto.TlsOffloadPending) { // Out of the timer wheel until complete
+                QuicTimerWheelUpdateConnection(&Connection->Worker->TimerWheel, Connection);
+            }
         }
     } else {
         Connection->ExpirationTimes[Type] = UINT64_MAX;
@@ -2176,6 +2205,126 @@ QuicConnRestart(
     }
 }
 
+//
+// Caches the full resumption ticket in the partition's shard of the session
+// cache and writes the ticket that references it to CacheTicket.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+static
+QUIC_STATUS
+QuicConnCacheResumptionTicket(
+    _In_ QUIC_CONNECTION* Connection,
+    _In_ uint32_t TicketLength,
+    _In_reads_bytes_(TicketLength)
+        const uint8_t* Ticket,
+    _Out_writes_bytes_(1 + QUIC_SESSION_CACHE_ID_LENGTH)
+        uint8_t* CacheTicket
+    )
+{
+    //
+    // The cache ticket is the (single byte) ticket type, followed by the
+    // session ID. The ID starts with the index of the partition caching it,
+    // and the rest is random.
+    //
+    uint8_t* Id = CacheTicket + 1;
+    CacheTicket[0] = QUIC_SESSION_CACHE_TICKET_TYPE;
+    CxPlatRandom(QUIC_SESSION_CACHE_ID_LENGTH, Id);
+    CxPlatCopyMemory(Id, &Connection->Partition->Index, sizeof(uint16_t));
+
+    return
+        QuicSessionCacheInsert(
+            &Connection->Partition->SessionCache,
+            Id,
+            TicketLength,
+            Ticket,
+            CxPlatTimeUs64());
+}
+
+//
+// Removes the session referenced by a cache ticket from the session cache.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+static
+QUIC_SESSION_CACHE_ENTRY*
+QuicConnRemoveCachedSession(
+    _In_ QUIC_CONNECTION* Connection,
+    _In_ uint16_t TicketLength,
+    _In_reads_(TicketLength)
+        const uint8_t* Ticket
+    )
+{
+    QUIC_SESSION_CACHE_ENTRY* Entry = NULL;
+    uint16_t PartitionIndex;
+
+    if (TicketLength != 1 + QUIC_SESSION_CACHE_ID_LENGTH ||
+        Ticket[0] != QUIC_SESSION_CACHE_TICKET_TYPE) {
+        QuicTraceEvent(
+            ConnError,
+            "[conn][%p] ERROR, %s.",
+            Connection,
+            "Resumption Ticket doesn't reference the session cache");
+        goto Exit;
+    }
+
+    CxPlatCopyMemory(&PartitionIndex, Ticket + 1, sizeof(PartitionIndex));
+    if (PartitionIndex < MsQuicLib.PartitionCount) {
+        Entry =
+            QuicSessionCacheRemove(
+                &MsQuicLib.Partitions[PartitionIndex].SessionCache,
+                Ticket + 1,
+                CxPlatTimeUs64());
+    }
+    if (Entry == NULL) {
+        QuicTraceEvent(
+            ConnError,
+            "[conn][%p] ERROR, %s.",
+            Connection,
+            "Resumption Ticket not found in session cache");
+    }
+
+Exit:
+
+    QuicPerfCounterIncrement(
+        Connection->Partition,
+        Entry != NULL ?
+            QUIC_PERF_COUNTER_SESSION_CACHE_HIT :
+            QUIC_PERF_COUNTER_SESSION_CACHE_MISS);
+
+    return Entry;
+}
+
+//
+// Checks the connection's ClientHello against the 0-RTT replay filter, adding
+// it if it isn't there yet. Returns TRUE if it (probably) was already there.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+static
+BOOLEAN
+QuicConnIsClientHelloReplay(
+    _In_ QUIC_CONNECTION* Connection
+    )
+{
+    if (Connection->Crypto.ReplayFilterChecked) {
+        //
+        // A ClientHello following a HelloRetryRequest keeps the same random,
+        // so it would look like a replay of the first one.
+        //
+        return FALSE;
+    }
+    Connection->Crypto.ReplayFilterChecked = TRUE;
+
+    const uint64_t* Hash = Connection->Crypto.ClientHelloHash;
+    QUIC_PARTITION* Partition =
+        &MsQuicLib.Partitions[(Hash[0] >> 32) % MsQuicLib.PartitionCount];
+    return
+        QuicReplayFilterTestAndSet(
+            &Partition->ReplayFilter,
+            Hash,
+            MsQuicLib.Settings.ReplayFilterSize,
+            MS_TO_US((uint64_t)MsQuicLib.Settings.ReplayFilterWindowMs),
+            CxPlatTimeUs64());
+}
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 QUIC_STATUS
 QuicConnSendResumptionTicket(
@@ -2211,7 +2360,21 @@ QuicConnSendResumptionTicket(
         goto Error;
     }
 
-    Status = QuicCryptoProcessAppData(&Connection->Crypto, TicketLength, TicketBuffer);
+    if (Connection->Settings.ServerSessionCacheEnabled) {
+        uint8_t CacheTicket[1 + QUIC_SESSION_CACHE_ID_LENGTH];
+        Status =
+            QuicConnCacheResumptionTicket(
+                Connection,
+                TicketLength,
+                TicketBuffer,
+                CacheTicket);
+        if (QUIC_FAILED(Status)) {
+            goto Error;
+        }
+        Status = QuicCryptoProcessAppData(&Connection->Crypto, sizeof(CacheTicket), CacheTicket);
+    } else {
+        Status = QuicCryptoProcessAppData(&Connection->Crypto, TicketLength, TicketBuffer);
+    }
 
 Error:
     if (TicketBuffer != NULL) {
@@ -2234,7 +2397,28 @@ QuicConnRecvResumptionTicket(
         const uint8_t* Ticket
     )
 {
+    if (Connection->Crypto.TlsOffloadPending) {
+        //
+        // Called on the crypto pool. The ticket is validated (server) or
+        // indicated to the app (client) on the worker. Until then, the server
+        // accepts resumption, like it does while the app validates the ticket
+        // asynchronously.
+        //
+        if (QuicConnIsServer(Connection) &&
+            Connection->Crypto.TicketValidationRejecting) {
+            Connection->Crypto.TlsOffloadTicketRejected = TRUE;
+            return FALSE;
+        }
+        return
+            QuicCryptoDeferTlsCallback(
+                &Connection->Crypto,
+                QUIC_TLS_OFFLOAD_CALLBACK_TICKET,
+                TicketLength,
+                Ticket);
+    }
+
     BOOLEAN ResumptionAccepted = FALSE;
+    QUIC_SESSION_CACHE_ENTRY* CachedSession = NULL;
     QUIC_TRANSPORT_PARAMETERS ResumedTP = {0};
     CxPlatZeroMemory(&ResumedTP, sizeof(ResumedTP));
     if (QuicConnIsServer(Connection)) {
@@ -2250,6 +2434,21 @@ QuicConnRecvResumptionTicket(
         }
         Connection->Crypto.TicketValidationPending = TRUE;
 
+        if (Connection->Settings.ServerSessionCacheEnabled) {
+            //
+            // Only tickets referencing the session cache are accepted, so
+            // that every ticket can only be used once.
+            //
+            CachedSession =
+                QuicConnRemoveCachedSession(Connection, TicketLength, Ticket);
+            if (CachedSession == NULL) {
+                Connection->Crypto.TicketValidationPending = FALSE;
+                goto Error;
+            }
+            Ticket = CachedSession->Ticket;
+            TicketLength = (uint16_t)CachedSession->TicketLength;
+        }
+
         const uint8_t* AppData = NULL;
         uint32_t AppDataLength = 0;
 
@@ -2290,6 +2489,22 @@ QuicConnRecvResumptionTicket(
             goto Error;
         }
 
+        if (Connection->Settings.ReplayFilterEnabled &&
+            Connection->Settings.ServerResumptionLevel == QUIC_SERVER_RESUME_AND_ZERORTT &&
+            QuicConnIsClientHelloReplay(Connection)) {
+            //
+            // Fall back to a full handshake, which also rejects any 0-RTT data
+            // that came with this ClientHello.
+            //
+            QuicTraceEvent(
+                ConnError,
+                "[conn][%p] ERROR, %s.",
+                Connection,
+                "Resumption rejected by 0-RTT replay filter");
+            Connection->Crypto.TicketValidationPending = FALSE;
+            goto Error;
+        }
+
         QUIC_CONNECTION_EVENT Event;
         Event.Type = QUIC_CONNECTION_EVENT_RESUMED;
         Event.RESUMED.ResumptionStateLength = (uint16_t)AppDataLength;
@@ -2356,6 +2571,9 @@ QuicConnRecvResumptionTicket(
 
 Error:
 
+    if (CachedSession != NULL) {
+        QuicSessionCacheEntryFree(CachedSession);
+    }
     QuicCryptoTlsCleanupTransportParameters(&ResumedTP);
     return ResumptionAccepted;
 }
@@ -2461,6 +2679,9 @@ QuicConnGenerateLocalTransportParameters(
     if (Connection->Settings.DatagramReceiveEnabled) {
         LocalTP->Flags |= QUIC_TP_FLAG_MAX_DATAGRAM_FRAME_SIZE;
         LocalTP->MaxDatagramFrameSize = QUIC_DEFAULT_MAX_DATAGRAM_LENGTH;
+        if (Connection->Settings.DatagramFecEnabled) {
+            LocalTP->Flags |= QUIC_TP_FLAG_DATAGRAM_FEC;
+        }
     }
 
     if (Connection->State.Disable1RttEncrytion) {
@@ -3289,6 +3510,13 @@ QuicConnPeerCertReceived(
     _In_ QUIC_STATUS DeferredStatus
     )
 {
+    //
+    // The certificate is only valid for the duration of this callback, so it
+    // can't be deferred to the worker. Connections that indicate it never
+    // offload TLS to the crypto pool.
+    //
+    CXPLAT_DBG_ASSERT(!Connection->Crypto.TlsOffloadPending);
+
     QUIC_CONNECTION_EVENT Event;
     Connection->Crypto.CertValidationPending = TRUE;
     Event.Type = QUIC_CONNECTION_EVENT_PEER_CERTIFICATE_RECEIVED;
@@ -4272,6 +4500,62 @@ QuicConnRecvPrepareDecrypt(
     return TRUE;
 }
 
+//
+// Called partway through decrypting a packet, with just the start of the
+// payload decrypted, to check if the packet is a single in-order STREAM frame
+// whose data can be decrypted directly into the stream's app-owned receive
+// buffer. Nothing has been authenticated yet, so this only picks where the
+// data goes; the frame is still fully validated when it is processed.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+_Function_class_(CXPLAT_DECRYPT_REDIRECT_CALLBACK)
+uint8_t*
+QuicConnRecvDecryptRedirect(
+    _In_ void* Context,
+    _In_ uint16_t PlainTextLength,
+    _In_ uint16_t PeekLength,
+    _In_reads_bytes_(PeekLength)
+        const uint8_t* PlainText,
+    _Out_ uint16_t* RedirectOffset
+    )
+{
+    QUIC_CONNECTION* Connection = (QUIC_CONNECTION*)Context;
+    *RedirectOffset = 0;
+
+    //
+    // STREAM frame types are always encoded in a single byte, and the largest
+    // possible STREAM frame header fits in the peeked bytes.
+    //
+    const QUIC_FRAME_TYPE FrameType = PlainText[0];
+    if (FrameType < QUIC_FRAME_STREAM || FrameType > QUIC_FRAME_STREAM_7) {
+        return NULL;
+    }
+
+    uint16_t Offset = sizeof(uint8_t);
+    QUIC_STREAM_EX Frame;
+    if (!QuicStreamFrameDecode(FrameType, PlainTextLength, PlainText, &Offset, &Frame) ||
+        Offset > PeekLength ||
+        Frame.Length == 0 ||
+        Offset + Frame.Length != PlainTextLength) {
+        return NULL;
+    }
+
+    QUIC_STREAM* Stream = QuicStreamSetLookupStream(&Connection->Streams, Frame.StreamID);
+    if (Stream == NULL) {
+        return NULL;
+    }
+
+    uint8_t* Destination =
+        QuicRecvBufferGetInOrderWriteBuffer(
+            &Stream->RecvBuffer,
+            Frame.Offset,
+            (uint16_t)Frame.Length);
+    if (Destination != NULL) {
+        *RedirectOffset = Offset;
+    }
+    return Destination;
+}
+
 //
 // Decrypts the packet's payload and authenticates the whole packet. On
 // successful authentication of the packet, does some final processing of the
@@ -4317,19 +4601,43 @@ QuicConnRecvDecryptAndAuthenticate(
     //
     // Decrypt the payload with the appropriate key.
     //
+    Packet->DecryptRedirectBuffer = NULL;
     if (Packet->Encrypted) {
         QuicTraceEvent(
             PacketDecrypt,
             "[pack][%llu] Decrypting",
             Packet->PacketId);
-        if (QUIC_FAILED(
-            CxPlatDecrypt(
-                Connection->Crypto.TlsState.ReadKeys[Packet->KeyType]->PacketKey,
-                Iv,
-                Packet->HeaderLength,   // HeaderLength
-                Packet->AvailBuffer,    // Header
-                Packet->PayloadLength,  // BufferLength
-                (uint8_t*)Payload))) {  // Buffer
+        QUIC_STATUS Status;
+        if (Connection->Settings.DecryptToAppBuffersEnabled &&
+            QuicKeyTypeToEncryptLevel(Packet->KeyType) == QUIC_ENCRYPT_LEVEL_1_RTT) {
+            //
+            // Stream data may be decrypted directly into an app-owned receive
+            // buffer, instead of in place and then copied out.
+            //
+            Status =
+                CxPlatDecryptRedirect(
+                    Connection->Crypto.TlsState.ReadKeys[Packet->KeyType]->PacketKey,
+                    Iv,
+                    Packet->HeaderLength,
+                    Packet->AvailBuffer,
+                    Packet->PayloadLength,
+                    (uint8_t*)Payload,
+                    QuicConnRecvDecryptRedirect,
+                    Connection,
+                    &Packet->DecryptRedirectOffset,
+                    &Packet->DecryptRedirectBuffer);
+        } else {
+            Status =
+                CxPlatDecrypt(
+                    Connection->Crypto.TlsState.ReadKeys[Packet->KeyType]->PacketKey,
+                    Iv,
+                    Packet->HeaderLength,   // HeaderLength
+                    Packet->AvailBuffer,    // Header
+                    Packet->PayloadLength,  // BufferLength
+                    (uint8_t*)Payload);     // Buffer
+        }
+        if (QUIC_FAILED(Status)) {
+            Packet->DecryptRedirectBuffer = NULL;
 
             //
             // Check for a stateless reset packet.
@@ -5398,6 +5706,37 @@ QuicConnRecvFrames(
             break;
         }
 
+        case QUIC_FRAME_DATAGRAM_FEC_SOURCE:
+        case QUIC_FRAME_DATAGRAM_FEC_REPAIR: {
+            if (!Connection->Settings.DatagramReceiveEnabled ||
+                !Connection->Settings.DatagramFecEnabled) {
+                QuicTraceEvent(
+                    ConnError,
+                    "[conn][%p] ERROR, %s.",
+                    Connection,
+                    "Received DATAGRAM_FEC frame when not negotiated");
+                QuicConnTransportError(Connection, QUIC_ERROR_PROTOCOL_VIOLATION);
+                return FALSE;
+            }
+            if (!QuicDatagramProcessFecFrame(
+                    &Connection->Datagram,
+                    Packet,
+                    FrameType,
+                    PayloadLength,
+                    Payload,
+                    &Offset)) {
+                QuicTraceEvent(
+                    ConnError,
+                    "[conn][%p] ERROR, %s.",
+                    Connection,
+                    "Decoding DATAGRAM_FEC frame");
+                QuicConnTransportError(Connection, QUIC_ERROR_FRAME_ENCODING_ERROR);
+                return FALSE;
+            }
+            AckEliciting = TRUE;
+            break;
+        }
+
         case QUIC_FRAME_ACK_FREQUENCY: { // Always accept the frame, because we always enable support.
             QUIC_ACK_FREQUENCY_EX Frame;
             if (!QuicAckFrequencyFrameDecode(PayloadLength, Payload, &Offset, &Frame)) {
@@ -5754,6 +6093,11 @@ QuicConnRecvDatagramBatch(
             }
         }
     }
+
+    //
+    // Indicate the batch's datagrams while the packets are still valid.
+    //
+    QuicDatagramRecvFlush(&Connection->Datagram);
 }
 
 _IRQL_requires_max_(PASSIVE_LEVEL)
@@ -6380,6 +6724,98 @@ QuicConnUpdatePeerPacketTolerance(
     }
 }
 
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicConnTunePeerAckFrequency(
+    _In_ QUIC_CONNECTION* Connection,
+    _In_ BOOLEAN CongestionEvent
+    )
+{
+    if (!Connection->Settings.AdaptiveAckFrequencyEnabled ||
+        !(Connection->PeerTransportParams.Flags & QUIC_TP_FLAG_MIN_ACK_DELAY)) {
+        return;
+    }
+
+    uint8_t NewPacketTolerance = QUIC_MIN_ACK_SEND_NUMBER;
+    uint32_t NewMaxAckDelayMs = 0;
+
+    if (CongestionEvent) {
+        //
+        // Go back to the default (frequent) acknowledgments for the duration
+        // of the recovery period, so that further loss is detected and the
+        // congestion window regrows as quickly as possible.
+        //
+        Connection->AckFreqRecoveryPacketNumber =
+            Connection->LossDetection.LargestSentPacketNumber;
+
+    } else {
+        if (Connection->LossDetection.LargestAck <=
+                Connection->AckFreqRecoveryPacketNumber) {
+            return; // Still in recovery.
+        }
+
+        const QUIC_PATH* Path = &Connection->Paths[0];
+        const uint32_t CwndPackets =
+            QuicCongestionControlGetCongestionWindow(&Connection->CongestionControl) /
+            QuicPathGetDatagramPayloadSize(Path);
+
+        //
+        // Ask for a few ACKs per congestion window. The tolerance is rounded
+        // down to a power of two so that small fluctuations of the congestion
+        // window don't result in a stream of ACK_FREQUENCY frames.
+        //
+        uint32_t Tolerance = CwndPackets / QUIC_ADAPTIVE_ACKS_PER_CWND;
+        if (Tolerance > QUIC_ADAPTIVE_MAX_ACK_SEND_NUMBER) {
+            Tolerance = QUIC_ADAPTIVE_MAX_ACK_SEND_NUMBER;
+        }
+        while (Tolerance & (Tolerance - 1)) {
+            Tolerance &= Tolerance - 1;
+        }
+        if (Tolerance <= QUIC_MIN_ACK_SEND_NUMBER) {
+            return; // Don't bother until the window is large enough.
+        }
+        NewPacketTolerance = (uint8_t)Tolerance;
+
+        //
+        // Allow the peer to delay its ACKs by a similar fraction of the RTT, so
+        // that the ACK delay timer isn't what ends up clocking the ACKs. Like
+        // the tolerance, it's rounded down to a power of two so that RTT jitter
+        // doesn't result in a stream of ACK_FREQUENCY frames either.
+        //
+        NewMaxAckDelayMs =
+            (uint32_t)US_TO_MS(Path->SmoothedRtt / QUIC_ADAPTIVE_ACKS_PER_CWND);
+        if (NewMaxAckDelayMs > QUIC_ADAPTIVE_MAX_ACK_DELAY_MS) {
+            NewMaxAckDelayMs = QUIC_ADAPTIVE_MAX_ACK_DELAY_MS;
+        }
+        while (NewMaxAckDelayMs & (NewMaxAckDelayMs - 1)) {
+            NewMaxAckDelayMs &= NewMaxAckDelayMs - 1;
+        }
+        if (MS_TO_US(NewMaxAckDelayMs) < Connection->PeerTransportParams.MinAckDelay) {
+            NewMaxAckDelayMs =
+                (uint32_t)US_TO_MS(Connection->PeerTransportParams.MinAckDelay + 999);
+        }
+        if (NewMaxAckDelayMs <= QuicConnGetAckDelay(Connection)) {
+            NewMaxAckDelayMs = 0; // Just use the default.
+        }
+    }
+
+    if (Connection->PeerPacketTolerance != NewPacketTolerance ||
+        Connection->PeerMaxAckDelayMs != NewMaxAckDelayMs) {
+        QuicTraceLogConnInfo(
+            UpdatePeerAckFrequency,
+            Connection,
+            "Updating peer ACK frequency to %hhu packets, %u ms",
+            NewPacketTolerance,
+            NewMaxAckDelayMs);
+        Connection->SendAckFreqSeqNum++;
+        Connection->PeerPacketTolerance = NewPacketTolerance;
+        Connection->PeerMaxAckDelayMs = NewMaxAckDelayMs;
+        QuicSendSetSendFlag(
+            &Connection->Send,
+            QUIC_CONN_SEND_FLAG_ACK_FREQUENCY);
+    }
+}
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 QUIC_STATUS
 QuicConnOpenNewPath(
@@ -6546,6 +6982,9 @@ QuicConnAddLocalAddress(
         Path = &Connection->Paths[0];
         Connection->State.LocalAddressSet = TRUE;
     } else {
+        if (!QuicConnGrowPaths(Connection)) {
+            return QUIC_STATUS_OUT_OF_MEMORY;
+        }
         if (Connection->PathsCount > 1) {
             //
             // Make room for the new path (at index 1).
@@ -7505,6 +7944,24 @@ QuicConnGetV2Statistics(
     if (STATISTICS_HAS_FIELD(*StatsLength, RttVariance)) {
         Stats->RttVariance = (uint32_t)Path->RttVariance;
     }
+    if (STATISTICS_HAS_FIELD(*StatsLength, RecvWindowBudgetLimitedCount)) {
+        Stats->RecvWindowBytes = Connection->Send.MaxDataWindow;
+        Stats->RecvWindowGrowCount = Connection->Stats.Recv.WindowGrowCount;
+        Stats->RecvWindowShrinkCount = Connection->Stats.Recv.WindowShrinkCount;
+        Stats->RecvWindowBudgetLimitedCount = Connection->Stats.Recv.WindowBudgetLimitedCount;
+    }
+    if (STATISTICS_HAS_FIELD(*StatsLength, SendPacketReorderThreshold)) {
+        Stats->SendSpuriousLostBytes = Connection->Stats.Send.SpuriousLostBytes;
+        Stats->SendSpuriousCongestionCount = Connection->Stats.Send.SpuriousCongestionCount;
+        Stats->SendPacketReorderThreshold = Connection->LossDetection.PacketReorderThreshold;
+    }
+    if (STATISTICS_HAS_FIELD(*StatsLength, RecvDatagramFecRecoveredCount)) {
+        Stats->SendDatagramFecRepairCount = Connection->Stats.Send.DatagramFecRepairCount;
+        Stats->RecvDatagramFecRecoveredCount = Connection->Stats.Recv.DatagramFecRecoveredCount;
+    }
+    if (STATISTICS_HAS_FIELD(*StatsLength, SendDatagramExpiredCount)) {
+        Stats->SendDatagramExpiredCount = Connection->Stats.Send.DatagramExpiredCount;
+    }
 
     *StatsLength = CXPLAT_MIN(*StatsLength, sizeof(QUIC_STATISTICS_V2));
 
@@ -8395,6 +8852,20 @@ QuicConnDrainOperations(
     while (!Connection->State.UpdateWorker &&
            OperationCount++ < MaxOperationCount) {
 
+        if (Connection->Crypto.TlsOffloadQueued &&
+            QuicCryptoPrepareTlsOffload(&Connection->Crypto)) {
+            //
+            // The previous operation queued TLS data for the crypto pool. The
+            // operation queue is held until the TLS processing completes, so
+            // stop here and let the worker hand the data off to the pool. The
+            // worker must not process the connection's timers in the meantime
+            // either, so take it out of the timer wheel until then.
+            //
+            QuicTimerWheelRemoveConnection(&Connection->Worker->TimerWheel, Connection);
+            HasMoreWorkToDo = FALSE;
+            break;
+        }
+
         Oper = QuicOperationDequeue(&Connection->OperQ, Connection->Partition);
         if (Oper == NULL) {
             HasMoreWorkToDo = FALSE;
@@ -8482,6 +8953,11 @@ QuicConnDrainOperations(
                 Connection, Oper->ROUTE.PhysicalAddress, Oper->ROUTE.PathId, Oper->ROUTE.Succeeded);
             break;
 
+        case QUIC_OPER_TYPE_TLS_COMPLETE:
+            QuicCryptoTlsOffloadComplete(&Connection->Crypto);
+            QuicTimerWheelUpdateConnection(&Connection->Worker->TimerWheel, Connection);
+            break;
+
         default:
             CXPLAT_FRE_ASSERT(FALSE);
             break;
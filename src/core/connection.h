@@ -236,6 +236,7 @@ typedef enum QUIC_CONNECTION_REF {
     QUIC_CONN_REF_TIMER_WHEEL,          // The timer wheel is tracking the connection.
     QUIC_CONN_REF_ROUTE,                // Route resolution is undergoing.
     QUIC_CONN_REF_STREAM,               // A stream depends on the connection.
+    QUIC_CONN_REF_TLS_OFFLOAD,          // TLS processing is running on the crypto pool.
 
     QUIC_CONN_REF_COUNT
 
@@ -254,6 +255,7 @@ typedef struct QUIC_CONN_STATS {
     uint32_t ResumptionSucceeded    : 1;
     uint32_t GreaseBitNegotiated    : 1;
     uint32_t EncryptionOffloaded    : 1;
+    uint32_t AmplificationStalled   : 1;    // Handshake data was held back by amplification protection.
 
     //
     // QUIC protocol version used. Network byte order.
@@ -288,6 +290,7 @@ typedef struct QUIC_CONN_STATS {
         uint64_t RetransmittablePackets;
         uint64_t SuspectedLostPackets;
         uint64_t SpuriousLostPackets;   // Actual lost is (SuspectedLostPackets - SpuriousLostPackets)
+        uint64_t SpuriousLostBytes;
 
         uint64_t TotalBytes;            // Sum of UDP payloads
         uint64_t TotalStreamBytes;      // Sum of stream payloads
@@ -295,6 +298,9 @@ typedef struct QUIC_CONN_STATS {
         uint32_t CongestionCount;
         uint32_t EcnCongestionCount;
         uint32_t PersistentCongestionCount;
+        uint32_t SpuriousCongestionCount;
+        uint32_t DatagramFecRepairCount;
+        uint32_t DatagramExpiredCount;
     } Send;
 
     struct {
@@ -308,6 +314,11 @@ typedef struct QUIC_CONN_STATS {
 
         uint64_t TotalBytes;            // Sum of UDP payloads
         uint64_t TotalStreamBytes;      // Sum of stream payloads
+
+        uint32_t WindowGrowCount;       // Receive windows grown by auto-tuning.
+        uint32_t WindowShrinkCount;     // Idle stream receive windows shrunk.
+        uint32_t WindowBudgetLimitedCount; // Window increases denied by the memory budget.
+        uint32_t DatagramFecRecoveredCount; // Lost datagrams recovered with FEC.
     } Recv;
 
     struct {
@@ -505,6 +516,20 @@ typedef struct QUIC_CONNECTION {
     //
     uint64_t NextRecvAckFreqSeqNum;
 
+    //
+    // The largest packet number sent when the peer's ACK frequency was last
+    // reduced because of congestion. Only used when adaptive ACK frequency is
+    // enabled; the peer's ACK frequency isn't relaxed again until a packet
+    // sent after this is acknowledged.
+    //
+    uint64_t AckFreqRecoveryPacketNumber;
+
+    //
+    // The max ACK delay (in ms) we want the peer to use, as sent in the
+    // ACK_FREQUENCY frame. Zero indicates our own ACK delay is used instead.
+    //
+    uint32_t PeerMaxAckDelayMs;
+
     //
     // The sequence number to use for the next source CID.
     //
@@ -521,7 +546,12 @@ typedef struct QUIC_CONNECTION {
     // rest (if any) are other tracked paths, sorted from most to least recently
     // used.
     //
-    QUIC_PATH Paths[QUIC_MAX_PATH_COUNT];
+    // Most connections only ever have one path, so this starts out pointing at
+    // InitialPath and is only moved to an allocated array of QUIC_MAX_PATH_COUNT
+    // paths when a second path is added (see QuicConnGrowPaths).
+    //
+    QUIC_PATH* Paths;
+    QUIC_PATH InitialPath;
 
     //
     // The list of connection IDs used for receiving.
@@ -1227,6 +1257,17 @@ QuicConnQueueHighestPriorityOper(
     _In_ QUIC_OPERATION* Oper
     );
 
+//
+// Queues an operation at the front of the connection's held operation queue
+// (see QuicOperationQueueHold) and queues the connection to resume processing.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicConnResumeHeldOperations(
+    _In_ QUIC_CONNECTION* Connection,
+    _In_ QUIC_OPERATION* Oper
+    );
+
 typedef enum QUIC_CONN_START_FLAGS {
     QUIC_CONN_START_FLAG_NONE =              0x00000000U,
     QUIC_CONN_START_FLAG_FAIL_SILENTLY =     0x00000001U // Don't send notification to API client
@@ -1463,6 +1504,22 @@ QuicConnGetAckDelay(
     return (uint64_t)Connection->Settings.MaxAckDelayMs;
 }
 
+//
+// Returns the max ACK delay (in ms) we want the peer to use.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+QUIC_INLINE
+uint64_t
+QuicConnGetPeerMaxAckDelay(
+    _In_ const QUIC_CONNECTION* Connection
+    )
+{
+    if (Connection->PeerMaxAckDelayMs != 0) {
+        return (uint64_t)Connection->PeerMaxAckDelayMs;
+    }
+    return QuicConnGetAckDelay(Connection);
+}
+
 //
 // Called when the QUIC version is set.
 //
@@ -1669,6 +1726,18 @@ QuicConnUpdatePeerPacketTolerance(
     _In_ uint8_t NewPacketTolerance
     );
 
+//
+// Adjusts the ACK frequency we want the peer to use, based on the current
+// congestion window and RTT. Called on acknowledgment and congestion events
+// when adaptive ACK frequency is enabled.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicConnTunePeerAckFrequency(
+    _In_ QUIC_CONNECTION* Connection,
+    _In_ BOOLEAN CongestionEvent
+    );
+
 //
 // Open a new path for the connection.
 //
@@ -1771,6 +1840,11 @@ QuicMtuDiscoveryCheckSearchCompleteTimeout(
         if (CxPlatTimeDiff64(
                 Path->MtuDiscovery.SearchCompleteEnterTimeUs,
                 TimeNow) >= TimeoutTime) {
+            //
+            // The path may have changed since, so earlier failed probes no
+            // longer bound the search.
+            //
+            Path->MtuDiscovery.SearchUpperBound = Path->MtuDiscovery.MaxMtu;
             QuicMtuDiscoveryMoveToSearching(&Path->MtuDiscovery, Connection);
         }
     }
@@ -235,6 +235,12 @@ QuicCryptoUninitialize(
         QuicPacketKeyFree(Crypto->TlsState.WriteKeys[i]);
         Crypto->TlsState.WriteKeys[i] = NULL;
     }
+    CXPLAT_DBG_ASSERT(!Crypto->TlsOffloadPending);
+    while (Crypto->TlsOffloadCallbacks != NULL) {
+        QUIC_TLS_OFFLOAD_CALLBACK* Callback = Crypto->TlsOffloadCallbacks;
+        Crypto->TlsOffloadCallbacks = Callback->Next;
+        CXPLAT_FREE(Callback, QUIC_POOL_TLS_OFFLOAD_CALLBACK);
+    }
     if (Crypto->TLS != NULL) {
         CxPlatTlsUninitialize(Crypto->TLS);
         Crypto->TLS = NULL;
@@ -1378,6 +1384,18 @@ QuicConnReceiveTP(
 {
     CXPLAT_DBG_ASSERT(QuicConnIsClient(Connection));
 
+    if (Connection->Crypto.TlsOffloadPending) {
+        //
+        // Called on the crypto pool. Decode and apply them on the worker.
+        //
+        return
+            QuicCryptoDeferTlsCallback(
+                &Connection->Crypto,
+                QUIC_TLS_OFFLOAD_CALLBACK_TP,
+                TPLength,
+                TPBuffer);
+    }
+
     if (!QuicCryptoTlsDecodeTransportParameters(
             Connection,
             TRUE,
@@ -1686,6 +1704,9 @@ QuicCryptoProcessTlsCompletion(
         if (Crypto->TlsState.SessionResumed) {
             QuicPerfCounterIncrement(Connection->Partition, QUIC_PERF_COUNTER_CONN_RESUMED);
         }
+        if (QuicConnIsServer(Connection) && !Connection->Stats.AmplificationStalled) {
+            QuicPerfCounterIncrement(Connection->Partition, QUIC_PERF_COUNTER_CONN_HANDSHAKE_NO_AMP_STALL);
+        }
         Connection->Stats.ResumptionSucceeded = Crypto->TlsState.SessionResumed;
 
         CXPLAT_DBG_ASSERT(Connection->PathsCount >= 1);
@@ -1863,6 +1884,15 @@ QuicCryptoProcessData(
         return Status;
     }
 
+    if (Crypto->TlsOffloadQueued || Crypto->TlsOffloadPending) {
+        //
+        // TLS processing is (about to be) offloaded to the crypto pool. Any
+        // new data is picked up once it completes.
+        //
+        Crypto->TlsOffloadClientInitial |= IsClientInitial;
+        return Status;
+    }
+
     if (IsClientInitial) {
         Buffer.Length = 0;
         Buffer.Buffer = NULL;
@@ -1915,6 +1945,12 @@ QuicCryptoProcessData(
                 goto Error;
             }
 
+            QuicCryptoTlsHashClientRandom(
+                Buffer.Buffer,
+                Buffer.Length,
+                MsQuicLib.ReplayFilterKey,
+                Crypto->ClientHelloHash);
+
             Status =
                 QuicConnProcessPeerTransportParameters(Connection, FALSE);
             if (QUIC_FAILED(Status)) {
@@ -1965,6 +2001,18 @@ QuicCryptoProcessData(
 
     QuicCryptoValidate(Crypto);
 
+    if (QuicCryptoGetConnection(Crypto)->Settings.TlsOffloadEnabled &&
+        !QuicCryptoGetConnection(Crypto)->Configuration->IndicateCertificateReceived) {
+        //
+        // Hand the data to the crypto pool once the current operation
+        // completes (see QuicCryptoPrepareTlsOffload). The data is read again
+        // then, so release the read for now.
+        //
+        Crypto->TlsOffloadQueued = TRUE;
+        Crypto->TlsOffloadClientInitial = IsClientInitial;
+        goto Error;
+    }
+
     Crypto->ResultFlags =
         CxPlatTlsProcessData(
             Crypto->TLS,
@@ -1985,6 +2033,256 @@ Error:
     return Status;
 }
 
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicCryptoPrepareTlsOffload(
+    _In_ QUIC_CRYPTO* Crypto
+    )
+{
+    QUIC_CONNECTION* Connection = QuicCryptoGetConnection(Crypto);
+    const BOOLEAN IsClientInitial = Crypto->TlsOffloadClientInitial;
+    QUIC_BUFFER Buffer;
+
+    CXPLAT_DBG_ASSERT(Crypto->TlsOffloadQueued);
+    CXPLAT_DBG_ASSERT(!Crypto->TlsOffloadPending);
+    Crypto->TlsOffloadQueued = FALSE;
+    Crypto->TlsOffloadClientInitial = FALSE;
+
+    if (Crypto->TLS == NULL || QuicConnIsClosed(Connection)) {
+        return FALSE;
+    }
+
+    if (IsClientInitial) {
+        Buffer.Length = 0;
+        Buffer.Buffer = NULL;
+
+    } else {
+        uint64_t BufferOffset;
+        uint32_t BufferCount = 1;
+        QuicRecvBufferRead(
+            &Crypto->RecvBuffer,
+            &BufferOffset,
+            &BufferCount,
+            &Buffer);
+
+        CXPLAT_DBG_ASSERT(BufferCount == 1);
+
+        Buffer.Length =
+            QuicCryptoTlsGetCompleteTlsMessagesLength(
+                Buffer.Buffer, Buffer.Length);
+        if (Buffer.Length == 0) {
+            QuicRecvBufferDrain(&Crypto->RecvBuffer, 0);
+            return FALSE;
+        }
+    }
+
+    QUIC_OPERATION* Oper =
+        QuicConnAllocOperation(Connection, QUIC_OPER_TYPE_TLS_COMPLETE);
+    if (Oper == NULL || !QuicCryptoPoolStart(&MsQuicLib.CryptoPool)) {
+        if (Oper == NULL) {
+            QuicTraceEvent(
+                AllocFailure,
+                "Allocation of '%s' failed. (%llu bytes)",
+                "TLS offload operation",
+                0);
+        } else {
+            QuicOperationFree(Oper);
+        }
+
+        //
+        // Fall back to processing the data inline.
+        //
+        Crypto->ResultFlags =
+            CxPlatTlsProcessData(
+                Crypto->TLS,
+                CXPLAT_TLS_CRYPTO_DATA,
+                Buffer.Buffer,
+                &Buffer.Length,
+                &Crypto->TlsState);
+
+        QuicCryptoProcessDataComplete(Crypto, Buffer.Length);
+        return FALSE;
+    }
+
+    QuicTraceLogConnVerbose(
+        TlsOffloadStart,
+        Connection,
+        "Offloading %u bytes of TLS data",
+        Buffer.Length);
+
+    Crypto->TlsOffloadPending = TRUE;
+    Crypto->TlsOffloadBuffer = Buffer.Buffer;
+    Crypto->TlsOffloadBufferLength = Buffer.Length;
+    Crypto->TlsOffloadOper = Oper;
+    QuicConnAddRef(Connection, QUIC_CONN_REF_TLS_OFFLOAD);
+    QuicOperationQueueHold(&Connection->OperQ);
+
+    return TRUE;
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicCryptoProcessTlsOffload(
+    _In_ QUIC_CRYPTO* Crypto
+    )
+{
+    QUIC_CONNECTION* Connection = QuicCryptoGetConnection(Crypto);
+    QUIC_OPERATION* Oper = Crypto->TlsOffloadOper;
+    Crypto->TlsOffloadOper = NULL;
+
+    CXPLAT_DBG_ASSERT(Crypto->TlsOffloadPending);
+    CXPLAT_DBG_ASSERT(Oper != NULL);
+
+    //
+    // The connection's operations are held while TLS runs here, but this is
+    // still not the connection's worker. Only the TLS computation happens on
+    // this thread; the TLS callbacks just save their data (see
+    // QuicCryptoDeferTlsCallback), and everything that changes connection
+    // state or indicates events to the app happens in
+    // QuicCryptoTlsOffloadComplete, back on the worker.
+    //
+    QuicConfigurationAttachSilo(Connection->Configuration);
+
+    Crypto->ResultFlags =
+        CxPlatTlsProcessData(
+            Crypto->TLS,
+            CXPLAT_TLS_CRYPTO_DATA,
+            Crypto->TlsOffloadBuffer,
+            &Crypto->TlsOffloadBufferLength,
+            &Crypto->TlsState);
+
+    QuicConfigurationDetachSilo();
+
+    QuicConnResumeHeldOperations(Connection, Oper);
+    QuicConnRelease(Connection, QUIC_CONN_REF_TLS_OFFLOAD);
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicCryptoTlsOffloadComplete(
+    _In_ QUIC_CRYPTO* Crypto
+    )
+{
+    QUIC_CONNECTION* Connection = QuicCryptoGetConnection(Crypto);
+    BOOLEAN RejectTicket = FALSE;
+
+    CXPLAT_DBG_ASSERT(Crypto->TlsOffloadPending);
+    Crypto->TlsOffloadPending = FALSE;
+    Crypto->TlsOffloadBuffer = NULL;
+
+    QuicTraceLogConnVerbose(
+        TlsOffloadComplete,
+        Connection,
+        "TLS offload complete, %u bytes consumed",
+        Crypto->TlsOffloadBufferLength);
+
+    if (Crypto->TlsOffloadTicketRejected) {
+        //
+        // TLS went through the asynchronously rejected ClientHello again and
+        // fell back to a full handshake.
+        //
+        Crypto->TlsOffloadTicketRejected = FALSE;
+        Crypto->TicketValidationRejecting = FALSE;
+        Crypto->TicketValidationPending = FALSE;
+    }
+
+    //
+    // Now that this is back on the worker, run the TLS callbacks that were
+    // made on the crypto pool, in order.
+    //
+    while (Crypto->TlsOffloadCallbacks != NULL) {
+        QUIC_TLS_OFFLOAD_CALLBACK* Callback = Crypto->TlsOffloadCallbacks;
+        Crypto->TlsOffloadCallbacks = Callback->Next;
+
+        if (QuicConnIsClosed(Connection)) {
+            //
+            // An earlier callback failed the connection.
+            //
+
+        } else if (Callback->Type == QUIC_TLS_OFFLOAD_CALLBACK_TP) {
+            if (!QuicConnReceiveTP(Connection, Callback->Length, Callback->Buffer)) {
+                QuicConnTransportError(
+                    Connection,
+                    QUIC_ERROR_TRANSPORT_PARAMETER_ERROR);
+            }
+
+        } else if (QuicConnIsServer(Connection)) {
+            //
+            // The server accepted the ticket on the crypto pool, the same as
+            // if the app were validating it asynchronously. If it is rejected
+            // now, roll back the way an asynchronous rejection does.
+            //
+            if (!QuicConnRecvResumptionTicket(Connection, Callback->Length, Callback->Buffer)) {
+                Crypto->TicketValidationPending = TRUE;
+                RejectTicket = TRUE;
+            }
+
+        } else {
+            (void)QuicConnRecvResumptionTicket(Connection, Callback->Length, Callback->Buffer);
+        }
+
+        CXPLAT_FREE(Callback, QUIC_POOL_TLS_OFFLOAD_CALLBACK);
+    }
+
+    if (QuicConnIsClosed(Connection)) {
+        Crypto->TlsOffloadBufferLength = 0;
+        return;
+    }
+
+    QuicCryptoProcessDataComplete(Crypto, Crypto->TlsOffloadBufferLength);
+    Crypto->TlsOffloadBufferLength = 0;
+
+    if (RejectTicket) {
+        QuicCryptoCustomTicketValidationComplete(Crypto, FALSE);
+    }
+
+    if (QuicRecvBufferHasUnreadData(&Crypto->RecvBuffer)) {
+        //
+        // More data was received while TLS was running on the crypto pool.
+        //
+        QuicCryptoProcessData(Crypto, FALSE);
+    }
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicCryptoDeferTlsCallback(
+    _In_ QUIC_CRYPTO* Crypto,
+    _In_ QUIC_TLS_OFFLOAD_CALLBACK_TYPE Type,
+    _In_ uint16_t Length,
+    _In_reads_(Length)
+        const uint8_t* Buffer
+    )
+{
+    CXPLAT_DBG_ASSERT(Crypto->TlsOffloadPending);
+
+    QUIC_TLS_OFFLOAD_CALLBACK* Callback =
+        CXPLAT_ALLOC_NONPAGED(
+            sizeof(QUIC_TLS_OFFLOAD_CALLBACK) + Length,
+            QUIC_POOL_TLS_OFFLOAD_CALLBACK);
+    if (Callback == NULL) {
+        QuicTraceEvent(
+            AllocFailure,
+            "Allocation of '%s' failed. (%llu bytes)",
+            "TLS offload callback",
+            sizeof(QUIC_TLS_OFFLOAD_CALLBACK) + Length);
+        return FALSE;
+    }
+
+    Callback->Next = NULL;
+    Callback->Type = Type;
+    Callback->Length = Length;
+    CxPlatCopyMemory(Callback->Buffer, Buffer, Length);
+
+    QUIC_TLS_OFFLOAD_CALLBACK** Tail = &Crypto->TlsOffloadCallbacks;
+    while (*Tail != NULL) {
+        Tail = &(*Tail)->Next;
+    }
+    *Tail = Callback;
+
+    return TRUE;
+}
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 QUIC_STATUS
 QuicCryptoProcessAppData(
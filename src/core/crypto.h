@@ -19,6 +19,22 @@ extern "C" {
 //
 extern CXPLAT_TLS_CALLBACKS QuicTlsCallbacks;
 
+//
+// A TLS callback that was made on the crypto pool. It is processed later, on
+// the connection's worker, once the TLS offload completes.
+//
+typedef enum QUIC_TLS_OFFLOAD_CALLBACK_TYPE {
+    QUIC_TLS_OFFLOAD_CALLBACK_TP,
+    QUIC_TLS_OFFLOAD_CALLBACK_TICKET
+} QUIC_TLS_OFFLOAD_CALLBACK_TYPE;
+
+typedef struct QUIC_TLS_OFFLOAD_CALLBACK {
+    struct QUIC_TLS_OFFLOAD_CALLBACK* Next;
+    QUIC_TLS_OFFLOAD_CALLBACK_TYPE Type;
+    uint16_t Length;
+    uint8_t Buffer[0];
+} QUIC_TLS_OFFLOAD_CALLBACK;
+
 //
 // Stream of TLS data.
 //
@@ -97,6 +113,12 @@ typedef struct QUIC_CRYPTO {
     //
     BOOLEAN TicketValidationPending : 1;
     BOOLEAN TicketValidationRejecting : 1;
+
+    //
+    // (Server) Indicates the ClientHello was already checked against the 0-RTT
+    // replay filter.
+    //
+    BOOLEAN ReplayFilterChecked : 1;
     uint32_t PendingValidationBufferLength;
 
     //
@@ -115,6 +137,62 @@ typedef struct QUIC_CRYPTO {
     uint8_t* ResumptionTicket;
     uint32_t ResumptionTicketLength;
 
+    //
+    // (Server) The keyed hash of the ClientHello random, used to look it up in
+    // the 0-RTT replay filter.
+    //
+    uint64_t ClientHelloHash[2];
+
+    //
+    // TLS offload (crypto pool) state.
+    //
+
+    //
+    // Indicates received (or client initial) TLS data is waiting to be handed
+    // to the crypto pool once the current connection operation completes.
+    //
+    BOOLEAN TlsOffloadQueued : 1;
+    BOOLEAN TlsOffloadClientInitial : 1;
+
+    //
+    // Indicates TLS data is being processed on the crypto pool. All other
+    // connection operations are held until it completes.
+    //
+    BOOLEAN TlsOffloadPending : 1;
+
+    //
+    // (Server) Indicates TLS rejected the resumption ticket on the crypto pool
+    // after an asynchronous rejection, so the ticket validation state must be
+    // reset once the offload completes.
+    //
+    BOOLEAN TlsOffloadTicketRejected : 1;
+
+    //
+    // The length of TLS data being processed on the crypto pool. Updated with
+    // the amount consumed once complete.
+    //
+    uint32_t TlsOffloadBufferLength;
+
+    //
+    // The TLS data being processed on the crypto pool.
+    //
+    const uint8_t* TlsOffloadBuffer;
+
+    //
+    // Preallocated operation used to return to the connection's worker.
+    //
+    QUIC_OPERATION* TlsOffloadOper;
+
+    //
+    // The TLS callbacks made on the crypto pool, in the order they were made.
+    //
+    QUIC_TLS_OFFLOAD_CALLBACK* TlsOffloadCallbacks;
+
+    //
+    // Link in the crypto pool's work queue.
+    //
+    CXPLAT_LIST_ENTRY TlsOffloadLink;
+
 } QUIC_CRYPTO;
 
 QUIC_INLINE
@@ -253,6 +331,50 @@ QuicCryptoProcessData(
     _In_ BOOLEAN IsClientInitial
     );
 
+//
+// Called once the current connection operation completes, with TLS data queued
+// for the crypto pool. Returns TRUE if the data was handed off, in which case
+// the connection must stop processing operations until the offload completes.
+// Otherwise, the data was processed inline.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicCryptoPrepareTlsOffload(
+    _In_ QUIC_CRYPTO* Crypto
+    );
+
+//
+// Processes the offloaded TLS data. Called on a crypto pool thread.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicCryptoProcessTlsOffload(
+    _In_ QUIC_CRYPTO* Crypto
+    );
+
+//
+// Completes the offloaded TLS processing back on the connection's worker.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicCryptoTlsOffloadComplete(
+    _In_ QUIC_CRYPTO* Crypto
+    );
+
+//
+// Called from a TLS callback made on the crypto pool. Saves a copy of the
+// callback's data to be processed on the connection's worker instead.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicCryptoDeferTlsCallback(
+    _In_ QUIC_CRYPTO* Crypto,
+    _In_ QUIC_TLS_OFFLOAD_CALLBACK_TYPE Type,
+    _In_ uint16_t Length,
+    _In_reads_(Length)
+        const uint8_t* Buffer
+    );
+
 //
 // Processes app-provided data for TLS (i.e. resumption ticket data).
 //
@@ -326,6 +448,20 @@ QuicCryptoTlsReadClientRandom(
     _Inout_ QUIC_TLS_SECRETS* TlsSecrets
     );
 
+//
+// Hashes the ClientRandom out of the initial CRYPTO data for the 0-RTT replay
+// filter. MUST ONLY BE CALLED AFTER QuicCryptoTlsReadInitial!!
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicCryptoTlsHashClientRandom(
+    _In_reads_(BufferLength)
+        const uint8_t* Buffer,
+    _In_ uint32_t BufferLength,
+    _In_reads_(2) const uint64_t* Key,
+    _Out_writes_(2) uint64_t* Hash
+    );
+
 //
 // Generates new 1-RTT read and write keys, unless they already exist.
 //
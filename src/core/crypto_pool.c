@@ -0,0 +1,177 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    The crypto pool is a small, library-wide set of threads that run TLS
+    handshake processing (key exchange, certificate signing and validation) on
+    behalf of connections with TLS offload enabled.
+
+    A connection hands off its TLS data once the current operation completes
+    (see QuicCryptoPrepareTlsOffload). Its operation queue is held and it is
+    taken out of its worker's timer wheel while the pool thread processes the
+    data, so the pool thread has exclusive access to the connection. When done,
+    the pool thread queues a TLS_COMPLETE operation to the front of the
+    connection's queue and requeues the connection on its worker, which then
+    finishes processing the TLS results.
+
+    This keeps a burst of expensive handshakes from stalling the worker's
+    other, already established connections.
+
+--*/
+
+#include "precomp.h"
+#ifdef QUIC_CLOG
+#include "crypto_pool.c.clog.h"
+#endif
+
+CXPLAT_THREAD_CALLBACK(QuicCryptoPoolThread, Context);
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicCryptoPoolInitialize(
+    _Inout_ QUIC_CRYPTO_POOL* Pool
+    )
+{
+    CxPlatZeroMemory(Pool, sizeof(*Pool));
+    CxPlatLockInitialize(&Pool->Lock);
+    CxPlatEventInitialize(&Pool->WakeEvent, FALSE, FALSE);
+    CxPlatListInitializeHead(&Pool->WorkQueue);
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicCryptoPoolUninitialize(
+    _Inout_ QUIC_CRYPTO_POOL* Pool
+    )
+{
+    CxPlatLockAcquire(&Pool->Lock);
+    CXPLAT_DBG_ASSERT(CxPlatListIsEmpty(&Pool->WorkQueue));
+    Pool->Shutdown = TRUE;
+    CxPlatLockRelease(&Pool->Lock);
+
+    if (Pool->ThreadCount != 0) {
+        //
+        // Each thread wakes the next one on its way out.
+        //
+        CxPlatEventSet(Pool->WakeEvent);
+        for (uint32_t i = 0; i < Pool->ThreadCount; ++i) {
+            CxPlatThreadWait(&Pool->Threads[i]);
+            CxPlatThreadDelete(&Pool->Threads[i]);
+        }
+        Pool->ThreadCount = 0;
+    }
+    Pool->Started = FALSE;
+
+    CxPlatEventUninitialize(Pool->WakeEvent);
+    CxPlatLockUninitialize(&Pool->Lock);
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicCryptoPoolStart(
+    _Inout_ QUIC_CRYPTO_POOL* Pool
+    )
+{
+    if (Pool->Started) {
+        return TRUE;
+    }
+
+    CxPlatLockAcquire(&Pool->Lock);
+    if (!Pool->Started && !Pool->Shutdown) {
+        uint32_t ThreadCount =
+            CxPlatProcCount() / QUIC_CRYPTO_POOL_PROCS_PER_THREAD;
+        if (ThreadCount == 0) {
+            ThreadCount = 1;
+        } else if (ThreadCount > QUIC_CRYPTO_POOL_MAX_THREADS) {
+            ThreadCount = QUIC_CRYPTO_POOL_MAX_THREADS;
+        }
+
+        CXPLAT_THREAD_CONFIG ThreadConfig = {
+            0,
+            0,
+            "quic_crypto",
+            QuicCryptoPoolThread,
+            Pool
+        };
+
+        for (uint32_t i = 0; i < ThreadCount; ++i) {
+            QUIC_STATUS Status =
+                CxPlatThreadCreate(&ThreadConfig, &Pool->Threads[Pool->ThreadCount]);
+            if (QUIC_FAILED(Status)) {
+                QuicTraceEvent(
+                    LibraryErrorStatus,
+                    "[ lib] ERROR, %u, %s.",
+                    Status,
+                    "CxPlatThreadCreate (crypto pool)");
+                break;
+            }
+            Pool->ThreadCount++;
+        }
+
+        if (Pool->ThreadCount != 0) {
+            QuicTraceLogInfo(
+                CryptoPoolStarted,
+                "[ lib] Crypto pool started with %u threads",
+                Pool->ThreadCount);
+            Pool->Started = TRUE;
+        }
+    }
+    BOOLEAN Started = Pool->Started;
+    CxPlatLockRelease(&Pool->Lock);
+
+    return Started;
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicCryptoPoolQueue(
+    _Inout_ QUIC_CRYPTO_POOL* Pool,
+    _In_ QUIC_CRYPTO* Crypto
+    )
+{
+    CXPLAT_DBG_ASSERT(Pool->Started);
+    CxPlatLockAcquire(&Pool->Lock);
+    CxPlatListInsertTail(&Pool->WorkQueue, &Crypto->TlsOffloadLink);
+    CxPlatLockRelease(&Pool->Lock);
+    CxPlatEventSet(Pool->WakeEvent);
+}
+
+CXPLAT_THREAD_CALLBACK(QuicCryptoPoolThread, Context)
+{
+    QUIC_CRYPTO_POOL* Pool = (QUIC_CRYPTO_POOL*)Context;
+
+    CxPlatLockAcquire(&Pool->Lock);
+    while (TRUE) {
+        if (CxPlatListIsEmpty(&Pool->WorkQueue)) {
+            if (Pool->Shutdown) {
+                break;
+            }
+            CxPlatLockRelease(&Pool->Lock);
+            CxPlatEventWaitForever(Pool->WakeEvent);
+            CxPlatLockAcquire(&Pool->Lock);
+            continue;
+        }
+
+        QUIC_CRYPTO* Crypto =
+            CXPLAT_CONTAINING_RECORD(
+                CxPlatListRemoveHead(&Pool->WorkQueue),
+                QUIC_CRYPTO,
+                TlsOffloadLink);
+        if (!CxPlatListIsEmpty(&Pool->WorkQueue)) {
+            CxPlatEventSet(Pool->WakeEvent); // Let another thread pick up the rest.
+        }
+        CxPlatLockRelease(&Pool->Lock);
+
+        QuicCryptoProcessTlsOffload(Crypto);
+
+        CxPlatLockAcquire(&Pool->Lock);
+    }
+    CxPlatLockRelease(&Pool->Lock);
+
+    CxPlatEventSet(Pool->WakeEvent); // Wake the next thread to shut down.
+
+    CXPLAT_THREAD_RETURN(QUIC_STATUS_SUCCESS);
+}
@@ -0,0 +1,91 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+--*/
+
+typedef struct QUIC_CRYPTO QUIC_CRYPTO;
+
+//
+// A library-wide pool of threads that run TLS handshake processing for
+// connections with QUIC_SETTINGS.TlsOffloadEnabled, so that expensive key
+// exchange and certificate operations don't hold up the connection's worker.
+//
+typedef struct QUIC_CRYPTO_POOL {
+
+    //
+    // Protects all fields below.
+    //
+    CXPLAT_LOCK Lock;
+
+    //
+    // Set when queued work is available, and chained from thread to thread
+    // while more remains.
+    //
+    CXPLAT_EVENT WakeEvent;
+
+    //
+    // Set to true to shut down the threads.
+    //
+    BOOLEAN Shutdown;
+
+    //
+    // Set once the threads have been (lazily) started.
+    //
+    BOOLEAN Started;
+
+    //
+    // The number of threads in Threads.
+    //
+    uint32_t ThreadCount;
+
+    //
+    // List of crypto objects (QUIC_CRYPTO.TlsOffloadLink) waiting for TLS
+    // processing.
+    //
+    CXPLAT_LIST_ENTRY WorkQueue;
+
+    CXPLAT_THREAD Threads[QUIC_CRYPTO_POOL_MAX_THREADS];
+
+} QUIC_CRYPTO_POOL;
+
+//
+// Initializes the pool. The threads aren't created until work is first queued.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicCryptoPoolInitialize(
+    _Inout_ QUIC_CRYPTO_POOL* Pool
+    );
+
+//
+// Stops any threads and cleans up the pool. All work must have completed.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicCryptoPoolUninitialize(
+    _Inout_ QUIC_CRYPTO_POOL* Pool
+    );
+
+//
+// Starts the pool's threads, if they aren't already running. Returns FALSE if
+// they can't be started, in which case the caller must process TLS data
+// itself.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicCryptoPoolStart(
+    _Inout_ QUIC_CRYPTO_POOL* Pool
+    );
+
+//
+// Queues the crypto object's pending TLS data to be processed on the pool.
+// The pool must have been started.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicCryptoPoolQueue(
+    _Inout_ QUIC_CRYPTO_POOL* Pool,
+    _In_ QUIC_CRYPTO* Crypto
+    );
@@ -68,6 +68,7 @@ typedef enum eSniNameType {
 #define QUIC_TP_ID_GREASE_QUIC_BIT                          0x2AB2          // N/A
 #define QUIC_TP_ID_RELIABLE_RESET_ENABLED                   0x17f7586d2cb570   // varint
 #define QUIC_TP_ID_ENABLE_TIMESTAMP                         0x7158          // varint
+#define QUIC_TP_ID_DATAGRAM_FEC                             0xfec0d47a91b3ULL // N/A
 
 BOOLEAN
 QuicTpIdIsReserved(
@@ -715,6 +716,28 @@ QuicCryptoTlsReadClientRandom(
     return QUIC_STATUS_SUCCESS;
 }
 
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicCryptoTlsHashClientRandom(
+    _In_reads_(BufferLength)
+        const uint8_t* Buffer,
+    _In_ uint32_t BufferLength,
+    _In_reads_(2) const uint64_t* Key,
+    _Out_writes_(2) uint64_t* Hash
+    )
+{
+    UNREFERENCED_PARAMETER(BufferLength);
+    CXPLAT_DBG_ASSERT(
+        BufferLength >=
+        TLS_MESSAGE_HEADER_LENGTH + sizeof(uint16_t) + TLS_RANDOM_LENGTH);
+
+    QuicReplayFilterHash(
+        Key,
+        TLS_RANDOM_LENGTH,
+        Buffer + TLS_MESSAGE_HEADER_LENGTH + sizeof(uint16_t),
+        Hash);
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 _Success_(return != NULL)
 const uint8_t*
@@ -894,6 +917,12 @@ QuicCryptoTlsEncodeTransportParameters(
                 QUIC_TP_ID_RELIABLE_RESET_ENABLED,
                 0);
     }
+    if (TransportParams->Flags & QUIC_TP_FLAG_DATAGRAM_FEC) {
+        RequiredTPLen +=
+            TlsTransportParamLength(
+                QUIC_TP_ID_DATAGRAM_FEC,
+                0);
+    }
     if (TransportParams->Flags & (QUIC_TP_FLAG_TIMESTAMP_SEND_ENABLED | QUIC_TP_FLAG_TIMESTAMP_RECV_ENABLED)) {
         const uint32_t value =
             (TransportParams->Flags &
@@ -1230,6 +1259,18 @@ QuicCryptoTlsEncodeTransportParameters(
             Connection,
             "TP: Reliable Reset");
     }
+    if (TransportParams->Flags & QUIC_TP_FLAG_DATAGRAM_FEC) {
+        TPBuf =
+            TlsWriteTransportParam(
+                QUIC_TP_ID_DATAGRAM_FEC,
+                0,
+                NULL,
+                TPBuf);
+        QuicTraceLogConnVerbose(
+            EncodeTPDatagramFec,
+            Connection,
+            "TP: Datagram FEC");
+    }
     if (TransportParams->Flags & (QUIC_TP_FLAG_TIMESTAMP_SEND_ENABLED | QUIC_TP_FLAG_TIMESTAMP_RECV_ENABLED)) {
         const uint32_t value =
             (TransportParams->Flags &
@@ -1924,6 +1965,23 @@ QuicCryptoTlsDecodeTransportParameters( // NOLINT(readability-function-size, goo
                 "TP: Reliable Reset");
             break;
 
+        case QUIC_TP_ID_DATAGRAM_FEC:
+            if (Length != 0) {
+                QuicTraceEvent(
+                    ConnErrorStatus,
+                    "[conn][%p] ERROR, %u, %s.",
+                    Connection,
+                    Length,
+                    "Invalid length of QUIC_TP_ID_DATAGRAM_FEC");
+                goto Exit;
+            }
+            TransportParams->Flags |= QUIC_TP_FLAG_DATAGRAM_FEC;
+            QuicTraceLogConnVerbose(
+                DecodeTPDatagramFec,
+                Connection,
+                "TP: Datagram FEC");
+            break;
+
         case QUIC_TP_ID_ENABLE_TIMESTAMP: {
             QUIC_VAR_INT value = 0;
             if (!TRY_READ_VAR_INT(value)) {
@@ -22,6 +22,20 @@ Abstract:
 #define TEN_TIMES_BETA_CUBIC 7
 #define TEN_TIMES_C_CUBIC 4
 
+//
+// SEARCH window size in initial RTTs (10x multiple for integer arithmetic),
+// and how far (in percent) the bytes delivered over a window may fall short of
+// twice those delivered one RTT earlier before slow start is exited.
+//
+#define TEN_TIMES_SEARCH_WINDOW_RTTS 35
+#define SEARCH_THRESHOLD_PERCENT 35
+
+//
+// The number of bins covering one initial RTT, rounded.
+//
+#define SEARCH_SHIFT_BINS \
+    ((10 * CUBIC_SEARCH_BINS + TEN_TIMES_SEARCH_WINDOW_RTTS / 2) / TEN_TIMES_SEARCH_WINDOW_RTTS)
+
 //
 // Shifting nth root algorithm.
 //
@@ -124,6 +138,87 @@ CubicCongestionHyStartResetPerRttRound(
     Cubic->MinRttInCurrentRound = UINT64_MAX;
 }
 
+void
+CubicCongestionSearchReset(
+    _In_ QUIC_CONGESTION_CONTROL_CUBIC* Cubic
+    )
+{
+    Cubic->SearchBinEnd = 0;
+    Cubic->SearchBinCount = 0;
+}
+
+//
+// Records the total bytes acknowledged at the end of every bin that has
+// passed. Returns TRUE once the bytes delivered stopped growing like the
+// sending rate does in slow start, i.e. the bottleneck is full. In that case
+// DeliveredLastRtt is the number of bytes delivered over the last initial RTT.
+//
+BOOLEAN
+CubicCongestionSearchUpdate(
+    _In_ QUIC_CONGESTION_CONTROL_CUBIC* Cubic,
+    _In_ uint64_t TimeNowUs,
+    _In_ uint64_t InitialRtt,
+    _In_ uint64_t TotalBytesAcked,
+    _Out_ uint64_t* DeliveredLastRtt
+    )
+{
+    CXPLAT_STATIC_ASSERT(
+        CUBIC_SEARCH_BINS + SEARCH_SHIFT_BINS < CUBIC_SEARCH_BIN_SLOTS,
+        "SEARCH history must cover the window and the RTT shift");
+
+    *DeliveredLastRtt = 0;
+
+    if (Cubic->SearchBinEnd == 0) {
+        Cubic->SearchBinDuration =
+            CXPLAT_MAX(1, InitialRtt * TEN_TIMES_SEARCH_WINDOW_RTTS / (10 * CUBIC_SEARCH_BINS));
+        Cubic->SearchBinEnd = TimeNowUs + Cubic->SearchBinDuration;
+        Cubic->SearchBinCount = 0;
+        Cubic->SearchBinDelivered[0] = TotalBytesAcked;
+        return FALSE;
+    }
+
+    if (TimeNowUs < Cubic->SearchBinEnd) {
+        return FALSE;
+    }
+
+    uint64_t PassedBins = (TimeNowUs - Cubic->SearchBinEnd) / Cubic->SearchBinDuration + 1;
+    if (PassedBins >= CUBIC_SEARCH_BIN_SLOTS) {
+        //
+        // No ACKs for longer than the history covers. Start over.
+        //
+        CubicCongestionSearchReset(Cubic);
+        return FALSE;
+    }
+
+    Cubic->SearchBinEnd += PassedBins * Cubic->SearchBinDuration;
+    while (PassedBins-- > 0) {
+        Cubic->SearchBinCount++;
+        Cubic->SearchBinDelivered[Cubic->SearchBinCount % CUBIC_SEARCH_BIN_SLOTS] =
+            TotalBytesAcked;
+    }
+
+    if (Cubic->SearchBinCount < CUBIC_SEARCH_BINS + SEARCH_SHIFT_BINS) {
+        return FALSE;
+    }
+
+#define SEARCH_BIN(Index) Cubic->SearchBinDelivered[(Index) % CUBIC_SEARCH_BIN_SLOTS]
+    const uint32_t Current = Cubic->SearchBinCount;
+    const uint32_t Previous = Current - SEARCH_SHIFT_BINS;
+    const uint64_t CurrentDelivered =
+        SEARCH_BIN(Current) - SEARCH_BIN(Current - CUBIC_SEARCH_BINS);
+    const uint64_t PreviousDelivered =
+        SEARCH_BIN(Previous) - SEARCH_BIN(Previous - CUBIC_SEARCH_BINS);
+    *DeliveredLastRtt = SEARCH_BIN(Current) - SEARCH_BIN(Previous);
+#undef SEARCH_BIN
+
+    //
+    // Exit when (2 * Previous - Current) / (2 * Previous) >= THRESHOLD.
+    //
+    return
+        PreviousDelivered != 0 &&
+        CurrentDelivered * 100 <= 2 * PreviousDelivered * (100 - SEARCH_THRESHOLD_PERCENT);
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 BOOLEAN
 CubicCongestionControlCanSend(
@@ -161,6 +256,7 @@ CubicCongestionControlReset(
     Cubic->HyStartRoundEnd = Connection->Send.NextPacketNumber;
     CubicCongestionHyStartResetPerRttRound(Cubic);
     CubicCongestionHyStartChangeState(Cc, HYSTART_NOT_STARTED);
+    CubicCongestionSearchReset(Cubic);
     Cubic->IsInRecovery = FALSE;
     Cubic->HasHadCongestionEvent = FALSE;
     Cubic->CongestionWindow = DatagramPayloadLength * Cubic->InitialWindowPackets;
@@ -476,14 +572,21 @@ CubicCongestionControlOnDataAcknowledged(
     if (Connection->Settings.HyStartEnabled && Cubic->HyStartState != HYSTART_DONE) {
         if (AckEvent->MinRttValid) {
             //
-            // Update Min RTT for the first N ACKs.
+            // Track the minimum RTT over the whole round (RFC 9406), only
+            // comparing rounds once enough samples were taken. When pacing,
+            // the first few samples of a round all come from its first paced
+            // chunk and are not representative of the round.
             //
+            Cubic->MinRttInCurrentRound =
+                CXPLAT_MIN(
+                    Cubic->MinRttInCurrentRound,
+                    AckEvent->MinRtt);
+            Cubic->HyStartAckCount++;
+
             if (Cubic->HyStartAckCount < QUIC_HYSTART_DEFAULT_N_SAMPLING) {
-                Cubic->MinRttInCurrentRound =
-                    CXPLAT_MIN(
-                        Cubic->MinRttInCurrentRound,
-                        AckEvent->MinRtt);
-                Cubic->HyStartAckCount++;
+                //
+                // Not enough samples in this round yet.
+                //
             } else if (Cubic->HyStartState == HYSTART_NOT_STARTED) {
                 const uint64_t Eta =
                     CXPLAT_MIN(
@@ -518,6 +621,37 @@ CubicCongestionControlOnDataAcknowledged(
             }
         }
 
+        //
+        // SEARCH: exit slow start once the bytes delivered stop growing with
+        // the sending rate. Unlike the delay signal, this doesn't depend on
+        // the queue growing fast enough to show up in the RTT samples, which
+        // pacing and deep buffers on fast paths defeat.
+        //
+        uint64_t DeliveredLastRtt;
+        if (Connection->Paths[0].GotFirstRttSample &&
+            CubicCongestionSearchUpdate(
+                Cubic,
+                TimeNowUs,
+                Connection->Paths[0].MinRtt,
+                AckEvent->NumTotalAckedRetransmittableBytes,
+                &DeliveredLastRtt)) {
+            //
+            // Any window beyond what the path delivered over the last RTT
+            // only builds a queue, so drop it before entering Congestion
+            // Avoidance.
+            //
+            const uint16_t DatagramPayloadLength =
+                QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+            Cubic->SlowStartThreshold =
+            Cubic->CongestionWindow =
+            Cubic->AimdWindow =
+                CXPLAT_MAX(
+                    (uint32_t)DatagramPayloadLength * QUIC_PERSISTENT_CONGESTION_WINDOW_PACKETS,
+                    (uint32_t)CXPLAT_MIN(Cubic->CongestionWindow, DeliveredLastRtt));
+            Cubic->TimeOfCongAvoidStart = TimeNowUs;
+            CubicCongestionHyStartChangeState(Cc, HYSTART_DONE);
+        }
+
         //
         // Reset HyStart parameters for each RTT round.
         //
@@ -544,7 +678,23 @@ CubicCongestionControlOnDataAcknowledged(
         // Slow Start
         //
 
-        Cubic->CongestionWindow += (BytesAcked / Cubic->CWndSlowStartGrowthDivisor);
+        uint32_t Increase = BytesAcked / Cubic->CWndSlowStartGrowthDivisor;
+        if (Connection->Settings.HyStartEnabled &&
+            (!Connection->Settings.PacingEnabled ||
+             !Connection->Paths[0].GotFirstRttSample ||
+             Connection->Paths[0].SmoothedRtt < QUIC_MIN_PACING_RTT)) {
+            //
+            // Without pacing, every ACK releases a burst, so limit the growth
+            // per ACK (L from RFC 9406).
+            //
+            const uint32_t Limit =
+                QUIC_HYSTART_DEFAULT_NON_PACED_GROWTH_LIMIT *
+                QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+            if (Increase > Limit) {
+                Increase = Limit;
+            }
+        }
+        Cubic->CongestionWindow += Increase;
         BytesAcked = 0;
         if (Cubic->CongestionWindow >= Cubic->SlowStartThreshold) {
             Cubic->TimeOfCongAvoidStart = TimeNowUs;
@@ -17,6 +17,13 @@ typedef enum QUIC_CUBIC_HYSTART_STATE {
     HYSTART_DONE = 2
 } QUIC_CUBIC_HYSTART_STATE;
 
+//
+// The number of delivery bins in a SEARCH window, and the number of bin
+// totals kept (the window plus the one RTT shift it is compared against).
+//
+#define CUBIC_SEARCH_BINS       10
+#define CUBIC_SEARCH_BIN_SLOTS  16
+
 typedef struct QUIC_CONGESTION_CONTROL_CUBIC {
 
     //
@@ -107,6 +114,17 @@ typedef struct QUIC_CONGESTION_CONTROL_CUBIC {
     uint32_t CWndSlowStartGrowthDivisor;
     uint32_t ConservativeSlowStartRounds;
 
+    //
+    // SEARCH slow start exit state. The total number of bytes acknowledged is
+    // sampled at the end of each bin (a fixed fraction of the initial RTT),
+    // and the bytes delivered over the most recent window of bins are compared
+    // to those delivered one RTT earlier.
+    //
+    uint64_t SearchBinEnd; // microseconds
+    uint64_t SearchBinDuration; // microseconds
+    uint32_t SearchBinCount;
+    uint64_t SearchBinDelivered[CUBIC_SEARCH_BIN_SLOTS]; // bytes
+
     //
     // This variable tracks the largest packet that was outstanding at the time
     // the last congestion event occurred. An ACK for any packet number greater
@@ -0,0 +1,527 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Adapter between the congestion control interface and an application
+    supplied algorithm (QUIC_CONGESTION_CONTROL_PROVIDER).
+
+    MsQuic owns the bytes in flight, probe exemptions and blocked state
+    bookkeeping; the application only maintains its congestion window (and
+    optionally its pacing) from the events forwarded here, with a read-only
+    snapshot of the connection's RTT and in-flight state.
+
+--*/
+
+#include "precomp.h"
+#ifdef QUIC_CLOG
+#include "custom_cc.c.clog.h"
+#endif
+
+#include "custom_cc.h"
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+void
+CustomCongestionControlGetState(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc,
+    _Out_ QUIC_CONGESTION_CONTROL_STATE* State
+    )
+{
+    const QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    const QUIC_PATH* Path = &Connection->Paths[0];
+
+    State->SmoothedRtt = Path->SmoothedRtt;
+    State->MinRtt = Path->MinRtt;
+    State->RttVariance = Path->RttVariance;
+    State->LatestRtt = Path->LatestRttSample;
+    State->BytesInFlight = Cc->Custom.BytesInFlight;
+    State->BytesInFlightMax = Cc->Custom.BytesInFlightMax;
+    State->DatagramPayloadLength = QuicPathGetDatagramPayloadSize(Path);
+    State->GotFirstRttSample = Path->GotFirstRttSample;
+    State->PacingEnabled = Connection->Settings.PacingEnabled;
+}
+
+//
+// Refreshes the cached congestion window from the application.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+void
+CustomCongestionControlUpdateWindow(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* State
+    )
+{
+    QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+    const uint32_t MinWindow =
+        (uint32_t)State->DatagramPayloadLength * QUIC_PERSISTENT_CONGESTION_WINDOW_PACKETS;
+    Custom->CongestionWindow =
+        CXPLAT_MAX(
+            MinWindow,
+            Custom->Provider.GetCongestionWindow(Custom->Instance, State));
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+CustomCongestionControlCanSend(
+    _In_ QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+    return Custom->BytesInFlight < Custom->CongestionWindow || Custom->Exemptions > 0;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+CustomCongestionControlSetExemption(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint8_t NumPackets
+    )
+{
+    Cc->Custom.Exemptions = NumPackets;
+}
+
+//
+// Returns TRUE if we became unblocked.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+BOOLEAN
+CustomCongestionControlUpdateBlockedState(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ BOOLEAN PreviousCanSendState
+    )
+{
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    QuicConnLogOutFlowStats(Connection);
+    if (PreviousCanSendState != CustomCongestionControlCanSend(Cc)) {
+        if (PreviousCanSendState) {
+            QuicConnAddOutFlowBlockedReason(
+                Connection, QUIC_FLOW_BLOCKED_CONGESTION_CONTROL);
+        } else {
+            QuicConnRemoveOutFlowBlockedReason(
+                Connection, QUIC_FLOW_BLOCKED_CONGESTION_CONTROL);
+            Connection->Send.LastFlushTime = CxPlatTimeUs64(); // Reset last flush time
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+CustomCongestionControlReset(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ BOOLEAN FullReset
+    )
+{
+    QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+
+    Custom->LastSendAllowance = 0;
+    if (FullReset) {
+        Custom->BytesInFlight = 0;
+    }
+
+    QUIC_CONGESTION_CONTROL_STATE State;
+    CustomCongestionControlGetState(Cc, &State);
+    if (Custom->Provider.Reset != NULL) {
+        Custom->Provider.Reset(Custom->Instance, &State, FullReset);
+    }
+    CustomCongestionControlUpdateWindow(Cc, &State);
+    Custom->BytesInFlightMax = Custom->CongestionWindow / 2;
+
+    QuicConnLogOutFlowStats(QuicCongestionControlGetConnection(Cc));
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint32_t
+CustomCongestionControlGetSendAllowance(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint64_t TimeSinceLastSend, // microsec
+    _In_ BOOLEAN TimeSinceLastSendValid
+    )
+{
+    QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+
+    if (Custom->BytesInFlight >= Custom->CongestionWindow) {
+        return 0;
+    }
+
+    const uint32_t Available = Custom->CongestionWindow - Custom->BytesInFlight;
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+
+    if (Custom->Provider.GetSendAllowance != NULL) {
+        QUIC_CONGESTION_CONTROL_STATE State;
+        CustomCongestionControlGetState(Cc, &State);
+        return
+            CXPLAT_MIN(
+                Available,
+                Custom->Provider.GetSendAllowance(
+                    Custom->Instance, &State, TimeSinceLastSend, TimeSinceLastSendValid));
+    }
+
+    if (!TimeSinceLastSendValid ||
+        !Connection->Settings.PacingEnabled ||
+        !Connection->Paths[0].GotFirstRttSample ||
+        Connection->Paths[0].SmoothedRtt < QUIC_MIN_PACING_RTT) {
+        return Available;
+    }
+
+    //
+    // Pace the window evenly over the RTT, with 25% headroom so that pacing
+    // doesn't slow down the window growth.
+    //
+    const uint64_t EstimatedWnd =
+        Custom->CongestionWindow + (Custom->CongestionWindow >> 2);
+    uint32_t SendAllowance =
+        Custom->LastSendAllowance +
+        (uint32_t)((EstimatedWnd * TimeSinceLastSend) / Connection->Paths[0].SmoothedRtt);
+    if (SendAllowance < Custom->LastSendAllowance || // Overflow case
+        SendAllowance > Available) {
+        SendAllowance = Available;
+    }
+
+    Custom->LastSendAllowance = SendAllowance;
+    return SendAllowance;
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+CustomCongestionControlOnDataSent(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint32_t NumRetransmittableBytes
+    )
+{
+    QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+
+    BOOLEAN PreviousCanSendState = CustomCongestionControlCanSend(Cc);
+
+    Custom->BytesInFlight += NumRetransmittableBytes;
+    if (Custom->BytesInFlightMax < Custom->BytesInFlight) {
+        Custom->BytesInFlightMax = Custom->BytesInFlight;
+        QuicSendBufferConnectionAdjust(QuicCongestionControlGetConnection(Cc));
+    }
+
+    if (NumRetransmittableBytes > Custom->LastSendAllowance) {
+        Custom->LastSendAllowance = 0;
+    } else {
+        Custom->LastSendAllowance -= NumRetransmittableBytes;
+    }
+
+    if (Custom->Exemptions > 0) {
+        --Custom->Exemptions;
+    }
+
+    if (Custom->Provider.OnDataSent != NULL) {
+        QUIC_CONGESTION_CONTROL_STATE State;
+        CustomCongestionControlGetState(Cc, &State);
+        Custom->Provider.OnDataSent(Custom->Instance, &State, NumRetransmittableBytes);
+        CustomCongestionControlUpdateWindow(Cc, &State);
+    }
+
+    CustomCongestionControlUpdateBlockedState(Cc, PreviousCanSendState);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+CustomCongestionControlOnDataInvalidated(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint32_t NumRetransmittableBytes
+    )
+{
+    QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+
+    BOOLEAN PreviousCanSendState = CustomCongestionControlCanSend(Cc);
+
+    CXPLAT_DBG_ASSERT(Custom->BytesInFlight >= NumRetransmittableBytes);
+    Custom->BytesInFlight -= NumRetransmittableBytes;
+
+    return CustomCongestionControlUpdateBlockedState(Cc, PreviousCanSendState);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+CustomCongestionControlOnDataAcknowledged(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_ACK_EVENT* AckEvent
+    )
+{
+    QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    BOOLEAN PreviousCanSendState = CustomCongestionControlCanSend(Cc);
+
+    CXPLAT_DBG_ASSERT(Custom->BytesInFlight >= AckEvent->NumRetransmittableBytes);
+    Custom->BytesInFlight -= AckEvent->NumRetransmittableBytes;
+
+    QUIC_CONGESTION_CONTROL_ACK Ack = {
+        AckEvent->TimeNow,
+        AckEvent->LargestAck,
+        AckEvent->LargestSentPacketNumber,
+        AckEvent->NumTotalAckedRetransmittableBytes,
+        AckEvent->MinRtt,
+        AckEvent->NumRetransmittableBytes,
+        AckEvent->MinRttValid,
+        AckEvent->HasLoss,
+        AckEvent->IsImplicit
+    };
+    QUIC_CONGESTION_CONTROL_STATE State;
+    CustomCongestionControlGetState(Cc, &State);
+    Custom->Provider.OnDataAcknowledged(Custom->Instance, &State, &Ack);
+    CustomCongestionControlUpdateWindow(Cc, &State);
+
+    if (Connection->Settings.NetStatsEventEnabled) {
+        const QUIC_PATH* Path = &Connection->Paths[0];
+        QUIC_CONNECTION_EVENT Event;
+        Event.Type = QUIC_CONNECTION_EVENT_NETWORK_STATISTICS;
+        Event.NETWORK_STATISTICS.BytesInFlight = Custom->BytesInFlight;
+        Event.NETWORK_STATISTICS.PostedBytes = Connection->SendBuffer.PostedBytes;
+        Event.NETWORK_STATISTICS.IdealBytes = Connection->SendBuffer.IdealBytes;
+        Event.NETWORK_STATISTICS.SmoothedRTT = Path->SmoothedRtt;
+        Event.NETWORK_STATISTICS.CongestionWindow = Custom->CongestionWindow;
+        Event.NETWORK_STATISTICS.Bandwidth = Custom->CongestionWindow / Path->SmoothedRtt;
+        QuicConnIndicateEvent(Connection, &Event);
+    }
+
+    return CustomCongestionControlUpdateBlockedState(Cc, PreviousCanSendState);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+CustomCongestionControlOnDataLost(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_LOSS_EVENT* LossEvent
+    )
+{
+    QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+
+    BOOLEAN PreviousCanSendState = CustomCongestionControlCanSend(Cc);
+
+    CXPLAT_DBG_ASSERT(Custom->BytesInFlight >= LossEvent->NumRetransmittableBytes);
+    Custom->BytesInFlight -= LossEvent->NumRetransmittableBytes;
+
+    QUIC_CONGESTION_CONTROL_LOSS Loss = {
+        LossEvent->LargestPacketNumberLost,
+        LossEvent->LargestSentPacketNumber,
+        LossEvent->NumRetransmittableBytes,
+        LossEvent->PersistentCongestion
+    };
+    QUIC_CONGESTION_CONTROL_STATE State;
+    CustomCongestionControlGetState(Cc, &State);
+    Custom->Provider.OnDataLost(Custom->Instance, &State, &Loss);
+    CustomCongestionControlUpdateWindow(Cc, &State);
+
+    CustomCongestionControlUpdateBlockedState(Cc, PreviousCanSendState);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+CustomCongestionControlOnEcn(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_ECN_EVENT* EcnEvent
+    )
+{
+    QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+
+    if (Custom->Provider.OnEcn == NULL) {
+        return;
+    }
+
+    BOOLEAN PreviousCanSendState = CustomCongestionControlCanSend(Cc);
+
+    QUIC_CONGESTION_CONTROL_ECN Ecn = {
+        EcnEvent->LargestPacketNumberAcked,
+        EcnEvent->LargestSentPacketNumber,
+        EcnEvent->CePacketCount
+    };
+    QUIC_CONGESTION_CONTROL_STATE State;
+    CustomCongestionControlGetState(Cc, &State);
+    Custom->Provider.OnEcn(Custom->Instance, &State, &Ecn);
+    CustomCongestionControlUpdateWindow(Cc, &State);
+
+    CustomCongestionControlUpdateBlockedState(Cc, PreviousCanSendState);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+CustomCongestionControlOnSpuriousCongestionEvent(
+    _In_ QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+
+    if (Custom->Provider.OnSpuriousCongestionEvent == NULL) {
+        return FALSE;
+    }
+
+    BOOLEAN PreviousCanSendState = CustomCongestionControlCanSend(Cc);
+
+    QUIC_CONGESTION_CONTROL_STATE State;
+    CustomCongestionControlGetState(Cc, &State);
+    Custom->Provider.OnSpuriousCongestionEvent(Custom->Instance, &State);
+    CustomCongestionControlUpdateWindow(Cc, &State);
+
+    return CustomCongestionControlUpdateBlockedState(Cc, PreviousCanSendState);
+}
+
+void
+CustomCongestionControlLogOutFlowStatus(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    const QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    const QUIC_PATH* Path = &Connection->Paths[0];
+    const QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+
+    QuicTraceEvent(
+        ConnOutFlowStatsV2,
+        "[conn][%p] OUT: BytesSent=%llu InFlight=%u CWnd=%u ConnFC=%llu ISB=%llu PostedBytes=%llu SRtt=%llu 1Way=%llu",
+        Connection,
+        Connection->Stats.Send.TotalBytes,
+        Custom->BytesInFlight,
+        Custom->CongestionWindow,
+        Connection->Send.PeerMaxData - Connection->Send.OrderedStreamBytesSent,
+        Connection->SendBuffer.IdealBytes,
+        Connection->SendBuffer.PostedBytes,
+        Path->GotFirstRttSample ? Path->SmoothedRtt : 0,
+        Path->OneWayDelay);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint8_t
+CustomCongestionControlGetExemptions(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    return Cc->Custom.Exemptions;
+}
+
+uint32_t
+CustomCongestionControlGetBytesInFlightMax(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    return Cc->Custom.BytesInFlightMax;
+}
+
+uint32_t
+CustomCongestionControlGetCongestionWindow(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    return Cc->Custom.CongestionWindow;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+CustomCongestionControlIsAppLimited(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    UNREFERENCED_PARAMETER(Cc);
+    return FALSE;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+CustomCongestionControlSetAppLimited(
+    _In_ struct QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    UNREFERENCED_PARAMETER(Cc);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+CustomCongestionControlGetNetworkStatistics(
+    _In_ const QUIC_CONNECTION* const Connection,
+    _In_ const QUIC_CONGESTION_CONTROL* const Cc,
+    _Out_ QUIC_NETWORK_STATISTICS* NetworkStatistics
+    )
+{
+    const QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+    const QUIC_PATH* Path = &Connection->Paths[0];
+
+    NetworkStatistics->BytesInFlight = Custom->BytesInFlight;
+    NetworkStatistics->PostedBytes = Connection->SendBuffer.PostedBytes;
+    NetworkStatistics->IdealBytes = Connection->SendBuffer.IdealBytes;
+    NetworkStatistics->SmoothedRTT = Path->SmoothedRtt;
+    NetworkStatistics->CongestionWindow = Custom->CongestionWindow;
+    NetworkStatistics->Bandwidth = Custom->CongestionWindow / Path->SmoothedRtt;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+CustomCongestionControlUninitialize(
+    _In_ QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+    if (Custom->Instance != NULL) {
+        Custom->Provider.Delete(Custom->Instance);
+        Custom->Instance = NULL;
+    }
+}
+
+static const QUIC_CONGESTION_CONTROL QuicCongestionControlCustom = {
+    .QuicCongestionControlCanSend = CustomCongestionControlCanSend,
+    .QuicCongestionControlSetExemption = CustomCongestionControlSetExemption,
+    .QuicCongestionControlReset = CustomCongestionControlReset,
+    .QuicCongestionControlGetSendAllowance = CustomCongestionControlGetSendAllowance,
+    .QuicCongestionControlOnDataSent = CustomCongestionControlOnDataSent,
+    .QuicCongestionControlOnDataInvalidated = CustomCongestionControlOnDataInvalidated,
+    .QuicCongestionControlOnDataAcknowledged = CustomCongestionControlOnDataAcknowledged,
+    .QuicCongestionControlOnDataLost = CustomCongestionControlOnDataLost,
+    .QuicCongestionControlOnEcn = CustomCongestionControlOnEcn,
+    .QuicCongestionControlOnSpuriousCongestionEvent = CustomCongestionControlOnSpuriousCongestionEvent,
+    .QuicCongestionControlLogOutFlowStatus = CustomCongestionControlLogOutFlowStatus,
+    .QuicCongestionControlGetExemptions = CustomCongestionControlGetExemptions,
+    .QuicCongestionControlGetBytesInFlightMax = CustomCongestionControlGetBytesInFlightMax,
+    .QuicCongestionControlIsAppLimited = CustomCongestionControlIsAppLimited,
+    .QuicCongestionControlSetAppLimited = CustomCongestionControlSetAppLimited,
+    .QuicCongestionControlGetCongestionWindow = CustomCongestionControlGetCongestionWindow,
+    .QuicCongestionControlGetNetworkStatistics = CustomCongestionControlGetNetworkStatistics,
+    .QuicCongestionControlUninitialize = CustomCongestionControlUninitialize
+};
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+CustomCongestionControlInitialize(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_CONGESTION_CONTROL_PROVIDER* Provider
+    )
+{
+    if (Provider->Create == NULL) {
+        return FALSE;
+    }
+
+    *Cc = QuicCongestionControlCustom;
+    Cc->Name = Provider->Name != NULL ? Provider->Name : "Custom";
+    Cc->UseEct1 = Provider->UseEct1;
+
+    QUIC_CONGESTION_CONTROL_CUSTOM* Custom = &Cc->Custom;
+    Custom->Provider = *Provider;
+
+    QUIC_CONGESTION_CONTROL_STATE State;
+    CustomCongestionControlGetState(Cc, &State);
+    QUIC_STATUS Status = Provider->Create(Provider->Context, &State, &Custom->Instance);
+    if (QUIC_FAILED(Status)) {
+        QuicTraceLogConnWarning(
+            CustomCongestionControlCreateFailed,
+            QuicCongestionControlGetConnection(Cc),
+            "Custom congestion control creation failed, 0x%x",
+            Status);
+        Custom->Instance = NULL;
+        return FALSE;
+    }
+    CXPLAT_DBG_ASSERT(Custom->Instance != NULL);
+
+    CustomCongestionControlUpdateWindow(Cc, &State);
+    Custom->BytesInFlightMax = Custom->CongestionWindow / 2;
+
+    QuicConnLogOutFlowStats(QuicCongestionControlGetConnection(Cc));
+    return TRUE;
+}
@@ -0,0 +1,65 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+--*/
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+typedef struct QUIC_CONGESTION_CONTROL_CUSTOM {
+
+    //
+    // Copy of the application's callbacks, taken when the connection's
+    // congestion control was initialized.
+    //
+    QUIC_CONGESTION_CONTROL_PROVIDER Provider;
+
+    //
+    // The application's per-connection algorithm state.
+    //
+    void* Instance;
+
+    //
+    // The window last reported by the application.
+    //
+    uint32_t CongestionWindow; // bytes
+
+    //
+    // The number of bytes considered to be still in the network.
+    //
+    uint32_t BytesInFlight;
+    uint32_t BytesInFlightMax;
+
+    //
+    // The leftover send allowance from a previous send. Only used when pacing
+    // on behalf of the application.
+    //
+    uint32_t LastSendAllowance; // bytes
+
+    //
+    // A count of packets which can be sent ignoring CongestionWindow.
+    //
+    uint8_t Exemptions;
+
+} QUIC_CONGESTION_CONTROL_CUSTOM;
+
+//
+// Initializes the congestion control with an application supplied provider.
+// Returns FALSE if the provider isn't set or failed to create its
+// per-connection state.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+CustomCongestionControlInitialize(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_CONGESTION_CONTROL_PROVIDER* Provider
+    );
+
+#if defined(__cplusplus)
+}
+#endif
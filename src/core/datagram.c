@@ -16,6 +16,12 @@ Abstract:
 
 #define DATAGRAM_FRAME_HEADER_LENGTH 3
 
+//
+// The longest header of the FEC frames: type (4), group (2), count (1), length
+// XOR (2) and length (2) of a DATAGRAM_FEC_REPAIR frame.
+//
+#define DATAGRAM_FEC_FRAME_HEADER_LENGTH 11
+
 #define QUIC_DATAGRAM_OVERHEAD(CidLength) \
 (\
     MIN_SHORT_HEADER_LENGTH_V1 + \
@@ -23,6 +29,20 @@ Abstract:
     DATAGRAM_FRAME_HEADER_LENGTH \
 )
 
+//
+// Returns TRUE if there are datagrams or an FEC repair frame to send.
+//
+QUIC_INLINE
+BOOLEAN
+QuicDatagramHasDataToSend(
+    _In_ const QUIC_DATAGRAM* Datagram
+    )
+{
+    return
+        Datagram->SendQueue != NULL ||
+        (Datagram->FecEncoder != NULL && Datagram->FecEncoder->RepairPending);
+}
+
 #if DEBUG
 _IRQL_requires_max_(PASSIVE_LEVEL)
 void
@@ -39,17 +59,20 @@ QuicDatagramValidate(
         CXPLAT_DBG_ASSERT(Datagram->SendQueue == NULL);
         CXPLAT_DBG_ASSERT((Connection->Send.SendFlags & QUIC_CONN_SEND_FLAG_DATAGRAM) == 0);
     } else if ((Connection->Send.SendFlags & QUIC_CONN_SEND_FLAG_DATAGRAM) != 0) {
-        CXPLAT_DBG_ASSERT(Datagram->SendQueue != NULL);
+        CXPLAT_DBG_ASSERT(QuicDatagramHasDataToSend(Datagram));
     } else if (Connection->State.PeerTransportParameterValid) {
-        CXPLAT_DBG_ASSERT(Datagram->SendQueue == NULL);
+        CXPLAT_DBG_ASSERT(!QuicDatagramHasDataToSend(Datagram));
     }
 
     if (!Datagram->SendEnabled) {
         CXPLAT_DBG_ASSERT(Datagram->MaxSendLength == 0);
     } else {
         QUIC_SEND_REQUEST* SendRequest = Datagram->SendQueue;
+        uint8_t PriorityClass = QUIC_DATAGRAM_PRIORITY_CLASS_MAX;
         while (SendRequest) {
             CXPLAT_DBG_ASSERT(SendRequest->TotalLength <= (uint64_t)Datagram->MaxSendLength);
+            CXPLAT_DBG_ASSERT(SendRequest->PriorityClass <= PriorityClass);
+            PriorityClass = SendRequest->PriorityClass;
             SendRequest = SendRequest->Next;
         }
     }
@@ -79,8 +102,10 @@ QuicDatagramInitialize(
 {
     Datagram->SendEnabled = TRUE;
     Datagram->MaxSendLength = UINT16_MAX;
-    Datagram->PrioritySendQueueTail = &Datagram->SendQueue;
-    Datagram->SendQueueTail = &Datagram->SendQueue;
+    for (uint32_t i = 0; i < QUIC_DATAGRAM_PRIORITY_CLASS_COUNT; ++i) {
+        Datagram->SendQueueTails[i] = &Datagram->SendQueue;
+    }
+    Datagram->ApiQueueTail = &Datagram->ApiQueue;
     CxPlatDispatchLockInitialize(&Datagram->ApiQueueLock);
     QuicDatagramValidate(Datagram);
 }
@@ -138,6 +163,83 @@ QuicDatagramCompleteSend(
     CxPlatPoolFree(SendRequest);
 }
 
+//
+// Inserts the send request at the end of its priority class.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicDatagramInsertSend(
+    _In_ QUIC_DATAGRAM* Datagram,
+    _In_ QUIC_SEND_REQUEST* SendRequest
+    )
+{
+    CXPLAT_DBG_ASSERT(SendRequest->PriorityClass < QUIC_DATAGRAM_PRIORITY_CLASS_COUNT);
+    QUIC_SEND_REQUEST** Tail = Datagram->SendQueueTails[SendRequest->PriorityClass];
+    SendRequest->Next = *Tail;
+    *Tail = SendRequest;
+
+    //
+    // Lower classes with nothing queued after this point now insert after the
+    // new request too.
+    //
+    for (uint32_t i = 0; i <= SendRequest->PriorityClass; ++i) {
+        if (Datagram->SendQueueTails[i] == Tail) {
+            Datagram->SendQueueTails[i] = &SendRequest->Next;
+        }
+    }
+}
+
+//
+// Removes the send request that Link points to from the send queue.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+QUIC_SEND_REQUEST*
+QuicDatagramRemoveSend(
+    _In_ QUIC_DATAGRAM* Datagram,
+    _In_ QUIC_SEND_REQUEST** Link
+    )
+{
+    QUIC_SEND_REQUEST* SendRequest = *Link;
+    for (uint32_t i = 0; i < QUIC_DATAGRAM_PRIORITY_CLASS_COUNT; ++i) {
+        if (Datagram->SendQueueTails[i] == &SendRequest->Next) {
+            Datagram->SendQueueTails[i] = Link;
+        }
+    }
+    *Link = SendRequest->Next;
+    return SendRequest;
+}
+
+//
+// Returns TRUE if the datagram was queued too long ago to still be sent.
+//
+QUIC_INLINE
+BOOLEAN
+QuicDatagramSendExpired(
+    _In_ const QUIC_SEND_REQUEST* SendRequest,
+    _In_ uint64_t TimeNow
+    )
+{
+    return
+        SendRequest->ExpirationTime != 0 &&
+        CxPlatTimeAtOrBefore64(SendRequest->ExpirationTime, TimeNow);
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicDatagramDropExpiredSend(
+    _In_ QUIC_CONNECTION* Connection,
+    _In_ QUIC_SEND_REQUEST* SendRequest
+    )
+{
+    QuicTraceLogConnVerbose(
+        DatagramSendExpired,
+        Connection,
+        "Datagram [%p] expired before it was sent",
+        SendRequest);
+    Connection->Stats.Send.DatagramExpiredCount++;
+    QuicDatagramCancelSend(Connection, SendRequest);
+}
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 void
 QuicDatagramUninitialize(
@@ -146,9 +248,63 @@ QuicDatagramUninitialize(
 {
     CXPLAT_DBG_ASSERT(Datagram->SendQueue == NULL);
     CXPLAT_DBG_ASSERT(Datagram->ApiQueue == NULL);
+    if (Datagram->FecEncoder != NULL) {
+        CXPLAT_FREE(Datagram->FecEncoder, QUIC_POOL_DATAGRAM_FEC);
+        Datagram->FecEncoder = NULL;
+    }
+    if (Datagram->FecDecoder != NULL) {
+        CXPLAT_FREE(Datagram->FecDecoder, QUIC_POOL_DATAGRAM_FEC);
+        Datagram->FecDecoder = NULL;
+    }
+    if (Datagram->RecvBatch != NULL) {
+        CXPLAT_DBG_ASSERT(Datagram->RecvBatch->Count == 0);
+        CXPLAT_FREE(Datagram->RecvBatch, QUIC_POOL_DATAGRAM_RECV_BATCH);
+        Datagram->RecvBatch = NULL;
+    }
     CxPlatDispatchLockUninitialize(&Datagram->ApiQueueLock);
 }
 
+//
+// XORs Length bytes of Data into Repair, a word at a time.
+//
+QUIC_INLINE
+void
+QuicDatagramFecXor(
+    _Inout_updates_bytes_(Length) uint8_t* Repair,
+    _In_reads_bytes_(Length) const uint8_t* Data,
+    _In_ uint16_t Length
+    )
+{
+    uint16_t i = 0;
+    for (; i + sizeof(uint64_t) <= Length; i += sizeof(uint64_t)) {
+        uint64_t RepairWord, DataWord;
+        CxPlatCopyMemory(&RepairWord, Repair + i, sizeof(RepairWord));
+        CxPlatCopyMemory(&DataWord, Data + i, sizeof(DataWord));
+        RepairWord ^= DataWord;
+        CxPlatCopyMemory(Repair + i, &RepairWord, sizeof(RepairWord));
+    }
+    for (; i < Length; ++i) {
+        Repair[i] ^= Data[i];
+    }
+}
+
+//
+// Starts the next FEC group. The repair data beyond Length is always zero.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicDatagramFecEncoderNextGroup(
+    _Inout_ QUIC_DATAGRAM_FEC_ENCODER* Encoder
+    )
+{
+    CxPlatZeroMemory(Encoder->Repair, Encoder->Length);
+    Encoder->Group = (Encoder->Group + 1) % QUIC_DATAGRAM_FEC_GROUP_WRAP;
+    Encoder->LengthXor = 0;
+    Encoder->Length = 0;
+    Encoder->Count = 0;
+    Encoder->RepairPending = FALSE;
+}
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 void
 QuicDatagramSendShutdown(
@@ -171,9 +327,13 @@ QuicDatagramSendShutdown(
     Datagram->MaxSendLength = 0;
     QUIC_SEND_REQUEST* ApiQueue = Datagram->ApiQueue;
     Datagram->ApiQueue = NULL;
+    Datagram->ApiQueueTail = &Datagram->ApiQueue;
     CxPlatDispatchLockRelease(&Datagram->ApiQueueLock);
 
     QuicSendClearSendFlag(&Connection->Send, QUIC_CONN_SEND_FLAG_DATAGRAM);
+    if (Datagram->FecEncoder != NULL) {
+        QuicDatagramFecEncoderNextGroup(Datagram->FecEncoder);
+    }
 
     //
     // Cancel all outstanding send requests.
@@ -183,8 +343,9 @@ QuicDatagramSendShutdown(
         Datagram->SendQueue = SendRequest->Next;
         QuicDatagramCancelSend(Connection, SendRequest);
     }
-    Datagram->PrioritySendQueueTail = &Datagram->SendQueue;
-    Datagram->SendQueueTail = &Datagram->SendQueue;
+    for (uint32_t i = 0; i < QUIC_DATAGRAM_PRIORITY_CLASS_COUNT; ++i) {
+        Datagram->SendQueueTails[i] = &Datagram->SendQueue;
+    }
 
     while (ApiQueue != NULL) {
         QUIC_SEND_REQUEST* SendRequest = ApiQueue;
@@ -209,19 +370,25 @@ QuicDatagramOnMaxSendLengthChanged(
     QUIC_SEND_REQUEST** SendQueue = &Datagram->SendQueue;
     while (*SendQueue != NULL) {
         if ((*SendQueue)->TotalLength > (uint64_t)Datagram->MaxSendLength) {
-            QUIC_SEND_REQUEST* SendRequest = *SendQueue;
-            if (Datagram->PrioritySendQueueTail == &SendRequest->Next) {
-                Datagram->PrioritySendQueueTail = SendQueue;
-            }
-            *SendQueue = SendRequest->Next;
-            QuicDatagramCancelSend(Connection, SendRequest);
+            QuicDatagramCancelSend(
+                Connection,
+                QuicDatagramRemoveSend(Datagram, SendQueue));
         } else {
             SendQueue = &((*SendQueue)->Next);
         }
     }
-    Datagram->SendQueueTail = SendQueue;
 
-    if (Datagram->SendQueue != NULL) {
+    if (Datagram->FecEncoder != NULL &&
+        (!Datagram->FecSendEnabled ||
+         Datagram->FecEncoder->Length > Datagram->MaxSendLength)) {
+        //
+        // The current group's repair frame might not fit any more either.
+        // Abandon the group.
+        //
+        QuicDatagramFecEncoderNextGroup(Datagram->FecEncoder);
+    }
+
+    if (QuicDatagramHasDataToSend(Datagram)) {
         QuicSendSetSendFlag(&Connection->Send, QUIC_CONN_SEND_FLAG_DATAGRAM);
     } else {
         QuicSendClearSendFlag(&Connection->Send, QUIC_CONN_SEND_FLAG_DATAGRAM);
@@ -250,6 +417,7 @@ QuicDatagramOnSendStateChanged(
     //
 
     BOOLEAN SendEnabled = TRUE;
+    BOOLEAN FecSendEnabled = FALSE;
     uint16_t NewMaxSendLength = UINT16_MAX;
     if (Connection->State.PeerTransportParameterValid) {
         if (!(Connection->PeerTransportParams.Flags & QUIC_TP_FLAG_MAX_DATAGRAM_FRAME_SIZE)) {
@@ -281,6 +449,27 @@ QuicDatagramOnSendStateChanged(
         if (NewMaxSendLength > MtuMaxSendLength) {
             NewMaxSendLength = MtuMaxSendLength;
         }
+
+        if (Connection->Settings.DatagramFecEnabled &&
+            Connection->State.PeerTransportParameterValid &&
+            (Connection->PeerTransportParams.Flags & QUIC_TP_FLAG_DATAGRAM_FEC) &&
+            NewMaxSendLength > DATAGRAM_FEC_FRAME_HEADER_LENGTH) {
+            //
+            // Leave room for the longer headers of the FEC frames.
+            //
+            FecSendEnabled = TRUE;
+            NewMaxSendLength -=
+                DATAGRAM_FEC_FRAME_HEADER_LENGTH - DATAGRAM_FRAME_HEADER_LENGTH;
+        }
+    }
+
+    if (FecSendEnabled != Datagram->FecSendEnabled) {
+        QuicTraceLogConnVerbose(
+            DatagramFecSendEnabled,
+            Connection,
+            "Datagram FEC send enabled = %hhu",
+            FecSendEnabled);
+        Datagram->FecSendEnabled = FecSendEnabled;
     }
 
     if (SendEnabled == Datagram->SendEnabled) {
@@ -322,14 +511,22 @@ _IRQL_requires_max_(DISPATCH_LEVEL)
 QUIC_STATUS
 QuicDatagramQueueSend(
     _In_ QUIC_DATAGRAM* Datagram,
-    _In_ QUIC_SEND_REQUEST* SendRequest
+    _In_ QUIC_SEND_REQUEST* SendRequests
     )
 {
     QUIC_STATUS Status;
     BOOLEAN QueueOper = TRUE;
-    const BOOLEAN IsPriority = !!(SendRequest->Flags & QUIC_SEND_FLAG_PRIORITY_WORK);
+    BOOLEAN IsPriority = FALSE;
     QUIC_CONNECTION* Connection = QuicDatagramGetConnection(Datagram);
 
+    QUIC_SEND_REQUEST** SendRequestsTail = &SendRequests;
+    while (*SendRequestsTail != NULL) {
+        if ((*SendRequestsTail)->Flags & QUIC_SEND_FLAG_PRIORITY_WORK) {
+            IsPriority = TRUE;
+        }
+        SendRequestsTail = &((*SendRequestsTail)->Next);
+    }
+
     CxPlatDispatchLockAcquire(&Datagram->ApiQueueLock);
     if (!Datagram->SendEnabled) {
         QuicTraceEvent(
@@ -339,27 +536,36 @@ QuicDatagramQueueSend(
             "Datagram send while disabled");
         Status = QUIC_STATUS_INVALID_STATE;
     } else {
-        if (SendRequest->TotalLength > (uint64_t)Datagram->MaxSendLength) {
-            QuicTraceEvent(
-                ConnError,
-                "[conn][%p] ERROR, %s.",
-                Connection,
-                "Datagram send request is longer than allowed");
-            Status = QUIC_STATUS_INVALID_PARAMETER;
-        } else {
-            QUIC_SEND_REQUEST** ApiQueueTail = &Datagram->ApiQueue;
-            while (*ApiQueueTail != NULL) {
-                ApiQueueTail = &((*ApiQueueTail)->Next);
+        Status = QUIC_STATUS_SUCCESS;
+        for (QUIC_SEND_REQUEST* SendRequest = SendRequests;
+             SendRequest != NULL;
+             SendRequest = SendRequest->Next) {
+            if (SendRequest->TotalLength > (uint64_t)Datagram->MaxSendLength) {
+                QuicTraceEvent(
+                    ConnError,
+                    "[conn][%p] ERROR, %s.",
+                    Connection,
+                    "Datagram send request is longer than allowed");
+                Status = QUIC_STATUS_INVALID_PARAMETER;
+                break;
+            }
+        }
+        if (QUIC_SUCCEEDED(Status)) {
+            if (Datagram->ApiQueue != NULL) {
                 QueueOper = FALSE; // Not necessary if the previous send hasn't been flushed yet.
             }
-            *ApiQueueTail = SendRequest;
-            Status = QUIC_STATUS_SUCCESS;
+            *Datagram->ApiQueueTail = SendRequests;
+            Datagram->ApiQueueTail = SendRequestsTail;
         }
     }
     CxPlatDispatchLockRelease(&Datagram->ApiQueueLock);
 
     if (QUIC_FAILED(Status)) {
-        CxPlatPoolFree(SendRequest);
+        while (SendRequests != NULL) {
+            QUIC_SEND_REQUEST* SendRequest = SendRequests;
+            SendRequests = SendRequests->Next;
+            CxPlatPoolFree(SendRequest);
+        }
         goto Exit;
     }
 
@@ -409,6 +615,7 @@ QuicDatagramSendFlush(
     CxPlatDispatchLockAcquire(&Datagram->ApiQueueLock);
     QUIC_SEND_REQUEST* ApiQueue = Datagram->ApiQueue;
     Datagram->ApiQueue = NULL;
+    Datagram->ApiQueueTail = &Datagram->ApiQueue;
     CxPlatDispatchLockRelease(&Datagram->ApiQueueLock);
     uint64_t TotalBytesSent = 0;
 
@@ -417,6 +624,7 @@ QuicDatagramSendFlush(
     }
 
     QUIC_CONNECTION* Connection = QuicDatagramGetConnection(Datagram);
+    const uint64_t TimeNow = CxPlatTimeUs64();
     while (ApiQueue != NULL) {
 
         QUIC_SEND_REQUEST* SendRequest = ApiQueue;
@@ -430,19 +638,13 @@ QuicDatagramSendFlush(
             QuicDatagramCancelSend(Connection, SendRequest);
             continue;
         }
+        if (QuicDatagramSendExpired(SendRequest, TimeNow)) {
+            QuicDatagramDropExpiredSend(Connection, SendRequest);
+            continue;
+        }
         TotalBytesSent += SendRequest->TotalLength;
 
-        if (SendRequest->Flags & QUIC_SEND_FLAG_DGRAM_PRIORITY) {
-            SendRequest->Next = *Datagram->PrioritySendQueueTail;
-            *Datagram->PrioritySendQueueTail = SendRequest;
-            if (Datagram->SendQueueTail == Datagram->PrioritySendQueueTail) {
-                Datagram->SendQueueTail = &SendRequest->Next;
-            }
-            Datagram->PrioritySendQueueTail = &SendRequest->Next;
-        } else {
-            *Datagram->SendQueueTail = SendRequest;
-            Datagram->SendQueueTail = &SendRequest->Next;
-        }
+        QuicDatagramInsertSend(Datagram, SendRequest);
 
         QuicTraceLogConnVerbose(
             DatagramSendQueued,
@@ -465,6 +667,87 @@ QuicDatagramSendFlush(
         TotalBytesSent);
 }
 
+//
+// Writes the repair frame of the encoder's completed group. Returns FALSE if
+// there wasn't room for it in the packet.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicDatagramWriteFecRepair(
+    _In_ QUIC_DATAGRAM* Datagram,
+    _Inout_ QUIC_PACKET_BUILDER* Builder
+    )
+{
+    QUIC_CONNECTION* Connection = QuicDatagramGetConnection(Datagram);
+    QUIC_DATAGRAM_FEC_ENCODER* Encoder = Datagram->FecEncoder;
+    CXPLAT_DBG_ASSERT(Encoder->RepairPending);
+
+    QUIC_DATAGRAM_FEC_REPAIR_EX Frame = {
+        Encoder->Group,
+        Encoder->Count,
+        Encoder->LengthXor,
+        Encoder->Length,
+        Encoder->Repair
+    };
+
+    uint16_t AvailableBufferLength =
+        (uint16_t)Builder->Datagram->Length - Builder->EncryptionOverhead;
+
+    if (!QuicDatagramFecRepairFrameEncode(
+            &Frame,
+            &Builder->DatagramLength,
+            AvailableBufferLength,
+            Builder->Datagram->Buffer)) {
+        return FALSE;
+    }
+
+    QuicTraceLogConnVerbose(
+        DatagramFecRepairSent,
+        Connection,
+        "Sent datagram FEC repair for group %hu (%hhu datagrams, %hu bytes)",
+        Encoder->Group,
+        Encoder->Count,
+        Encoder->Length);
+    Connection->Stats.Send.DatagramFecRepairCount++;
+
+    Builder->Metadata->Flags.IsAckEliciting = TRUE;
+    Builder->Metadata->Frames[Builder->Metadata->FrameCount].Type = QUIC_FRAME_DATAGRAM_FEC_REPAIR;
+    QuicDatagramFecEncoderNextGroup(Encoder);
+
+    return TRUE;
+}
+
+//
+// Adds the datagram to the encoder's current group and, if that completes the
+// group, queues its repair frame.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicDatagramFecEncode(
+    _Inout_ QUIC_DATAGRAM_FEC_ENCODER* Encoder,
+    _In_ const QUIC_SEND_REQUEST* SendRequest
+    )
+{
+    CXPLAT_DBG_ASSERT(SendRequest->TotalLength <= QUIC_DATAGRAM_FEC_MAX_LENGTH);
+    uint16_t Length = 0;
+    for (uint32_t i = 0; i < SendRequest->BufferCount; ++i) {
+        QuicDatagramFecXor(
+            Encoder->Repair + Length,
+            SendRequest->Buffers[i].Buffer,
+            (uint16_t)SendRequest->Buffers[i].Length);
+        Length += (uint16_t)SendRequest->Buffers[i].Length;
+    }
+
+    Encoder->LengthXor ^= Length;
+    if (Length > Encoder->Length) {
+        Encoder->Length = Length;
+    }
+    if (++Encoder->Count == QUIC_DATAGRAM_FEC_GROUP_SIZE ||
+        (SendRequest->Flags & QUIC_SEND_FLAG_DGRAM_FEC_FLUSH)) {
+        Encoder->RepairPending = TRUE;
+    }
+}
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 BOOLEAN
 QuicDatagramWriteFrame(
@@ -478,9 +761,59 @@ QuicDatagramWriteFrame(
 
     QuicDatagramValidate(Datagram);
 
-    while (Datagram->SendQueue != NULL) {
+    if (Datagram->FecSendEnabled && Datagram->FecEncoder == NULL) {
+        Datagram->FecEncoder =
+            CXPLAT_ALLOC_NONPAGED(
+                sizeof(QUIC_DATAGRAM_FEC_ENCODER),
+                QUIC_POOL_DATAGRAM_FEC);
+        if (Datagram->FecEncoder == NULL) {
+            //
+            // Fall back to sending the datagrams without protection.
+            //
+            QuicTraceEvent(
+                AllocFailure,
+                "Allocation of '%s' failed. (%llu bytes)",
+                "Datagram FEC encoder",
+                sizeof(QUIC_DATAGRAM_FEC_ENCODER));
+        } else {
+            CxPlatZeroMemory(Datagram->FecEncoder, sizeof(QUIC_DATAGRAM_FEC_ENCODER));
+        }
+    }
+    QUIC_DATAGRAM_FEC_ENCODER* Encoder =
+        Datagram->FecSendEnabled ? Datagram->FecEncoder : NULL;
+    const uint64_t TimeNow = CxPlatTimeUs64();
+
+    while (QuicDatagramHasDataToSend(Datagram)) {
+
+        if (Encoder != NULL && Encoder->RepairPending) {
+            if (Builder->Metadata->Flags.KeyType == QUIC_PACKET_KEY_0_RTT) {
+                Result = FALSE;
+                goto Exit; // FEC is only negotiated for 1-RTT.
+            }
+            if (!QuicDatagramWriteFecRepair(Datagram, Builder)) {
+                Result = TRUE;
+                goto Exit;
+            }
+            if (++Builder->Metadata->FrameCount == QUIC_MAX_FRAMES_PER_PACKET) {
+                Result = TRUE;
+                goto Exit;
+            }
+            continue;
+        }
+
+        if (Datagram->SendQueue == NULL) {
+            break;
+        }
+
         QUIC_SEND_REQUEST* SendRequest = Datagram->SendQueue;
 
+        if (QuicDatagramSendExpired(SendRequest, TimeNow)) {
+            QuicDatagramDropExpiredSend(
+                Connection,
+                QuicDatagramRemoveSend(Datagram, &Datagram->SendQueue));
+            continue;
+        }
+
         if (Builder->Metadata->Flags.KeyType == QUIC_PACKET_KEY_0_RTT &&
             !(SendRequest->Flags & QUIC_SEND_FLAG_ALLOW_0_RTT)) {
             CXPLAT_DBG_ASSERT(FALSE);
@@ -493,14 +826,28 @@ QuicDatagramWriteFrame(
         uint16_t AvailableBufferLength =
             (uint16_t)Builder->Datagram->Length - Builder->EncryptionOverhead;
 
+        BOOLEAN Protect =
+            Encoder != NULL &&
+            Builder->Metadata->Flags.KeyType != QUIC_PACKET_KEY_0_RTT &&
+            SendRequest->TotalLength <= QUIC_DATAGRAM_FEC_MAX_LENGTH;
         BOOLEAN HadRoomForDatagram =
-            QuicDatagramFrameEncodeEx(
-                SendRequest->Buffers,
-                SendRequest->BufferCount,
-                SendRequest->TotalLength,
-                &Builder->DatagramLength,
-                AvailableBufferLength,
-                Builder->Datagram->Buffer);
+            Protect ?
+                QuicDatagramFecSourceFrameEncodeEx(
+                    Encoder->Group,
+                    Encoder->Count,
+                    SendRequest->Buffers,
+                    SendRequest->BufferCount,
+                    SendRequest->TotalLength,
+                    &Builder->DatagramLength,
+                    AvailableBufferLength,
+                    Builder->Datagram->Buffer) :
+                QuicDatagramFrameEncodeEx(
+                    SendRequest->Buffers,
+                    SendRequest->BufferCount,
+                    SendRequest->TotalLength,
+                    &Builder->DatagramLength,
+                    AvailableBufferLength,
+                    Builder->Datagram->Buffer);
         if (!HadRoomForDatagram) {
             //
             // We didn't have room to frame this datagram. This should only
@@ -516,13 +863,11 @@ QuicDatagramWriteFrame(
             goto Exit;
         }
 
-        if (Datagram->PrioritySendQueueTail == &SendRequest->Next) {
-            Datagram->PrioritySendQueueTail = &Datagram->SendQueue;
-        }
-        if (Datagram->SendQueueTail == &SendRequest->Next) {
-            Datagram->SendQueueTail = &Datagram->SendQueue;
+        (void)QuicDatagramRemoveSend(Datagram, &Datagram->SendQueue);
+
+        if (Protect) {
+            QuicDatagramFecEncode(Encoder, SendRequest);
         }
-        Datagram->SendQueue = SendRequest->Next;
 
         Builder->Metadata->Flags.IsAckEliciting = TRUE;
         Builder->Metadata->Frames[Builder->Metadata->FrameCount].Type = QUIC_FRAME_DATAGRAM;
@@ -538,7 +883,7 @@ QuicDatagramWriteFrame(
     }
 
 Exit:
-    if (Datagram->SendQueue == NULL) {
+    if (!QuicDatagramHasDataToSend(Datagram)) {
         Connection->Send.SendFlags &= ~QUIC_CONN_SEND_FLAG_DATAGRAM;
     }
 
@@ -547,50 +892,357 @@ Exit:
     return Result;
 }
 
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicDatagramRecvFlush(
+    _In_ QUIC_DATAGRAM* Datagram
+    )
+{
+    QUIC_DATAGRAM_RECV_BATCH* Batch = Datagram->RecvBatch;
+    if (Batch == NULL || Batch->Count == 0) {
+        return;
+    }
+
+    QUIC_CONNECTION* Connection = QuicDatagramGetConnection(Datagram);
+    uint64_t TotalLength = 0;
+    for (uint32_t i = 0; i < Batch->Count; ++i) {
+        TotalLength += Batch->Buffers[i].Length;
+    }
+
+    QUIC_CONNECTION_EVENT Event;
+    Event.Type = QUIC_CONNECTION_EVENT_DATAGRAMS_RECEIVED;
+    Event.DATAGRAMS_RECEIVED.Buffers = Batch->Buffers;
+    Event.DATAGRAMS_RECEIVED.BufferCount = Batch->Count;
+    Event.DATAGRAMS_RECEIVED.Flags = Batch->Flags;
+
+    //
+    // Reset before indicating, in case the app's callback leads to more
+    // datagrams being processed.
+    //
+    Batch->Count = 0;
+
+    QuicTraceLogConnVerbose(
+        IndicateDatagramsReceived,
+        Connection,
+        "Indicating DATAGRAMS_RECEIVED [count=%u, len=%llu]",
+        Event.DATAGRAMS_RECEIVED.BufferCount,
+        TotalLength);
+    (void)QuicConnIndicateEvent(Connection, &Event);
+
+    QuicPerfCounterAdd(
+        Connection->Partition,
+        QUIC_PERF_COUNTER_APP_RECV_BYTES,
+        TotalLength);
+}
+
+//
+// Adds the datagram to the receive batch. Returns FALSE if batching isn't
+// available, in which case it must be indicated on its own.
+//
 _IRQL_requires_max_(PASSIVE_LEVEL)
 BOOLEAN
-QuicDatagramProcessFrame(
+QuicDatagramRecvBatchAdd(
     _In_ QUIC_DATAGRAM* Datagram,
-    _In_ const QUIC_RX_PACKET* const Packet,
-    _In_ QUIC_FRAME_TYPE FrameType,
-    _In_ uint16_t BufferLength,
-    _In_reads_bytes_(BufferLength)
-        const uint8_t * const Buffer,
-    _Inout_ uint16_t* Offset
+    _In_ QUIC_RECEIVE_FLAGS Flags,
+    _In_ uint16_t Length,
+    _In_reads_bytes_(Length)
+        const uint8_t* Data
     )
 {
-    QUIC_CONNECTION* Connection = QuicDatagramGetConnection(Datagram);
-    CXPLAT_DBG_ASSERT(Connection->Settings.DatagramReceiveEnabled);
+    if (Datagram->RecvBatch == NULL) {
+        Datagram->RecvBatch =
+            CXPLAT_ALLOC_NONPAGED(
+                sizeof(QUIC_DATAGRAM_RECV_BATCH),
+                QUIC_POOL_DATAGRAM_RECV_BATCH);
+        if (Datagram->RecvBatch == NULL) {
+            QuicTraceEvent(
+                AllocFailure,
+                "Allocation of '%s' failed. (%llu bytes)",
+                "Datagram receive batch",
+                sizeof(QUIC_DATAGRAM_RECV_BATCH));
+            return FALSE;
+        }
+        Datagram->RecvBatch->Count = 0;
+    }
 
-    QUIC_DATAGRAM_EX Frame;
-    if (!QuicDatagramFrameDecode(FrameType, BufferLength, Buffer, Offset, &Frame)) {
-        return FALSE;
+    QUIC_DATAGRAM_RECV_BATCH* Batch = Datagram->RecvBatch;
+    if (Batch->Count != 0 && Batch->Flags != Flags) {
+        QuicDatagramRecvFlush(Datagram);
     }
 
+    Batch->Flags = Flags;
+    Batch->Buffers[Batch->Count].Length = Length;
+    Batch->Buffers[Batch->Count].Buffer = (uint8_t*)Data;
+    if (++Batch->Count == QUIC_DATAGRAM_RECV_BATCH_MAX) {
+        QuicDatagramRecvFlush(Datagram);
+    }
+
+    return TRUE;
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicDatagramIndicateReceive(
+    _In_ QUIC_DATAGRAM* Datagram,
+    _In_ const QUIC_RX_PACKET* const Packet,
+    _In_ uint16_t Length,
+    _In_reads_bytes_(Length)
+        const uint8_t* Data
+    )
+{
+    QUIC_CONNECTION* Connection = QuicDatagramGetConnection(Datagram);
+
     // TODO - If we ever limit max receive length, validate it here.
 
-    const QUIC_BUFFER QuicBuffer = { (uint16_t)Frame.Length, (uint8_t*)Frame.Data };
+    const QUIC_RECEIVE_FLAGS Flags =
+        Packet->EncryptedWith0Rtt ? QUIC_RECEIVE_FLAG_0_RTT : QUIC_RECEIVE_FLAG_NONE;
+
+    if (Connection->Settings.DatagramReceiveBatchEnabled &&
+        QuicDatagramRecvBatchAdd(Datagram, Flags, Length, Data)) {
+        return;
+    }
+
+    const QUIC_BUFFER QuicBuffer = { Length, (uint8_t*)Data };
 
     QUIC_CONNECTION_EVENT Event;
     Event.Type = QUIC_CONNECTION_EVENT_DATAGRAM_RECEIVED;
     Event.DATAGRAM_RECEIVED.Buffer = &QuicBuffer;
-    if (Packet->EncryptedWith0Rtt) {
-        Event.DATAGRAM_RECEIVED.Flags = QUIC_RECEIVE_FLAG_0_RTT;
-    } else {
-        Event.DATAGRAM_RECEIVED.Flags = 0;
-    }
+    Event.DATAGRAM_RECEIVED.Flags = Flags;
 
     QuicTraceLogConnVerbose(
         IndicateDatagramReceived,
         Connection,
         "Indicating DATAGRAM_RECEIVED [len=%hu]",
-        (uint16_t)Frame.Length);
+        Length);
     (void)QuicConnIndicateEvent(Connection, &Event);
 
     QuicPerfCounterAdd(
         Connection->Partition,
         QUIC_PERF_COUNTER_APP_RECV_BYTES,
         QuicBuffer.Length);
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicDatagramProcessFrame(
+    _In_ QUIC_DATAGRAM* Datagram,
+    _In_ const QUIC_RX_PACKET* const Packet,
+    _In_ QUIC_FRAME_TYPE FrameType,
+    _In_ uint16_t BufferLength,
+    _In_reads_bytes_(BufferLength)
+        const uint8_t * const Buffer,
+    _Inout_ uint16_t* Offset
+    )
+{
+    CXPLAT_DBG_ASSERT(QuicDatagramGetConnection(Datagram)->Settings.DatagramReceiveEnabled);
+
+    QUIC_DATAGRAM_EX Frame;
+    if (!QuicDatagramFrameDecode(FrameType, BufferLength, Buffer, Offset, &Frame)) {
+        return FALSE;
+    }
+
+    QuicDatagramIndicateReceive(
+        Datagram, Packet, (uint16_t)Frame.Length, Frame.Data);
+
+    return TRUE;
+}
+
+//
+// Returns the receive state for the group, or NULL if the group is older than
+// the ones being tracked (or the state couldn't be allocated).
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+QUIC_DATAGRAM_FEC_GROUP*
+QuicDatagramFecGetGroup(
+    _In_ QUIC_DATAGRAM* Datagram,
+    _In_ uint16_t GroupNumber
+    )
+{
+    if (Datagram->FecDecoder == NULL) {
+        Datagram->FecDecoder =
+            CXPLAT_ALLOC_NONPAGED(
+                sizeof(QUIC_DATAGRAM_FEC_DECODER),
+                QUIC_POOL_DATAGRAM_FEC);
+        if (Datagram->FecDecoder == NULL) {
+            QuicTraceEvent(
+                AllocFailure,
+                "Allocation of '%s' failed. (%llu bytes)",
+                "Datagram FEC decoder",
+                sizeof(QUIC_DATAGRAM_FEC_DECODER));
+            return NULL;
+        }
+        CxPlatZeroMemory(Datagram->FecDecoder, sizeof(QUIC_DATAGRAM_FEC_DECODER));
+    }
+
+    QUIC_DATAGRAM_FEC_GROUP* Group =
+        &Datagram->FecDecoder->Groups[GroupNumber & 1];
+    if (Group->InUse) {
+        if (Group->Group == GroupNumber) {
+            return Group;
+        }
+        uint16_t Diff =
+            (uint16_t)(GroupNumber - Group->Group) % QUIC_DATAGRAM_FEC_GROUP_WRAP;
+        if (Diff >= QUIC_DATAGRAM_FEC_GROUP_WRAP / 2) {
+            return NULL; // Older group.
+        }
+        CxPlatZeroMemory(Group->Data, Group->Length);
+    }
+
+    Group->Group = GroupNumber;
+    Group->LengthXor = 0;
+    Group->Length = 0;
+    Group->Count = 0;
+    Group->SourceCount = 0;
+    Group->ReceivedMask = 0;
+    Group->InUse = TRUE;
+    Group->Complete = FALSE;
+
+    return Group;
+}
+
+//
+// XORs a datagram or repair payload into the group's state.
+//
+QUIC_INLINE
+void
+QuicDatagramFecGroupAdd(
+    _Inout_ QUIC_DATAGRAM_FEC_GROUP* Group,
+    _In_ uint16_t Length,
+    _In_reads_bytes_(Length)
+        const uint8_t* Data
+    )
+{
+    QuicDatagramFecXor(Group->Data, Data, Length);
+    if (Length > Group->Length) {
+        Group->Length = Length;
+    }
+}
+
+//
+// Recovers the group's missing datagram, if exactly one is missing and the
+// repair has been received.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicDatagramFecTryRecover(
+    _In_ QUIC_DATAGRAM* Datagram,
+    _In_ const QUIC_RX_PACKET* const Packet,
+    _Inout_ QUIC_DATAGRAM_FEC_GROUP* Group
+    )
+{
+    if (Group->SourceCount == 0) {
+        return; // No repair yet.
+    }
+
+    if (Group->Count >= Group->SourceCount) {
+        Group->Complete = TRUE; // Nothing was lost.
+        return;
+    }
+
+    if (Group->Count + 1 != Group->SourceCount) {
+        return; // Too many losses to recover (yet).
+    }
+
+    Group->Complete = TRUE;
+    if (Group->LengthXor > Group->Length) {
+        return; // The peer sent inconsistent lengths.
+    }
+    Group->ReceivedMask = (uint32_t)((1ull << Group->SourceCount) - 1);
+
+    QUIC_CONNECTION* Connection = QuicDatagramGetConnection(Datagram);
+    QuicTraceLogConnVerbose(
+        DatagramFecRecovered,
+        Connection,
+        "Recovered datagram from FEC group %hu [len=%hu]",
+        Group->Group,
+        Group->LengthXor);
+    Connection->Stats.Recv.DatagramFecRecoveredCount++;
+
+    QuicDatagramIndicateReceive(
+        Datagram, Packet, Group->LengthXor, Group->Data);
+
+    //
+    // The group's state is reused by later frames, so the recovered datagram
+    // can't wait for the end of the receive batch.
+    //
+    QuicDatagramRecvFlush(Datagram);
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicDatagramProcessFecFrame(
+    _In_ QUIC_DATAGRAM* Datagram,
+    _In_ const QUIC_RX_PACKET* const Packet,
+    _In_ QUIC_FRAME_TYPE FrameType,
+    _In_ uint16_t BufferLength,
+    _In_reads_bytes_(BufferLength)
+        const uint8_t * const Buffer,
+    _Inout_ uint16_t* Offset
+    )
+{
+    CXPLAT_DBG_ASSERT(QuicDatagramGetConnection(Datagram)->Settings.DatagramReceiveEnabled);
+    QUIC_DATAGRAM_FEC_GROUP* Group;
+
+    if (FrameType == QUIC_FRAME_DATAGRAM_FEC_SOURCE) {
+        QUIC_DATAGRAM_FEC_SOURCE_EX Frame;
+        if (!QuicDatagramFecSourceFrameDecode(BufferLength, Buffer, Offset, &Frame) ||
+            Frame.Group >= QUIC_DATAGRAM_FEC_GROUP_WRAP ||
+            Frame.Index >= QUIC_DATAGRAM_FEC_MAX_GROUP_SIZE) {
+            return FALSE;
+        }
+
+        if (Frame.Length > QUIC_DATAGRAM_FEC_MAX_LENGTH ||
+            (Group = QuicDatagramFecGetGroup(Datagram, (uint16_t)Frame.Group)) == NULL) {
+            //
+            // Too large or too old to help recover anything. Just deliver it.
+            //
+            QuicDatagramIndicateReceive(
+                Datagram, Packet, (uint16_t)Frame.Length, Frame.Data);
+            return TRUE;
+        }
+
+        const uint32_t Bit = 1u << Frame.Index;
+        if (Group->ReceivedMask & Bit) {
+            return TRUE; // Already delivered (or recovered).
+        }
+        Group->ReceivedMask |= Bit;
+
+        if (!Group->Complete) {
+            QuicDatagramFecGroupAdd(Group, (uint16_t)Frame.Length, Frame.Data);
+            Group->LengthXor ^= (uint16_t)Frame.Length;
+            Group->Count++;
+        }
+
+        QuicDatagramIndicateReceive(
+            Datagram, Packet, (uint16_t)Frame.Length, Frame.Data);
+
+        if (!Group->Complete) {
+            QuicDatagramFecTryRecover(Datagram, Packet, Group);
+        }
+
+    } else {
+        CXPLAT_DBG_ASSERT(FrameType == QUIC_FRAME_DATAGRAM_FEC_REPAIR);
+        QUIC_DATAGRAM_FEC_REPAIR_EX Frame;
+        if (!QuicDatagramFecRepairFrameDecode(BufferLength, Buffer, Offset, &Frame) ||
+            Frame.Group >= QUIC_DATAGRAM_FEC_GROUP_WRAP ||
+            Frame.Count == 0 ||
+            Frame.Count > QUIC_DATAGRAM_FEC_MAX_GROUP_SIZE ||
+            Frame.LengthXor > UINT16_MAX) {
+            return FALSE;
+        }
+
+        if (Frame.Length > QUIC_DATAGRAM_FEC_MAX_LENGTH ||
+            (Group = QuicDatagramFecGetGroup(Datagram, (uint16_t)Frame.Group)) == NULL ||
+            Group->SourceCount != 0 ||
+            Group->Complete) {
+            return TRUE; // Nothing to recover with it.
+        }
+
+        Group->SourceCount = (uint8_t)Frame.Count;
+        QuicDatagramFecGroupAdd(Group, (uint16_t)Frame.Length, Frame.Data);
+        Group->LengthXor ^= (uint16_t)Frame.LengthXor;
+        QuicDatagramFecTryRecover(Datagram, Packet, Group);
+    }
 
     return TRUE;
 }
@@ -610,20 +1262,15 @@ QuicDatagramCancelBlocked(
 
     do {
         if ((*SendQueue)->Flags & QUIC_SEND_FLAG_CANCEL_ON_BLOCKED) {
-            QUIC_SEND_REQUEST* SendRequest = *SendQueue;
-            if (Datagram->PrioritySendQueueTail == &SendRequest->Next) {
-                Datagram->PrioritySendQueueTail = SendQueue;
-            }
-            *SendQueue = SendRequest->Next;
-            QuicDatagramCancelSend(Connection, SendRequest);
+            QuicDatagramCancelSend(
+                Connection,
+                QuicDatagramRemoveSend(Datagram, SendQueue));
         } else {
             SendQueue = &((*SendQueue)->Next);
         }
     } while (*SendQueue != NULL);
 
-    Datagram->SendQueueTail = SendQueue;
-
-    if (Datagram->SendQueue != NULL) {
+    if (QuicDatagramHasDataToSend(Datagram)) {
         QuicSendSetSendFlag(&Connection->Send, QUIC_CONN_SEND_FLAG_DATAGRAM);
     } else {
         QuicSendClearSendFlag(&Connection->Send, QUIC_CONN_SEND_FLAG_DATAGRAM);
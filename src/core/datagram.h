@@ -5,14 +5,82 @@
 
 --*/
 
+#define QUIC_DATAGRAM_PRIORITY_CLASS_COUNT (QUIC_DATAGRAM_PRIORITY_CLASS_MAX + 1)
+
+//
+// Forward error correction state for sent datagrams: the XOR of the datagrams
+// (zero padded to the longest) and of their lengths in the current group.
+//
+typedef struct QUIC_DATAGRAM_FEC_ENCODER {
+
+    uint16_t Group;
+    uint16_t LengthXor;
+    uint16_t Length;
+    uint8_t Count;
+
+    //
+    // The group is complete and its repair frame still needs to be sent.
+    //
+    BOOLEAN RepairPending;
+
+    uint8_t Repair[QUIC_DATAGRAM_FEC_MAX_LENGTH];
+
+} QUIC_DATAGRAM_FEC_ENCODER;
+
+//
+// Forward error correction state for one group of received datagrams. The
+// XOR of the datagrams (and repair) received so far. Once all but one of
+// the group's datagrams and the repair have been received, it is the missing
+// datagram.
+//
+typedef struct QUIC_DATAGRAM_FEC_GROUP {
+
+    uint16_t Group;
+    uint16_t LengthXor;
+    uint16_t Length;
+    uint8_t Count;          // Datagrams received.
+    uint8_t SourceCount;    // Datagrams in the group; 0 until the repair is received.
+    uint32_t ReceivedMask;  // Indexes of the datagrams received or recovered.
+    BOOLEAN InUse : 1;
+    BOOLEAN Complete : 1;
+
+    uint8_t Data[QUIC_DATAGRAM_FEC_MAX_LENGTH];
+
+} QUIC_DATAGRAM_FEC_GROUP;
+
+//
+// The receiver tracks the two most recent groups, which covers a repair frame
+// arriving after the next group started.
+//
+typedef struct QUIC_DATAGRAM_FEC_DECODER {
+
+    QUIC_DATAGRAM_FEC_GROUP Groups[2];
+
+} QUIC_DATAGRAM_FEC_DECODER;
+
+//
+// Received datagrams waiting to be indicated together at the end of the
+// receive batch. The buffers point into the received packets, which stay
+// valid until then.
+//
+typedef struct QUIC_DATAGRAM_RECV_BATCH {
+
+    QUIC_RECEIVE_FLAGS Flags;
+    uint32_t Count;
+    QUIC_BUFFER Buffers[QUIC_DATAGRAM_RECV_BATCH_MAX];
+
+} QUIC_DATAGRAM_RECV_BATCH;
+
 typedef struct QUIC_DATAGRAM {
 
     //
-    // Datagram send queue.
+    // Datagram send queue, ordered by priority class (highest first) and then
+    // by submission. SendQueueTails[i] is where the next datagram of class i
+    // is inserted, after the last queued datagram of class i or higher, so
+    // SendQueueTails[0] is the tail of the whole queue.
     //
     QUIC_SEND_REQUEST* SendQueue;
-    QUIC_SEND_REQUEST** PrioritySendQueueTail;
-    QUIC_SEND_REQUEST** SendQueueTail;
+    QUIC_SEND_REQUEST** SendQueueTails[QUIC_DATAGRAM_PRIORITY_CLASS_COUNT];
 
     //
     // API calls to DatagramSend queue the send request here and then queue the
@@ -20,6 +88,7 @@ typedef struct QUIC_DATAGRAM {
     // send queue.
     //
     QUIC_SEND_REQUEST* ApiQueue;
+    QUIC_SEND_REQUEST** ApiQueueTail;
     CXPLAT_DISPATCH_LOCK ApiQueueLock;
 
     //
@@ -38,6 +107,23 @@ typedef struct QUIC_DATAGRAM {
     //
     BOOLEAN SendEnabled : 1;
 
+    //
+    // Indicates that sent datagrams are protected by FEC repair frames. Both
+    // endpoints enabled FEC and the peer receives datagrams.
+    //
+    BOOLEAN FecSendEnabled : 1;
+
+    //
+    // Forward error correction state, allocated on first use.
+    //
+    QUIC_DATAGRAM_FEC_ENCODER* FecEncoder;
+    QUIC_DATAGRAM_FEC_DECODER* FecDecoder;
+
+    //
+    // Batched receive indication state, allocated on first use.
+    //
+    QUIC_DATAGRAM_RECV_BATCH* RecvBatch;
+
 } QUIC_DATAGRAM;
 
 _IRQL_requires_max_(PASSIVE_LEVEL)
@@ -64,11 +150,15 @@ QuicDatagramOnSendStateChanged(
     _In_ QUIC_DATAGRAM* Datagram
     );
 
+//
+// Queues a list of send requests, linked by their Next pointers. Either all
+// of them are queued or, on failure, all of them are freed.
+//
 _IRQL_requires_max_(DISPATCH_LEVEL)
 QUIC_STATUS
 QuicDatagramQueueSend(
     _In_ QUIC_DATAGRAM* Datagram,
-    _In_ QUIC_SEND_REQUEST* SendRequest
+    _In_ QUIC_SEND_REQUEST* SendRequests
     );
 
 _IRQL_requires_max_(PASSIVE_LEVEL)
@@ -104,6 +194,27 @@ QuicDatagramProcessFrame(
     _Inout_ uint16_t* Offset
     );
 
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicDatagramProcessFecFrame(
+    _In_ QUIC_DATAGRAM* Datagram,
+    _In_ const QUIC_RX_PACKET* const Packet,
+    _In_ QUIC_FRAME_TYPE FrameType,
+    _In_ uint16_t BufferLength,
+    _In_reads_bytes_(BufferLength)
+        const uint8_t * const Buffer,
+    _Inout_ uint16_t* Offset
+    );
+
+//
+// Indicates any received datagrams still waiting in the receive batch.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicDatagramRecvFlush(
+    _In_ QUIC_DATAGRAM* Datagram
+    );
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 void
 QuicDatagramCancelBlocked(
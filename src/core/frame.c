@@ -1234,6 +1234,128 @@ QuicDatagramFrameDecode(
     return TRUE;
 }
 
+_Success_(return != FALSE)
+BOOLEAN
+QuicDatagramFecSourceFrameEncodeEx(
+    _In_ uint16_t Group,
+    _In_ uint8_t Index,
+    _In_reads_(BufferCount)
+        const QUIC_BUFFER* const Buffers,
+    _In_ uint32_t BufferCount,
+    _In_ uint64_t TotalLength,
+    _Inout_ uint16_t* Offset,
+    _In_ uint16_t BufferLength,
+    _Out_writes_to_(BufferLength, *Offset)
+        uint8_t* Buffer
+    )
+{
+    uint16_t RequiredLength =
+        QuicVarIntSize(QUIC_FRAME_DATAGRAM_FEC_SOURCE) +
+        QuicVarIntSize(Group) +
+        QuicVarIntSize(Index) +
+        QuicVarIntSize(TotalLength) +
+        (uint16_t)TotalLength;
+
+    if (BufferLength < *Offset + RequiredLength) {
+        return FALSE;
+    }
+
+    Buffer = Buffer + *Offset;
+    Buffer = QuicVarIntEncode(QUIC_FRAME_DATAGRAM_FEC_SOURCE, Buffer);
+    Buffer = QuicVarIntEncode(Group, Buffer);
+    Buffer = QuicVarIntEncode(Index, Buffer);
+    Buffer = QuicVarIntEncode(TotalLength, Buffer);
+    for (uint32_t i = 0; i < BufferCount; ++i) {
+        if (Buffers[i].Length != 0) {
+            CxPlatCopyMemory(Buffer, Buffers[i].Buffer, Buffers[i].Length);
+            Buffer += Buffers[i].Length;
+        }
+    }
+
+    *Offset += RequiredLength;
+
+    return TRUE;
+}
+
+_Success_(return != FALSE)
+BOOLEAN
+QuicDatagramFecSourceFrameDecode(
+    _In_ uint16_t BufferLength,
+    _In_reads_bytes_(BufferLength)
+        const uint8_t * const Buffer,
+    _Deref_in_range_(0, BufferLength)
+    _Inout_ uint16_t* Offset,
+    _Out_ QUIC_DATAGRAM_FEC_SOURCE_EX* Frame
+    )
+{
+    if (!QuicVarIntDecode(BufferLength, Buffer, Offset, &Frame->Group) ||
+        !QuicVarIntDecode(BufferLength, Buffer, Offset, &Frame->Index) ||
+        !QuicVarIntDecode(BufferLength, Buffer, Offset, &Frame->Length) ||
+        BufferLength < Frame->Length + *Offset) {
+        return FALSE;
+    }
+    Frame->Data = Buffer + *Offset;
+    *Offset += (uint16_t)Frame->Length;
+    return TRUE;
+}
+
+_Success_(return != FALSE)
+BOOLEAN
+QuicDatagramFecRepairFrameEncode(
+    _In_ const QUIC_DATAGRAM_FEC_REPAIR_EX * const Frame,
+    _Inout_ uint16_t* Offset,
+    _In_ uint16_t BufferLength,
+    _Out_writes_to_(BufferLength, *Offset)
+        uint8_t* Buffer
+    )
+{
+    uint16_t RequiredLength =
+        QuicVarIntSize(QUIC_FRAME_DATAGRAM_FEC_REPAIR) +
+        QuicVarIntSize(Frame->Group) +
+        QuicVarIntSize(Frame->Count) +
+        QuicVarIntSize(Frame->LengthXor) +
+        QuicVarIntSize(Frame->Length) +
+        (uint16_t)Frame->Length;
+
+    if (BufferLength < *Offset + RequiredLength) {
+        return FALSE;
+    }
+
+    Buffer = Buffer + *Offset;
+    Buffer = QuicVarIntEncode(QUIC_FRAME_DATAGRAM_FEC_REPAIR, Buffer);
+    Buffer = QuicVarIntEncode(Frame->Group, Buffer);
+    Buffer = QuicVarIntEncode(Frame->Count, Buffer);
+    Buffer = QuicVarIntEncode(Frame->LengthXor, Buffer);
+    Buffer = QuicVarIntEncode(Frame->Length, Buffer);
+    CxPlatCopyMemory(Buffer, Frame->Data, (size_t)Frame->Length);
+    *Offset += RequiredLength;
+
+    return TRUE;
+}
+
+_Success_(return != FALSE)
+BOOLEAN
+QuicDatagramFecRepairFrameDecode(
+    _In_ uint16_t BufferLength,
+    _In_reads_bytes_(BufferLength)
+        const uint8_t * const Buffer,
+    _Deref_in_range_(0, BufferLength)
+    _Inout_ uint16_t* Offset,
+    _Out_ QUIC_DATAGRAM_FEC_REPAIR_EX* Frame
+    )
+{
+    if (!QuicVarIntDecode(BufferLength, Buffer, Offset, &Frame->Group) ||
+        !QuicVarIntDecode(BufferLength, Buffer, Offset, &Frame->Count) ||
+        !QuicVarIntDecode(BufferLength, Buffer, Offset, &Frame->LengthXor) ||
+        !QuicVarIntDecode(BufferLength, Buffer, Offset, &Frame->Length) ||
+        BufferLength < Frame->Length + *Offset) {
+        return FALSE;
+    }
+    Frame->Data = Buffer + *Offset;
+    *Offset += (uint16_t)Frame->Length;
+    return TRUE;
+}
+
 _Success_(return != FALSE)
 BOOLEAN
 QuicAckFrequencyFrameEncode(
@@ -1926,6 +2048,52 @@ QuicFrameLog(
         break;
     }
 
+    case QUIC_FRAME_DATAGRAM_FEC_SOURCE: {
+        QUIC_DATAGRAM_FEC_SOURCE_EX Frame;
+        if (!QuicDatagramFecSourceFrameDecode(PacketLength, Packet, Offset, &Frame)) {
+            QuicTraceLogVerbose(
+                FrameLogDatagramFecSourceInvalid,
+                "[%c][%cX][%llu]   DATAGRAM_FEC_SOURCE [Invalid]",
+                PtkConnPre(Connection),
+                PktRxPre(Rx),
+                PacketNumber);
+            return FALSE;
+        }
+        QuicTraceLogVerbose(
+            FrameLogDatagramFecSource,
+            "[%c][%cX][%llu]   DATAGRAM_FEC_SOURCE Group:%llu Index:%llu Len:%hu",
+            PtkConnPre(Connection),
+            PktRxPre(Rx),
+            PacketNumber,
+            Frame.Group,
+            Frame.Index,
+            (uint16_t)Frame.Length);
+        break;
+    }
+
+    case QUIC_FRAME_DATAGRAM_FEC_REPAIR: {
+        QUIC_DATAGRAM_FEC_REPAIR_EX Frame;
+        if (!QuicDatagramFecRepairFrameDecode(PacketLength, Packet, Offset, &Frame)) {
+            QuicTraceLogVerbose(
+                FrameLogDatagramFecRepairInvalid,
+                "[%c][%cX][%llu]   DATAGRAM_FEC_REPAIR [Invalid]",
+                PtkConnPre(Connection),
+                PktRxPre(Rx),
+                PacketNumber);
+            return FALSE;
+        }
+        QuicTraceLogVerbose(
+            FrameLogDatagramFecRepair,
+            "[%c][%cX][%llu]   DATAGRAM_FEC_REPAIR Group:%llu Count:%llu Len:%hu",
+            PtkConnPre(Connection),
+            PktRxPre(Rx),
+            PacketNumber,
+            Frame.Group,
+            Frame.Count,
+            (uint16_t)Frame.Length);
+        break;
+    }
+
     case QUIC_FRAME_ACK_FREQUENCY: {
         QUIC_ACK_FREQUENCY_EX Frame;
         if (!QuicAckFrequencyFrameDecode(PacketLength, Packet, Offset, &Frame)) {
@@ -159,6 +159,9 @@ typedef enum QUIC_FRAME_TYPE {
     QUIC_FRAME_IMMEDIATE_ACK        = 0x1fULL,
     /* 0xaf to 0x2f4 are unused currently */
     QUIC_FRAME_TIMESTAMP            = 0x2f5ULL,
+    /* 0x2f6 to 0xfebf are unused currently */
+    QUIC_FRAME_DATAGRAM_FEC_SOURCE  = 0xfec0ULL, // Private, see docs/PreviewFeatures.md
+    QUIC_FRAME_DATAGRAM_FEC_REPAIR  = 0xfec1ULL, // Private, see docs/PreviewFeatures.md
 
     QUIC_FRAME_MAX_SUPPORTED
 
@@ -177,7 +180,8 @@ CXPLAT_STATIC_ASSERT(
      (X >= QUIC_FRAME_DATAGRAM && X <= QUIC_FRAME_DATAGRAM_1) || \
       X == QUIC_FRAME_ACK_FREQUENCY || X == QUIC_FRAME_IMMEDIATE_ACK || \
       X == QUIC_FRAME_RELIABLE_RESET_STREAM || \
-      X == QUIC_FRAME_TIMESTAMP \
+      X == QUIC_FRAME_TIMESTAMP || \
+      X == QUIC_FRAME_DATAGRAM_FEC_SOURCE || X == QUIC_FRAME_DATAGRAM_FEC_REPAIR \
     )
 
 //
@@ -841,6 +845,82 @@ QuicDatagramFrameDecode(
     _Out_ QUIC_DATAGRAM_EX* Frame
     );
 
+//
+// QUIC_FRAME_DATAGRAM_FEC_SOURCE Encoding/Decoding
+//
+
+typedef struct QUIC_DATAGRAM_FEC_SOURCE_EX {
+
+    QUIC_VAR_INT Group;
+    QUIC_VAR_INT Index;
+    QUIC_VAR_INT Length;
+    _Field_size_bytes_(Length)
+    const uint8_t* Data;
+
+} QUIC_DATAGRAM_FEC_SOURCE_EX;
+
+_Success_(return != FALSE)
+BOOLEAN
+QuicDatagramFecSourceFrameEncodeEx(
+    _In_ uint16_t Group,
+    _In_ uint8_t Index,
+    _In_reads_(BufferCount)
+        const QUIC_BUFFER* const Buffers,
+    _In_ uint32_t BufferCount,
+    _In_ uint64_t TotalLength,
+    _Inout_ uint16_t* Offset,
+    _In_ uint16_t BufferLength,
+    _Out_writes_to_(BufferLength, *Offset)
+        uint8_t* Buffer
+    );
+
+_Success_(return != FALSE)
+BOOLEAN
+QuicDatagramFecSourceFrameDecode(
+    _In_ uint16_t BufferLength,
+    _In_reads_bytes_(BufferLength)
+        const uint8_t * const Buffer,
+    _Deref_in_range_(0, BufferLength)
+    _Inout_ uint16_t* Offset,
+    _Out_ QUIC_DATAGRAM_FEC_SOURCE_EX* Frame
+    );
+
+//
+// QUIC_FRAME_DATAGRAM_FEC_REPAIR Encoding/Decoding
+//
+
+typedef struct QUIC_DATAGRAM_FEC_REPAIR_EX {
+
+    QUIC_VAR_INT Group;
+    QUIC_VAR_INT Count;     // Number of source datagrams in the group
+    QUIC_VAR_INT LengthXor; // XOR of the lengths of the source datagrams
+    QUIC_VAR_INT Length;
+    _Field_size_bytes_(Length)
+    const uint8_t* Data;    // XOR of the (zero padded) source datagrams
+
+} QUIC_DATAGRAM_FEC_REPAIR_EX;
+
+_Success_(return != FALSE)
+BOOLEAN
+QuicDatagramFecRepairFrameEncode(
+    _In_ const QUIC_DATAGRAM_FEC_REPAIR_EX * const Frame,
+    _Inout_ uint16_t* Offset,
+    _In_ uint16_t BufferLength,
+    _Out_writes_to_(BufferLength, *Offset)
+        uint8_t* Buffer
+    );
+
+_Success_(return != FALSE)
+BOOLEAN
+QuicDatagramFecRepairFrameDecode(
+    _In_ uint16_t BufferLength,
+    _In_reads_bytes_(BufferLength)
+        const uint8_t * const Buffer,
+    _Deref_in_range_(0, BufferLength)
+    _Inout_ uint16_t* Offset,
+    _Out_ QUIC_DATAGRAM_FEC_REPAIR_EX* Frame
+    );
+
 //
 // QUIC_ACK_FREQUENCY Encoding/Decoding
 //
@@ -507,6 +507,8 @@ MsQuicLibraryInitialize(
     MsQuicLib.ToeplitzHash.InputSize = CXPLAT_TOEPLITZ_INPUT_SIZE_QUIC;
     CxPlatToeplitzHashInitialize(&MsQuicLib.ToeplitzHash);
 
+    CxPlatRandom(sizeof(MsQuicLib.ReplayFilterKey), MsQuicLib.ReplayFilterKey);
+
     CxPlatDispatchRwLockInitialize(&MsQuicLib.StatelessRetry.Lock);
 
     CxPlatZeroMemory(&MsQuicLib.Settings, sizeof(MsQuicLib.Settings));
@@ -515,6 +517,7 @@ MsQuicLibraryInitialize(
     MsQuicLib.RegistrationCloseCleanupShutdown = FALSE;
     CxPlatListInitializeHead(&MsQuicLib.RegistrationCloseCleanupList);
     CxPlatRundownInitialize(&MsQuicLib.RegistrationCloseCleanupRundown);
+    QuicCryptoPoolInitialize(&MsQuicLib.CryptoPool);
 
     PlatformInitialized = TRUE;
 
@@ -622,6 +625,7 @@ Error:
             MsQuicLib.DefaultCompatibilityList = NULL;
         }
         if (PlatformInitialized) {
+            QuicCryptoPoolUninitialize(&MsQuicLib.CryptoPool);
             CxPlatRundownUninitialize(&MsQuicLib.RegistrationCloseCleanupRundown);
             CxPlatEventUninitialize(MsQuicLib.RegistrationCloseCleanupEvent);
             CxPlatLockUninitialize(&MsQuicLib.RegistrationCloseCleanupLock);
@@ -732,6 +736,12 @@ MsQuicLibraryUninitialize(
 
     MsQuicLibraryLazyUninitialize();
 
+    //
+    // All connections are gone, so there is no more TLS work for the crypto
+    // pool.
+    //
+    QuicCryptoPoolUninitialize(&MsQuicLib.CryptoPool);
+
     if (MsQuicLib.Storage != NULL) {
         CxPlatStorageClose(MsQuicLib.Storage);
         MsQuicLib.Storage = NULL;
@@ -1430,6 +1440,79 @@ QuicLibrarySetGlobalParam(
         break;
     }
 
+    case QUIC_PARAM_GLOBAL_SEND_BUFFER_BUDGET:
+
+        if (BufferLength != sizeof(MsQuicLib.SendBufferBudget) || Buffer == NULL) {
+            Status = QUIC_STATUS_INVALID_PARAMETER;
+            break;
+        }
+
+        MsQuicLib.SendBufferBudget = *(uint64_t*)Buffer;
+
+        QuicTraceLogInfo(
+            LibrarySendBufferBudgetSet,
+            "[ lib] Updated send buffer budget = %llu",
+            MsQuicLib.SendBufferBudget);
+
+        Status = QUIC_STATUS_SUCCESS;
+        break;
+
+    case QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT:
+
+        if (BufferLength != sizeof(MsQuicLib.RecvMemoryPercent) || Buffer == NULL) {
+            Status = QUIC_STATUS_INVALID_PARAMETER;
+            break;
+        }
+
+        MsQuicLib.RecvMemoryPercent = *(uint16_t*)Buffer;
+        MsQuicLib.RecvMemoryLimit =
+            (MsQuicLib.RecvMemoryPercent * CxPlatTotalMemory) / UINT16_MAX;
+
+        QuicTraceLogInfo(
+            LibraryRecvMemoryLimitSet,
+            "[ lib] Updated receive memory limit = %llu bytes",
+            MsQuicLib.RecvMemoryLimit);
+
+        Status = QUIC_STATUS_SUCCESS;
+        break;
+
+    case QUIC_PARAM_GLOBAL_CONGESTION_CONTROL_PROVIDER: {
+
+        if (BufferLength != sizeof(QUIC_CONGESTION_CONTROL_PROVIDER) || Buffer == NULL) {
+            Status = QUIC_STATUS_INVALID_PARAMETER;
+            break;
+        }
+
+        const QUIC_CONGESTION_CONTROL_PROVIDER* Provider =
+            (const QUIC_CONGESTION_CONTROL_PROVIDER*)Buffer;
+        if (Provider->Create == NULL ||
+            Provider->Delete == NULL ||
+            Provider->GetCongestionWindow == NULL ||
+            Provider->OnDataAcknowledged == NULL ||
+            Provider->OnDataLost == NULL) {
+            Status = QUIC_STATUS_INVALID_PARAMETER;
+            break;
+        }
+
+        if (MsQuicLib.InUse) {
+            QuicTraceLogError(
+                LibraryCongestionControlProviderSetAfterInUse,
+                "[ lib] Tried to change congestion control provider after library in use!");
+            Status = QUIC_STATUS_INVALID_STATE;
+            break;
+        }
+
+        MsQuicLib.CongestionControlProvider = *Provider;
+
+        QuicTraceLogInfo(
+            LibraryCongestionControlProviderSet,
+            "[ lib] Updated congestion control provider = %s",
+            Provider->Name != NULL ? Provider->Name : "Custom");
+
+        Status = QUIC_STATUS_SUCCESS;
+        break;
+    }
+
     default:
         Status = QUIC_STATUS_INVALID_PARAMETER;
         break;
@@ -1728,7 +1811,11 @@ QuicLibraryGetGlobalParam(
             QUIC_STATISTICS_V2_SIZE_1,
             QUIC_STATISTICS_V2_SIZE_2,
             QUIC_STATISTICS_V2_SIZE_3,
-            QUIC_STATISTICS_V2_SIZE_4
+            QUIC_STATISTICS_V2_SIZE_4,
+            QUIC_STATISTICS_V2_SIZE_5,
+            QUIC_STATISTICS_V2_SIZE_6,
+            QUIC_STATISTICS_V2_SIZE_7,
+            QUIC_STATISTICS_V2_SIZE_8
         };
         static const uint32_t NumStatSizes = ARRAYSIZE(StatSizes);
         uint32_t MaxSizes = *BufferLength / sizeof(uint32_t);
@@ -1785,6 +1872,44 @@ QuicLibraryGetGlobalParam(
 #endif // DEBUG
     }
 
+    case QUIC_PARAM_GLOBAL_SEND_BUFFER_BUDGET:
+
+        if (*BufferLength < sizeof(MsQuicLib.SendBufferBudget)) {
+            *BufferLength = sizeof(MsQuicLib.SendBufferBudget);
+            Status = QUIC_STATUS_BUFFER_TOO_SMALL;
+            break;
+        }
+
+        if (Buffer == NULL) {
+            Status = QUIC_STATUS_INVALID_PARAMETER;
+            break;
+        }
+
+        *BufferLength = sizeof(MsQuicLib.SendBufferBudget);
+        *(uint64_t*)Buffer = MsQuicLib.SendBufferBudget;
+
+        Status = QUIC_STATUS_SUCCESS;
+        break;
+
+    case QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT:
+
+        if (*BufferLength < sizeof(MsQuicLib.RecvMemoryPercent)) {
+            *BufferLength = sizeof(MsQuicLib.RecvMemoryPercent);
+            Status = QUIC_STATUS_BUFFER_TOO_SMALL;
+            break;
+        }
+
+        if (Buffer == NULL) {
+            Status = QUIC_STATUS_INVALID_PARAMETER;
+            break;
+        }
+
+        *BufferLength = sizeof(MsQuicLib.RecvMemoryPercent);
+        *(uint16_t*)Buffer = MsQuicLib.RecvMemoryPercent;
+
+        Status = QUIC_STATUS_SUCCESS;
+        break;
+
     default:
         Status = QUIC_STATUS_INVALID_PARAMETER;
         break;
@@ -2147,6 +2272,7 @@ MsQuicOpenVersion(
     Api->StreamProvideReceiveBuffers = MsQuicStreamProvideReceiveBuffers;
 
     Api->DatagramSend = MsQuicDatagramSend;
+    Api->DatagramSendBatch = MsQuicDatagramSendBatch;
 
 #ifndef _KERNEL_MODE
     Api->ExecutionCreate = MsQuicExecutionCreate;
@@ -2896,6 +3022,7 @@ QuicLibrarySetRetryKeyConfig(
     }
     MsQuicLib.StatelessRetry.AeadAlgorithm = (CXPLAT_AEAD_TYPE)Config->Algorithm;
     MsQuicLib.StatelessRetry.KeyRotationMs = Config->RotationMs;
+    MsQuicLib.StatelessRetry.Generation++;
     CxPlatDispatchRwLockReleaseExclusive(&MsQuicLib.StatelessRetry.Lock, PrevIrql);
     QuicTraceLogInfo(
         LibraryRetryKeyUpdated,
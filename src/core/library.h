@@ -193,6 +193,44 @@ typedef struct QUIC_LIBRARY {
     //
     uint64_t CurrentHandshakeMemoryUsage;
 
+    //
+    // The maximum number of bytes all connections may buffer for stream sends,
+    // shared fairly between the connections actively buffering. Zero means
+    // unlimited.
+    //
+    uint64_t SendBufferBudget;
+
+    //
+    // The number of connections currently holding buffered send bytes.
+    //
+    long SendBufferActiveConnections;
+
+    //
+    // The percentage (out of UINT16_MAX) of available memory that receive
+    // window auto-tuning may commit. Zero disables the budget. This only
+    // blocks window growth; it doesn't bound receive buffer allocations.
+    //
+    uint16_t RecvMemoryPercent;
+
+    //
+    // The maximum number of bytes of receive window growth auto-tuning may
+    // commit across all connections, derived from RecvMemoryPercent and the
+    // (possibly cgroup restricted) available memory.
+    //
+    uint64_t RecvMemoryLimit;
+
+    //
+    // The number of bytes of receive window growth currently committed.
+    //
+    int64_t RecvWindowReserved;
+
+    //
+    // Application supplied congestion control algorithm, used by connections
+    // configured with QUIC_CONGESTION_CONTROL_ALGORITHM_CUSTOM. Only set
+    // before the library is in use, so it is read without a lock.
+    //
+    QUIC_CONGESTION_CONTROL_PROVIDER CongestionControlProvider;
+
     //
     // Handle to global persistent storage (registry).
     //
@@ -252,6 +290,11 @@ typedef struct QUIC_LIBRARY {
     //
     CXPLAT_RUNDOWN_REF RegistrationCloseCleanupRundown;
 
+    //
+    // Threads for offloaded TLS processing, started on first use.
+    //
+    QUIC_CRYPTO_POOL CryptoPool;
+
     //
     // Per-partition storage. Count of `PartitionCount`.
     //
@@ -284,6 +327,12 @@ typedef struct QUIC_LIBRARY {
         //
         uint32_t KeyRotationMs;
 
+        //
+        // Incremented each time the configuration changes, so that partitions
+        // know to drop their cached keys. Read without the lock.
+        //
+        uint32_t Generation;
+
     } StatelessRetry;
 
     //
@@ -291,6 +340,11 @@ typedef struct QUIC_LIBRARY {
     //
     CXPLAT_TOEPLITZ_HASH ToeplitzHash;
 
+    //
+    // The secret key used to hash ClientHellos for the 0-RTT replay filter.
+    //
+    uint64_t ReplayFilterKey[2];
+
 #if QUIC_TEST_DATAPATH_HOOKS_ENABLED
     //
     // An optional callback to allow test code to modify the data path.
@@ -417,6 +471,46 @@ QuicPartitionIdGetIndex(
     return (PartitionId & MsQuicLib.PartitionMask) % MsQuicLib.PartitionCount;
 }
 
+//
+// Reserves receive window growth against the library's receive memory budget.
+// Returns FALSE if the growth would exceed the budget. Nothing is tracked (and
+// Reserved is zero) when no budget is configured.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_INLINE
+BOOLEAN
+QuicLibraryTryReserveRecvWindow(
+    _In_ uint32_t Length,
+    _Out_ uint32_t* Reserved
+    )
+{
+    *Reserved = 0;
+    if (MsQuicLib.RecvMemoryLimit == 0) {
+        return TRUE;
+    }
+    const int64_t Total =
+        InterlockedExchangeAdd64(&MsQuicLib.RecvWindowReserved, (int64_t)Length) +
+        (int64_t)Length;
+    if ((uint64_t)Total > MsQuicLib.RecvMemoryLimit) {
+        InterlockedExchangeAdd64(&MsQuicLib.RecvWindowReserved, -(int64_t)Length);
+        return FALSE;
+    }
+    *Reserved = Length;
+    return TRUE;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_INLINE
+void
+QuicLibraryReleaseRecvWindow(
+    _In_ uint64_t Length
+    )
+{
+    if (Length != 0) {
+        InterlockedExchangeAdd64(&MsQuicLib.RecvWindowReserved, -(int64_t)Length);
+    }
+}
+
 #define QUIC_PERF_SAMPLE_INTERVAL_S    1 // 1 second
 
 _IRQL_requires_max_(DISPATCH_LEVEL)
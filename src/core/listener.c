@@ -692,20 +692,6 @@ QuicListenerFindAlpnInList(
     return NULL;
 }
 
-_IRQL_requires_max_(DISPATCH_LEVEL)
-BOOLEAN
-QuicListenerHasAlpnOverlap(
-    _In_ const QUIC_LISTENER* Listener1,
-    _In_ const QUIC_LISTENER* Listener2
-    )
-{
-    return
-        QuicListenerFindAlpnInList(
-            Listener1,
-            Listener2->AlpnListLength,
-            Listener2->AlpnList) != NULL;
-}
-
 _IRQL_requires_max_(DISPATCH_LEVEL)
 BOOLEAN
 QuicListenerMatchesAlpn(
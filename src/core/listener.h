@@ -5,6 +5,23 @@
 
 --*/
 
+//
+// An entry in a binding's ALPN index, mapping one of a listener's ALPNs back to
+// the listener.
+//
+typedef struct QUIC_LISTENER_ALPN_ENTRY {
+
+    CXPLAT_HASHTABLE_ENTRY TableEntry;
+
+    struct QUIC_LISTENER* Listener;
+
+    //
+    // The ALPN, prefixed with its length. Points into the listener's AlpnList.
+    //
+    const uint8_t* Alpn;
+
+} QUIC_LISTENER_ALPN_ENTRY;
+
 //
 // Represents the Listener specific state.
 //
@@ -154,6 +171,19 @@ typedef struct QUIC_LISTENER {
     _Field_size_(AlpnListLength)
     uint8_t* AlpnList;
 
+    //
+    // The listener's entries in its binding's ALPN index, one per ALPN in
+    // AlpnList. Only valid while registered with the binding.
+    //
+    uint16_t AlpnEntryCount;
+    QUIC_LISTENER_ALPN_ENTRY* AlpnEntries;
+
+    //
+    // The order the listener was registered with its binding. Used to find
+    // which of several matching listeners comes first in the binding's list.
+    //
+    uint64_t BindingSequence;
+
     //
     // An app configured prefix for all connection IDs in this listener. The
     // first byte indicates the length of the ID, the second byte the offset of
@@ -223,16 +253,6 @@ QuicListenerRelease(
     _In_ QUIC_LISTENER* Listener
     );
 
-//
-// Returns TRUE if the two listeners have an overlapping ALPN.
-//
-_IRQL_requires_max_(DISPATCH_LEVEL)
-BOOLEAN
-QuicListenerHasAlpnOverlap(
-    _In_ const QUIC_LISTENER* Listener1,
-    _In_ const QUIC_LISTENER* Listener2
-    );
-
 //
 // Returns TRUE if the listener has a matching ALPN. Also updates the new
 // connection info with the matching ALPN.
@@ -20,6 +20,9 @@ Abstract:
         sent more than QUIC_PACKET_REORDER_THRESHOLD packets ago is assumed
         lost.
 
+    Both thresholds adapt to the path: when a packet assumed lost is
+    acknowledged later, they grow to tolerate that much reordering.
+
 
     There are three logical timers in this module:
 
@@ -85,6 +88,10 @@ QuicLossDetectionInitializeInternalState(
     LossDetection->TimeOfLastAckedPacketSent = 0;
     LossDetection->AdjustedLastAckedTime = 0;
     LossDetection->ProbeCount = 0;
+    LossDetection->TimeReorderEighths = QUIC_TIME_REORDER_EIGHTHS;
+    LossDetection->ReorderWindowPersist = 0;
+    LossDetection->PacketReorderThreshold = QUIC_PACKET_REORDER_THRESHOLD;
+    LossDetection->ReorderAdjustPacketNumber = 0;
 }
 
 #if DEBUG
@@ -236,10 +243,19 @@ QuicLossDetectionComputeProbeTimeout(
     //
     // Microseconds.
     //
+    uint64_t MaxAckDelay = Connection->PeerTransportParams.MaxAckDelay;
+    if (Connection->PeerMaxAckDelayMs > MaxAckDelay) {
+        //
+        // We asked the peer (via ACK_FREQUENCY) to delay its ACKs for longer
+        // than it would by default.
+        //
+        MaxAckDelay = Connection->PeerMaxAckDelayMs;
+    }
+
     uint64_t Pto =
         Path->SmoothedRtt +
         4 * Path->RttVariance +
-        MS_TO_US(Connection->PeerTransportParams.MaxAckDelay);
+        MS_TO_US(MaxAckDelay);
     Pto *= Count;
     return Pto;
 }
@@ -311,7 +327,9 @@ QuicLossDetectionUpdateTimer(
         //
         TimeoutType = LOSS_TIMER_RACK;
         uint64_t RttUs = CXPLAT_MAX(Path->SmoothedRtt, Path->LatestRttSample);
-        TimeFires = OldestPacket->SentTime + QUIC_TIME_REORDER_THRESHOLD(RttUs);
+        TimeFires =
+            OldestPacket->SentTime +
+            QUIC_TIME_REORDER_THRESHOLD(RttUs, LossDetection->TimeReorderEighths);
 
     } else if (!Path->GotFirstRttSample) {
 
@@ -639,6 +657,13 @@ QuicLossDetectionOnPacketAcknowledged(
                 QuicAddrGetFamily(&Path->Route.RemoteAddress),
                 Packet->PacketLength);
         BOOLEAN ChangedMtu = FALSE;
+        if (PacketMtu > Connection->Settings.MinimumMtu) {
+            //
+            // Large packets are getting through, so the path isn't a black
+            // hole for them.
+            //
+            Path->MtuDiscovery.LargePacketLossEvents = 0;
+        }
         if (!Path->IsMinMtuValidated &&
             PacketMtu >= Path->Mtu) {
             Path->IsMinMtuValidated = TRUE;
@@ -973,8 +998,10 @@ QuicLossDetectionDetectAndHandleLostPackets(
         //
         const QUIC_PATH* Path = &Connection->Paths[0]; // TODO - Correct?
         uint64_t Rtt = CXPLAT_MAX(Path->SmoothedRtt, Path->LatestRttSample);
-        uint64_t TimeReorderThreshold = QUIC_TIME_REORDER_THRESHOLD(Rtt);
+        uint64_t TimeReorderThreshold =
+            QUIC_TIME_REORDER_THRESHOLD(Rtt, LossDetection->TimeReorderEighths);
         uint64_t LargestLostPacketNumber = 0;
+        uint16_t LargestLostPacketLength = 0;
         QUIC_SENT_PACKET_METADATA* PrevPacket = NULL;
         Packet = LossDetection->SentPackets;
         while (Packet != NULL) {
@@ -991,7 +1018,7 @@ QuicLossDetectionDetectAndHandleLostPackets(
                 continue;
             }
 
-            if (Packet->PacketNumber + QUIC_PACKET_REORDER_THRESHOLD < LossDetection->LargestAck) {
+            if (Packet->PacketNumber + LossDetection->PacketReorderThreshold < LossDetection->LargestAck) {
                 if (!NonretransmittableHandshakePacket) {
                     QuicTraceLogVerbose(
                         PacketTxLostFack,
@@ -1034,6 +1061,11 @@ QuicLossDetectionDetectAndHandleLostPackets(
             if (Packet->Flags.IsAckEliciting) {
                 LossDetection->PacketsInFlight--;
                 LostRetransmittableBytes += Packet->PacketLength;
+                if (!Packet->Flags.IsMtuProbe &&
+                    Packet->PathId == Path->ID &&
+                    Packet->PacketLength > LargestLostPacketLength) {
+                    LargestLostPacketLength = Packet->PacketLength;
+                }
                 QuicLossDetectionRetransmitFrames(LossDetection, Packet, FALSE);
             }
 
@@ -1067,6 +1099,20 @@ QuicLossDetectionDetectAndHandleLostPackets(
                 QuicConnUpdatePeerPacketTolerance(Connection, QUIC_MIN_ACK_SEND_NUMBER);
             }
 
+            QuicConnTunePeerAckFrequency(Connection, TRUE);
+
+            if (LargestLostPacketLength > 0 &&
+                QuicMtuDiscoveryOnLostPackets(
+                    &Connection->Paths[0].MtuDiscovery,
+                    PacketSizeFromUdpPayloadSize(
+                        QuicAddrGetFamily(&Path->Route.RemoteAddress),
+                        LargestLostPacketLength),
+                    Connection)) {
+                QuicDatagramOnSendStateChanged(&Connection->Datagram);
+            }
+
+            QuicLossDetectionDecayReorderThresholds(LossDetection);
+
             QUIC_LOSS_EVENT LossEvent = {
                 .LargestPacketNumberLost = LargestLostPacketNumber,
                 .LargestSentPacketNumber = LossDetection->LargestSentPacketNumber,
@@ -1298,6 +1344,74 @@ QuicLossDetectionOnZeroRttRejected(
     }
 }
 
+//
+// Called for each packet previously declared lost that has now been
+// acknowledged. Grows the reordering thresholds so that the same amount of
+// reordering doesn't cause spurious losses again.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicLossDetectionOnSpuriousLoss(
+    _In_ QUIC_LOSS_DETECTION* LossDetection,
+    _In_ const QUIC_SENT_PACKET_METADATA* Packet
+    )
+{
+    QUIC_CONNECTION* Connection = QuicLossDetectionGetConnection(LossDetection);
+
+    Connection->Stats.Send.SpuriousLostBytes += Packet->PacketLength;
+
+    if (Packet->PacketNumber < LossDetection->LargestAck) {
+        uint64_t Reordering = LossDetection->LargestAck - Packet->PacketNumber;
+        if (Reordering > LossDetection->PacketReorderThreshold) {
+            LossDetection->PacketReorderThreshold =
+                (uint32_t)CXPLAT_MIN(Reordering, QUIC_MAX_PACKET_REORDER_THRESHOLD);
+        }
+    }
+
+    if (Packet->PacketNumber >= LossDetection->ReorderAdjustPacketNumber &&
+        LossDetection->TimeReorderEighths < QUIC_MAX_TIME_REORDER_EIGHTHS) {
+        //
+        // Like RACK-TLP, grow the time threshold by a quarter RTT at most
+        // once per round trip.
+        //
+        LossDetection->TimeReorderEighths =
+            CXPLAT_MIN(LossDetection->TimeReorderEighths + 2, QUIC_MAX_TIME_REORDER_EIGHTHS);
+        LossDetection->ReorderAdjustPacketNumber =
+            LossDetection->LargestSentPacketNumber + 1;
+    }
+
+    LossDetection->ReorderWindowPersist = QUIC_REORDER_WINDOW_PERSIST;
+
+    QuicTraceLogConnVerbose(
+        ReorderThresholdUpdated,
+        Connection,
+        "Reordering thresholds updated: %u packets, %hhu/8 RTT",
+        LossDetection->PacketReorderThreshold,
+        LossDetection->TimeReorderEighths);
+}
+
+//
+// Called for each loss event. Once ReorderWindowPersist loss events pass
+// without a spurious loss, the reordering thresholds go back to their
+// initial values so that losses are detected quickly again.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicLossDetectionDecayReorderThresholds(
+    _In_ QUIC_LOSS_DETECTION* LossDetection
+    )
+{
+    if (LossDetection->ReorderWindowPersist != 0 &&
+        --LossDetection->ReorderWindowPersist == 0) {
+        LossDetection->TimeReorderEighths = QUIC_TIME_REORDER_EIGHTHS;
+        LossDetection->PacketReorderThreshold = QUIC_PACKET_REORDER_THRESHOLD;
+        QuicTraceLogConnVerbose(
+            ReorderThresholdReset,
+            QuicLossDetectionGetConnection(LossDetection),
+            "Reordering thresholds reset");
+    }
+}
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 void
 QuicLossDetectionProcessAckBlocks(
@@ -1375,6 +1489,7 @@ QuicLossDetectionProcessAckBlocks(
                 Connection->Stats.Send.SpuriousLostPackets++;
                 QuicPerfCounterDecrement(
                     Connection->Partition, QUIC_PERF_COUNTER_PKTS_SUSPECTED_LOST);
+                QuicLossDetectionOnSpuriousLoss(LossDetection, *End);
                 //
                 // NOTE: we don't increment AckedRetransmittableBytes here
                 // because we already told the congestion control module that
@@ -1400,6 +1515,7 @@ QuicLossDetectionProcessAckBlocks(
                 // All previously considered lost packets were found to be
                 // spuriously lost. Inform congestion control.
                 //
+                Connection->Stats.Send.SpuriousCongestionCount++;
                 if (QuicCongestionControlOnSpuriousCongestionEvent(
                         &Connection->CongestionControl)) {
                     //
@@ -1549,8 +1665,15 @@ CheckSentPackets:
             BOOLEAN EcnValidated = TRUE;
             int64_t EctCeDeltaSum = 0;
             if (Ecn != NULL) {
+                //
+                // Scalable (L4S) congestion controllers send ECT(1) instead of
+                // ECT(0); only the codepoint we use may be echoed back.
+                //
+                const BOOLEAN UseEct1 = Connection->CongestionControl.UseEct1;
+                const uint64_t EctCount = UseEct1 ? Ecn->ECT_1_Count : Ecn->ECT_0_Count;
+                const uint64_t OtherEctCount = UseEct1 ? Ecn->ECT_0_Count : Ecn->ECT_1_Count;
                 EctCeDeltaSum += Ecn->CE_Count - Packets->EcnCeCounter;
-                EctCeDeltaSum += Ecn->ECT_0_Count - Packets->EcnEctCounter;
+                EctCeDeltaSum += EctCount - Packets->EcnEctCounter;
                 //
                 // Conditions where ECN validation fails:
                 // 1. Reneging ECN counts from the peer.
@@ -1558,13 +1681,14 @@ CheckSentPackets:
                 //
                 if (EctCeDeltaSum < 0 ||
                     EctCeDeltaSum < EcnEctCounter ||
-                    Ecn->ECT_1_Count != 0 ||
-                    Connection->Send.NumPacketsSentWithEct < Ecn->ECT_0_Count) {
+                    OtherEctCount != 0 ||
+                    Connection->Send.NumPacketsSentWithEct < EctCount) {
                     EcnValidated = FALSE;
                 } else {
                     BOOLEAN NewCE = Ecn->CE_Count > Packets->EcnCeCounter;
+                    uint64_t CePacketCount = Ecn->CE_Count - Packets->EcnCeCounter;
                     Packets->EcnCeCounter = Ecn->CE_Count;
-                    Packets->EcnEctCounter = Ecn->ECT_0_Count;
+                    Packets->EcnEctCounter = EctCount;
                     if (Path->EcnValidationState <= ECN_VALIDATION_UNKNOWN) {
                         Path->EcnValidationState = ECN_VALIDATION_CAPABLE;
                         QuicTraceEvent(
@@ -1579,8 +1703,10 @@ CheckSentPackets:
                         QUIC_ECN_EVENT EcnEvent = {
                             .LargestPacketNumberAcked = LargestAckedPacketNum,
                             .LargestSentPacketNumber = LossDetection->LargestSentPacketNumber,
+                            .CePacketCount = (uint32_t)CXPLAT_MIN(CePacketCount, UINT32_MAX),
                         };
                         QuicCongestionControlOnEcn(&Connection->CongestionControl, &EcnEvent);
+                        QuicConnTunePeerAckFrequency(Connection, TRUE);
                     }
                 }
             } else {
@@ -1640,6 +1766,8 @@ CheckSentPackets:
             //
             QuicSendQueueFlush(&Connection->Send, REASON_CONGESTION_CONTROL);
         }
+
+        QuicConnTunePeerAckFrequency(Connection, FALSE);
     }
 
     LossDetection->ProbeCount = 0;
@@ -1746,6 +1874,35 @@ QuicLossDetectionScheduleProbe(
         "probe round %hu",
         LossDetection->ProbeCount);
 
+    //
+    // Nothing was acknowledged for a whole probe timeout, so treat the
+    // outstanding packets as a loss event for black hole detection. If every
+    // packet is too large for the path, no ACK ever comes back to infer losses
+    // from. This has to happen before retransmitting, so that the probes are
+    // sent at the reduced MTU.
+    //
+    QUIC_PATH* Path = &Connection->Paths[0];
+    uint16_t LargestOutstandingPacketLength = 0;
+    for (QUIC_SENT_PACKET_METADATA* Packet = LossDetection->SentPackets;
+        Packet != NULL;
+        Packet = Packet->Next) {
+        if (Packet->Flags.IsAckEliciting &&
+            !Packet->Flags.IsMtuProbe &&
+            Packet->PathId == Path->ID &&
+            Packet->PacketLength > LargestOutstandingPacketLength) {
+            LargestOutstandingPacketLength = Packet->PacketLength;
+        }
+    }
+    if (LargestOutstandingPacketLength > 0 &&
+        QuicMtuDiscoveryOnLostPackets(
+            &Path->MtuDiscovery,
+            PacketSizeFromUdpPayloadSize(
+                QuicAddrGetFamily(&Path->Route.RemoteAddress),
+                LargestOutstandingPacketLength),
+            Connection)) {
+        QuicDatagramOnSendStateChanged(&Connection->Datagram);
+    }
+
     //
     // Below, we will schedule a fixed number packets to be retransmitted. What
     // we'd like to do here send only that number of packets' worth of fresh
@@ -5,6 +5,10 @@
 
 --*/
 
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
 typedef struct QUIC_LOSS_DETECTION {
 
     //
@@ -87,6 +91,22 @@ typedef struct QUIC_LOSS_DETECTION {
     //
     uint16_t ProbeCount;
 
+    //
+    // The current reordering tolerance. Both thresholds grow when a packet
+    // declared lost is acknowledged later (RACK-TLP, RFC 8985), and return to
+    // their initial values after ReorderWindowPersist more loss events without
+    // spurious losses.
+    //
+    uint8_t TimeReorderEighths;
+    uint8_t ReorderWindowPersist;
+    uint32_t PacketReorderThreshold;
+
+    //
+    // The time threshold grows at most once per round trip: only for spurious
+    // losses of packets sent after the last time it grew.
+    //
+    uint64_t ReorderAdjustPacketNumber;
+
 } QUIC_LOSS_DETECTION;
 
 _IRQL_requires_max_(PASSIVE_LEVEL)
@@ -187,3 +207,28 @@ void
 QuicLossDetectionProcessTimerOperation(
     _In_ QUIC_LOSS_DETECTION* LossDetection
     );
+
+//
+// Called when a packet previously declared lost is acknowledged. Grows the
+// reordering thresholds.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicLossDetectionOnSpuriousLoss(
+    _In_ QUIC_LOSS_DETECTION* LossDetection,
+    _In_ const QUIC_SENT_PACKET_METADATA* Packet
+    );
+
+//
+// Called for each loss event. Resets the reordering thresholds after enough
+// loss events without a spurious loss.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicLossDetectionDecayReorderThresholds(
+    _In_ QUIC_LOSS_DETECTION* LossDetection
+    );
+
+#if defined(__cplusplus)
+}
+#endif
@@ -15,17 +15,28 @@ Abstract:
     reached.
 
     If a probe packet is not ACKed, the probe at the same size will be retried.
-    If this fails QUIC_DPLPMTUD_MAX_PROBES times, max MTU is considered found
-    and searching stops.
+    If this fails QUIC_DPLPMTUD_MAX_PROBES times, the probe size is considered
+    too large for the path and the search continues below it.
+
+    Probe sizes are picked by a binary search between the current MTU and the
+    largest size not yet known to fail. Before bisecting, 1280 and 1500 are
+    tried, as they are the most common MTUs, followed by the maximum allowed
+    MTU, so that paths supporting jumbo frames are found in a few round trips.
+    Searching stops once the remaining range is less than
+    QUIC_DPLPMTUD_MIN_SEARCH_STEP bytes.
 
     Once searching has stopped, discovery will stay idle until
     QUIC_DPLPMTUD_RAISE_TIMER_TIMEOUT has passed. The next send will then
     trigger a new MTU discovery period, unless maximum allowed MTU is already
     reached.
 
-    The current algorithm is very simplistic, increasing by 80 bytes each
-    probe. A special case is added so 1500 is always a checked value, as 1500
-    is often the max allowed over the internet.
+    The result of each search is cached on the binding, per remote address.
+    New connections to the same address probe the cached MTU first.
+
+    If packets larger than the minimum MTU keep getting lost while none are
+    acknowledged, the path is considered a black hole for the current MTU. The
+    MTU falls back to the minimum and a new search is started below the size
+    that stopped working.
 
 --*/
 
@@ -65,6 +76,19 @@ QuicMtuDiscoveryMoveToSearchComplete(
         "Path[%hhu] Mtu Discovery Entering Search Complete at MTU %hu",
         Path->ID,
         Path->Mtu);
+
+    if (Path->IsMinMtuValidated && Path->Binding != NULL) {
+        //
+        // If the search was bounded below the max allowed MTU, then a larger
+        // probe failed (now or on an earlier connection) and this is the max
+        // for the path itself.
+        //
+        QuicBindingSetPathMtu(
+            Path->Binding,
+            &Path->Route.RemoteAddress,
+            Path->Mtu,
+            MtuDiscovery->SearchUpperBound < MtuDiscovery->MaxMtu);
+    }
 }
 
 _IRQL_requires_max_(PASSIVE_LEVEL)
@@ -76,34 +100,57 @@ QuicGetNextProbeSize(
 {
     QUIC_PATH* Path =
         CXPLAT_CONTAINING_RECORD(MtuDiscovery, QUIC_PATH, MtuDiscovery);
+    const uint16_t Low = Path->Mtu;
+    const uint16_t High = MtuDiscovery->SearchUpperBound;
+
     //
-    // N.B. This algorithm must always be increasing. Other logic in the module
-    // depends on that behavior.
+    // N.B. The probe size must always be larger than the current MTU. Other
+    // logic in the module depends on that behavior. Returning the current MTU
+    // indicates there is nothing left to search.
     //
+    if (High <= Low) {
+        return Low;
+    }
 
     //
-    // Jump automatically to 1280 to return algorithm to ideal case. 1280 should
-    // be supported in most scenarios. With minimum being 1248, this will always
-    // be less then a full increment.
+    // An earlier connection to the same remote address found this MTU, so it
+    // is the most likely answer.
     //
-    if (Path->Mtu < 1280) {
-        return CXPLAT_MIN(1280, MtuDiscovery->MaxMtu);
+    if (MtuDiscovery->CachedMtu > Low) {
+        uint16_t Mtu = CXPLAT_MIN(MtuDiscovery->CachedMtu, High);
+        MtuDiscovery->CachedMtu = 0;
+        return Mtu;
     }
 
-    uint16_t Mtu = Path->Mtu + QUIC_DPLPMTUD_INCREMENT;
-    if (Mtu > MtuDiscovery->MaxMtu) {
-        Mtu = MtuDiscovery->MaxMtu;
+    //
+    // Jump automatically to 1280 to return algorithm to ideal case. 1280 should
+    // be supported in most scenarios.
+    //
+    if (Low < 1280) {
+        return CXPLAT_MIN(1280, High);
     }
 
     //
-    // Our increasing algorithm might not hit 1500 by default. Ensure that
-    // happens.
+    // 1500 is often the max allowed over the internet, so make sure it gets
+    // checked instead of being bisected around.
     //
-    if (!MtuDiscovery->HasProbed1500 && Mtu >= 1500) {
+    if (!MtuDiscovery->HasProbed1500 && Low < 1500 && High >= 1500) {
         MtuDiscovery->HasProbed1500 = TRUE;
-        Mtu = 1500;
+        return 1500;
+    }
+
+    //
+    // Until a probe fails, optimistically try the max allowed MTU directly.
+    //
+    if (High == MtuDiscovery->MaxMtu) {
+        return High;
     }
-    return Mtu;
+
+    if (High - Low < QUIC_DPLPMTUD_MIN_SEARCH_STEP) {
+        return Low;
+    }
+
+    return (uint16_t)(Low + (High - Low + 1) / 2);
 }
 
 _IRQL_requires_max_(PASSIVE_LEVEL)
@@ -161,9 +208,34 @@ QuicMtuDiscoveryPeerValidated(
     // default
     //
     MtuDiscovery->MaxMtu = QuicConnGetMaxMtuForPath(Connection, Path);
+    MtuDiscovery->SearchUpperBound = MtuDiscovery->MaxMtu;
+    MtuDiscovery->CachedMtu = 0;
+    MtuDiscovery->LargePacketLossEvents = 0;
     MtuDiscovery->HasProbed1500 = Path->Mtu >= 1500;
     CXPLAT_DBG_ASSERT(Path->Mtu <= MtuDiscovery->MaxMtu);
 
+    uint16_t CachedMtu;
+    BOOLEAN IsCeiling;
+    if (Path->Binding != NULL &&
+        QuicBindingGetPathMtu(
+            Path->Binding,
+            &Path->Route.RemoteAddress,
+            Connection->Settings.MtuDiscoverySearchCompleteTimeoutUs,
+            &CachedMtu,
+            &IsCeiling)) {
+        MtuDiscovery->CachedMtu = CXPLAT_MIN(CachedMtu, MtuDiscovery->MaxMtu);
+        if (IsCeiling && CachedMtu < MtuDiscovery->MaxMtu) {
+            MtuDiscovery->SearchUpperBound = CachedMtu;
+        }
+        QuicTraceLogConnInfo(
+            MtuCachedMtuFound,
+            Connection,
+            "Path[%hhu] Mtu Discovery Cached MTU: mtu=%hu, ceiling=%hhu",
+            Path->ID,
+            CachedMtu,
+            IsCeiling);
+    }
+
     QuicTraceLogConnInfo(
         MtuPathInitialized,
         Connection,
@@ -253,14 +325,73 @@ QuicMtuDiscoveryProbePacketDiscarded(
         MtuDiscovery->ProbeCount);
 
     //
-    // If we've done max probes, we've found our max, enter search complete
-    // waiting phase. Otherwise send out another probe of the same size.
+    // If we've done max probes, the probe size is too large for the path, so
+    // continue the search below it. Otherwise send out another probe of the
+    // same size.
     //
     if (MtuDiscovery->ProbeCount >=
             (int16_t)Connection->Settings.MtuDiscoveryMissingProbeCount - 1) {
-        QuicMtuDiscoveryMoveToSearchComplete(MtuDiscovery, Connection);
+        if (!Path->IsMinMtuValidated) {
+            QuicMtuDiscoveryMoveToSearchComplete(MtuDiscovery, Connection);
+            return;
+        }
+        CXPLAT_DBG_ASSERT(MtuDiscovery->ProbeSize > Path->Mtu);
+        MtuDiscovery->SearchUpperBound = MtuDiscovery->ProbeSize - 1;
+        QuicMtuDiscoveryMoveToSearching(MtuDiscovery, Connection);
         return;
     }
     MtuDiscovery->ProbeCount++;
     QuicMtuDiscoverySendProbePacket(Connection);
 }
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicMtuDiscoveryOnLostPackets(
+    _In_ QUIC_MTU_DISCOVERY* MtuDiscovery,
+    _In_ uint16_t LargestLostPacketMtu,
+    _In_ QUIC_CONNECTION* Connection
+    )
+{
+    QUIC_PATH* Path =
+        CXPLAT_CONTAINING_RECORD(MtuDiscovery, QUIC_PATH, MtuDiscovery);
+    const uint16_t MinimumMtu = Connection->Settings.MinimumMtu;
+
+    if (Path->Mtu <= MinimumMtu || LargestLostPacketMtu <= MinimumMtu) {
+        return FALSE;
+    }
+
+    //
+    // Congestion losses are interleaved with acknowledgements of other large
+    // packets, which reset the count. Only a path that stopped carrying large
+    // packets altogether gets here repeatedly.
+    //
+    if (++MtuDiscovery->LargePacketLossEvents < QUIC_DPLPMTUD_BLACK_HOLE_THRESHOLD) {
+        return FALSE;
+    }
+
+    QuicTraceLogConnWarning(
+        MtuBlackHoleDetected,
+        Connection,
+        "Path[%hhu] Mtu Discovery Black Hole Detected at MTU %hu",
+        Path->ID,
+        Path->Mtu);
+
+    MtuDiscovery->SearchUpperBound = Path->Mtu - 1;
+    MtuDiscovery->CachedMtu = 0;
+    MtuDiscovery->LargePacketLossEvents = 0;
+    MtuDiscovery->HasProbed1500 = MinimumMtu >= 1500;
+    Path->Mtu = MinimumMtu;
+    QuicTraceLogConnInfo(
+        PathMtuUpdated,
+        Connection,
+        "Path[%hhu] MTU updated to %hu bytes",
+        Path->ID,
+        Path->Mtu);
+
+    if (Path->Binding != NULL) {
+        QuicBindingSetPathMtu(Path->Binding, &Path->Route.RemoteAddress, 0, FALSE);
+    }
+
+    QuicMtuDiscoveryMoveToSearching(MtuDiscovery, Connection);
+    return TRUE;
+}
@@ -17,6 +17,18 @@ typedef struct QUIC_MTU_DISCOVERY {
     //
     uint16_t MaxMtu;
 
+    //
+    // The largest MTU not yet known to fail. The search happens between the
+    // path's current MTU and this.
+    //
+    uint16_t SearchUpperBound;
+
+    //
+    // The MTU found by a previous connection to the same remote address, to
+    // be probed before anything else. Zero if there is none.
+    //
+    uint16_t CachedMtu;
+
     //
     // The current MTU size being probed.
     //
@@ -27,6 +39,12 @@ typedef struct QUIC_MTU_DISCOVERY {
     //
     uint8_t ProbeCount;
 
+    //
+    // The number of consecutive loss events in which packets larger than the
+    // minimum MTU were lost without any being acknowledged.
+    //
+    uint8_t LargePacketLossEvents;
+
     //
     // Is MTU discovery is searching or search complete.
     //
@@ -80,3 +98,16 @@ QuicMtuDiscoveryProbePacketDiscarded(
     _In_ QUIC_CONNECTION* Connection,
     _In_ uint16_t PacketMtu
     );
+
+//
+// Handle a loss event in which packets up to the given size were lost. Falls
+// back to the minimum MTU if the path appears to have become a black hole for
+// larger packets. Returns TRUE if the path's MTU was reduced.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicMtuDiscoveryOnLostPackets(
+    _In_ QUIC_MTU_DISCOVERY* MtuDiscovery,
+    _In_ uint16_t LargestLostPacketMtu,
+    _In_ QUIC_CONNECTION* Connection
+    );
@@ -208,6 +208,17 @@ QuicOperationEnqueueFront(
     return StartProcessing;
 }
 
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicOperationQueueHold(
+    _In_ QUIC_OPERATION_QUEUE* OperQ
+    )
+{
+    CxPlatDispatchLockAcquire(&OperQ->Lock);
+    OperQ->ActivelyProcessing = TRUE;
+    CxPlatDispatchLockRelease(&OperQ->Lock);
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 QUIC_OPERATION*
 QuicOperationDequeue(
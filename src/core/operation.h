@@ -27,7 +27,7 @@ typedef enum QUIC_OPERATION_TYPE {
     QUIC_OPER_TYPE_UNREACHABLE,         // Process UDP unreachable event.
     QUIC_OPER_TYPE_FLUSH_STREAM_RECV,   // Indicate a stream data to the app.
     QUIC_OPER_TYPE_FLUSH_SEND,          // Frame packets and send them.
-    QUIC_OPER_TYPE_DEPRECATED,          // No longer used.
+    QUIC_OPER_TYPE_TLS_COMPLETE,        // TLS processing on the crypto pool completed.
     QUIC_OPER_TYPE_TIMER_EXPIRED,       // A timer expired.
     QUIC_OPER_TYPE_TRACE_RUNDOWN,       // A trace rundown was triggered.
     QUIC_OPER_TYPE_ROUTE_COMPLETION,    // Process route completion event.
@@ -197,6 +197,7 @@ typedef struct QUIC_STATELESS_CONTEXT {
     CXPLAT_HASHTABLE_ENTRY TableEntry;
     QUIC_RX_PACKET* Packet;
     uint32_t CreationTimeMs;
+    uint16_t ShardIndex;
     uint8_t HasBindingRef : 1;
     uint8_t IsProcessed : 1;
     uint8_t IsExpired : 1;
@@ -395,6 +396,17 @@ QuicOperationEnqueueFront(
     _In_ QUIC_OPERATION* Oper
     );
 
+//
+// Holds the queue in the actively processing state, without dequeuing anything,
+// so that newly queued operations don't cause the owner to be scheduled. The
+// hold ends when the owner is explicitly scheduled again and drains the queue.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicOperationQueueHold(
+    _In_ QUIC_OPERATION_QUEUE* OperQ
+    );
+
 //
 // Dequeues an operation. Returns NULL if the queue is empty.
 //
@@ -512,47 +512,83 @@ QuicPacketDecodeRetryTokenV1(
 }
 
 //
-// Returns TRUE if the retry token was successfully decrypted and validated.
+// Returns TRUE if the token is a retry token of the expected length.
 //
 _IRQL_requires_max_(DISPATCH_LEVEL)
 BOOLEAN
-QuicPacketValidateInitialToken(
+QuicPacketValidateRetryTokenFormat(
     _In_ const void* const Owner,
     _In_ const QUIC_RX_PACKET* const Packet,
     _In_range_(>, 0) uint16_t TokenLength,
     _In_reads_(TokenLength)
-        const uint8_t* TokenBuffer,
-    _Inout_ BOOLEAN* DropPacket
+        const uint8_t* TokenBuffer
     )
 {
     const BOOLEAN IsNewToken = TokenBuffer[0] & 0x1;
     if (IsNewToken) {
         QuicPacketLogDrop(Owner, Packet, "New Token not supported");
-        *DropPacket = TRUE;
         return FALSE; // TODO - Support NEW_TOKEN tokens.
     }
 
     if (TokenLength != sizeof(QUIC_TOKEN_CONTENTS)) {
         QuicPacketLogDrop(Owner, Packet, "Invalid Token Length");
-        *DropPacket = TRUE;
         return FALSE;
     }
 
-    QUIC_TOKEN_CONTENTS Token;
-    if (!QuicRetryTokenDecrypt(Packet, TokenBuffer, &Token)) {
-        QuicPacketLogDrop(Owner, Packet, "Retry Token Decryption Failure");
+    return TRUE;
+}
+
+//
+// Returns TRUE if the decrypted retry token is valid for the packet.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicPacketValidateRetryTokenContents(
+    _In_ const void* const Owner,
+    _In_ const QUIC_RX_PACKET* const Packet,
+    _In_ const QUIC_TOKEN_CONTENTS* Token
+    )
+{
+    if (Token->Encrypted.OrigConnIdLength > sizeof(Token->Encrypted.OrigConnId)) {
+        QuicPacketLogDrop(Owner, Packet, "Invalid Retry Token OrigConnId Length");
+        return FALSE;
+    }
+
+    if (!QuicAddrCompare(&Token->Encrypted.RemoteAddress, &Packet->Route->RemoteAddress)) {
+        QuicPacketLogDrop(Owner, Packet, "Retry Token Addr Mismatch");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+//
+// Returns TRUE if the retry token was successfully decrypted and validated.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicPacketValidateInitialToken(
+    _In_ const void* const Owner,
+    _In_ const QUIC_RX_PACKET* const Packet,
+    _In_range_(>, 0) uint16_t TokenLength,
+    _In_reads_(TokenLength)
+        const uint8_t* TokenBuffer,
+    _Inout_ BOOLEAN* DropPacket
+    )
+{
+    if (!QuicPacketValidateRetryTokenFormat(Owner, Packet, TokenLength, TokenBuffer)) {
         *DropPacket = TRUE;
         return FALSE;
     }
 
-    if (Token.Encrypted.OrigConnIdLength > sizeof(Token.Encrypted.OrigConnId)) {
-        QuicPacketLogDrop(Owner, Packet, "Invalid Retry Token OrigConnId Length");
+    QUIC_TOKEN_CONTENTS Token;
+    if (!QuicRetryTokenDecrypt(Packet, TokenBuffer, &Token)) {
+        QuicPacketLogDrop(Owner, Packet, "Retry Token Decryption Failure");
         *DropPacket = TRUE;
         return FALSE;
     }
 
-    if (!QuicAddrCompare(&Token.Encrypted.RemoteAddress, &Packet->Route->RemoteAddress)) {
-        QuicPacketLogDrop(Owner, Packet, "Retry Token Addr Mismatch");
+    if (!QuicPacketValidateRetryTokenContents(Owner, Packet, &Token)) {
         *DropPacket = TRUE;
         return FALSE;
     }
@@ -307,6 +307,24 @@ QuicPacketDecodeRetryTokenV1(
     _Out_ uint16_t* TokenLength
     );
 
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicPacketValidateRetryTokenFormat(
+    _In_ const void* const Owner,
+    _In_ const QUIC_RX_PACKET* const Packet,
+    _In_range_(>, 0) uint16_t TokenLength,
+    _In_reads_(TokenLength)
+        const uint8_t* TokenBuffer
+    );
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicPacketValidateRetryTokenContents(
+    _In_ const void* const Owner,
+    _In_ const QUIC_RX_PACKET* const Packet,
+    _In_ const QUIC_TOKEN_CONTENTS* Token
+    );
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 BOOLEAN
 QuicPacketValidateInitialToken(
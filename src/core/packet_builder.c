@@ -102,6 +102,8 @@ QuicPacketBuilderInitialize(
     Builder->PacketBatchSent = FALSE;
     Builder->PacketBatchRetransmittable = FALSE;
     Builder->WrittenConnectionCloseFrame = FALSE;
+    Builder->EncryptInCopy = FALSE;
+    Builder->GatherSegmentCount = 0;
     Builder->Metadata = &Builder->MetadataStorage.Metadata;
     Builder->EncryptionOverhead = CXPLAT_ENCRYPTION_OVERHEAD;
     Builder->TotalDatagramsLength = 0;
@@ -263,7 +265,10 @@ QuicPacketBuilderPrepare(
                     MaxUdpPayloadSizeForFamily(
                         QuicAddrGetFamily(&Builder->Path->Route.RemoteAddress),
                         DatagramSize),
-                Builder->EcnEctSet ? CXPLAT_ECN_ECT_0 : CXPLAT_ECN_NON_ECT,
+                !Builder->EcnEctSet ?
+                    CXPLAT_ECN_NON_ECT :
+                    Connection->CongestionControl.UseEct1 ?
+                        CXPLAT_ECN_ECT_1 : CXPLAT_ECN_ECT_0,
                 Builder->Connection->Registration->ExecProfile == QUIC_EXECUTION_PROFILE_TYPE_MAX_THROUGHPUT ?
                     CXPLAT_SEND_FLAGS_MAX_THROUGHPUT : CXPLAT_SEND_FLAGS_NONE,
                 Connection->DSCP
@@ -370,6 +375,13 @@ QuicPacketBuilderPrepare(
             Connection->State.Disable1RttEncrytion) {
             Builder->EncryptionOverhead = 0;
         }
+#ifndef QUIC_FUZZER // The fuzzer needs the complete plaintext before encryption.
+        Builder->EncryptInCopy =
+            Connection->Settings.EncryptInCopyEnabled &&
+            Builder->EncryptionOverhead != 0 &&
+            !(NewPacketKeyType == QUIC_PACKET_KEY_1_RTT && Connection->Paths[0].EncryptionOffloading);
+#endif
+        Builder->GatherSegmentCount = 0;
 
         Builder->Metadata->PacketId =
             PartitionShifted | InterlockedIncrement64((int64_t*)&Partition->SendPacketId);
@@ -865,16 +877,19 @@ QuicPacketBuilderFinalize(
         QUIC_STATUS Status;
         if (QUIC_FAILED(
             Status =
-            CxPlatEncrypt(
+            CxPlatEncryptGather(
                 Builder->Key->PacketKey,
                 Iv,
                 Builder->HeaderLength,
                 Header,
+                Builder->GatherSegmentCount,
+                Builder->GatherSegments,
                 PayloadLength,
                 Payload))) {
             QuicConnFatalError(Connection, Status, "Encryption failure");
             goto Exit;
         }
+        Builder->GatherSegmentCount = 0;
 
         QuicTraceEvent(
             PacketFinalize,
@@ -970,6 +985,7 @@ QuicPacketBuilderFinalize(
 
     } else {
 
+        CXPLAT_DBG_ASSERT(Builder->GatherSegmentCount == 0);
         QuicTraceEvent(
             PacketFinalize,
             "[pack][%llu] Finalizing",
@@ -83,6 +83,17 @@ typedef struct QUIC_PACKET_BUILDER {
     //
     uint8_t WrittenConnectionCloseFrame : 1;
 
+    //
+    // Indicates stream data may be encrypted directly from the send request
+    // buffers for the current QUIC packet.
+    //
+    uint8_t EncryptInCopy : 1;
+
+    //
+    // The number of (valid) entries in GatherSegments.
+    //
+    uint8_t GatherSegmentCount;
+
     //
     // The total number of datagrams that have been created.
     //
@@ -148,6 +159,12 @@ typedef struct QUIC_PACKET_BUILDER {
 
     uint64_t BatchId;
 
+    //
+    // Ranges of stream data in the current QUIC packet that haven't been copied
+    // in yet, and instead are encrypted directly from the send request buffers.
+    //
+    CXPLAT_CRYPT_SEGMENT GatherSegments[QUIC_MAX_ENCRYPT_GATHER_SEGMENTS];
+
     //
     // Represents the metadata of the current QUIC packet.
     //
@@ -181,6 +198,43 @@ QuicPacketBuilderCleanup(
     _Inout_ QUIC_PACKET_BUILDER* Builder
     );
 
+//
+// Tries to defer writing (copying) data into the current QUIC packet until
+// the packet is encrypted. Returns FALSE if the caller must copy it instead.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+QUIC_INLINE
+BOOLEAN
+QuicPacketBuilderAddGatherSegment(
+    _Inout_ QUIC_PACKET_BUILDER* Builder,
+    _In_ const uint8_t* Destination,
+    _In_reads_bytes_(Length)
+        const uint8_t* Source,
+    _In_ uint16_t Length
+    )
+{
+    if (!Builder->EncryptInCopy ||
+        Builder->GatherSegmentCount == QUIC_MAX_ENCRYPT_GATHER_SEGMENTS) {
+        return FALSE;
+    }
+
+    const uint8_t* Payload =
+        Builder->Datagram->Buffer + Builder->PacketStart + Builder->HeaderLength;
+    CXPLAT_DBG_ASSERT(Destination >= Payload);
+    CXPLAT_DBG_ASSERT(
+        Builder->GatherSegmentCount == 0 ||
+        Destination >= Payload +
+            Builder->GatherSegments[Builder->GatherSegmentCount - 1].Offset +
+            Builder->GatherSegments[Builder->GatherSegmentCount - 1].Length);
+
+    CXPLAT_CRYPT_SEGMENT* Segment =
+        &Builder->GatherSegments[Builder->GatherSegmentCount++];
+    Segment->Source = Source;
+    Segment->Offset = (uint16_t)(Destination - Payload);
+    Segment->Length = Length;
+    return TRUE;
+}
+
 //
 // Prepares the packet builder for framing control payload.
 //
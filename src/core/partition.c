@@ -31,6 +31,17 @@ QuicPartitionInitialize(
         return Status;
     }
 
+    Status =
+        QuicSessionCacheInitialize(
+            &Partition->SessionCache,
+            QUIC_SESSION_CACHE_PARTITION_MAX_BYTES,
+            QUIC_SESSION_CACHE_LIFETIME_US);
+    if (QUIC_FAILED(Status)) {
+        CxPlatHashFree(Partition->ResetTokenHash);
+        Partition->ResetTokenHash = NULL;
+        return Status;
+    }
+
     Partition->Index = Index;
     Partition->Processor = Processor;
     CxPlatPoolInitialize(FALSE, sizeof(QUIC_CONNECTION), QUIC_POOL_CONN, &Partition->ConnectionPool);
@@ -46,6 +57,10 @@ QuicPartitionInitialize(
     CxPlatPoolInitialize(FALSE, sizeof(QUIC_RECV_CHUNK), QUIC_POOL_APP_BUFFER_CHUNK, &Partition->AppBufferChunkPool);
     CxPlatLockInitialize(&Partition->ResetTokenLock);
     CxPlatDispatchLockInitialize(&Partition->StatelessRetryKeysLock);
+    CxPlatDispatchLockInitialize(&Partition->StatelessOperRateLock);
+    Partition->StatelessOperTokens = QUIC_STATELESS_OPERATION_BURST;
+    Partition->StatelessOperRefillTimeMs = CxPlatTimeMs32();
+    QuicReplayFilterInitialize(&Partition->ReplayFilter);
 
     return QUIC_STATUS_SUCCESS;
 }
@@ -71,17 +86,44 @@ QuicPartitionUninitialize(
     CxPlatPoolUninitialize(&Partition->AppBufferChunkPool);
     CxPlatLockUninitialize(&Partition->ResetTokenLock);
     CxPlatDispatchLockUninitialize(&Partition->StatelessRetryKeysLock);
+    CxPlatDispatchLockUninitialize(&Partition->StatelessOperRateLock);
+    QuicSessionCacheUninitialize(&Partition->SessionCache);
+    QuicReplayFilterUninitialize(&Partition->ReplayFilter);
     CxPlatHashFree(Partition->ResetTokenHash);
 }
 
+//
+// Drops the partition's cached keys if the global retry configuration changed
+// since they were derived, and refreshes the partition's copy of it.
+//
+_Requires_lock_held_(Partition->StatelessRetryKeysLock)
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+void
+QuicPartitionRefreshStatelessRetryConfig(
+    _In_ QUIC_PARTITION* Partition
+    )
+{
+    if (Partition->StatelessRetryGeneration == MsQuicLib.StatelessRetry.Generation) {
+        return;
+    }
+
+    CxPlatDispatchRwLockAcquireShared(&MsQuicLib.StatelessRetry.Lock, PrevIrql);
+    Partition->StatelessRetryGeneration = MsQuicLib.StatelessRetry.Generation;
+    Partition->StatelessRetryKeyRotationMs = MsQuicLib.StatelessRetry.KeyRotationMs;
+    CxPlatDispatchRwLockReleaseShared(&MsQuicLib.StatelessRetry.Lock, PrevIrql);
+
+    for (size_t i = 0; i < ARRAYSIZE(Partition->StatelessRetryKeys); ++i) {
+        CxPlatKeyFree(Partition->StatelessRetryKeys[i].Key);
+        Partition->StatelessRetryKeys[i].Key = NULL;
+    }
+}
+
 //
 // MUST be called while holding the per-partition StatelessRetryKeysLock to
-// ensure no-concurrent modification of the per-partition encryption key *AND*
-// while holding the the global MsQuicLib.StatelessRetry.Lock in shared mode to
-// ensure the configuration is read in a complete state.
+// ensure no-concurrent modification of the per-partition encryption key.
 //
 _Requires_lock_held_(Partition->StatelessRetryKeysLock)
-_Requires_shared_lock_held_(MsQuicLib.StatelessRetry.Lock)
 _IRQL_requires_max_(DISPATCH_LEVEL)
 _Ret_maybenull_
 CXPLAT_KEY*
@@ -93,14 +135,18 @@ QuicPartitionGetStatelessRetryKey(
     //
     // Check if the key is already generated.
     //
-    if (Partition->StatelessRetryKeys[KeyIndex & 1].Index == KeyIndex) {
+    if (Partition->StatelessRetryKeys[KeyIndex & 1].Key != NULL &&
+        Partition->StatelessRetryKeys[KeyIndex & 1].Index == KeyIndex) {
         return Partition->StatelessRetryKeys[KeyIndex & 1].Key;
     }
 
     //
     // Generate a new key from the base retry secret using SP800-108 CTR-HMAC.
+    // The global lock ensures the configuration is read in a complete state.
     //
     uint8_t RawKey[CXPLAT_AEAD_MAX_SIZE];
+    CxPlatDispatchRwLockAcquireShared(&MsQuicLib.StatelessRetry.Lock, PrevIrql);
+    const CXPLAT_AEAD_TYPE AeadAlgorithm = MsQuicLib.StatelessRetry.AeadAlgorithm;
     QUIC_STATUS Status =
         CxPlatKbKdfDerive(
             MsQuicLib.StatelessRetry.BaseSecret,
@@ -110,6 +156,7 @@ QuicPartitionGetStatelessRetryKey(
             sizeof(KeyIndex),
             MsQuicLib.StatelessRetry.SecretLength,
             RawKey);
+    CxPlatDispatchRwLockReleaseShared(&MsQuicLib.StatelessRetry.Lock, PrevIrql);
     if (QUIC_FAILED(Status)) {
         return NULL;
     }
@@ -117,7 +164,7 @@ QuicPartitionGetStatelessRetryKey(
     CXPLAT_KEY* NewKey;
     Status =
         CxPlatKeyCreate(
-            MsQuicLib.StatelessRetry.AeadAlgorithm,
+            AeadAlgorithm,
             RawKey,
             &NewKey);
     if (QUIC_FAILED(Status)) {
@@ -146,12 +193,10 @@ QuicPartitionGetCurrentStatelessRetryKey(
     _In_ QUIC_PARTITION* Partition
     )
 {
+    QuicPartitionRefreshStatelessRetryConfig(Partition);
     const int64_t Now = CxPlatTimeEpochMs64();
-    CxPlatDispatchRwLockAcquireShared(&MsQuicLib.StatelessRetry.Lock, PrevIrql);
-    const int64_t KeyIndex = Now / MsQuicLib.StatelessRetry.KeyRotationMs;
-    CXPLAT_KEY* Key = QuicPartitionGetStatelessRetryKey(Partition, KeyIndex);
-    CxPlatDispatchRwLockReleaseShared(&MsQuicLib.StatelessRetry.Lock, PrevIrql);
-    return Key;
+    const int64_t KeyIndex = Now / Partition->StatelessRetryKeyRotationMs;
+    return QuicPartitionGetStatelessRetryKey(Partition, KeyIndex);
 }
 
 _IRQL_requires_max_(DISPATCH_LEVEL)
@@ -163,20 +208,56 @@ QuicPartitionGetStatelessRetryKeyForTimestamp(
     _In_ int64_t Timestamp
     )
 {
+    QuicPartitionRefreshStatelessRetryConfig(Partition);
     const int64_t Now = CxPlatTimeEpochMs64();
-    CxPlatDispatchRwLockAcquireShared(&MsQuicLib.StatelessRetry.Lock, PrevIrql);
-    const int64_t CurrentKeyIndex = Now / MsQuicLib.StatelessRetry.KeyRotationMs;
-    const int64_t KeyIndex = Timestamp / MsQuicLib.StatelessRetry.KeyRotationMs;
+    const int64_t CurrentKeyIndex = Now / Partition->StatelessRetryKeyRotationMs;
+    const int64_t KeyIndex = Timestamp / Partition->StatelessRetryKeyRotationMs;
 
     if (KeyIndex < CurrentKeyIndex - 1 || KeyIndex > CurrentKeyIndex) {
         //
         // This key index is too old or too new.
         //
-        CxPlatDispatchRwLockReleaseShared(&MsQuicLib.StatelessRetry.Lock, PrevIrql);
         return NULL;
     }
 
-    CXPLAT_KEY* Key = QuicPartitionGetStatelessRetryKey(Partition, KeyIndex);
-    CxPlatDispatchRwLockReleaseShared(&MsQuicLib.StatelessRetry.Lock, PrevIrql);
-    return Key;
+    return QuicPartitionGetStatelessRetryKey(Partition, KeyIndex);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicPartitionTryConsumeStatelessOperToken(
+    _In_ QUIC_PARTITION* Partition,
+    _In_ uint32_t TimeMs
+    )
+{
+    BOOLEAN Result = FALSE;
+
+    CxPlatDispatchLockAcquire(&Partition->StatelessOperRateLock);
+
+    //
+    // Callers on other processors may pass a slightly older time than the last
+    // refill, so only move forward in time. The refill time is only updated
+    // when at least one token is added, so that low rates don't round away.
+    //
+    const int32_t Elapsed = (int32_t)(TimeMs - Partition->StatelessOperRefillTimeMs);
+    if (Elapsed > 0) {
+        const uint64_t NewTokens =
+            ((uint64_t)Elapsed * QUIC_STATELESS_OPERATION_RATE) / 1000;
+        if (NewTokens != 0) {
+            Partition->StatelessOperTokens =
+                (uint32_t)CXPLAT_MIN(
+                    (uint64_t)Partition->StatelessOperTokens + NewTokens,
+                    QUIC_STATELESS_OPERATION_BURST);
+            Partition->StatelessOperRefillTimeMs = TimeMs;
+        }
+    }
+
+    if (Partition->StatelessOperTokens != 0) {
+        Partition->StatelessOperTokens--;
+        Result = TRUE;
+    }
+
+    CxPlatDispatchLockRelease(&Partition->StatelessOperRateLock);
+
+    return Result;
 }
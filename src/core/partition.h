@@ -74,10 +74,22 @@ typedef struct QUIC_CACHEALIGN QUIC_PARTITION {
     CXPLAT_LOCK ResetTokenLock;
 
     //
-    // Two most recent keys used for generating stateless retries.
+    // Two most recent keys used for generating stateless retries, along with
+    // a copy of the retry configuration they were derived from, so that the
+    // global configuration lock is only needed to derive a new key.
     //
     CXPLAT_DISPATCH_LOCK StatelessRetryKeysLock;
     QUIC_RETRY_KEY StatelessRetryKeys[2];
+    uint32_t StatelessRetryGeneration;
+    uint32_t StatelessRetryKeyRotationMs;
+
+    //
+    // Token bucket limiting the rate of stateless operations (version
+    // negotiation, stateless reset and retry) queued to this partition.
+    //
+    CXPLAT_DISPATCH_LOCK StatelessOperRateLock;
+    uint32_t StatelessOperTokens;
+    uint32_t StatelessOperRefillTimeMs;
 
     //
     // Pools for allocations.
@@ -94,6 +106,17 @@ typedef struct QUIC_CACHEALIGN QUIC_PARTITION {
     CXPLAT_POOL OperPool;                   // QUIC_OPERATION
     CXPLAT_POOL AppBufferChunkPool;         // QUIC_RECV_CHUNK
 
+    //
+    // This partition's shard of the server-side session cache.
+    //
+    QUIC_SESSION_CACHE SessionCache;
+
+    //
+    // A shard of the 0-RTT replay filter. Note that ClientHellos are assigned
+    // to shards by hash, not by the partition of their connection.
+    //
+    QUIC_REPLAY_FILTER ReplayFilter;
+
     //
     // Per-processor performance counters.
     //
@@ -143,6 +166,17 @@ QuicPartitionGetStatelessRetryKeyForTimestamp(
     _In_ int64_t Timestamp
     );
 
+//
+// Takes a token from the partition's stateless operation bucket. Returns FALSE
+// if the partition has exceeded its stateless operation rate.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicPartitionTryConsumeStatelessOperToken(
+    _In_ QUIC_PARTITION* Partition,
+    _In_ uint32_t TimeMs
+    );
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 QUIC_INLINE
 QUIC_STATUS
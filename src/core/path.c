@@ -46,6 +46,41 @@ QuicPathInitialize(
         Path->ID);
 }
 
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicConnGrowPaths(
+    _In_ QUIC_CONNECTION* Connection
+    )
+{
+    if (Connection->Paths != &Connection->InitialPath) {
+        return TRUE;
+    }
+
+    CXPLAT_DBG_ASSERT(Connection->PathsCount <= 1);
+    QUIC_PATH* Paths =
+        CXPLAT_ALLOC_NONPAGED(QUIC_MAX_PATH_COUNT * sizeof(QUIC_PATH), QUIC_POOL_PATHS);
+    if (Paths == NULL) {
+        QuicTraceEvent(
+            AllocFailure,
+            "Allocation of '%s' failed. (%llu bytes)",
+            "paths",
+            QUIC_MAX_PATH_COUNT * sizeof(QUIC_PATH));
+        return FALSE;
+    }
+
+    CxPlatZeroMemory(Paths, QUIC_MAX_PATH_COUNT * sizeof(QUIC_PATH));
+    Paths[0] = Connection->InitialPath;
+#if DEBUG
+    if (Paths[0].DestCid != NULL &&
+        Paths[0].DestCid->AssignedPath == &Connection->InitialPath) {
+        Paths[0].DestCid->AssignedPath = &Paths[0];
+    }
+#endif
+    Connection->Paths = Paths;
+
+    return TRUE;
+}
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 void
 QuicPathRemove(
@@ -261,6 +296,10 @@ QuicConnGetPathForPacket(
         }
     }
 
+    if (!QuicConnGrowPaths(Connection)) {
+        return NULL;
+    }
+
     if (!QuicLibraryTryAddRefBinding(Connection->Paths[0].Binding)) {
         return NULL;
     }
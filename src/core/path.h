@@ -209,6 +209,18 @@ QuicPathInitialize(
     _In_ QUIC_PATH* Path
     );
 
+//
+// Moves the connection's paths from its inline storage, which only has room
+// for the first path, to a full array of QUIC_MAX_PATH_COUNT paths. Must be
+// called before adding a second path. Returns FALSE on allocation failure.
+// Any pointers to the first path are invalidated.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+BOOLEAN
+QuicConnGrowPaths(
+    _In_ QUIC_CONNECTION* Connection
+    );
+
 _IRQL_requires_max_(PASSIVE_LEVEL)
 void
 QuicPathRemove(
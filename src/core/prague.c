@@ -0,0 +1,614 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    A scalable (L4S) congestion controller modeled after TCP Prague and DCTCP.
+
+    Packets are marked ECT(1) and the congestion window is reduced, at most
+    once per round trip, in proportion to the fraction of bytes that the
+    network marked CE (alpha), instead of by a fixed factor. This keeps the
+    bottleneck queue short while still filling the link. Loss is treated as
+    a classic congestion signal and halves the window.
+
+--*/
+
+#include "precomp.h"
+#ifdef QUIC_CLOG
+#include "prague.c.clog.h"
+#endif
+
+#include "prague.h"
+
+//
+// Gain of the alpha EWMA, as a shift (g = 1/16, as for DCTCP).
+//
+#define PRAGUE_ALPHA_GAIN_SHIFT 4
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+PragueCongestionControlCanSend(
+    _In_ QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+    return Prague->BytesInFlight < Prague->CongestionWindow || Prague->Exemptions > 0;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+PragueCongestionControlSetExemption(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint8_t NumPackets
+    )
+{
+    Cc->Prague.Exemptions = NumPackets;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+PragueCongestionControlReset(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ BOOLEAN FullReset
+    )
+{
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    const uint16_t DatagramPayloadLength =
+        QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+    Prague->SlowStartThreshold = UINT32_MAX;
+    Prague->IsInRecovery = FALSE;
+    Prague->HasHadCongestionEvent = FALSE;
+    Prague->HasHadEcnReduction = FALSE;
+    Prague->CongestionWindow = DatagramPayloadLength * Prague->InitialWindowPackets;
+    Prague->BytesInFlightMax = Prague->CongestionWindow / 2;
+    Prague->LastSendAllowance = 0;
+    Prague->AiAccumulator = 0;
+    Prague->Alpha = PRAGUE_ALPHA_MAX;
+    Prague->RoundAckedBytes = 0;
+    Prague->RoundCeBytes = 0;
+    Prague->RoundEnd = 0;
+    if (FullReset) {
+        Prague->BytesInFlight = 0;
+    }
+
+    QuicConnLogOutFlowStats(Connection);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint32_t
+PragueCongestionControlGetSendAllowance(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint64_t TimeSinceLastSend, // microsec
+    _In_ BOOLEAN TimeSinceLastSendValid
+    )
+{
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    uint32_t SendAllowance;
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    if (Prague->BytesInFlight >= Prague->CongestionWindow) {
+        //
+        // We are CC blocked, so we can't send anything.
+        //
+        SendAllowance = 0;
+
+    } else if (
+        !TimeSinceLastSendValid ||
+        !Connection->Settings.PacingEnabled ||
+        !Connection->Paths[0].GotFirstRttSample ||
+        Connection->Paths[0].SmoothedRtt < QUIC_MIN_PACING_RTT) {
+        //
+        // We're not in the necessary state to pace.
+        //
+        SendAllowance = Prague->CongestionWindow - Prague->BytesInFlight;
+
+    } else {
+        //
+        // Pace at the predicted window of the next round trip over the RTT:
+        // double the window in slow start and 25% more in congestion
+        // avoidance. Scalable marking relies on smooth arrivals at the
+        // bottleneck, so pacing matters more here than for loss based
+        // algorithms.
+        //
+        uint64_t EstimatedWnd;
+        if (Prague->CongestionWindow < Prague->SlowStartThreshold) {
+            EstimatedWnd = (uint64_t)Prague->CongestionWindow << 1;
+            if (EstimatedWnd > Prague->SlowStartThreshold) {
+                EstimatedWnd = Prague->SlowStartThreshold;
+            }
+        } else {
+            EstimatedWnd = Prague->CongestionWindow + (Prague->CongestionWindow >> 2);
+        }
+
+        SendAllowance =
+            Prague->LastSendAllowance +
+            (uint32_t)((EstimatedWnd * TimeSinceLastSend) / Connection->Paths[0].SmoothedRtt);
+        if (SendAllowance < Prague->LastSendAllowance || // Overflow case
+            SendAllowance > (Prague->CongestionWindow - Prague->BytesInFlight)) {
+            SendAllowance = Prague->CongestionWindow - Prague->BytesInFlight;
+        }
+
+        Prague->LastSendAllowance = SendAllowance;
+    }
+    return SendAllowance;
+}
+
+//
+// Returns TRUE if we became unblocked.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+PragueCongestionControlUpdateBlockedState(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ BOOLEAN PreviousCanSendState
+    )
+{
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    QuicConnLogOutFlowStats(Connection);
+    if (PreviousCanSendState != PragueCongestionControlCanSend(Cc)) {
+        if (PreviousCanSendState) {
+            QuicConnAddOutFlowBlockedReason(
+                Connection, QUIC_FLOW_BLOCKED_CONGESTION_CONTROL);
+        } else {
+            QuicConnRemoveOutFlowBlockedReason(
+                Connection, QUIC_FLOW_BLOCKED_CONGESTION_CONTROL);
+            Connection->Send.LastFlushTime = CxPlatTimeUs64(); // Reset last flush time
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+PragueCongestionControlOnDataSent(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint32_t NumRetransmittableBytes
+    )
+{
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    BOOLEAN PreviousCanSendState = PragueCongestionControlCanSend(Cc);
+
+    Prague->BytesInFlight += NumRetransmittableBytes;
+    if (Prague->BytesInFlightMax < Prague->BytesInFlight) {
+        Prague->BytesInFlightMax = Prague->BytesInFlight;
+        QuicSendBufferConnectionAdjust(QuicCongestionControlGetConnection(Cc));
+    }
+
+    if (NumRetransmittableBytes > Prague->LastSendAllowance) {
+        Prague->LastSendAllowance = 0;
+    } else {
+        Prague->LastSendAllowance -= NumRetransmittableBytes;
+    }
+
+    if (Prague->Exemptions > 0) {
+        --Prague->Exemptions;
+    }
+
+    PragueCongestionControlUpdateBlockedState(Cc, PreviousCanSendState);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+PragueCongestionControlOnDataInvalidated(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ uint32_t NumRetransmittableBytes
+    )
+{
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    BOOLEAN PreviousCanSendState = PragueCongestionControlCanSend(Cc);
+
+    CXPLAT_DBG_ASSERT(Prague->BytesInFlight >= NumRetransmittableBytes);
+    Prague->BytesInFlight -= NumRetransmittableBytes;
+
+    return PragueCongestionControlUpdateBlockedState(Cc, PreviousCanSendState);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+PragueCongestionControlGetNetworkStatistics(
+    _In_ const QUIC_CONNECTION* const Connection,
+    _In_ const QUIC_CONGESTION_CONTROL* const Cc,
+    _Out_ QUIC_NETWORK_STATISTICS* NetworkStatistics
+    )
+{
+    const QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+    const QUIC_PATH* Path = &Connection->Paths[0];
+
+    NetworkStatistics->BytesInFlight = Prague->BytesInFlight;
+    NetworkStatistics->PostedBytes = Connection->SendBuffer.PostedBytes;
+    NetworkStatistics->IdealBytes = Connection->SendBuffer.IdealBytes;
+    NetworkStatistics->SmoothedRTT = Path->SmoothedRtt;
+    NetworkStatistics->CongestionWindow = Prague->CongestionWindow;
+    NetworkStatistics->Bandwidth = Prague->CongestionWindow / Path->SmoothedRtt;
+}
+
+//
+// Folds the CE marked fraction of the round trip that just ended into alpha.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+PragueCongestionControlUpdateAlpha(
+    _In_ QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    if (Prague->RoundAckedBytes == 0) {
+        return;
+    }
+
+    const uint64_t CeBytes = CXPLAT_MIN(Prague->RoundCeBytes, Prague->RoundAckedBytes);
+    const uint32_t Fraction =
+        (uint32_t)((CeBytes << PRAGUE_ALPHA_SHIFT) / Prague->RoundAckedBytes);
+
+    Prague->Alpha =
+        Prague->Alpha - (Prague->Alpha >> PRAGUE_ALPHA_GAIN_SHIFT) +
+        (Fraction >> PRAGUE_ALPHA_GAIN_SHIFT);
+    if (Prague->Alpha > PRAGUE_ALPHA_MAX) {
+        Prague->Alpha = PRAGUE_ALPHA_MAX;
+    }
+
+    QuicTraceLogConnVerbose(
+        PragueAlphaUpdate,
+        QuicCongestionControlGetConnection(Cc),
+        "Prague: Alpha=%u CeFraction=%u CongestionWindow=%u",
+        Prague->Alpha,
+        Fraction,
+        Prague->CongestionWindow);
+
+    Prague->RoundAckedBytes = 0;
+    Prague->RoundCeBytes = 0;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+PragueCongestionControlOnDataAcknowledged(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_ACK_EVENT* AckEvent
+    )
+{
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    BOOLEAN PreviousCanSendState = PragueCongestionControlCanSend(Cc);
+    uint32_t BytesAcked = AckEvent->NumRetransmittableBytes;
+
+    CXPLAT_DBG_ASSERT(Prague->BytesInFlight >= BytesAcked);
+    Prague->BytesInFlight -= BytesAcked;
+
+    Prague->RoundAckedBytes += BytesAcked;
+    if (AckEvent->LargestAck >= Prague->RoundEnd) {
+        PragueCongestionControlUpdateAlpha(Cc);
+        Prague->RoundEnd = AckEvent->LargestSentPacketNumber + 1;
+    }
+
+    if (Prague->IsInRecovery) {
+        if (AckEvent->LargestAck > Prague->RecoverySentPacketNumber) {
+            QuicTraceEvent(
+                ConnRecoveryExit,
+                "[conn][%p] Recovery complete",
+                Connection);
+            Prague->IsInRecovery = FALSE;
+            Prague->IsInPersistentCongestion = FALSE;
+        }
+        goto Exit;
+    } else if (BytesAcked == 0) {
+        goto Exit;
+    }
+
+    if (Prague->CongestionWindow < Prague->SlowStartThreshold) {
+        //
+        // Slow Start
+        //
+        Prague->CongestionWindow += BytesAcked;
+        BytesAcked = 0;
+        if (Prague->CongestionWindow >= Prague->SlowStartThreshold) {
+            BytesAcked = Prague->CongestionWindow - Prague->SlowStartThreshold;
+            Prague->CongestionWindow = Prague->SlowStartThreshold;
+        }
+    }
+
+    if (BytesAcked > 0) {
+        //
+        // Congestion Avoidance: additive increase of one packet per window
+        // worth of acknowledged bytes.
+        //
+        const uint16_t DatagramPayloadLength =
+            QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+        Prague->AiAccumulator += BytesAcked;
+        if (Prague->AiAccumulator >= Prague->CongestionWindow) {
+            Prague->AiAccumulator -= Prague->CongestionWindow;
+            Prague->CongestionWindow += DatagramPayloadLength;
+        }
+    }
+
+    //
+    // Limit the growth of the window based on the number of bytes we
+    // actually manage to put on the wire.
+    //
+    if (Prague->CongestionWindow > 2 * Prague->BytesInFlightMax) {
+        Prague->CongestionWindow = 2 * Prague->BytesInFlightMax;
+    }
+
+Exit:
+
+    if (Connection->Settings.NetStatsEventEnabled) {
+        const QUIC_PATH* Path = &Connection->Paths[0];
+        QUIC_CONNECTION_EVENT Event;
+        Event.Type = QUIC_CONNECTION_EVENT_NETWORK_STATISTICS;
+        Event.NETWORK_STATISTICS.BytesInFlight = Prague->BytesInFlight;
+        Event.NETWORK_STATISTICS.PostedBytes = Connection->SendBuffer.PostedBytes;
+        Event.NETWORK_STATISTICS.IdealBytes = Connection->SendBuffer.IdealBytes;
+        Event.NETWORK_STATISTICS.SmoothedRTT = Path->SmoothedRtt;
+        Event.NETWORK_STATISTICS.CongestionWindow = Prague->CongestionWindow;
+        Event.NETWORK_STATISTICS.Bandwidth = Prague->CongestionWindow / Path->SmoothedRtt;
+        QuicConnIndicateEvent(Connection, &Event);
+    }
+
+    return PragueCongestionControlUpdateBlockedState(Cc, PreviousCanSendState);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+PragueCongestionControlOnDataLost(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_LOSS_EVENT* LossEvent
+    )
+{
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    BOOLEAN PreviousCanSendState = PragueCongestionControlCanSend(Cc);
+
+    if (!Prague->HasHadCongestionEvent ||
+        LossEvent->LargestPacketNumberLost > Prague->RecoverySentPacketNumber) {
+
+        const uint16_t DatagramPayloadLength =
+            QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+        const uint32_t MinWindow =
+            (uint32_t)DatagramPayloadLength * QUIC_PERSISTENT_CONGESTION_WINDOW_PACKETS;
+
+        QuicTraceEvent(
+            ConnCongestionV2,
+            "[conn][%p] Congestion event: IsEcn=%hu",
+            Connection,
+            FALSE);
+        Connection->Stats.Send.CongestionCount++;
+
+        Prague->RecoverySentPacketNumber = LossEvent->LargestSentPacketNumber;
+        Prague->IsInRecovery = TRUE;
+        Prague->HasHadCongestionEvent = TRUE;
+        Prague->PrevCongestionWindow = Prague->CongestionWindow;
+        Prague->PrevSlowStartThreshold = Prague->SlowStartThreshold;
+
+        if (LossEvent->PersistentCongestion && !Prague->IsInPersistentCongestion) {
+            QuicTraceEvent(
+                ConnPersistentCongestion,
+                "[conn][%p] Persistent congestion event",
+                Connection);
+            Connection->Stats.Send.PersistentCongestionCount++;
+            Connection->Paths[0].Route.State = RouteSuspected; // used only for RAW datapath
+
+            Prague->IsInPersistentCongestion = TRUE;
+            Prague->SlowStartThreshold = CXPLAT_MAX(MinWindow, Prague->CongestionWindow / 2);
+            Prague->CongestionWindow = MinWindow;
+        } else {
+            Prague->SlowStartThreshold =
+            Prague->CongestionWindow =
+                CXPLAT_MAX(MinWindow, Prague->CongestionWindow / 2);
+        }
+        Prague->AiAccumulator = 0;
+    }
+
+    CXPLAT_DBG_ASSERT(Prague->BytesInFlight >= LossEvent->NumRetransmittableBytes);
+    Prague->BytesInFlight -= LossEvent->NumRetransmittableBytes;
+
+    PragueCongestionControlUpdateBlockedState(Cc, PreviousCanSendState);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+PragueCongestionControlOnEcn(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_ECN_EVENT* EcnEvent
+    )
+{
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    BOOLEAN PreviousCanSendState = PragueCongestionControlCanSend(Cc);
+    const uint16_t DatagramPayloadLength =
+        QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+
+    //
+    // ACK_ECN only reports packet counts. Nearly all marked packets of a bulk
+    // flow are full sized, so estimate the marked bytes from the count.
+    //
+    Prague->RoundCeBytes += (uint64_t)EcnEvent->CePacketCount * DatagramPayloadLength;
+
+    //
+    // Reduce the window once per round trip, by alpha/2. A loss recovery
+    // already in progress has made a bigger reduction.
+    //
+    if (!Prague->IsInRecovery &&
+        (!Prague->HasHadEcnReduction ||
+         EcnEvent->LargestPacketNumberAcked > Prague->CwrSentPacketNumber)) {
+
+        const uint32_t MinWindow =
+            (uint32_t)DatagramPayloadLength * QUIC_PERSISTENT_CONGESTION_WINDOW_PACKETS;
+
+        QuicTraceEvent(
+            ConnCongestionV2,
+            "[conn][%p] Congestion event: IsEcn=%hu",
+            Connection,
+            TRUE);
+        Connection->Stats.Send.CongestionCount++;
+        Connection->Stats.Send.EcnCongestionCount++;
+
+        Prague->HasHadEcnReduction = TRUE;
+        Prague->CwrSentPacketNumber = EcnEvent->LargestSentPacketNumber;
+
+        const uint32_t Reduction =
+            (uint32_t)(((uint64_t)Prague->CongestionWindow * Prague->Alpha) >>
+                (PRAGUE_ALPHA_SHIFT + 1));
+        Prague->SlowStartThreshold =
+        Prague->CongestionWindow =
+            CXPLAT_MAX(MinWindow, Prague->CongestionWindow - Reduction);
+
+        QuicTraceLogConnVerbose(
+            PragueEcnReduction,
+            Connection,
+            "Prague: CE reduction Alpha=%u CongestionWindow=%u",
+            Prague->Alpha,
+            Prague->CongestionWindow);
+    }
+
+    PragueCongestionControlUpdateBlockedState(Cc, PreviousCanSendState);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+PragueCongestionControlOnSpuriousCongestionEvent(
+    _In_ QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    if (!Prague->IsInRecovery) {
+        return FALSE;
+    }
+
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    BOOLEAN PreviousCanSendState = PragueCongestionControlCanSend(Cc);
+
+    QuicTraceEvent(
+        ConnSpuriousCongestion,
+        "[conn][%p] Spurious congestion event",
+        Connection);
+
+    Prague->SlowStartThreshold = Prague->PrevSlowStartThreshold;
+    Prague->CongestionWindow = Prague->PrevCongestionWindow;
+    Prague->IsInRecovery = FALSE;
+    Prague->HasHadCongestionEvent = FALSE;
+
+    return PragueCongestionControlUpdateBlockedState(Cc, PreviousCanSendState);
+}
+
+void
+PragueCongestionControlLogOutFlowStatus(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    const QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    const QUIC_PATH* Path = &Connection->Paths[0];
+    const QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    QuicTraceEvent(
+        ConnOutFlowStatsV2,
+        "[conn][%p] OUT: BytesSent=%llu InFlight=%u CWnd=%u ConnFC=%llu ISB=%llu PostedBytes=%llu SRtt=%llu 1Way=%llu",
+        Connection,
+        Connection->Stats.Send.TotalBytes,
+        Prague->BytesInFlight,
+        Prague->CongestionWindow,
+        Connection->Send.PeerMaxData - Connection->Send.OrderedStreamBytesSent,
+        Connection->SendBuffer.IdealBytes,
+        Connection->SendBuffer.PostedBytes,
+        Path->GotFirstRttSample ? Path->SmoothedRtt : 0,
+        Path->OneWayDelay);
+}
+
+uint32_t
+PragueCongestionControlGetBytesInFlightMax(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    return Cc->Prague.BytesInFlightMax;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint8_t
+PragueCongestionControlGetExemptions(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    return Cc->Prague.Exemptions;
+}
+
+uint32_t
+PragueCongestionControlGetCongestionWindow(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    return Cc->Prague.CongestionWindow;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+PragueCongestionControlIsAppLimited(
+    _In_ const QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    UNREFERENCED_PARAMETER(Cc);
+    return FALSE;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+PragueCongestionControlSetAppLimited(
+    _In_ struct QUIC_CONGESTION_CONTROL* Cc
+    )
+{
+    UNREFERENCED_PARAMETER(Cc);
+}
+
+static const QUIC_CONGESTION_CONTROL QuicCongestionControlPrague = {
+    .Name = "Prague",
+    .UseEct1 = TRUE,
+    .QuicCongestionControlCanSend = PragueCongestionControlCanSend,
+    .QuicCongestionControlSetExemption = PragueCongestionControlSetExemption,
+    .QuicCongestionControlReset = PragueCongestionControlReset,
+    .QuicCongestionControlGetSendAllowance = PragueCongestionControlGetSendAllowance,
+    .QuicCongestionControlOnDataSent = PragueCongestionControlOnDataSent,
+    .QuicCongestionControlOnDataInvalidated = PragueCongestionControlOnDataInvalidated,
+    .QuicCongestionControlOnDataAcknowledged = PragueCongestionControlOnDataAcknowledged,
+    .QuicCongestionControlOnDataLost = PragueCongestionControlOnDataLost,
+    .QuicCongestionControlOnEcn = PragueCongestionControlOnEcn,
+    .QuicCongestionControlOnSpuriousCongestionEvent = PragueCongestionControlOnSpuriousCongestionEvent,
+    .QuicCongestionControlLogOutFlowStatus = PragueCongestionControlLogOutFlowStatus,
+    .QuicCongestionControlGetExemptions = PragueCongestionControlGetExemptions,
+    .QuicCongestionControlGetBytesInFlightMax = PragueCongestionControlGetBytesInFlightMax,
+    .QuicCongestionControlIsAppLimited = PragueCongestionControlIsAppLimited,
+    .QuicCongestionControlSetAppLimited = PragueCongestionControlSetAppLimited,
+    .QuicCongestionControlGetCongestionWindow = PragueCongestionControlGetCongestionWindow,
+    .QuicCongestionControlGetNetworkStatistics = PragueCongestionControlGetNetworkStatistics
+};
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+PragueCongestionControlInitialize(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_SETTINGS_INTERNAL* Settings
+    )
+{
+    *Cc = QuicCongestionControlPrague;
+
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    QUIC_CONNECTION* Connection = QuicCongestionControlGetConnection(Cc);
+    const uint16_t DatagramPayloadLength =
+        QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+    Prague->InitialWindowPackets = Settings->InitialWindowPackets;
+    Prague->SlowStartThreshold = UINT32_MAX;
+    Prague->CongestionWindow = DatagramPayloadLength * Prague->InitialWindowPackets;
+    Prague->BytesInFlightMax = Prague->CongestionWindow / 2;
+    Prague->Alpha = PRAGUE_ALPHA_MAX;
+
+    QuicConnLogOutFlowStats(Connection);
+}
@@ -0,0 +1,114 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+--*/
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//
+// Fixed point scale of the Prague/DCTCP congestion estimate (alpha).
+//
+#define PRAGUE_ALPHA_SHIFT 10
+#define PRAGUE_ALPHA_MAX (1u << PRAGUE_ALPHA_SHIFT)
+
+typedef struct QUIC_CONGESTION_CONTROL_PRAGUE {
+
+    //
+    // TRUE if we have had at least one loss based congestion event.
+    // If TRUE, RecoverySentPacketNumber is valid.
+    //
+    BOOLEAN HasHadCongestionEvent : 1;
+
+    //
+    // This flag indicates a loss based congestion event occurred and CC is
+    // attempting to recover from it.
+    //
+    BOOLEAN IsInRecovery : 1;
+
+    //
+    // This flag indicates a persistent congestion event occurred and CC is
+    // attempting to recover from it.
+    //
+    BOOLEAN IsInPersistentCongestion : 1;
+
+    //
+    // TRUE if the window has been reduced in response to CE marks. If TRUE,
+    // CwrSentPacketNumber is valid.
+    //
+    BOOLEAN HasHadEcnReduction : 1;
+
+    //
+    // The size of the initial congestion window, in packets.
+    //
+    uint32_t InitialWindowPackets;
+
+    uint32_t CongestionWindow; // bytes
+    uint32_t PrevCongestionWindow; // bytes
+    uint32_t SlowStartThreshold; // bytes
+    uint32_t PrevSlowStartThreshold; // bytes
+    uint32_t AiAccumulator; // bytes
+
+    //
+    // The number of bytes considered to be still in the network.
+    //
+    uint32_t BytesInFlight;
+    uint32_t BytesInFlightMax;
+
+    //
+    // The leftover send allowance from a previous send. Only used when pacing.
+    //
+    uint32_t LastSendAllowance; // bytes
+
+    //
+    // A count of packets which can be sent ignoring CongestionWindow.
+    //
+    uint8_t Exemptions;
+
+    //
+    // EWMA of the fraction of acknowledged bytes that were CE marked, in units
+    // of 1/PRAGUE_ALPHA_MAX. Updated once per round trip.
+    //
+    uint32_t Alpha;
+
+    //
+    // Acknowledged and (estimated) CE marked bytes in the current round trip.
+    //
+    uint64_t RoundAckedBytes;
+    uint64_t RoundCeBytes;
+
+    //
+    // The round trip ends when a packet sent after this one is acknowledged.
+    //
+    uint64_t RoundEnd; // Packet Number
+
+    //
+    // The largest packet that was outstanding at the time of the last loss
+    // based congestion event.
+    //
+    uint64_t RecoverySentPacketNumber;
+
+    //
+    // The largest packet that was outstanding at the time of the last CE
+    // driven window reduction. The window is reduced at most once per round
+    // trip.
+    //
+    uint64_t CwrSentPacketNumber;
+
+} QUIC_CONGESTION_CONTROL_PRAGUE;
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+PragueCongestionControlInitialize(
+    _In_ QUIC_CONGESTION_CONTROL* Cc,
+    _In_ const QUIC_SETTINGS_INTERNAL* Settings
+    );
+
+#if defined(__cplusplus)
+}
+#endif
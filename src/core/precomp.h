@@ -50,7 +50,11 @@
 #include "timer_wheel.h"
 #include "settings.h"
 #include "sent_packet_metadata.h"
+#include "session_cache.h"
+#include "replay_filter.h"
+#include "source_limiter.h"
 #include "partition.h"
+#include "crypto_pool.h"
 #include "library.h"
 #include "operation.h"
 #include "binding.h"
@@ -68,16 +68,28 @@ typedef struct QUIC_RX_PACKET QUIC_RX_PACKET;
 #define QUIC_AMPLIFICATION_RATIO                3
 
 //
-// The max expected reordering in terms of number of packets
-// (for FACK loss detection).
+// The initial max expected reordering in terms of number of packets
+// (for FACK loss detection), and how far it may grow on paths found to
+// reorder packets.
 //
 #define QUIC_PACKET_REORDER_THRESHOLD           3
+#define QUIC_MAX_PACKET_REORDER_THRESHOLD       32
 
 //
-// The max expected reordering in terms of time
-// (for RACK loss detection).
+// The max expected reordering in terms of time (for RACK loss detection): one
+// RTT plus the given number of eighths of an RTT. It starts at 9/8 RTT and may
+// grow to 2 RTT on paths found to reorder packets.
 //
-#define QUIC_TIME_REORDER_THRESHOLD(rtt)        ((rtt) + ((rtt) / 8))
+#define QUIC_TIME_REORDER_THRESHOLD(rtt, eighths) ((rtt) + ((rtt) * (eighths) / 8))
+#define QUIC_TIME_REORDER_EIGHTHS               1
+#define QUIC_MAX_TIME_REORDER_EIGHTHS           8
+
+//
+// The number of loss events without any spurious loss after which the
+// reordering thresholds return to their initial values (RACK-TLP's
+// reo_wnd_persist).
+//
+#define QUIC_REORDER_WINDOW_PERSIST             16
 
 //
 // Number of consecutive PTOs after which the network is considered to be
@@ -109,6 +121,25 @@ typedef struct QUIC_RX_PACKET QUIC_RX_PACKET;
 //
 #define QUIC_MIN_REORDERING_THRESHOLD           1
 
+//
+// When adaptive ACK frequency is enabled, the peer is asked to acknowledge
+// (at least) this many times per congestion window.
+//
+#define QUIC_ADAPTIVE_ACKS_PER_CWND             4
+
+//
+// The maximum packet tolerance requested of the peer by the adaptive ACK
+// frequency logic.
+//
+#define QUIC_ADAPTIVE_MAX_ACK_SEND_NUMBER       64
+
+//
+// The maximum ACK delay (in ms) requested of the peer by the adaptive ACK
+// frequency logic. The requested value is a fraction (1/QUIC_ADAPTIVE_ACKS_PER_CWND)
+// of the smoothed RTT, capped by this.
+//
+#define QUIC_ADAPTIVE_MAX_ACK_DELAY_MS          25
+
 //
 // The size of the stateless reset token.
 //
@@ -165,6 +196,19 @@ typedef struct QUIC_RX_PACKET QUIC_RX_PACKET;
 //
 #define QUIC_MAX_BINDING_STATELESS_OPERATIONS   100
 
+//
+// The maximum number of Initial packets with retry tokens, from one receive
+// batch, that are validated together.
+//
+#define QUIC_RETRY_TOKEN_BATCH_SIZE             8
+
+//
+// The rate (per second) at which each partition may queue stateless operations,
+// and the number it may queue in a burst above that rate.
+//
+#define QUIC_STATELESS_OPERATION_RATE           50000
+#define QUIC_STATELESS_OPERATION_BURST          1000
+
 //
 // The number of milliseconds we keep an entry in the binding stateless
 // operation table before removing it.
@@ -177,6 +221,14 @@ typedef struct QUIC_RX_PACKET QUIC_RX_PACKET;
 //
 #define QUIC_MAX_OPERATIONS_PER_DRAIN           16
 
+//
+// The maximum number of threads in the library's TLS offload (crypto) pool.
+// The pool uses one thread for every QUIC_CRYPTO_POOL_PROCS_PER_THREAD
+// processors, up to this limit.
+//
+#define QUIC_CRYPTO_POOL_MAX_THREADS            8
+#define QUIC_CRYPTO_POOL_PROCS_PER_THREAD       4
+
 //
 // Used as a hint for the maximum number of UDP datagrams to send for each
 // FLUSH_SEND operation. The actual number will generally exceed this value up
@@ -200,6 +252,13 @@ typedef struct QUIC_RX_PACKET QUIC_RX_PACKET;
 //
 #define QUIC_MAX_CRYPTO_BATCH_COUNT             8
 
+//
+// The maximum number of ranges of stream data per packet that are encrypted
+// directly from the send request buffers (see EncryptInCopyEnabled). Any more
+// are copied into the packet first.
+//
+#define QUIC_MAX_ENCRYPT_GATHER_SEGMENTS        8
+
 //
 // The maximum number of received packets that may be processed in a single
 // flush operation.
@@ -340,6 +399,19 @@ CXPLAT_STATIC_ASSERT(
 //
 #define QUIC_RECV_BUFFER_DRAIN_RATIO            4
 
+//
+// With a receive memory budget configured, the connection flow control window
+// is auto-tuned (doubled) up to this size.
+//
+#define QUIC_MAX_TUNED_CONN_FLOW_CONTROL_WINDOW 0x40000000 // 1GB
+
+//
+// A stream that hasn't delivered a window update in this many RTTs is idle,
+// and its auto-tuned window growth may be reclaimed for hotter streams when
+// the receive memory budget is exhausted.
+//
+#define QUIC_RECV_WINDOW_IDLE_RTT_COUNT         8
+
 //
 // The default value for send buffering being enabled or not.
 //
@@ -438,6 +510,31 @@ CXPLAT_STATIC_ASSERT(
 //
 #define QUIC_DEFAULT_DATAGRAM_RECEIVE_ENABLED   FALSE
 
+//
+// The number of datagrams protected by each datagram FEC repair frame, and the
+// largest group we accept from the peer.
+//
+#define QUIC_DATAGRAM_FEC_GROUP_SIZE            8
+#define QUIC_DATAGRAM_FEC_MAX_GROUP_SIZE        32
+
+//
+// Datagram FEC group numbers wrap at this value, so they always fit in a
+// two byte variable length integer.
+//
+#define QUIC_DATAGRAM_FEC_GROUP_WRAP            0x4000
+
+//
+// The longest datagram covered by FEC. Longer datagrams can't be sent over any
+// supported MTU anyway.
+//
+#define QUIC_DATAGRAM_FEC_MAX_LENGTH            CXPLAT_MAX_MTU
+
+//
+// The maximum number of received datagrams indicated in a single batched
+// receive event. A full batch is indicated early.
+//
+#define QUIC_DATAGRAM_RECV_BATCH_MAX            32
+
 //
 // The default max_datagram_frame_length transport parameter value we send. Set
 // to max uint16 to not explicitly limit the length of datagrams.
@@ -473,6 +570,29 @@ CXPLAT_STATIC_ASSERT(
 //
 #define CXPLAT_TLS_RESUMPTION_CLIENT_TICKET_VERSION      1
 
+//
+// Type of the (server) ticket that only references resumption state held in
+// the server's session cache. It is deliberately outside the range of valid
+// resumption ticket versions above, so that it is never decoded as one.
+//
+#define QUIC_SESSION_CACHE_TICKET_TYPE             0x20
+
+//
+// The length of the random ID identifying a session in the session cache.
+//
+#define QUIC_SESSION_CACHE_ID_LENGTH               16
+
+//
+// The maximum number of bytes of resumption state cached per partition.
+//
+#define QUIC_SESSION_CACHE_PARTITION_MAX_BYTES     (1024 * 1024)
+
+//
+// How long a session remains in the session cache. This matches the default
+// lifetime of the TLS session tickets that reference it.
+//
+#define QUIC_SESSION_CACHE_LIFETIME_US             S_TO_US(2 * 60 * 60ull)
+
 //
 // By default the Version Negotiation Extension is disabled.
 //
@@ -501,9 +621,23 @@ CXPLAT_STATIC_ASSERT(
 #define QUIC_DPLPMTUD_RAISE_TIMER_TIMEOUT           S_TO_US(600)
 
 //
-// The amount of bytes to increase our PLMTU each probe
+// The binary search for the path MTU stops once the gap between the largest
+// acknowledged probe and the smallest failed probe is less than this many
+// bytes.
 //
-#define QUIC_DPLPMTUD_INCREMENT                     80
+#define QUIC_DPLPMTUD_MIN_SEARCH_STEP               16
+
+//
+// The number of consecutive loss events, in which only packets larger than
+// the minimum MTU were lost, before the path is considered a black hole for
+// the current MTU.
+//
+#define QUIC_DPLPMTUD_BLACK_HOLE_THRESHOLD          3
+
+//
+// The number of path MTUs remembered per binding, indexed by remote address.
+//
+#define QUIC_DPLPMTUD_PATH_CACHE_SIZE               32
 
 //
 // The default congestion control algorithm
@@ -565,6 +699,95 @@ CXPLAT_STATIC_ASSERT(
 //
 #define QUIC_DEFAULT_STREAM_MULTI_RECEIVE_ENABLED    FALSE
 
+//
+// The default settings for adaptively tuning the peer's ACK frequency.
+//
+#define QUIC_DEFAULT_ADAPTIVE_ACK_FREQUENCY_ENABLED   FALSE
+
+//
+// The default settings for encrypting stream data directly from the send
+// request buffers.
+//
+#define QUIC_DEFAULT_ENCRYPT_IN_COPY_ENABLED         FALSE
+
+//
+// The default setting for decrypting in-order stream data directly into
+// app-owned receive buffers.
+//
+#define QUIC_DEFAULT_DECRYPT_TO_APP_BUFFERS_ENABLED FALSE
+
+//
+// The default setting for protecting datagrams with forward error correction.
+//
+#define QUIC_DEFAULT_DATAGRAM_FEC_ENABLED           FALSE
+#define QUIC_DEFAULT_DATAGRAM_RECEIVE_BATCH_ENABLED FALSE
+
+//
+// The default setting for running TLS handshake processing on the crypto
+// thread pool instead of the connection's worker.
+//
+#define QUIC_DEFAULT_TLS_OFFLOAD_ENABLED            FALSE
+
+//
+// The default setting for keeping resumption state in the server-side session
+// cache instead of in stateless tickets.
+//
+#define QUIC_DEFAULT_SERVER_SESSION_CACHE_ENABLED   FALSE
+
+//
+// The default setting for checking ClientHellos against the 0-RTT replay
+// filter before accepting resumption.
+//
+#define QUIC_DEFAULT_REPLAY_FILTER_ENABLED          FALSE
+
+//
+// The default setting for generating server key shares ahead of time, from a
+// pool refilled in the background.
+//
+#define QUIC_DEFAULT_KEY_SHARE_POOL_ENABLED         FALSE
+
+//
+// The default size (in bytes) of each generation of the 0-RTT replay filter,
+// per partition. Rounded down to a power of two.
+//
+#define QUIC_DEFAULT_REPLAY_FILTER_SIZE             (64 * 1024)
+
+//
+// The default length (in milliseconds) of each generation of the 0-RTT replay
+// filter. A ClientHello is remembered for at least this long.
+//
+#define QUIC_DEFAULT_REPLAY_FILTER_WINDOW_MS        10000
+
+//
+// The number of bits set in the 0-RTT replay filter for each ClientHello.
+//
+#define QUIC_REPLAY_FILTER_HASH_COUNT               4
+
+//
+// The default maximum rate (in packets per second) of Initial packets that may
+// create new connections from a single source prefix on a binding. Zero
+// disables the limit.
+//
+#define QUIC_DEFAULT_INITIAL_RATE_LIMIT             0
+
+//
+// The largest allowed value for the InitialRateLimit setting.
+//
+#define QUIC_MAX_INITIAL_RATE_LIMIT                 1000000
+
+//
+// The number of rows and cells per row in the source limiter's sketch.
+//
+#define QUIC_SOURCE_LIMITER_DEPTH                   4
+#define QUIC_SOURCE_LIMITER_WIDTH                   1024
+
+//
+// The number of address bytes in a source prefix: /24 for IPv4 and /48 for
+// IPv6.
+//
+#define QUIC_SOURCE_LIMITER_IPV4_PREFIX_LENGTH      3
+#define QUIC_SOURCE_LIMITER_IPV6_PREFIX_LENGTH      6
+
 //
 // The default settings for disabling Connection ID generation.
 //
@@ -585,6 +808,12 @@ CXPLAT_STATIC_ASSERT(
 //
 #define QUIC_HYSTART_DEFAULT_MAX_ETA                16000
 
+//
+// The maximum growth of the window per ACK in slow start, in packets, when not
+// pacing (L from RFC 9406).
+//
+#define QUIC_HYSTART_DEFAULT_NON_PACED_GROWTH_LIMIT 8
+
 //
 // The number of rounds to spend in Conservative Slow Start before switching
 // to Congestion Avoidance.
@@ -627,6 +856,7 @@ CXPLAT_STATIC_ASSERT(
 #define QUIC_TP_FLAG_TIMESTAMP_RECV_ENABLED                 0x01000000
 #define QUIC_TP_FLAG_TIMESTAMP_SEND_ENABLED                 0x02000000
 #define QUIC_TP_FLAG_TIMESTAMP_SHIFT                        24
+#define QUIC_TP_FLAG_DATAGRAM_FEC                           0x04000000
 
 #define QUIC_TP_MAX_PACKET_SIZE_DEFAULT                     65527
 #define QUIC_TP_MAX_UDP_PAYLOAD_SIZE_MIN                    1200
@@ -659,6 +889,9 @@ CXPLAT_STATIC_ASSERT(
 #define QUIC_SETTING_RETRY_MEMORY_FRACTION          "RetryMemoryFraction"
 #define QUIC_SETTING_LOAD_BALANCING_MODE            "LoadBalancingMode"
 #define QUIC_SETTING_FIXED_SERVER_ID                "FixedServerID"
+#define QUIC_SETTING_REPLAY_FILTER_SIZE             "ReplayFilterSize"
+#define QUIC_SETTING_REPLAY_FILTER_WINDOW_MS        "ReplayFilterWindowMs"
+#define QUIC_SETTING_INITIAL_RATE_LIMIT             "InitialRateLimit"
 #define QUIC_SETTING_MAX_WORKER_QUEUE_DELAY         "MaxWorkerQueueDelayMs"
 #define QUIC_SETTING_MAX_STATELESS_OPERATIONS       "MaxStatelessOperations"
 #define QUIC_SETTING_MAX_BINDING_STATELESS_OPERATIONS "MaxBindingStatelessOperations"
@@ -679,6 +912,15 @@ CXPLAT_STATIC_ASSERT(
 #define QUIC_SETTING_ONE_WAY_DELAY_ENABLED          "OneWayDelayEnabled"
 #define QUIC_SETTING_NET_STATS_EVENT_ENABLED        "NetStatsEventEnabled"
 #define QUIC_SETTING_STREAM_MULTI_RECEIVE_ENABLED   "StreamMultiReceiveEnabled"
+#define QUIC_SETTING_ADAPTIVE_ACK_FREQUENCY_ENABLED "AdaptiveAckFrequencyEnabled"
+#define QUIC_SETTING_ENCRYPT_IN_COPY_ENABLED        "EncryptInCopyEnabled"
+#define QUIC_SETTING_DECRYPT_TO_APP_BUFFERS_ENABLED "DecryptToAppBuffersEnabled"
+#define QUIC_SETTING_DATAGRAM_FEC_ENABLED           "DatagramFecEnabled"
+#define QUIC_SETTING_DATAGRAM_RECEIVE_BATCH_ENABLED "DatagramReceiveBatchEnabled"
+#define QUIC_SETTING_TLS_OFFLOAD_ENABLED            "TlsOffloadEnabled"
+#define QUIC_SETTING_SERVER_SESSION_CACHE_ENABLED   "ServerSessionCacheEnabled"
+#define QUIC_SETTING_REPLAY_FILTER_ENABLED          "ReplayFilterEnabled"
+#define QUIC_SETTING_KEY_SHARE_POOL_ENABLED         "KeySharePoolEnabled"
 
 #define QUIC_SETTING_INITIAL_WINDOW_PACKETS         "InitialWindowPackets"
 #define QUIC_SETTING_SEND_IDLE_TIMEOUT_MS           "SendIdleTimeoutMs"
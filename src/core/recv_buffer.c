@@ -606,7 +606,9 @@ QuicRecvBufferCopyIntoChunks(
     QUIC_BUFFER Buffer;
     while (WriteLength != 0 && QuicRecvChunkIteratorNext(&Iterator, FALSE, &Buffer)) {
         const uint32_t CopyLength = CXPLAT_MIN(Buffer.Length, WriteLength);
-        CxPlatCopyMemory(Buffer.Buffer, WriteBuffer, CopyLength);
+        if (Buffer.Buffer != WriteBuffer) { // Already in place if decrypted directly into the chunk
+            CxPlatCopyMemory(Buffer.Buffer, WriteBuffer, CopyLength);
+        }
         WriteBuffer += CopyLength;
         WriteLength -= (uint16_t)CopyLength;
     }
@@ -750,6 +752,58 @@ QuicRecvBufferWrite(
     return QUIC_STATUS_SUCCESS;
 }
 
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint8_t*
+QuicRecvBufferGetInOrderWriteBuffer(
+    _In_ QUIC_RECV_BUFFER* RecvBuffer,
+    _In_ uint64_t WriteOffset,
+    _In_ uint16_t WriteLength
+    )
+{
+    CXPLAT_DBG_ASSERT(WriteLength != 0);
+
+    if (RecvBuffer->RecvMode != QUIC_RECV_BUF_MODE_APP_OWNED) {
+        return NULL;
+    }
+
+    //
+    // The write must start exactly where the contiguous data ends and there
+    // must not be anything written past it, so that the returned range only
+    // covers bytes the app has never seen and nothing else will be written to.
+    //
+    const uint32_t RangeCount = QuicRangeSize(&RecvBuffer->WrittenRanges);
+    uint64_t InOrderEnd = 0;
+    if (RangeCount != 0) {
+        QUIC_SUBRANGE* FirstRange = QuicRangeGet(&RecvBuffer->WrittenRanges, 0);
+        if (RangeCount > 1 || FirstRange->Low != 0) {
+            return NULL;
+        }
+        InOrderEnd = FirstRange->Count;
+    }
+    if (WriteOffset != InOrderEnd || WriteOffset < RecvBuffer->BaseOffset) {
+        return NULL;
+    }
+
+    const uint64_t AbsoluteLength = WriteOffset + WriteLength;
+    if (AbsoluteLength > RecvBuffer->BaseOffset + RecvBuffer->VirtualBufferLength ||
+        AbsoluteLength > RecvBuffer->BaseOffset + QuicRecvBufferGetTotalAllocLength(RecvBuffer)) {
+        return NULL;
+    }
+
+    //
+    // Only hand out the range if it doesn't straddle chunks (or wrap around).
+    //
+    QUIC_RECV_CHUNK_ITERATOR Iterator =
+        QuicRecvBufferGetChunkIterator(RecvBuffer, WriteOffset - RecvBuffer->BaseOffset);
+    QUIC_BUFFER Buffer;
+    if (!QuicRecvChunkIteratorNext(&Iterator, FALSE, &Buffer) ||
+        Buffer.Length < WriteLength) {
+        return NULL;
+    }
+
+    return Buffer.Buffer;
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 uint32_t
 QuicRecvBufferReadBufferNeededCount(
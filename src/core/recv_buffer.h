@@ -185,6 +185,20 @@ QuicRecvBufferWrite(
     _Out_ uint64_t* BufferSizeNeeded
     );
 
+//
+// Returns where a write of WriteLength bytes at WriteOffset would be copied to
+// if it is the next in-order write and would land in a single contiguous span
+// of an app-owned chunk. Returns NULL otherwise. Data placed there beforehand
+// still needs to be written with QuicRecvBufferWrite (which skips the copy).
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint8_t*
+QuicRecvBufferGetInOrderWriteBuffer(
+    _In_ QUIC_RECV_BUFFER* RecvBuffer,
+    _In_ uint64_t WriteOffset,
+    _In_ uint16_t WriteLength
+    );
+
 //
 // Returns how many QUIC_BUFFERs should be passed to `QuicRecvBufferRead` to
 // read all the available data in the buffer.
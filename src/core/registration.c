@@ -513,11 +513,33 @@ QuicRegistrationParamSet(
         const void* Buffer
     )
 {
-    UNREFERENCED_PARAMETER(Registration);
-    UNREFERENCED_PARAMETER(Param);
-    UNREFERENCED_PARAMETER(BufferLength);
-    UNREFERENCED_PARAMETER(Buffer);
-    return QUIC_STATUS_INVALID_PARAMETER;
+    QUIC_STATUS Status;
+
+    switch (Param) {
+    case QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET:
+
+        if (BufferLength != sizeof(Registration->SendBufferBudget) || Buffer == NULL) {
+            Status = QUIC_STATUS_INVALID_PARAMETER;
+            break;
+        }
+
+        Registration->SendBufferBudget = *(uint64_t*)Buffer;
+
+        QuicTraceLogInfo(
+            RegistrationSendBufferBudgetSet,
+            "[ reg][%p] Updated send buffer budget = %llu",
+            Registration,
+            Registration->SendBufferBudget);
+
+        Status = QUIC_STATUS_SUCCESS;
+        break;
+
+    default:
+        Status = QUIC_STATUS_INVALID_PARAMETER;
+        break;
+    }
+
+    return Status;
 }
 
 _IRQL_requires_max_(PASSIVE_LEVEL)
@@ -530,9 +552,32 @@ QuicRegistrationParamGet(
         void* Buffer
     )
 {
-    UNREFERENCED_PARAMETER(Registration);
-    UNREFERENCED_PARAMETER(Param);
-    UNREFERENCED_PARAMETER(BufferLength);
-    UNREFERENCED_PARAMETER(Buffer);
-    return QUIC_STATUS_INVALID_PARAMETER;
+    QUIC_STATUS Status;
+
+    switch (Param) {
+    case QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET:
+
+        if (*BufferLength < sizeof(Registration->SendBufferBudget)) {
+            *BufferLength = sizeof(Registration->SendBufferBudget);
+            Status = QUIC_STATUS_BUFFER_TOO_SMALL;
+            break;
+        }
+
+        if (Buffer == NULL) {
+            Status = QUIC_STATUS_INVALID_PARAMETER;
+            break;
+        }
+
+        *BufferLength = sizeof(Registration->SendBufferBudget);
+        *(uint64_t*)Buffer = Registration->SendBufferBudget;
+
+        Status = QUIC_STATUS_SUCCESS;
+        break;
+
+    default:
+        Status = QUIC_STATUS_INVALID_PARAMETER;
+        break;
+    }
+
+    return Status;
 }
@@ -113,6 +113,19 @@ typedef struct QUIC_REGISTRATION {
     //
     CXPLAT_LIST_ENTRY Listeners;
 
+    //
+    // The maximum number of bytes this registration's connections may buffer
+    // for stream sends, shared fairly between the connections actively
+    // buffering. Zero means unlimited.
+    //
+    uint64_t SendBufferBudget;
+
+    //
+    // The number of this registration's connections currently holding
+    // buffered send bytes.
+    //
+    long SendBufferActiveConnections;
+
     //
     // Rundown for all child objects.
     //
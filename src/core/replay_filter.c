@@ -0,0 +1,198 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    The 0-RTT replay filter remembers the ClientHellos that recently attempted
+    resumption, so that a server can refuse to resume (and so refuse the 0-RTT
+    data of) a ClientHello it has already seen. This is the "ClientHello
+    recording" anti-replay scheme of RFC 8446, section 8.2, with the record kept
+    in a Bloom filter to bound its memory.
+
+    The filter is sharded by partition to spread out lock contention. Since a
+    replayed ClientHello can arrive on any partition, the shard is picked from
+    the ClientHello's hash rather than from the connection's partition.
+
+--*/
+
+#include "precomp.h"
+#ifdef QUIC_CLOG
+#include "replay_filter.c.clog.h"
+#endif
+
+QUIC_INLINE
+uint64_t
+QuicReplayFilterMix(
+    _In_ uint64_t Value
+    )
+{
+    //
+    // The splitmix64 finalizer.
+    //
+    Value ^= Value >> 30;
+    Value *= 0xbf58476d1ce4e5b9ull;
+    Value ^= Value >> 27;
+    Value *= 0x94d049bb133111ebull;
+    Value ^= Value >> 31;
+    return Value;
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicReplayFilterInitialize(
+    _Out_ QUIC_REPLAY_FILTER* Filter
+    )
+{
+    CxPlatZeroMemory(Filter, sizeof(*Filter));
+    CxPlatDispatchLockInitialize(&Filter->Lock);
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicReplayFilterUninitialize(
+    _In_ QUIC_REPLAY_FILTER* Filter
+    )
+{
+    if (Filter->Bits[0] != NULL) {
+        CXPLAT_FREE(Filter->Bits[0], QUIC_POOL_REPLAY_FILTER);
+        Filter->Bits[0] = Filter->Bits[1] = NULL;
+    }
+    CxPlatDispatchLockUninitialize(&Filter->Lock);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicReplayFilterHash(
+    _In_reads_(2) const uint64_t* Key,
+    _In_ uint32_t Length,
+    _In_reads_bytes_(Length)
+        const uint8_t* Value,
+    _Out_writes_(2) uint64_t* Hash
+    )
+{
+    //
+    // The values are (attacker chosen) ClientHello randoms, so they are hashed
+    // with a secret key to keep a client from picking which bits they set.
+    //
+    uint64_t Hash0 = Key[0];
+    uint64_t Hash1 = Key[1];
+    while (Length != 0) {
+        uint64_t Word = 0;
+        const uint32_t WordLength = CXPLAT_MIN(Length, (uint32_t)sizeof(Word));
+        CxPlatCopyMemory(&Word, Value, WordLength);
+        Hash0 = QuicReplayFilterMix(Hash0 ^ Word);
+        Hash1 = QuicReplayFilterMix(Hash1 ^ Word);
+        Value += WordLength;
+        Length -= WordLength;
+    }
+    Hash[0] = Hash0;
+    Hash[1] = Hash1 | 1; // Odd, so that each probe of a value hits a different bit.
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+BOOLEAN
+QuicReplayFilterAllocate(
+    _In_ QUIC_REPLAY_FILTER* Filter,
+    _In_ uint32_t Size,
+    _In_ uint64_t TimeNow
+    )
+{
+    uint64_t ByteCount = sizeof(uint64_t);
+    while (ByteCount * 2 <= Size) {
+        ByteCount *= 2;
+    }
+
+    const uint64_t AllocSize = 2 * ByteCount;
+    if ((size_t)AllocSize != AllocSize) {
+        return FALSE;
+    }
+
+    uint64_t* Bits = CXPLAT_ALLOC_NONPAGED((size_t)AllocSize, QUIC_POOL_REPLAY_FILTER);
+    if (Bits == NULL) {
+        QuicTraceEvent(
+            AllocFailure,
+            "Allocation of '%s' failed. (%llu bytes)",
+            "replay filter",
+            AllocSize);
+        return FALSE;
+    }
+    CxPlatZeroMemory(Bits, (size_t)AllocSize);
+
+    CxPlatDispatchLockAcquire(&Filter->Lock);
+    if (Filter->Bits[0] == NULL) {
+        Filter->Bits[0] = Bits;
+        Filter->Bits[1] = Bits + ByteCount / sizeof(uint64_t);
+        Filter->BitCount = ByteCount * 8;
+        Filter->GenerationStart = TimeNow;
+        Bits = NULL;
+    }
+    CxPlatDispatchLockRelease(&Filter->Lock);
+
+    if (Bits != NULL) {
+        CXPLAT_FREE(Bits, QUIC_POOL_REPLAY_FILTER); // Another thread beat us to it.
+    }
+
+    return TRUE;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicReplayFilterTestAndSet(
+    _In_ QUIC_REPLAY_FILTER* Filter,
+    _In_reads_(2) const uint64_t* Hash,
+    _In_ uint32_t Size,
+    _In_ uint64_t Window,
+    _In_ uint64_t TimeNow
+    )
+{
+    if (Filter->Bits[0] == NULL &&
+        !QuicReplayFilterAllocate(Filter, Size, TimeNow)) {
+        return TRUE;
+    }
+
+    CxPlatDispatchLockAcquire(&Filter->Lock);
+
+    const uint64_t Elapsed =
+        TimeNow > Filter->GenerationStart ? TimeNow - Filter->GenerationStart : 0;
+    if (Elapsed >= Window) {
+        const size_t GenerationSize = (size_t)(Filter->BitCount / 8);
+        if (Elapsed >= 2 * Window) {
+            //
+            // Everything in both generations is older than the window.
+            //
+            CxPlatZeroMemory(Filter->Bits[0], 2 * GenerationSize);
+        } else {
+            Filter->Current ^= 1;
+            CxPlatZeroMemory(Filter->Bits[Filter->Current], GenerationSize);
+        }
+        Filter->GenerationStart = TimeNow;
+    }
+
+    uint64_t* Current = Filter->Bits[Filter->Current];
+    const uint64_t* Previous = Filter->Bits[Filter->Current ^ 1];
+    const uint64_t BitMask = Filter->BitCount - 1;
+    BOOLEAN InCurrent = TRUE;
+    BOOLEAN InPrevious = TRUE;
+
+    uint64_t Probe = Hash[0];
+    for (uint32_t i = 0; i < QUIC_REPLAY_FILTER_HASH_COUNT; ++i) {
+        const uint64_t Bit = Probe & BitMask;
+        const uint64_t Word = Bit / 64;
+        const uint64_t WordBit = 1ull << (Bit % 64);
+        if (!(Current[Word] & WordBit)) {
+            Current[Word] |= WordBit;
+            InCurrent = FALSE;
+        }
+        if (!(Previous[Word] & WordBit)) {
+            InPrevious = FALSE;
+        }
+        Probe += Hash[1];
+    }
+
+    CxPlatDispatchLockRelease(&Filter->Lock);
+
+    return InCurrent || InPrevious;
+}
@@ -0,0 +1,93 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+--*/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//
+// One shard of the 0-RTT replay filter: a time-bucketed Bloom filter of the
+// ClientHellos that attempted resumption. Each partition owns a shard, and a
+// ClientHello is always checked against the same shard (picked from its hash),
+// whichever partition the connection lands on.
+//
+// The filter keeps two generations of bits. New values are added to the
+// current generation, and lookups check both. Once the current generation is
+// older than the window, it becomes the previous one and the old previous one
+// is cleared, so a value is remembered for between one and two windows.
+//
+// Like any Bloom filter it has false positives (a new ClientHello taken for a
+// replay), which just cost that connection a full handshake. It has no false
+// negatives within the window.
+//
+typedef struct QUIC_REPLAY_FILTER {
+
+    CXPLAT_DISPATCH_LOCK Lock;
+
+    //
+    // The bits of each generation, allocated (as a single block) on first use.
+    // Bits[Current] is the current generation.
+    //
+    uint64_t* Bits[2];
+    uint32_t Current;
+
+    //
+    // The number of bits in each generation. Always a power of two.
+    //
+    uint64_t BitCount;
+
+    //
+    // The time (in us) the current generation started.
+    //
+    uint64_t GenerationStart;
+
+} QUIC_REPLAY_FILTER;
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicReplayFilterInitialize(
+    _Out_ QUIC_REPLAY_FILTER* Filter
+    );
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicReplayFilterUninitialize(
+    _In_ QUIC_REPLAY_FILTER* Filter
+    );
+
+//
+// Computes the keyed hash used to look up a value in the filter.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicReplayFilterHash(
+    _In_reads_(2) const uint64_t* Key,
+    _In_ uint32_t Length,
+    _In_reads_bytes_(Length)
+        const uint8_t* Value,
+    _Out_writes_(2) uint64_t* Hash
+    );
+
+//
+// Returns TRUE if the hashed value was (probably) already seen in the last
+// window, otherwise adds it to the filter and returns FALSE. Size is the number
+// of bytes for each generation, used when the filter is first allocated. If
+// that allocation fails, every value is reported as seen.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicReplayFilterTestAndSet(
+    _In_ QUIC_REPLAY_FILTER* Filter,
+    _In_reads_(2) const uint64_t* Hash,
+    _In_ uint32_t Size,
+    _In_ uint64_t Window,
+    _In_ uint64_t TimeNow
+    );
+
+#if defined(__cplusplus)
+}
+#endif
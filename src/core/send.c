@@ -34,6 +34,7 @@ QuicSendInitialize(
 {
     CxPlatListInitializeHead(&Send->SendStreams);
     Send->MaxData = Settings->ConnFlowControlWindow;
+    Send->MaxDataWindow = Settings->ConnFlowControlWindow;
     Send->SkippedPacketNumber = UINT64_MAX;
 
     //
@@ -61,6 +62,9 @@ QuicSendUninitialize(
     Send->DelayedAckTimerActive = FALSE;
     Send->SendFlags = 0;
 
+    QuicLibraryReleaseRecvWindow(Send->MaxDataWindowReserved);
+    Send->MaxDataWindowReserved = 0;
+
     if (Send->InitialToken != NULL) {
         CXPLAT_FREE(Send->InitialToken, QUIC_POOL_INITIAL_TOKEN);
         Send->InitialToken = NULL;
@@ -92,6 +96,9 @@ QuicSendApplyNewSettings(
     )
 {
     Send->MaxData = Settings->ConnFlowControlWindow;
+    Send->MaxDataWindow = Settings->ConnFlowControlWindow;
+    QuicLibraryReleaseRecvWindow(Send->MaxDataWindowReserved);
+    Send->MaxDataWindowReserved = 0;
 }
 
 _IRQL_requires_max_(PASSIVE_LEVEL)
@@ -913,7 +920,7 @@ QuicSendWriteFrames(
             QUIC_ACK_FREQUENCY_EX Frame;
             Frame.SequenceNumber = Connection->SendAckFreqSeqNum;
             Frame.AckElicitingThreshold = Connection->PeerPacketTolerance;
-            Frame.RequestedMaxAckDelay = MS_TO_US(QuicConnGetAckDelay(Connection));
+            Frame.RequestedMaxAckDelay = MS_TO_US(QuicConnGetPeerMaxAckDelay(Connection));
             Frame.ReorderingThreshold = Connection->PeerReorderingThreshold;
 
             if (QuicAckFrequencyFrameEncode(
@@ -1309,6 +1316,9 @@ QuicSendFlush(
                 AmplificationProtectionBlocked,
                 Connection,
                 "Cannot send any more because of amplification protection");
+            if (QuicCryptoHasPendingCryptoFrame(&Connection->Crypto)) {
+                Connection->Stats.AmplificationStalled = TRUE;
+            }
             Result = QUIC_SEND_COMPLETE;
             break;
         }
@@ -1501,7 +1511,8 @@ QuicSendFlush(
         //
         QuicSendQueueFlush(&Connection->Send, REASON_SCHEDULING);
 
-        if (Builder.TotalCountDatagrams + 1 > Connection->PeerPacketTolerance) {
+        if (!Connection->Settings.AdaptiveAckFrequencyEnabled &&
+            Builder.TotalCountDatagrams + 1 > Connection->PeerPacketTolerance) {
             //
             // We're scheduling limited, so we should tell the peer to use our
             // (max) batch size + 1 as the peer tolerance as a hint that they
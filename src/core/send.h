@@ -294,6 +294,18 @@ typedef struct QUIC_SEND {
     //
     uint64_t MaxData;
 
+    //
+    // The connection-wide receive window MaxData is kept ahead of the
+    // delivered bytes. Starts at ConnFlowControlWindow and may be grown by
+    // receive window auto-tuning.
+    //
+    uint64_t MaxDataWindow;
+
+    //
+    // Bytes of MaxDataWindow growth reserved from the receive memory budget.
+    //
+    uint64_t MaxDataWindowReserved;
+
     //
     // The max value received in MAX_DATA frames.
     //
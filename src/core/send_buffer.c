@@ -52,6 +52,23 @@ Abstract:
     one stream to be steadily sending, in which case this scheme will
     maximize throughput and minimize memory usage.
 
+
+    Send buffer budgets:
+
+    The app may cap the total bytes buffered across all connections (globally
+    and/or per registration). A budget is shared fairly between the
+    connections that currently hold buffered bytes: each is limited to
+    (Budget / ActiveConnections), and a connection that isn't buffering yet
+    is always entitled to a share as if it were. This keeps a single busy
+    connection (or registration) from starving the others, without the cost
+    of tracking aggregate byte counts on every allocation.
+
+    When a budget caps a connection's buffering, the app is told via
+    QUIC_CONNECTION_EVENT_SEND_BUFFER_PRESSURE so it can pause its producers,
+    and again once the buffered bytes drain below half of the limit. Without
+    send buffering, the bytes in send requests that haven't completed yet are
+    counted instead, since they pin the app's buffers just the same.
+
 --*/
 
 #include "precomp.h"
@@ -66,6 +83,7 @@ QuicSendBufferInitialize(
     )
 {
     SendBuffer->IdealBytes = QUIC_DEFAULT_IDEAL_SEND_BUFFER_SIZE;
+    SendBuffer->LastLimit = QUIC_DEFAULT_IDEAL_SEND_BUFFER_SIZE;
 }
 
 _IRQL_requires_max_(DISPATCH_LEVEL)
@@ -77,18 +95,136 @@ QuicSendBufferUninitialize(
     UNREFERENCED_PARAMETER(SendBuffer);
 }
 
+//
+// Returns the bytes held for stream sends that count against the budgets.
+// Without send buffering, these are the app's own buffers in send requests
+// that haven't completed yet.
+//
+QUIC_INLINE
+uint64_t
+QuicSendBufferHeldBytes(
+    _In_ const QUIC_CONNECTION* Connection
+    )
+{
+    return
+        Connection->Settings.SendBufferingEnabled ?
+            Connection->SendBuffer.BufferedBytes :
+            Connection->SendBuffer.PostedBytes;
+}
+
+//
+// Updates whether the connection counts against the send buffer budgets, based
+// on whether it currently holds any buffered bytes.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+void
+QuicSendBufferUpdateBudgetActive(
+    _In_ QUIC_CONNECTION* Connection
+    )
+{
+    QUIC_SEND_BUFFER* SendBuffer = &Connection->SendBuffer;
+    const BOOLEAN Active =
+        QuicSendBufferHeldBytes(Connection) != 0 && Connection->State.Registered;
+
+    if (Active == SendBuffer->BudgetActive) {
+        return;
+    }
+
+    SendBuffer->BudgetActive = Active;
+    if (Active) {
+        InterlockedIncrement(&MsQuicLib.SendBufferActiveConnections);
+        InterlockedIncrement(&Connection->Registration->SendBufferActiveConnections);
+    } else {
+        InterlockedDecrement(&MsQuicLib.SendBufferActiveConnections);
+        InterlockedDecrement(&Connection->Registration->SendBufferActiveConnections);
+    }
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicSendBufferReleaseBudget(
+    _In_ QUIC_CONNECTION* Connection
+    )
+{
+    if (Connection->SendBuffer.BudgetActive) {
+        Connection->SendBuffer.BudgetActive = FALSE;
+        InterlockedDecrement(&MsQuicLib.SendBufferActiveConnections);
+        InterlockedDecrement(&Connection->Registration->SendBufferActiveConnections);
+    }
+}
+
+//
+// Calculates a connection's fair share of a budget. A connection that isn't
+// counted yet is given the share it would have once it starts buffering.
+//
+QUIC_INLINE
+uint64_t
+QuicSendBufferBudgetShare(
+    _In_ uint64_t Budget,
+    _In_ long ActiveConnections,
+    _In_ BOOLEAN IsActive
+    )
+{
+    if (Budget == 0) {
+        return UINT64_MAX; // Unlimited
+    }
+    if (!IsActive) {
+        ActiveConnections++;
+    }
+    if (ActiveConnections < 1) {
+        ActiveConnections = 1;
+    }
+    return Budget / (uint64_t)ActiveConnections;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint64_t
+QuicSendBufferGetLimit(
+    _In_ const QUIC_CONNECTION* Connection
+    )
+{
+    const QUIC_SEND_BUFFER* SendBuffer = &Connection->SendBuffer;
+    uint64_t Limit = SendBuffer->IdealBytes;
+
+    const uint64_t GlobalShare =
+        QuicSendBufferBudgetShare(
+            MsQuicLib.SendBufferBudget,
+            MsQuicLib.SendBufferActiveConnections,
+            SendBuffer->BudgetActive);
+    if (GlobalShare < Limit) {
+        Limit = GlobalShare;
+    }
+
+    if (Connection->State.Registered) {
+        const uint64_t RegistrationShare =
+            QuicSendBufferBudgetShare(
+                Connection->Registration->SendBufferBudget,
+                Connection->Registration->SendBufferActiveConnections,
+                SendBuffer->BudgetActive);
+        if (RegistrationShare < Limit) {
+            Limit = RegistrationShare;
+        }
+    }
+
+    return Limit;
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 _Success_(return != NULL)
 uint8_t*
 QuicSendBufferAlloc(
-    _Inout_ QUIC_SEND_BUFFER* SendBuffer,
+    _In_ QUIC_CONNECTION* Connection,
     _In_ uint32_t Size
     )
 {
     uint8_t* Buf = (uint8_t*)CXPLAT_ALLOC_NONPAGED(Size, QUIC_POOL_SENDBUF);
 
     if (Buf != NULL) {
-        SendBuffer->BufferedBytes += Size;
+        Connection->SendBuffer.BufferedBytes += Size;
+        QuicSendBufferUpdateBudgetActive(Connection);
+        QuicPerfCounterAdd(
+            Connection->Partition, QUIC_PERF_COUNTER_SEND_BUFFER_BYTES, Size);
     } else {
         QuicTraceEvent(
             AllocFailure,
@@ -103,22 +239,101 @@ QuicSendBufferAlloc(
 _IRQL_requires_max_(DISPATCH_LEVEL)
 void
 QuicSendBufferFree(
-    _Inout_ QUIC_SEND_BUFFER* SendBuffer,
+    _In_ QUIC_CONNECTION* Connection,
     _In_ uint8_t* Buf,
     _In_ uint32_t Size
     )
 {
     CXPLAT_FREE(Buf, QUIC_POOL_SENDBUF);
-    SendBuffer->BufferedBytes -= Size;
+    Connection->SendBuffer.BufferedBytes -= Size;
+    QuicSendBufferUpdateBudgetActive(Connection);
+    QuicPerfCounterAdd(
+        Connection->Partition, QUIC_PERF_COUNTER_SEND_BUFFER_BYTES, -(int64_t)Size);
 }
 
 _IRQL_requires_max_(DISPATCH_LEVEL)
 BOOLEAN
 QuicSendBufferHasSpace(
-    _Inout_ QUIC_SEND_BUFFER* SendBuffer
+    _In_ const QUIC_CONNECTION* Connection
     )
 {
-    return SendBuffer->BufferedBytes < SendBuffer->IdealBytes;
+    return Connection->SendBuffer.BufferedBytes < QuicSendBufferGetLimit(Connection);
+}
+
+//
+// Indicates the current buffer limit to all send-enabled streams, if it
+// changed since it was last indicated.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+static
+void
+QuicSendBufferIndicateLimit(
+    _In_ QUIC_CONNECTION* Connection
+    )
+{
+    const uint64_t Limit = QuicSendBufferGetLimit(Connection);
+    if (Limit == Connection->SendBuffer.LastLimit ||
+        Connection->Streams.StreamTable == NULL) {
+        return;
+    }
+    Connection->SendBuffer.LastLimit = Limit;
+
+    CXPLAT_HASHTABLE_ENUMERATOR Enumerator;
+    CXPLAT_HASHTABLE_ENTRY* Entry;
+    CxPlatHashtableEnumerateBegin(Connection->Streams.StreamTable, &Enumerator);
+    while ((Entry = CxPlatHashtableEnumerateNext(Connection->Streams.StreamTable, &Enumerator)) != NULL) {
+        QUIC_STREAM* Stream = CXPLAT_CONTAINING_RECORD(Entry, QUIC_STREAM, TableEntry);
+        if (Stream->Flags.SendEnabled) {
+            QuicSendBufferStreamAdjust(Stream);
+        }
+    }
+    CxPlatHashtableEnumerateEnd(Connection->Streams.StreamTable, &Enumerator);
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicSendBufferUpdatePressure(
+    _In_ QUIC_CONNECTION* Connection
+    )
+{
+    QUIC_SEND_BUFFER* SendBuffer = &Connection->SendBuffer;
+    if (!Connection->Settings.SendBufferingEnabled) {
+        QuicSendBufferUpdateBudgetActive(Connection);
+    }
+
+    const uint64_t HeldBytes = QuicSendBufferHeldBytes(Connection);
+    const uint64_t Limit = QuicSendBufferGetLimit(Connection);
+    const BOOLEAN BudgetLimited = Limit < SendBuffer->IdealBytes;
+
+    BOOLEAN Paused;
+    if (!SendBuffer->BudgetPaused) {
+        if (!BudgetLimited || HeldBytes < Limit) {
+            return;
+        }
+        Paused = TRUE;
+        QuicPerfCounterIncrement(
+            Connection->Partition, QUIC_PERF_COUNTER_SEND_BUFFER_BUDGET_EXHAUSTED);
+    } else {
+        if (BudgetLimited && HeldBytes > Limit / 2) {
+            return;
+        }
+        Paused = FALSE;
+    }
+
+    SendBuffer->BudgetPaused = Paused;
+    QuicSendBufferIndicateLimit(Connection);
+
+    QUIC_CONNECTION_EVENT Event;
+    Event.Type = QUIC_CONNECTION_EVENT_SEND_BUFFER_PRESSURE;
+    Event.SEND_BUFFER_PRESSURE.Paused = Paused;
+    Event.SEND_BUFFER_PRESSURE.BufferLimit = Limit;
+    QuicTraceLogConnVerbose(
+        IndicateSendBufferPressure,
+        Connection,
+        "Indicating QUIC_CONNECTION_EVENT_SEND_BUFFER_PRESSURE [Paused=%hhu, Limit=%llu]",
+        Paused,
+        Limit);
+    (void)QuicConnIndicateEvent(Connection, &Event);
 }
 
 _IRQL_requires_max_(PASSIVE_LEVEL)
@@ -149,7 +364,7 @@ QuicSendBufferFill(
     CXPLAT_DBG_ASSERT(Connection->Settings.SendBufferingEnabled);
 
     Entry = Connection->Send.SendStreams.Flink;
-    while (QuicSendBufferHasSpace(&Connection->SendBuffer) && Entry != &(Connection->Send.SendStreams)) {
+    while (QuicSendBufferHasSpace(Connection) && Entry != &(Connection->Send.SendStreams)) {
 
         QUIC_STREAM* Stream = CXPLAT_CONTAINING_RECORD(Entry, QUIC_STREAM, SendLink);
         Entry = Entry->Flink;
@@ -177,7 +392,7 @@ QuicSendBufferFill(
         //
         // Buffer as many requests as we can before moving to the next stream.
         //
-        while (Req != NULL && QuicSendBufferHasSpace(&Connection->SendBuffer)) {
+        while (Req != NULL && QuicSendBufferHasSpace(Connection)) {
             if (QUIC_FAILED(QuicStreamSendBufferRequest(Stream, Req))) {
                 return;
             }
@@ -185,6 +400,8 @@ QuicSendBufferFill(
         }
 
     }
+
+    QuicSendBufferUpdatePressure(Connection);
 }
 
 _IRQL_requires_max_(DISPATCH_LEVEL)
@@ -219,10 +436,10 @@ QuicSendBufferStreamAdjust(
 {
     //
     // Calculate the value to actually indicate to the app for this stream as
-    // a minimum of the connection-wide IdealBytes and the value based on the
+    // a minimum of the connection-wide limit and the value based on the
     // stream's estimated SendWindow.
     //
-    uint64_t ByteCount = Stream->Connection->SendBuffer.IdealBytes;
+    uint64_t ByteCount = QuicSendBufferGetLimit(Stream->Connection);
     if ((uint64_t)Stream->SendWindow < ByteCount) {
         const uint64_t SendWindowIdealBytes =
             QuicGetNextIdealBytes(Stream->SendWindow);
@@ -268,19 +485,12 @@ QuicSendBufferConnectionAdjust(
     if (NewIdealBytes > Connection->SendBuffer.IdealBytes) {
         Connection->SendBuffer.IdealBytes = NewIdealBytes;
 
-        CXPLAT_HASHTABLE_ENUMERATOR Enumerator;
-        CXPLAT_HASHTABLE_ENTRY* Entry;
-        CxPlatHashtableEnumerateBegin(Connection->Streams.StreamTable, &Enumerator);
-        while ((Entry = CxPlatHashtableEnumerateNext(Connection->Streams.StreamTable, &Enumerator)) != NULL) {
-            QUIC_STREAM* Stream = CXPLAT_CONTAINING_RECORD(Entry, QUIC_STREAM, TableEntry);
-            if (Stream->Flags.SendEnabled) {
-                QuicSendBufferStreamAdjust(Stream);
-            }
-        }
-        CxPlatHashtableEnumerateEnd(Connection->Streams.StreamTable, &Enumerator);
+        QuicSendBufferIndicateLimit(Connection);
 
         if (Connection->Settings.SendBufferingEnabled) {
             QuicSendBufferFill(Connection);
+        } else {
+            QuicSendBufferUpdatePressure(Connection);
         }
     }
 }
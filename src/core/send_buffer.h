@@ -27,6 +27,24 @@ typedef struct QUIC_SEND_BUFFER {
     //
     uint64_t IdealBytes;
 
+    //
+    // The last buffer limit (IdealBytes capped by the connection's share of
+    // any send buffer budgets) indicated to the streams.
+    //
+    uint64_t LastLimit;
+
+    //
+    // TRUE if the connection is counted as actively buffering against the
+    // global and registration send buffer budgets.
+    //
+    BOOLEAN BudgetActive : 1;
+
+    //
+    // TRUE if the app has been told to pause producing send data because
+    // buffering is limited by a send buffer budget.
+    //
+    BOOLEAN BudgetPaused : 1;
+
 } QUIC_SEND_BUFFER;
 
 _IRQL_requires_max_(DISPATCH_LEVEL)
@@ -45,7 +63,7 @@ _IRQL_requires_max_(DISPATCH_LEVEL)
 _Success_(return != NULL)
 uint8_t*
 QuicSendBufferAlloc(
-    _Inout_ QUIC_SEND_BUFFER* SendBuffer,
+    _In_ QUIC_CONNECTION* Connection,
     _In_ uint32_t Size
     );
 
@@ -55,11 +73,31 @@ QuicSendBufferAlloc(
 _IRQL_requires_max_(DISPATCH_LEVEL)
 void
 QuicSendBufferFree(
-    _Inout_ QUIC_SEND_BUFFER* SendBuffer,
+    _In_ QUIC_CONNECTION* Connection,
     _In_ uint8_t* Buf,
     _In_ uint32_t Size
     );
 
+//
+// Stops counting the connection against its registration's send buffer
+// budget. Called when the connection is unregistered.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicSendBufferReleaseBudget(
+    _In_ QUIC_CONNECTION* Connection
+    );
+
+//
+// Returns the number of bytes the connection should buffer: IdealBytes,
+// capped by the connection's fair share of any send buffer budgets.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint64_t
+QuicSendBufferGetLimit(
+    _In_ const QUIC_CONNECTION* Connection
+    );
+
 //
 // Buffers pending send requests until the send buffer is full.
 // Should be called when the send buffer is adjusted or bytes are ACKed.
@@ -70,6 +108,18 @@ QuicSendBufferFill(
     _In_ QUIC_CONNECTION* Connection
     );
 
+//
+// Pauses the app's producers when a send buffer budget caps the connection's
+// buffering, and resumes them once the held bytes drain below half of the
+// limit (or the budget no longer applies). Called by QuicSendBufferFill, and
+// directly when send buffering is disabled.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicSendBufferUpdatePressure(
+    _In_ QUIC_CONNECTION* Connection
+    );
+
 //
 // Indicates an ISB update to the stream.
 //
@@ -0,0 +1,227 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    The server-side session cache keeps the resumption state for the tickets a
+    server issues, so that the ticket sent to the client only needs to carry a
+    random ID referencing it (see QuicConnSendResumptionTicket).
+
+    Keeping the state on the server allows each session to be resumed only
+    once, which protects 0-RTT data from being replayed with the same ticket.
+
+    The cache is sharded by partition to avoid contention: a session is cached
+    in the shard of the partition that issued it, and the partition index is
+    encoded in the session's ID so that it can be found again from any other
+    partition.
+
+--*/
+
+#include "precomp.h"
+#ifdef QUIC_CLOG
+#include "session_cache.c.clog.h"
+#endif
+
+QUIC_INLINE
+uint64_t
+QuicSessionCacheSignature(
+    _In_reads_(QUIC_SESSION_CACHE_ID_LENGTH)
+        const uint8_t* Id
+    )
+{
+    //
+    // The ID is mostly random, so its tail makes for a good signature.
+    //
+    uint64_t Signature;
+    CxPlatCopyMemory(
+        &Signature,
+        Id + QUIC_SESSION_CACHE_ID_LENGTH - sizeof(Signature),
+        sizeof(Signature));
+    return Signature;
+}
+
+QUIC_INLINE
+uint32_t
+QuicSessionCacheEntrySize(
+    _In_ const QUIC_SESSION_CACHE_ENTRY* Entry
+    )
+{
+    return (uint32_t)sizeof(QUIC_SESSION_CACHE_ENTRY) + Entry->TicketLength;
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+QUIC_STATUS
+QuicSessionCacheInitialize(
+    _Out_ QUIC_SESSION_CACHE* Cache,
+    _In_ uint32_t MaxByteCount,
+    _In_ uint64_t Lifetime
+    )
+{
+    CxPlatZeroMemory(Cache, sizeof(*Cache));
+    if (!CxPlatHashtableInitializeEx(&Cache->Table, CXPLAT_HASH_MIN_SIZE)) {
+        QuicTraceEvent(
+            AllocFailure,
+            "Allocation of '%s' failed. (%llu bytes)",
+            "session cache table",
+            0);
+        return QUIC_STATUS_OUT_OF_MEMORY;
+    }
+    CxPlatDispatchLockInitialize(&Cache->Lock);
+    CxPlatListInitializeHead(&Cache->LruList);
+    Cache->MaxByteCount = MaxByteCount;
+    Cache->Lifetime = Lifetime;
+    return QUIC_STATUS_SUCCESS;
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicSessionCacheUninitialize(
+    _In_ QUIC_SESSION_CACHE* Cache
+    )
+{
+    while (!CxPlatListIsEmpty(&Cache->LruList)) {
+        QUIC_SESSION_CACHE_ENTRY* Entry =
+            CXPLAT_CONTAINING_RECORD(
+                CxPlatListRemoveHead(&Cache->LruList),
+                QUIC_SESSION_CACHE_ENTRY,
+                LruEntry);
+        CxPlatHashtableRemove(&Cache->Table, &Entry->TableEntry, NULL);
+        QuicSessionCacheEntryFree(Entry);
+    }
+    CxPlatHashtableUninitialize(&Cache->Table);
+    CxPlatDispatchLockUninitialize(&Cache->Lock);
+}
+
+_Requires_lock_held_(Cache->Lock)
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+void
+QuicSessionCacheRemoveEntry(
+    _In_ QUIC_SESSION_CACHE* Cache,
+    _In_ QUIC_SESSION_CACHE_ENTRY* Entry
+    )
+{
+    CxPlatHashtableRemove(&Cache->Table, &Entry->TableEntry, NULL);
+    CxPlatListEntryRemove(&Entry->LruEntry);
+    CXPLAT_DBG_ASSERT(Cache->EntryCount > 0);
+    CXPLAT_DBG_ASSERT(Cache->ByteCount >= QuicSessionCacheEntrySize(Entry));
+    Cache->EntryCount--;
+    Cache->ByteCount -= QuicSessionCacheEntrySize(Entry);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_STATUS
+QuicSessionCacheInsert(
+    _In_ QUIC_SESSION_CACHE* Cache,
+    _In_reads_(QUIC_SESSION_CACHE_ID_LENGTH)
+        const uint8_t* Id,
+    _In_ uint32_t TicketLength,
+    _In_reads_bytes_(TicketLength)
+        const uint8_t* Ticket,
+    _In_ uint64_t TimeNow
+    )
+{
+    const uint32_t EntrySize = (uint32_t)sizeof(QUIC_SESSION_CACHE_ENTRY) + TicketLength;
+    if (EntrySize > Cache->MaxByteCount) {
+        return QUIC_STATUS_BUFFER_TOO_SMALL;
+    }
+
+    QUIC_SESSION_CACHE_ENTRY* NewEntry =
+        CXPLAT_ALLOC_NONPAGED(EntrySize, QUIC_POOL_SESSION_CACHE);
+    if (NewEntry == NULL) {
+        QuicTraceEvent(
+            AllocFailure,
+            "Allocation of '%s' failed. (%llu bytes)",
+            "session cache entry",
+            EntrySize);
+        return QUIC_STATUS_OUT_OF_MEMORY;
+    }
+
+    NewEntry->ExpirationTime = TimeNow + Cache->Lifetime;
+    CxPlatCopyMemory(NewEntry->Id, Id, QUIC_SESSION_CACHE_ID_LENGTH);
+    NewEntry->TicketLength = TicketLength;
+    CxPlatCopyMemory(NewEntry->Ticket, Ticket, TicketLength);
+
+    CxPlatDispatchLockAcquire(&Cache->Lock);
+
+    //
+    // Sessions expire in LRU order, so expired sessions are always at the head
+    // of the list. Evict those first, then the least recently used ones until
+    // the new session fits.
+    //
+    while (!CxPlatListIsEmpty(&Cache->LruList)) {
+        QUIC_SESSION_CACHE_ENTRY* OldEntry =
+            CXPLAT_CONTAINING_RECORD(
+                Cache->LruList.Flink,
+                QUIC_SESSION_CACHE_ENTRY,
+                LruEntry);
+        if (OldEntry->ExpirationTime > TimeNow &&
+            Cache->ByteCount + EntrySize <= Cache->MaxByteCount) {
+            break;
+        }
+        QuicSessionCacheRemoveEntry(Cache, OldEntry);
+        QuicSessionCacheEntryFree(OldEntry);
+    }
+
+    CxPlatHashtableInsert(
+        &Cache->Table,
+        &NewEntry->TableEntry,
+        QuicSessionCacheSignature(Id),
+        NULL);
+    CxPlatListInsertTail(&Cache->LruList, &NewEntry->LruEntry);
+    Cache->EntryCount++;
+    Cache->ByteCount += EntrySize;
+
+    CxPlatDispatchLockRelease(&Cache->Lock);
+
+    return QUIC_STATUS_SUCCESS;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+_Must_inspect_result_
+_Success_(return != NULL)
+QUIC_SESSION_CACHE_ENTRY*
+QuicSessionCacheRemove(
+    _In_ QUIC_SESSION_CACHE* Cache,
+    _In_reads_(QUIC_SESSION_CACHE_ID_LENGTH)
+        const uint8_t* Id,
+    _In_ uint64_t TimeNow
+    )
+{
+    QUIC_SESSION_CACHE_ENTRY* Entry = NULL;
+
+    CxPlatDispatchLockAcquire(&Cache->Lock);
+
+    CXPLAT_HASHTABLE_LOOKUP_CONTEXT Context;
+    CXPLAT_HASHTABLE_ENTRY* TableEntry =
+        CxPlatHashtableLookup(&Cache->Table, QuicSessionCacheSignature(Id), &Context);
+    while (TableEntry != NULL) {
+        QUIC_SESSION_CACHE_ENTRY* Candidate =
+            CXPLAT_CONTAINING_RECORD(TableEntry, QUIC_SESSION_CACHE_ENTRY, TableEntry);
+        if (memcmp(Candidate->Id, Id, QUIC_SESSION_CACHE_ID_LENGTH) == 0) {
+            QuicSessionCacheRemoveEntry(Cache, Candidate);
+            if (Candidate->ExpirationTime > TimeNow) {
+                Entry = Candidate;
+            } else {
+                QuicSessionCacheEntryFree(Candidate);
+            }
+            break;
+        }
+        TableEntry = CxPlatHashtableLookupNext(&Cache->Table, &Context);
+    }
+
+    CxPlatDispatchLockRelease(&Cache->Lock);
+
+    return Entry;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicSessionCacheEntryFree(
+    _In_ __drv_freesMem(Mem) QUIC_SESSION_CACHE_ENTRY* Entry
+    )
+{
+    CXPLAT_FREE(Entry, QUIC_POOL_SESSION_CACHE);
+}
@@ -0,0 +1,133 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+--*/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//
+// A single cached session: the full (server) resumption ticket that a client
+// ticket references by ID.
+//
+typedef struct QUIC_SESSION_CACHE_ENTRY {
+
+    //
+    // Link in the cache's hash table, keyed by the ID.
+    //
+    CXPLAT_HASHTABLE_ENTRY TableEntry;
+
+    //
+    // Link in the cache's LRU list.
+    //
+    CXPLAT_LIST_ENTRY LruEntry;
+
+    //
+    // The time (in us) after which the session can no longer be resumed.
+    //
+    uint64_t ExpirationTime;
+
+    uint8_t Id[QUIC_SESSION_CACHE_ID_LENGTH];
+
+    uint32_t TicketLength;
+    _Field_size_bytes_(TicketLength)
+    uint8_t Ticket[0];
+
+} QUIC_SESSION_CACHE_ENTRY;
+
+//
+// One shard of the server-side session cache. Each partition owns a shard,
+// which holds the sessions issued by connections on that partition.
+//
+// Sessions are single use: a lookup removes the session it finds, so a
+// replayed ticket misses. Sessions also expire after a fixed lifetime, and
+// the least recently issued sessions are evicted to keep the shard within its
+// memory limit.
+//
+typedef struct QUIC_SESSION_CACHE {
+
+    CXPLAT_DISPATCH_LOCK Lock;
+
+    //
+    // Table of all cached sessions (QUIC_SESSION_CACHE_ENTRY.TableEntry).
+    //
+    CXPLAT_HASHTABLE Table;
+
+    //
+    // List of all cached sessions (QUIC_SESSION_CACHE_ENTRY.LruEntry), least
+    // recently used first. Since sessions are single use, that is also the
+    // order they were issued, and so the order they expire.
+    //
+    CXPLAT_LIST_ENTRY LruList;
+
+    //
+    // The number of sessions and their total size (in bytes) in the cache.
+    //
+    uint32_t EntryCount;
+    uint32_t ByteCount;
+
+    //
+    // Limits configured at initialization.
+    //
+    uint32_t MaxByteCount;
+    uint64_t Lifetime;
+
+} QUIC_SESSION_CACHE;
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+QUIC_STATUS
+QuicSessionCacheInitialize(
+    _Out_ QUIC_SESSION_CACHE* Cache,
+    _In_ uint32_t MaxByteCount,
+    _In_ uint64_t Lifetime
+    );
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicSessionCacheUninitialize(
+    _In_ QUIC_SESSION_CACHE* Cache
+    );
+
+//
+// Caches a copy of the ticket under the given ID, first evicting expired and
+// then least recently used sessions as necessary to make room for it.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_STATUS
+QuicSessionCacheInsert(
+    _In_ QUIC_SESSION_CACHE* Cache,
+    _In_reads_(QUIC_SESSION_CACHE_ID_LENGTH)
+        const uint8_t* Id,
+    _In_ uint32_t TicketLength,
+    _In_reads_bytes_(TicketLength)
+        const uint8_t* Ticket,
+    _In_ uint64_t TimeNow
+    );
+
+//
+// Removes and returns the unexpired session with the given ID, if there is
+// one. The caller must free it with QuicSessionCacheEntryFree.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+_Must_inspect_result_
+_Success_(return != NULL)
+QUIC_SESSION_CACHE_ENTRY*
+QuicSessionCacheRemove(
+    _In_ QUIC_SESSION_CACHE* Cache,
+    _In_reads_(QUIC_SESSION_CACHE_ID_LENGTH)
+        const uint8_t* Id,
+    _In_ uint64_t TimeNow
+    );
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+QuicSessionCacheEntryFree(
+    _In_ __drv_freesMem(Mem) QUIC_SESSION_CACHE_ENTRY* Entry
+    );
+
+#if defined(__cplusplus)
+}
+#endif
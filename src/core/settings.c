@@ -51,6 +51,15 @@ QuicSettingsSetDefault(
     if (!Settings->IsSet.FixedServerID) {
         Settings->FixedServerID = 0;
     }
+    if (!Settings->IsSet.ReplayFilterSize) {
+        Settings->ReplayFilterSize = QUIC_DEFAULT_REPLAY_FILTER_SIZE;
+    }
+    if (!Settings->IsSet.ReplayFilterWindowMs) {
+        Settings->ReplayFilterWindowMs = QUIC_DEFAULT_REPLAY_FILTER_WINDOW_MS;
+    }
+    if (!Settings->IsSet.InitialRateLimit) {
+        Settings->InitialRateLimit = QUIC_DEFAULT_INITIAL_RATE_LIMIT;
+    }
     if (!Settings->IsSet.MaxWorkerQueueDelayUs) {
         Settings->MaxWorkerQueueDelayUs = MS_TO_US(QUIC_MAX_WORKER_QUEUE_DELAY);
     }
@@ -174,6 +183,33 @@ QuicSettingsSetDefault(
     if (!Settings->IsSet.StreamMultiReceiveEnabled) {
         Settings->StreamMultiReceiveEnabled = QUIC_DEFAULT_STREAM_MULTI_RECEIVE_ENABLED;
     }
+    if (!Settings->IsSet.AdaptiveAckFrequencyEnabled) {
+        Settings->AdaptiveAckFrequencyEnabled = QUIC_DEFAULT_ADAPTIVE_ACK_FREQUENCY_ENABLED;
+    }
+    if (!Settings->IsSet.EncryptInCopyEnabled) {
+        Settings->EncryptInCopyEnabled = QUIC_DEFAULT_ENCRYPT_IN_COPY_ENABLED;
+    }
+    if (!Settings->IsSet.DecryptToAppBuffersEnabled) {
+        Settings->DecryptToAppBuffersEnabled = QUIC_DEFAULT_DECRYPT_TO_APP_BUFFERS_ENABLED;
+    }
+    if (!Settings->IsSet.DatagramFecEnabled) {
+        Settings->DatagramFecEnabled = QUIC_DEFAULT_DATAGRAM_FEC_ENABLED;
+    }
+    if (!Settings->IsSet.DatagramReceiveBatchEnabled) {
+        Settings->DatagramReceiveBatchEnabled = QUIC_DEFAULT_DATAGRAM_RECEIVE_BATCH_ENABLED;
+    }
+    if (!Settings->IsSet.TlsOffloadEnabled) {
+        Settings->TlsOffloadEnabled = QUIC_DEFAULT_TLS_OFFLOAD_ENABLED;
+    }
+    if (!Settings->IsSet.ServerSessionCacheEnabled) {
+        Settings->ServerSessionCacheEnabled = QUIC_DEFAULT_SERVER_SESSION_CACHE_ENABLED;
+    }
+    if (!Settings->IsSet.ReplayFilterEnabled) {
+        Settings->ReplayFilterEnabled = QUIC_DEFAULT_REPLAY_FILTER_ENABLED;
+    }
+    if (!Settings->IsSet.KeySharePoolEnabled) {
+        Settings->KeySharePoolEnabled = QUIC_DEFAULT_KEY_SHARE_POOL_ENABLED;
+    }
 #if QUIC_TEST_MANUAL_CONN_ID_GENERATION
     if (!Settings->IsSet.ConnIDGenDisabled) {
         Settings->ConnIDGenDisabled = QUIC_DEFAULT_CONN_ID_GENERATION_DISABLED;
@@ -212,6 +248,15 @@ QuicSettingsCopy(
     if (!Destination->IsSet.FixedServerID) {
         Destination->FixedServerID = Source->FixedServerID;
     }
+    if (!Destination->IsSet.ReplayFilterSize) {
+        Destination->ReplayFilterSize = Source->ReplayFilterSize;
+    }
+    if (!Destination->IsSet.ReplayFilterWindowMs) {
+        Destination->ReplayFilterWindowMs = Source->ReplayFilterWindowMs;
+    }
+    if (!Destination->IsSet.InitialRateLimit) {
+        Destination->InitialRateLimit = Source->InitialRateLimit;
+    }
     if (!Destination->IsSet.MaxWorkerQueueDelayUs) {
         Destination->MaxWorkerQueueDelayUs = Source->MaxWorkerQueueDelayUs;
     }
@@ -353,6 +398,33 @@ QuicSettingsCopy(
     if (!Destination->IsSet.StreamMultiReceiveEnabled) {
         Destination->StreamMultiReceiveEnabled = Source->StreamMultiReceiveEnabled;
     }
+    if (!Destination->IsSet.AdaptiveAckFrequencyEnabled) {
+        Destination->AdaptiveAckFrequencyEnabled = Source->AdaptiveAckFrequencyEnabled;
+    }
+    if (!Destination->IsSet.EncryptInCopyEnabled) {
+        Destination->EncryptInCopyEnabled = Source->EncryptInCopyEnabled;
+    }
+    if (!Destination->IsSet.DecryptToAppBuffersEnabled) {
+        Destination->DecryptToAppBuffersEnabled = Source->DecryptToAppBuffersEnabled;
+    }
+    if (!Destination->IsSet.DatagramFecEnabled) {
+        Destination->DatagramFecEnabled = Source->DatagramFecEnabled;
+    }
+    if (!Destination->IsSet.DatagramReceiveBatchEnabled) {
+        Destination->DatagramReceiveBatchEnabled = Source->DatagramReceiveBatchEnabled;
+    }
+    if (!Destination->IsSet.TlsOffloadEnabled) {
+        Destination->TlsOffloadEnabled = Source->TlsOffloadEnabled;
+    }
+    if (!Destination->IsSet.ServerSessionCacheEnabled) {
+        Destination->ServerSessionCacheEnabled = Source->ServerSessionCacheEnabled;
+    }
+    if (!Destination->IsSet.ReplayFilterEnabled) {
+        Destination->ReplayFilterEnabled = Source->ReplayFilterEnabled;
+    }
+    if (!Destination->IsSet.KeySharePoolEnabled) {
+        Destination->KeySharePoolEnabled = Source->KeySharePoolEnabled;
+    }
 #if QUIC_TEST_MANUAL_CONN_ID_GENERATION
     if (!Destination->IsSet.ConnIDGenDisabled) {
         Destination->ConnIDGenDisabled = Source->ConnIDGenDisabled;
@@ -474,6 +546,27 @@ QuicSettingApply(
         Destination->FixedServerID = Source->FixedServerID;
         Destination->IsSet.FixedServerID = TRUE;
     }
+    if (Source->IsSet.ReplayFilterSize && (!Destination->IsSet.ReplayFilterSize || OverWrite)) {
+        if (Source->ReplayFilterSize < sizeof(uint64_t)) {
+            return FALSE;
+        }
+        Destination->ReplayFilterSize = Source->ReplayFilterSize;
+        Destination->IsSet.ReplayFilterSize = TRUE;
+    }
+    if (Source->IsSet.ReplayFilterWindowMs && (!Destination->IsSet.ReplayFilterWindowMs || OverWrite)) {
+        if (Source->ReplayFilterWindowMs == 0) {
+            return FALSE;
+        }
+        Destination->ReplayFilterWindowMs = Source->ReplayFilterWindowMs;
+        Destination->IsSet.ReplayFilterWindowMs = TRUE;
+    }
+    if (Source->IsSet.InitialRateLimit && (!Destination->IsSet.InitialRateLimit || OverWrite)) {
+        if (Source->InitialRateLimit > QUIC_MAX_INITIAL_RATE_LIMIT) {
+            return FALSE;
+        }
+        Destination->InitialRateLimit = Source->InitialRateLimit;
+        Destination->IsSet.InitialRateLimit = TRUE;
+    }
     if (Source->IsSet.MaxWorkerQueueDelayUs && (!Destination->IsSet.MaxWorkerQueueDelayUs || OverWrite)) {
         Destination->MaxWorkerQueueDelayUs = Source->MaxWorkerQueueDelayUs;
         Destination->IsSet.MaxWorkerQueueDelayUs = TRUE;
@@ -748,6 +841,51 @@ QuicSettingApply(
         Destination->IsSet.StreamMultiReceiveEnabled = TRUE;
     }
 
+    if (Source->IsSet.AdaptiveAckFrequencyEnabled && (!Destination->IsSet.AdaptiveAckFrequencyEnabled || OverWrite)) {
+        Destination->AdaptiveAckFrequencyEnabled = Source->AdaptiveAckFrequencyEnabled;
+        Destination->IsSet.AdaptiveAckFrequencyEnabled = TRUE;
+    }
+
+    if (Source->IsSet.EncryptInCopyEnabled && (!Destination->IsSet.EncryptInCopyEnabled || OverWrite)) {
+        Destination->EncryptInCopyEnabled = Source->EncryptInCopyEnabled;
+        Destination->IsSet.EncryptInCopyEnabled = TRUE;
+    }
+
+    if (Source->IsSet.DecryptToAppBuffersEnabled && (!Destination->IsSet.DecryptToAppBuffersEnabled || OverWrite)) {
+        Destination->DecryptToAppBuffersEnabled = Source->DecryptToAppBuffersEnabled;
+        Destination->IsSet.DecryptToAppBuffersEnabled = TRUE;
+    }
+
+    if (Source->IsSet.DatagramFecEnabled && (!Destination->IsSet.DatagramFecEnabled || OverWrite)) {
+        Destination->DatagramFecEnabled = Source->DatagramFecEnabled;
+        Destination->IsSet.DatagramFecEnabled = TRUE;
+    }
+
+    if (Source->IsSet.DatagramReceiveBatchEnabled && (!Destination->IsSet.DatagramReceiveBatchEnabled || OverWrite)) {
+        Destination->DatagramReceiveBatchEnabled = Source->DatagramReceiveBatchEnabled;
+        Destination->IsSet.DatagramReceiveBatchEnabled = TRUE;
+    }
+
+    if (Source->IsSet.TlsOffloadEnabled && (!Destination->IsSet.TlsOffloadEnabled || OverWrite)) {
+        Destination->TlsOffloadEnabled = Source->TlsOffloadEnabled;
+        Destination->IsSet.TlsOffloadEnabled = TRUE;
+    }
+
+    if (Source->IsSet.ServerSessionCacheEnabled && (!Destination->IsSet.ServerSessionCacheEnabled || OverWrite)) {
+        Destination->ServerSessionCacheEnabled = Source->ServerSessionCacheEnabled;
+        Destination->IsSet.ServerSessionCacheEnabled = TRUE;
+    }
+
+    if (Source->IsSet.ReplayFilterEnabled && (!Destination->IsSet.ReplayFilterEnabled || OverWrite)) {
+        Destination->ReplayFilterEnabled = Source->ReplayFilterEnabled;
+        Destination->IsSet.ReplayFilterEnabled = TRUE;
+    }
+
+    if (Source->IsSet.KeySharePoolEnabled && (!Destination->IsSet.KeySharePoolEnabled || OverWrite)) {
+        Destination->KeySharePoolEnabled = Source->KeySharePoolEnabled;
+        Destination->IsSet.KeySharePoolEnabled = TRUE;
+    }
+
 #if QUIC_TEST_MANUAL_CONN_ID_GENERATION
     if (Source->IsSet.ConnIDGenDisabled && (!Destination->IsSet.ConnIDGenDisabled || OverWrite)) {
         Destination->ConnIDGenDisabled = Source->ConnIDGenDisabled;
@@ -880,6 +1018,45 @@ QuicSettingsLoad(
             &ValueLen);
     }
 
+    if (!Settings->IsSet.ReplayFilterSize) {
+        Value = QUIC_DEFAULT_REPLAY_FILTER_SIZE;
+        ValueLen = sizeof(Value);
+        CxPlatStorageReadValue(
+            Storage,
+            QUIC_SETTING_REPLAY_FILTER_SIZE,
+            (uint8_t*)&Value,
+            &ValueLen);
+        if (Value >= sizeof(uint64_t)) {
+            Settings->ReplayFilterSize = Value;
+        }
+    }
+
+    if (!Settings->IsSet.ReplayFilterWindowMs) {
+        Value = QUIC_DEFAULT_REPLAY_FILTER_WINDOW_MS;
+        ValueLen = sizeof(Value);
+        CxPlatStorageReadValue(
+            Storage,
+            QUIC_SETTING_REPLAY_FILTER_WINDOW_MS,
+            (uint8_t*)&Value,
+            &ValueLen);
+        if (Value != 0) {
+            Settings->ReplayFilterWindowMs = Value;
+        }
+    }
+
+    if (!Settings->IsSet.InitialRateLimit) {
+        Value = QUIC_DEFAULT_INITIAL_RATE_LIMIT;
+        ValueLen = sizeof(Value);
+        CxPlatStorageReadValue(
+            Storage,
+            QUIC_SETTING_INITIAL_RATE_LIMIT,
+            (uint8_t*)&Value,
+            &ValueLen);
+        if (Value <= QUIC_MAX_INITIAL_RATE_LIMIT) {
+            Settings->InitialRateLimit = Value;
+        }
+    }
+
     if (!Settings->IsSet.MaxWorkerQueueDelayUs) {
         Value = QUIC_MAX_WORKER_QUEUE_DELAY;
         ValueLen = sizeof(Value);
@@ -1442,6 +1619,96 @@ VersionSettingsFail:
             &ValueLen);
         Settings->StreamMultiReceiveEnabled = !!Value;
     }
+    if (!Settings->IsSet.AdaptiveAckFrequencyEnabled) {
+        Value = QUIC_DEFAULT_ADAPTIVE_ACK_FREQUENCY_ENABLED;
+        ValueLen = sizeof(Value);
+        CxPlatStorageReadValue(
+            Storage,
+            QUIC_SETTING_ADAPTIVE_ACK_FREQUENCY_ENABLED,
+            (uint8_t*)&Value,
+            &ValueLen);
+        Settings->AdaptiveAckFrequencyEnabled = !!Value;
+    }
+    if (!Settings->IsSet.EncryptInCopyEnabled) {
+        Value = QUIC_DEFAULT_ENCRYPT_IN_COPY_ENABLED;
+        ValueLen = sizeof(Value);
+        CxPlatStorageReadValue(
+            Storage,
+            QUIC_SETTING_ENCRYPT_IN_COPY_ENABLED,
+            (uint8_t*)&Value,
+            &ValueLen);
+        Settings->EncryptInCopyEnabled = !!Value;
+    }
+    if (!Settings->IsSet.DecryptToAppBuffersEnabled) {
+        Value = QUIC_DEFAULT_DECRYPT_TO_APP_BUFFERS_ENABLED;
+        ValueLen = sizeof(Value);
+        CxPlatStorageReadValue(
+            Storage,
+            QUIC_SETTING_DECRYPT_TO_APP_BUFFERS_ENABLED,
+            (uint8_t*)&Value,
+            &ValueLen);
+        Settings->DecryptToAppBuffersEnabled = !!Value;
+    }
+    if (!Settings->IsSet.DatagramFecEnabled) {
+        Value = QUIC_DEFAULT_DATAGRAM_FEC_ENABLED;
+        ValueLen = sizeof(Value);
+        CxPlatStorageReadValue(
+            Storage,
+            QUIC_SETTING_DATAGRAM_FEC_ENABLED,
+            (uint8_t*)&Value,
+            &ValueLen);
+        Settings->DatagramFecEnabled = !!Value;
+    }
+    if (!Settings->IsSet.DatagramReceiveBatchEnabled) {
+        Value = QUIC_DEFAULT_DATAGRAM_RECEIVE_BATCH_ENABLED;
+        ValueLen = sizeof(Value);
+        CxPlatStorageReadValue(
+            Storage,
+            QUIC_SETTING_DATAGRAM_RECEIVE_BATCH_ENABLED,
+            (uint8_t*)&Value,
+            &ValueLen);
+        Settings->DatagramReceiveBatchEnabled = !!Value;
+    }
+    if (!Settings->IsSet.TlsOffloadEnabled) {
+        Value = QUIC_DEFAULT_TLS_OFFLOAD_ENABLED;
+        ValueLen = sizeof(Value);
+        CxPlatStorageReadValue(
+            Storage,
+            QUIC_SETTING_TLS_OFFLOAD_ENABLED,
+            (uint8_t*)&Value,
+            &ValueLen);
+        Settings->TlsOffloadEnabled = !!Value;
+    }
+    if (!Settings->IsSet.ServerSessionCacheEnabled) {
+        Value = QUIC_DEFAULT_SERVER_SESSION_CACHE_ENABLED;
+        ValueLen = sizeof(Value);
+        CxPlatStorageReadValue(
+            Storage,
+            QUIC_SETTING_SERVER_SESSION_CACHE_ENABLED,
+            (uint8_t*)&Value,
+            &ValueLen);
+        Settings->ServerSessionCacheEnabled = !!Value;
+    }
+    if (!Settings->IsSet.ReplayFilterEnabled) {
+        Value = QUIC_DEFAULT_REPLAY_FILTER_ENABLED;
+        ValueLen = sizeof(Value);
+        CxPlatStorageReadValue(
+            Storage,
+            QUIC_SETTING_REPLAY_FILTER_ENABLED,
+            (uint8_t*)&Value,
+            &ValueLen);
+        Settings->ReplayFilterEnabled = !!Value;
+    }
+    if (!Settings->IsSet.KeySharePoolEnabled) {
+        Value = QUIC_DEFAULT_KEY_SHARE_POOL_ENABLED;
+        ValueLen = sizeof(Value);
+        CxPlatStorageReadValue(
+            Storage,
+            QUIC_SETTING_KEY_SHARE_POOL_ENABLED,
+            (uint8_t*)&Value,
+            &ValueLen);
+        Settings->KeySharePoolEnabled = !!Value;
+    }
 #if QUIC_TEST_MANUAL_CONN_ID_GENERATION
     if (!Settings->IsSet.ConnIDGenDisabled) {
         Value = QUIC_DEFAULT_CONN_ID_GENERATION_DISABLED;
@@ -1471,6 +1738,9 @@ QuicSettingsDump(
     QuicTraceLogVerbose(SettingDumpRetryMemoryLimit,        "[sett] RetryMemoryLimit       = %hu", Settings->RetryMemoryLimit);
     QuicTraceLogVerbose(SettingDumpLoadBalancingMode,       "[sett] LoadBalancingMode      = %hu", Settings->LoadBalancingMode);
     QuicTraceLogVerbose(SettingDumpFixedServerID,           "[sett] FixedServerID          = %u", Settings->FixedServerID);
+    QuicTraceLogVerbose(SettingDumpReplayFilterSize,        "[sett] ReplayFilterSize       = %u", Settings->ReplayFilterSize);
+    QuicTraceLogVerbose(SettingDumpReplayFilterWindowMs,    "[sett] ReplayFilterWindowMs   = %u", Settings->ReplayFilterWindowMs);
+    QuicTraceLogVerbose(SettingDumpInitialRateLimit,        "[sett] InitialRateLimit       = %u", Settings->InitialRateLimit);
     QuicTraceLogVerbose(SettingDumpMaxStatelessOperations,  "[sett] MaxStatelessOperations = %u", Settings->MaxStatelessOperations);
     QuicTraceLogVerbose(SettingDumpMaxWorkerQueueDelayUs,   "[sett] MaxWorkerQueueDelayUs  = %u", Settings->MaxWorkerQueueDelayUs);
     QuicTraceLogVerbose(SettingDumpInitialWindowPackets,    "[sett] InitialWindowPackets   = %u", Settings->InitialWindowPackets);
@@ -1525,6 +1795,15 @@ QuicSettingsDump(
     QuicTraceLogVerbose(SettingOneWayDelayEnabled,          "[sett] OneWayDelayEnabled     = %hhu", Settings->OneWayDelayEnabled);
     QuicTraceLogVerbose(SettingNetStatsEventEnabled,        "[sett] NetStatsEventEnabled   = %hhu", Settings->NetStatsEventEnabled);
     QuicTraceLogVerbose(SettingsStreamMultiReceiveEnabled,  "[sett] StreamMultiReceiveEnabled= %hhu", Settings->StreamMultiReceiveEnabled);
+    QuicTraceLogVerbose(SettingAdaptiveAckFrequencyEnabled, "[sett] AdaptiveAckFrequencyEnabled= %hhu", Settings->AdaptiveAckFrequencyEnabled);
+    QuicTraceLogVerbose(SettingEncryptInCopyEnabled,    "[sett] EncryptInCopyEnabled   = %hhu", Settings->EncryptInCopyEnabled);
+    QuicTraceLogVerbose(SettingDecryptToAppBuffersEnabled,  "[sett] DecryptToAppBuffersEnabled = %hhu", Settings->DecryptToAppBuffersEnabled);
+    QuicTraceLogVerbose(SettingDatagramFecEnabled,          "[sett] DatagramFecEnabled     = %hhu", Settings->DatagramFecEnabled);
+    QuicTraceLogVerbose(SettingDatagramReceiveBatchEnabled, "[sett] DatagramReceiveBatchEnabled = %hhu", Settings->DatagramReceiveBatchEnabled);
+    QuicTraceLogVerbose(SettingTlsOffloadEnabled,           "[sett] TlsOffloadEnabled      = %hhu", Settings->TlsOffloadEnabled);
+    QuicTraceLogVerbose(SettingServerSessionCacheEnabled,   "[sett] ServerSessionCacheEnabled = %hhu", Settings->ServerSessionCacheEnabled);
+    QuicTraceLogVerbose(SettingReplayFilterEnabled,         "[sett] ReplayFilterEnabled    = %hhu", Settings->ReplayFilterEnabled);
+    QuicTraceLogVerbose(SettingKeySharePoolEnabled,         "[sett] KeySharePoolEnabled    = %hhu", Settings->KeySharePoolEnabled);
 }
 
 _IRQL_requires_max_(PASSIVE_LEVEL)
@@ -1558,6 +1837,15 @@ QuicSettingsDumpNew(
     if (Settings->IsSet.FixedServerID) {
         QuicTraceLogVerbose(SettingDumpLFixedServerID,              "[sett] FixedServerID          = %u", Settings->FixedServerID);
     }
+    if (Settings->IsSet.ReplayFilterSize) {
+        QuicTraceLogVerbose(SettingDumpReplayFilterSize,            "[sett] ReplayFilterSize       = %u", Settings->ReplayFilterSize);
+    }
+    if (Settings->IsSet.ReplayFilterWindowMs) {
+        QuicTraceLogVerbose(SettingDumpReplayFilterWindowMs,        "[sett] ReplayFilterWindowMs   = %u", Settings->ReplayFilterWindowMs);
+    }
+    if (Settings->IsSet.InitialRateLimit) {
+        QuicTraceLogVerbose(SettingDumpInitialRateLimit,            "[sett] InitialRateLimit       = %u", Settings->InitialRateLimit);
+    }
     if (Settings->IsSet.MaxStatelessOperations) {
         QuicTraceLogVerbose(SettingDumpMaxStatelessOperations,      "[sett] MaxStatelessOperations = %u", Settings->MaxStatelessOperations);
     }
@@ -1695,6 +1983,33 @@ QuicSettingsDumpNew(
     if (Settings->IsSet.StreamMultiReceiveEnabled) {
         QuicTraceLogVerbose(SettingStreamMultiReceiveEnabled,       "[sett] StreamMultiReceiveEnabled  = %hhu", Settings->StreamMultiReceiveEnabled);
     }
+    if (Settings->IsSet.AdaptiveAckFrequencyEnabled) {
+        QuicTraceLogVerbose(SettingAdaptiveAckFrequencyEnabled, "[sett] AdaptiveAckFrequencyEnabled= %hhu", Settings->AdaptiveAckFrequencyEnabled);
+    }
+    if (Settings->IsSet.EncryptInCopyEnabled) {
+        QuicTraceLogVerbose(SettingEncryptInCopyEnabled,        "[sett] EncryptInCopyEnabled       = %hhu", Settings->EncryptInCopyEnabled);
+    }
+    if (Settings->IsSet.DecryptToAppBuffersEnabled) {
+        QuicTraceLogVerbose(SettingDecryptToAppBuffersEnabled,  "[sett] DecryptToAppBuffersEnabled = %hhu", Settings->DecryptToAppBuffersEnabled);
+    }
+    if (Settings->IsSet.DatagramFecEnabled) {
+        QuicTraceLogVerbose(SettingDatagramFecEnabled,          "[sett] DatagramFecEnabled         = %hhu", Settings->DatagramFecEnabled);
+    }
+    if (Settings->IsSet.DatagramReceiveBatchEnabled) {
+        QuicTraceLogVerbose(SettingDatagramReceiveBatchEnabled, "[sett] DatagramReceiveBatchEnabled = %hhu", Settings->DatagramReceiveBatchEnabled);
+    }
+    if (Settings->IsSet.TlsOffloadEnabled) {
+        QuicTraceLogVerbose(SettingTlsOffloadEnabled,           "[sett] TlsOffloadEnabled      = %hhu", Settings->TlsOffloadEnabled);
+    }
+    if (Settings->IsSet.ServerSessionCacheEnabled) {
+        QuicTraceLogVerbose(SettingServerSessionCacheEnabled,   "[sett] ServerSessionCacheEnabled = %hhu", Settings->ServerSessionCacheEnabled);
+    }
+    if (Settings->IsSet.ReplayFilterEnabled) {
+        QuicTraceLogVerbose(SettingReplayFilterEnabled,         "[sett] ReplayFilterEnabled    = %hhu", Settings->ReplayFilterEnabled);
+    }
+    if (Settings->IsSet.KeySharePoolEnabled) {
+        QuicTraceLogVerbose(SettingKeySharePoolEnabled,         "[sett] KeySharePoolEnabled    = %hhu", Settings->KeySharePoolEnabled);
+    }
 #if QUIC_TEST_MANUAL_CONN_ID_GENERATION
     if (Settings->IsSet.ConnIDGenDisabled) {
         QuicTraceLogVerbose(SettingConnIDGenDisabled,               "[sett] ConnIDGenDisabled          = %hhu", Settings->ConnIDGenDisabled);
@@ -1745,6 +2060,27 @@ QuicSettingsGlobalSettingsToInternal(
         SettingsSize,
         InternalSettings);
 
+    SETTING_COPY_TO_INTERNAL_SIZED(
+        ReplayFilterSize,
+        QUIC_GLOBAL_SETTINGS,
+        Settings,
+        SettingsSize,
+        InternalSettings);
+
+    SETTING_COPY_TO_INTERNAL_SIZED(
+        ReplayFilterWindowMs,
+        QUIC_GLOBAL_SETTINGS,
+        Settings,
+        SettingsSize,
+        InternalSettings);
+
+    SETTING_COPY_TO_INTERNAL_SIZED(
+        InitialRateLimit,
+        QUIC_GLOBAL_SETTINGS,
+        Settings,
+        SettingsSize,
+        InternalSettings);
+
     return QUIC_STATUS_SUCCESS;
 }
 
@@ -1974,6 +2310,78 @@ QuicSettingsSettingsToInternal(
         SettingsSize,
         InternalSettings);
 
+    SETTING_COPY_FLAG_TO_INTERNAL_SIZED(
+        Flags,
+        AdaptiveAckFrequencyEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        SettingsSize,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_TO_INTERNAL_SIZED(
+        Flags,
+        EncryptInCopyEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        SettingsSize,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_TO_INTERNAL_SIZED(
+        Flags,
+        DecryptToAppBuffersEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        SettingsSize,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_TO_INTERNAL_SIZED(
+        Flags,
+        DatagramFecEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        SettingsSize,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_TO_INTERNAL_SIZED(
+        Flags,
+        DatagramReceiveBatchEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        SettingsSize,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_TO_INTERNAL_SIZED(
+        Flags,
+        TlsOffloadEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        SettingsSize,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_TO_INTERNAL_SIZED(
+        Flags,
+        ServerSessionCacheEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        SettingsSize,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_TO_INTERNAL_SIZED(
+        Flags,
+        ReplayFilterEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        SettingsSize,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_TO_INTERNAL_SIZED(
+        Flags,
+        KeySharePoolEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        SettingsSize,
+        InternalSettings);
+
     return QUIC_STATUS_SUCCESS;
 }
 
@@ -2159,6 +2567,78 @@ QuicSettingsGetSettings(
         *SettingsLength,
         InternalSettings);
 
+    SETTING_COPY_FLAG_FROM_INTERNAL_SIZED(
+        Flags,
+        AdaptiveAckFrequencyEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        *SettingsLength,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_FROM_INTERNAL_SIZED(
+        Flags,
+        EncryptInCopyEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        *SettingsLength,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_FROM_INTERNAL_SIZED(
+        Flags,
+        DecryptToAppBuffersEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        *SettingsLength,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_FROM_INTERNAL_SIZED(
+        Flags,
+        DatagramFecEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        *SettingsLength,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_FROM_INTERNAL_SIZED(
+        Flags,
+        DatagramReceiveBatchEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        *SettingsLength,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_FROM_INTERNAL_SIZED(
+        Flags,
+        TlsOffloadEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        *SettingsLength,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_FROM_INTERNAL_SIZED(
+        Flags,
+        ServerSessionCacheEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        *SettingsLength,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_FROM_INTERNAL_SIZED(
+        Flags,
+        ReplayFilterEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        *SettingsLength,
+        InternalSettings);
+
+    SETTING_COPY_FLAG_FROM_INTERNAL_SIZED(
+        Flags,
+        KeySharePoolEnabled,
+        QUIC_SETTINGS,
+        Settings,
+        *SettingsLength,
+        InternalSettings);
+
     *SettingsLength = CXPLAT_MIN(*SettingsLength, sizeof(QUIC_SETTINGS));
 
     return QUIC_STATUS_SUCCESS;
@@ -2203,6 +2683,27 @@ QuicSettingsGetGlobalSettings(
         *SettingsLength,
         InternalSettings);
 
+    SETTING_COPY_FROM_INTERNAL_SIZED(
+        ReplayFilterSize,
+        QUIC_GLOBAL_SETTINGS,
+        Settings,
+        *SettingsLength,
+        InternalSettings);
+
+    SETTING_COPY_FROM_INTERNAL_SIZED(
+        ReplayFilterWindowMs,
+        QUIC_GLOBAL_SETTINGS,
+        Settings,
+        *SettingsLength,
+        InternalSettings);
+
+    SETTING_COPY_FROM_INTERNAL_SIZED(
+        InitialRateLimit,
+        QUIC_GLOBAL_SETTINGS,
+        Settings,
+        *SettingsLength,
+        InternalSettings);
+
     *SettingsLength = CXPLAT_MIN(*SettingsLength, sizeof(QUIC_GLOBAL_SETTINGS));
 
     return QUIC_STATUS_SUCCESS;
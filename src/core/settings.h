@@ -62,10 +62,22 @@ typedef struct QUIC_SETTINGS_INTERNAL {
             uint64_t OneWayDelayEnabled                     : 1;
             uint64_t NetStatsEventEnabled                   : 1;
             uint64_t StreamMultiReceiveEnabled              : 1;
+            uint64_t AdaptiveAckFrequencyEnabled            : 1;
+            uint64_t EncryptInCopyEnabled                   : 1;
+            uint64_t DecryptToAppBuffersEnabled             : 1;
+            uint64_t DatagramFecEnabled                     : 1;
+            uint64_t DatagramReceiveBatchEnabled            : 1;
+            uint64_t TlsOffloadEnabled                      : 1;
+            uint64_t ServerSessionCacheEnabled              : 1;
+            uint64_t ReplayFilterEnabled                    : 1;
+            uint64_t KeySharePoolEnabled                    : 1;
+            uint64_t ReplayFilterSize                       : 1;
+            uint64_t ReplayFilterWindowMs                   : 1;
+            uint64_t InitialRateLimit                       : 1;
             uint64_t XdpEnabled                             : 1;
             uint64_t QTIPEnabled                            : 1;
             uint64_t ConnIDGenDisabled                      : 1;
-            uint64_t RESERVED                               : 13;
+            uint64_t RESERVED                               : 1;
         } IsSet;
     };
 
@@ -92,6 +104,9 @@ typedef struct QUIC_SETTINGS_INTERNAL {
     uint32_t KeepAliveIntervalMs;
     uint32_t DestCidUpdateIdleTimeoutMs;
     uint32_t FixedServerID;                 // Global only
+    uint32_t ReplayFilterSize;              // Global only
+    uint32_t ReplayFilterWindowMs;          // Global only
+    uint32_t InitialRateLimit;              // Global only
     uint16_t PeerBidiStreamCount;
     uint16_t PeerUnidiStreamCount;
     uint16_t RetryMemoryLimit;              // Global only
@@ -116,6 +131,15 @@ typedef struct QUIC_SETTINGS_INTERNAL {
     uint8_t OneWayDelayEnabled              : 1;
     uint8_t NetStatsEventEnabled            : 1;
     uint8_t StreamMultiReceiveEnabled       : 1;
+    uint8_t AdaptiveAckFrequencyEnabled     : 1;
+    uint8_t EncryptInCopyEnabled            : 1;
+    uint8_t DecryptToAppBuffersEnabled      : 1;
+    uint8_t DatagramFecEnabled              : 1;
+    uint8_t DatagramReceiveBatchEnabled     : 1;
+    uint8_t TlsOffloadEnabled               : 1;
+    uint8_t ServerSessionCacheEnabled       : 1;
+    uint8_t ReplayFilterEnabled             : 1;
+    uint8_t KeySharePoolEnabled             : 1;
     uint8_t XdpEnabled                      : 1;
     uint8_t QTIPEnabled                     : 1;
     uint8_t ConnIDGenDisabled               : 1;
@@ -0,0 +1,186 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    The source limiter bounds the rate at which a single source address prefix
+    can create new connections on a binding, so that one abusive network can't
+    take all of a server's handshake capacity. It tracks prefixes in a
+    count-min sketch, so its memory is fixed however many prefixes are seen.
+
+--*/
+
+#include "precomp.h"
+#ifdef QUIC_CLOG
+#include "source_limiter.c.clog.h"
+#endif
+
+//
+// Each packet adds this much to its prefix's level, so that levels can drain
+// by fractions of a packet per millisecond.
+//
+#define QUIC_SOURCE_LIMITER_PACKET_COST 1000
+
+CXPLAT_STATIC_ASSERT(
+    (QUIC_SOURCE_LIMITER_WIDTH & (QUIC_SOURCE_LIMITER_WIDTH - 1)) == 0,
+    "Sketch width must be a power of two");
+CXPLAT_STATIC_ASSERT(
+    (uint64_t)QUIC_MAX_INITIAL_RATE_LIMIT * QUIC_SOURCE_LIMITER_PACKET_COST +
+        QUIC_SOURCE_LIMITER_PACKET_COST <= UINT32_MAX,
+    "Levels must fit in a cell");
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicSourceLimiterInitialize(
+    _Out_ QUIC_SOURCE_LIMITER* Limiter
+    )
+{
+    CxPlatZeroMemory(Limiter, sizeof(*Limiter));
+    CxPlatDispatchLockInitialize(&Limiter->Lock);
+    CxPlatRandom(sizeof(Limiter->Key), Limiter->Key);
+}
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicSourceLimiterUninitialize(
+    _In_ QUIC_SOURCE_LIMITER* Limiter
+    )
+{
+    if (Limiter->Cells != NULL) {
+        CXPLAT_FREE(Limiter->Cells, QUIC_POOL_SOURCE_LIMITER);
+        Limiter->Cells = NULL;
+    }
+    CxPlatDispatchLockUninitialize(&Limiter->Lock);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+static
+BOOLEAN
+QuicSourceLimiterAllocate(
+    _In_ QUIC_SOURCE_LIMITER* Limiter
+    )
+{
+    const size_t AllocSize =
+        QUIC_SOURCE_LIMITER_DEPTH * QUIC_SOURCE_LIMITER_WIDTH *
+        sizeof(QUIC_SOURCE_LIMITER_CELL);
+
+    QUIC_SOURCE_LIMITER_CELL* Cells =
+        CXPLAT_ALLOC_NONPAGED(AllocSize, QUIC_POOL_SOURCE_LIMITER);
+    if (Cells == NULL) {
+        QuicTraceEvent(
+            AllocFailure,
+            "Allocation of '%s' failed. (%llu bytes)",
+            "source limiter",
+            AllocSize);
+        return FALSE;
+    }
+    CxPlatZeroMemory(Cells, AllocSize);
+
+    CxPlatDispatchLockAcquire(&Limiter->Lock);
+    if (Limiter->Cells == NULL) {
+        Limiter->Cells = Cells;
+        Cells = NULL;
+    }
+    CxPlatDispatchLockRelease(&Limiter->Lock);
+
+    if (Cells != NULL) {
+        CXPLAT_FREE(Cells, QUIC_POOL_SOURCE_LIMITER); // Another thread beat us to it.
+    }
+
+    return TRUE;
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicSourceLimiterTryAcquire(
+    _In_ QUIC_SOURCE_LIMITER* Limiter,
+    _In_ const QUIC_ADDR* RemoteAddress,
+    _In_ uint32_t Rate,
+    _In_ uint32_t TimeMs
+    )
+{
+    CXPLAT_DBG_ASSERT(Rate != 0 && Rate <= QUIC_MAX_INITIAL_RATE_LIMIT);
+
+    if (Limiter->Cells == NULL &&
+        !QuicSourceLimiterAllocate(Limiter)) {
+        return TRUE;
+    }
+
+    //
+    // The prefix (and the family, to keep IPv4 and IPv6 prefixes apart) is what
+    // is hashed, so that every address in the prefix shares its cells.
+    //
+    uint8_t Prefix[1 + QUIC_SOURCE_LIMITER_IPV6_PREFIX_LENGTH];
+    uint32_t PrefixLength;
+    const QUIC_ADDRESS_FAMILY Family = QuicAddrGetFamily(RemoteAddress);
+    if (Family == QUIC_ADDRESS_FAMILY_INET) {
+        Prefix[0] = 4;
+        CxPlatCopyMemory(
+            Prefix + 1,
+            &RemoteAddress->Ipv4.sin_addr,
+            QUIC_SOURCE_LIMITER_IPV4_PREFIX_LENGTH);
+        PrefixLength = 1 + QUIC_SOURCE_LIMITER_IPV4_PREFIX_LENGTH;
+    } else {
+        Prefix[0] = 6;
+        CxPlatCopyMemory(
+            Prefix + 1,
+            &RemoteAddress->Ipv6.sin6_addr,
+            QUIC_SOURCE_LIMITER_IPV6_PREFIX_LENGTH);
+        PrefixLength = 1 + QUIC_SOURCE_LIMITER_IPV6_PREFIX_LENGTH;
+    }
+
+    uint64_t Hash[2];
+    QuicReplayFilterHash(Limiter->Key, PrefixLength, Prefix, Hash);
+
+    const uint32_t Capacity = Rate * QUIC_SOURCE_LIMITER_PACKET_COST;
+    QUIC_SOURCE_LIMITER_CELL* Cells[QUIC_SOURCE_LIMITER_DEPTH];
+    uint32_t MinLevel = UINT32_MAX;
+
+    CxPlatDispatchLockAcquire(&Limiter->Lock);
+
+    //
+    // Drain each of the prefix's cells at the rate, and find the smallest.
+    //
+    uint64_t Probe = Hash[0];
+    for (uint32_t i = 0; i < QUIC_SOURCE_LIMITER_DEPTH; ++i) {
+        QUIC_SOURCE_LIMITER_CELL* Cell =
+            &Limiter->Cells[i * QUIC_SOURCE_LIMITER_WIDTH +
+                (Probe & (QUIC_SOURCE_LIMITER_WIDTH - 1))];
+        const int32_t Elapsed = (int32_t)(TimeMs - Cell->TimeMs);
+        if (Elapsed > 0) {
+            const uint64_t Drain = (uint64_t)Elapsed * Rate;
+            Cell->Level = Drain >= Cell->Level ? 0 : Cell->Level - (uint32_t)Drain;
+            Cell->TimeMs = TimeMs;
+        } else if (Elapsed < -1000) {
+            //
+            // Small negative values are just another processor's clock lagging
+            // behind. Anything more means the cell is so old that the time has
+            // wrapped around, and a full bucket drains in a second.
+            //
+            Cell->Level = 0;
+            Cell->TimeMs = TimeMs;
+        }
+        if (Cell->Level < MinLevel) {
+            MinLevel = Cell->Level;
+        }
+        Cells[i] = Cell;
+        Probe += Hash[1];
+    }
+
+    BOOLEAN Allowed = FALSE;
+    if (MinLevel + QUIC_SOURCE_LIMITER_PACKET_COST <= Capacity) {
+        const uint32_t NewLevel = MinLevel + QUIC_SOURCE_LIMITER_PACKET_COST;
+        for (uint32_t i = 0; i < QUIC_SOURCE_LIMITER_DEPTH; ++i) {
+            if (Cells[i]->Level < NewLevel) {
+                Cells[i]->Level = NewLevel;
+            }
+        }
+        Allowed = TRUE;
+    }
+
+    CxPlatDispatchLockRelease(&Limiter->Lock);
+
+    return Allowed;
+}
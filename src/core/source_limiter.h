@@ -0,0 +1,83 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+--*/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+//
+// One counter of the source limiter's sketch: a leaky bucket level (in
+// thousandths of a packet) and the time (in ms) it was last drained.
+//
+typedef struct QUIC_SOURCE_LIMITER_CELL {
+
+    uint32_t Level;
+    uint32_t TimeMs;
+
+} QUIC_SOURCE_LIMITER_CELL;
+
+//
+// Rate limits the Initial packets that may create new connections on a binding,
+// per source address prefix (IPv4 /24 or IPv6 /48).
+//
+// Rather than track every prefix, the limiter keeps a count-min sketch of leaky
+// buckets: each prefix hashes to one cell in each of several rows, and its level
+// is the smallest of those cells. Collisions can only make a prefix look busier
+// than it is, never quieter, so a heavy hitter is always limited while memory
+// stays fixed no matter how many prefixes are seen. Each packet raises the
+// prefix's cells to its level plus one ("conservative update") to keep light
+// prefixes that share a cell with a heavy one from being over-counted.
+//
+// A prefix may send a burst of one second's worth of packets, then the rate.
+//
+typedef struct QUIC_SOURCE_LIMITER {
+
+    CXPLAT_DISPATCH_LOCK Lock;
+
+    //
+    // The sketch, QUIC_SOURCE_LIMITER_DEPTH rows of QUIC_SOURCE_LIMITER_WIDTH
+    // cells, allocated on first use.
+    //
+    QUIC_SOURCE_LIMITER_CELL* Cells;
+
+    //
+    // Secret key for hashing prefixes, so that a peer can't pick which cells
+    // its prefixes land on.
+    //
+    uint64_t Key[2];
+
+} QUIC_SOURCE_LIMITER;
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicSourceLimiterInitialize(
+    _Out_ QUIC_SOURCE_LIMITER* Limiter
+    );
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+void
+QuicSourceLimiterUninitialize(
+    _In_ QUIC_SOURCE_LIMITER* Limiter
+    );
+
+//
+// Returns FALSE if the prefix of the remote address has exceeded Rate packets
+// per second; otherwise counts the packet against the prefix and returns TRUE.
+// If the sketch can't be allocated, every packet is allowed.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+BOOLEAN
+QuicSourceLimiterTryAcquire(
+    _In_ QUIC_SOURCE_LIMITER* Limiter,
+    _In_ const QUIC_ADDR* RemoteAddress,
+    _In_ uint32_t Rate,
+    _In_ uint32_t TimeMs
+    );
+
+#if defined(__cplusplus)
+}
+#endif
@@ -162,6 +162,7 @@ QuicStreamInitialize(
     }
 
     Stream->MaxAllowedRecvOffset = Stream->RecvBuffer.VirtualBufferLength;
+    Stream->RecvWindow = Stream->RecvBuffer.VirtualBufferLength;
     Stream->RecvWindowLastUpdate = CxPlatTimeUs64();
 
     QuicConnAddRef(Connection, QUIC_CONN_REF_STREAM);
@@ -223,6 +224,7 @@ QuicStreamFree(
 #endif
     QuicPerfCounterDecrement(Connection->Partition, QUIC_PERF_COUNTER_STRM_ACTIVE);
 
+    QuicLibraryReleaseRecvWindow(Stream->RecvWindowReserved);
     QuicRecvBufferUninitialize(&Stream->RecvBuffer);
     QuicRangeUninitialize(&Stream->SparseAckRanges);
     CxPlatDispatchLockUninitialize(&Stream->ApiSendRequestLock);
@@ -829,8 +831,7 @@ QuicStreamParamGet(
         }
 
         *BufferLength = sizeof(uint64_t);
-        *(uint64_t*)Buffer =
-            Stream->Connection->SendBuffer.IdealBytes;
+        *(uint64_t*)Buffer = QuicSendBufferGetLimit(Stream->Connection);
 
         Status = QUIC_STATUS_SUCCESS;
         break;
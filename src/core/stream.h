@@ -99,6 +99,18 @@ typedef struct QUIC_SEND_REQUEST {
     //
     void* ClientContext;
 
+    //
+    // Datagrams only: the time (in us) after which the datagram is dropped
+    // instead of sent, or 0 for no limit.
+    //
+    uint64_t ExpirationTime;
+
+    //
+    // Datagrams only: the priority class, up to
+    // QUIC_DATAGRAM_PRIORITY_CLASS_MAX.
+    //
+    uint8_t PriorityClass;
+
 } QUIC_SEND_REQUEST;
 
 //
@@ -420,6 +432,19 @@ typedef struct QUIC_STREAM {
     //
     uint64_t RecvWindowLastUpdate;
 
+    //
+    // The auto-tuned receive window advertised beyond RecvBuffer.BaseOffset.
+    // Only differs from RecvBuffer.VirtualBufferLength (which never shrinks)
+    // after an idle stream's window was shrunk to return memory to the
+    // library's receive budget.
+    //
+    uint32_t RecvWindow;
+
+    //
+    // Bytes of RecvWindow growth reserved from the receive memory budget.
+    //
+    uint32_t RecvWindowReserved;
+
     //
     // The structure for tracking received buffers.
     //
@@ -469,6 +469,15 @@ QuicStreamProcessStreamFrame(
         goto Error;
     }
 
+    if (EndOffset > Stream->MaxAllowedRecvOffset) {
+        //
+        // The receive buffer's virtual length may exceed the advertised window
+        // after auto-tuning shrank it, so explicitly enforce the credit given.
+        //
+        Status = QUIC_STATUS_BUFFER_TOO_SMALL;
+        goto Error;
+    }
+
     if (Frame->Length == 0) {
 
         Status = QUIC_STATUS_SUCCESS;
@@ -748,6 +757,16 @@ QuicStreamRecv(
             return QUIC_STATUS_INVALID_PARAMETER;
         }
 
+        if (Packet->DecryptRedirectBuffer != NULL &&
+            Frame.Data == Packet->AvailBuffer + Packet->HeaderLength + Packet->DecryptRedirectOffset) {
+            //
+            // The data was decrypted directly into the receive buffer, so the
+            // packet only has the (undefined) leftovers at this point.
+            //
+            CXPLAT_DBG_ASSERT(Frame.Data + Frame.Length == Buffer + BufferLength);
+            Frame.Data = Packet->DecryptRedirectBuffer;
+        }
+
         Status =
             QuicStreamProcessStreamFrame(
                 Stream, Packet->EncryptedWith0Rtt, &Frame);
@@ -764,6 +783,190 @@ QuicStreamRecv(
     return Status;
 }
 
+//
+// Receive window auto-tuning:
+//
+// Stream windows grow (double) when the app drains them fast enough that they
+// might limit throughput (see QuicStreamOnBytesDelivered). Each growth beyond
+// the initial window is reserved from the library-wide receive memory budget
+// (QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT), much like TCP receive buffer
+// auto-tuning is bounded by tcp_rmem.
+//
+// When a budget is configured, the connection-wide window is tuned the same
+// way once a hot stream's window reaches it. When the budget is exhausted,
+// growth reserved by the connection's idle streams is reclaimed for the hot
+// one. Credit that was already advertised can't be revoked, so a shrunk
+// window only takes effect as the peer consumes it.
+//
+// The budget only blocks window growth. It isn't a cap on receive memory in
+// use: the initial windows aren't charged against it, receive buffer chunks
+// are allocated without consulting it, and a window that was shrunk keeps
+// its buffer until the data already advertised for has been delivered.
+//
+
+_IRQL_requires_max_(PASSIVE_LEVEL)
+static
+uint32_t
+QuicStreamRecvGetWindow(
+    _In_ const QUIC_STREAM* Stream
+    )
+{
+    //
+    // With app-owned buffers, the window is entirely based on the amount of
+    // buffer space provided by the app.
+    //
+    return Stream->RecvBuffer.RecvMode == QUIC_RECV_BUF_MODE_APP_OWNED ?
+        Stream->RecvBuffer.VirtualBufferLength : Stream->RecvWindow;
+}
+
+//
+// Shrinks the auto-tuned windows of the connection's idle streams back to their
+// initial size, returning the reserved growth to the receive memory budget.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+static
+void
+QuicStreamRecvReclaimIdleWindows(
+    _In_ QUIC_CONNECTION* Connection,
+    _In_ const QUIC_STREAM* HotStream
+    )
+{
+    if (Connection->Streams.StreamTable == NULL) {
+        return;
+    }
+
+    const uint64_t TimeNow = CxPlatTimeUs64();
+    const uint64_t IdleThreshold =
+        QUIC_RECV_WINDOW_IDLE_RTT_COUNT * Connection->Paths[0].SmoothedRtt;
+
+    CXPLAT_HASHTABLE_ENUMERATOR Enumerator;
+    CXPLAT_HASHTABLE_ENTRY* Entry;
+    CxPlatHashtableEnumerateBegin(Connection->Streams.StreamTable, &Enumerator);
+    while ((Entry = CxPlatHashtableEnumerateNext(Connection->Streams.StreamTable, &Enumerator)) != NULL) {
+        QUIC_STREAM* Stream = CXPLAT_CONTAINING_RECORD(Entry, QUIC_STREAM, TableEntry);
+        if (Stream == HotStream ||
+            Stream->RecvWindowReserved == 0 ||
+            Stream->RecvBuffer.RecvMode == QUIC_RECV_BUF_MODE_APP_OWNED ||
+            CxPlatTimeDiff64(Stream->RecvWindowLastUpdate, TimeNow) <= IdleThreshold) {
+            continue;
+        }
+
+        Stream->RecvWindow -= Stream->RecvWindowReserved;
+        QuicLibraryReleaseRecvWindow(Stream->RecvWindowReserved);
+        Stream->RecvWindowReserved = 0;
+        Connection->Stats.Recv.WindowShrinkCount++;
+
+        QuicTraceLogStreamVerbose(
+            ShrinkRxWindow,
+            Stream,
+            "Shrinking idle RX window to %u",
+            Stream->RecvWindow);
+    }
+    CxPlatHashtableEnumerateEnd(Connection->Streams.StreamTable, &Enumerator);
+}
+
+//
+// Reserves window growth from the receive memory budget, reclaiming the
+// growth of idle streams if the budget is exhausted.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+static
+BOOLEAN
+QuicStreamRecvReserveWindow(
+    _In_ QUIC_STREAM* Stream,
+    _In_ uint32_t Length,
+    _Out_ uint32_t* Reserved
+    )
+{
+    if (QuicLibraryTryReserveRecvWindow(Length, Reserved)) {
+        return TRUE;
+    }
+
+    QuicStreamRecvReclaimIdleWindows(Stream->Connection, Stream);
+    if (QuicLibraryTryReserveRecvWindow(Length, Reserved)) {
+        return TRUE;
+    }
+
+    Stream->Connection->Stats.Recv.WindowBudgetLimitedCount++;
+    QuicTraceLogStreamVerbose(
+        RxWindowBudgetLimited,
+        Stream,
+        "RX window growth limited by receive memory budget");
+    return FALSE;
+}
+
+//
+// Doubles the connection-wide receive window. Only done when a receive memory
+// budget is configured; otherwise the window stays at ConnFlowControlWindow.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+static
+BOOLEAN
+QuicStreamRecvGrowConnWindow(
+    _In_ QUIC_STREAM* Stream
+    )
+{
+    QUIC_CONNECTION* Connection = Stream->Connection;
+
+    if (MsQuicLib.RecvMemoryLimit == 0 ||
+        Connection->Send.MaxDataWindow >= QUIC_MAX_TUNED_CONN_FLOW_CONTROL_WINDOW) {
+        return FALSE;
+    }
+
+    const uint32_t Growth = (uint32_t)Connection->Send.MaxDataWindow;
+    uint32_t Reserved;
+    if (!QuicStreamRecvReserveWindow(Stream, Growth, &Reserved)) {
+        return FALSE;
+    }
+
+    Connection->Send.MaxDataWindow += Growth;
+    Connection->Send.MaxDataWindowReserved += Reserved;
+    Connection->Send.MaxData += Growth;
+    Connection->Stats.Recv.WindowGrowCount++;
+    QuicSendSetSendFlag(&Connection->Send, QUIC_CONN_SEND_FLAG_MAX_DATA);
+
+    QuicTraceLogConnVerbose(
+        IncreaseConnRxWindow,
+        Connection,
+        "Increasing connection RX window to %llu",
+        Connection->Send.MaxDataWindow);
+
+    return TRUE;
+}
+
+//
+// Doubles the stream's receive window, first growing the connection-wide
+// window if the stream's window is already limited by it.
+//
+_IRQL_requires_max_(PASSIVE_LEVEL)
+static
+void
+QuicStreamRecvGrowWindow(
+    _In_ QUIC_STREAM* Stream
+    )
+{
+    const uint32_t Window = QuicStreamRecvGetWindow(Stream);
+
+    if (Window >= Stream->Connection->Send.MaxDataWindow &&
+        !QuicStreamRecvGrowConnWindow(Stream)) {
+        return;
+    }
+
+    uint32_t Reserved;
+    if (!QuicStreamRecvReserveWindow(Stream, Window, &Reserved)) {
+        return;
+    }
+
+    Stream->RecvWindow = Window * 2;
+    Stream->RecvWindowReserved += Reserved;
+    Stream->Connection->Stats.Recv.WindowGrowCount++;
+    if (Stream->RecvWindow > Stream->RecvBuffer.VirtualBufferLength) {
+        QuicRecvBufferIncreaseVirtualBufferLength(
+            &Stream->RecvBuffer,
+            Stream->RecvWindow);
+    }
+}
+
 //
 // Criteria for sending MAX_DATA/MAX_STREAM_DATA frames:
 //
@@ -783,14 +986,14 @@ QuicStreamOnBytesDelivered(
     )
 {
     const uint64_t RecvBufferDrainThreshold =
-        Stream->RecvBuffer.VirtualBufferLength / QUIC_RECV_BUFFER_DRAIN_RATIO;
+        QuicStreamRecvGetWindow(Stream) / QUIC_RECV_BUFFER_DRAIN_RATIO;
 
     Stream->RecvWindowBytesDelivered += BytesDelivered;
     Stream->Connection->Send.MaxData += BytesDelivered;
 
     Stream->Connection->Send.OrderedStreamBytesDeliveredAccumulator += BytesDelivered;
     if (Stream->Connection->Send.OrderedStreamBytesDeliveredAccumulator >=
-        Stream->Connection->Settings.ConnFlowControlWindow / QUIC_RECV_BUFFER_DRAIN_RATIO) {
+        Stream->Connection->Send.MaxDataWindow / QUIC_RECV_BUFFER_DRAIN_RATIO) {
         Stream->Connection->Send.OrderedStreamBytesDeliveredAccumulator = 0;
         QuicSendSetSendFlag(
             &Stream->Connection->Send,
@@ -802,12 +1005,14 @@ QuicStreamOnBytesDelivered(
         uint64_t TimeNow = CxPlatTimeUs64();
 
         //
-        // Limit stream FC window growth by the connection FC window size.
+        // Limit stream FC window growth by the connection FC window size
+        // (unless auto-tuning can grow that too).
         // When using app-owned buffers, skip this: the virtual buffer length is entirely based
         // on the amount of buffer space provided by the app.
         //
         if (Stream->RecvBuffer.VirtualBufferLength != 0 &&
-            Stream->RecvBuffer.VirtualBufferLength < Stream->Connection->Settings.ConnFlowControlWindow) {
+            (QuicStreamRecvGetWindow(Stream) < Stream->Connection->Send.MaxDataWindow ||
+             MsQuicLib.RecvMemoryLimit != 0)) {
 
             uint64_t TimeThreshold =
                 ((Stream->RecvWindowBytesDelivered * Stream->Connection->Paths[0].SmoothedRtt) / RecvBufferDrainThreshold);
@@ -822,25 +1027,22 @@ QuicStreamOnBytesDelivered(
                 // We've delivered data at an average rate of at least:
                 //   R / QUIC_RECV_BUFFER_DRAIN_RATIO
                 //
-                // Double VirtualBufferLength to make sure it doesn't limit
-                // throughput.
+                // Double the window to make sure it doesn't limit throughput.
                 //
                 // Mainly people complain about flow control when it limits
                 // throughput. But if we grow the buffer limit and then the app
-                // stops receiving data, bytes will pile up in the buffer. We could
-                // add logic to shrink the buffer when the app absorb rate is too
-                // low.
+                // stops receiving data, bytes will pile up in the buffer. With
+                // a receive memory budget configured, such idle streams give
+                // their growth back when a hotter stream needs it.
                 //
 
-                QuicRecvBufferIncreaseVirtualBufferLength(
-                    &Stream->RecvBuffer,
-                    Stream->RecvBuffer.VirtualBufferLength * 2);
+                QuicStreamRecvGrowWindow(Stream);
 
                 QuicTraceLogStreamVerbose(
                     IncreaseRxBuffer,
                     Stream,
                     "Increasing max RX buffer size to %u (MinRtt=%llu; TimeNow=%llu; LastUpdate=%llu)",
-                    Stream->RecvBuffer.VirtualBufferLength * 2,
+                    QuicStreamRecvGetWindow(Stream),
                     Stream->Connection->Paths[0].MinRtt,
                     TimeNow,
                     Stream->RecvWindowLastUpdate);
@@ -872,8 +1074,11 @@ QuicStreamOnBytesDelivered(
         Stream->RecvBuffer.BaseOffset + Stream->RecvBuffer.VirtualBufferLength >=
         Stream->MaxAllowedRecvOffset);
 
-    Stream->MaxAllowedRecvOffset =
-        Stream->RecvBuffer.BaseOffset + Stream->RecvBuffer.VirtualBufferLength;
+    const uint64_t NewMaxAllowedRecvOffset =
+        Stream->RecvBuffer.BaseOffset + QuicStreamRecvGetWindow(Stream);
+    if (NewMaxAllowedRecvOffset > Stream->MaxAllowedRecvOffset) {
+        Stream->MaxAllowedRecvOffset = NewMaxAllowedRecvOffset;
+    }
 
     QuicSendSetSendFlag(
         &Stream->Connection->Send,
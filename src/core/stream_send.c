@@ -263,6 +263,8 @@ QuicStreamSendShutdown(
 
             if (Stream->Connection->Settings.SendBufferingEnabled) {
                 QuicSendBufferFill(Stream->Connection);
+            } else {
+                QuicSendBufferUpdatePressure(Stream->Connection);
             }
 
             CXPLAT_DBG_ASSERT(Stream->SendRequests != NULL);
@@ -456,7 +458,7 @@ QuicStreamCompleteSendRequest(
         (void)QuicStreamIndicateEvent(Stream, &Event);
     } else if (SendRequest->InternalBuffer.Length != 0) {
         QuicSendBufferFree(
-            &Connection->SendBuffer,
+            Connection,
             SendRequest->InternalBuffer.Buffer,
             SendRequest->InternalBuffer.Length);
     }
@@ -467,6 +469,8 @@ QuicStreamCompleteSendRequest(
 
         if (Connection->Settings.SendBufferingEnabled) {
             QuicSendBufferFill(Connection);
+        } else {
+            QuicSendBufferUpdatePressure(Connection);
         }
     }
 
@@ -490,7 +494,7 @@ QuicStreamSendBufferRequest(
         //
         uint8_t* Buf =
             QuicSendBufferAlloc(
-                &Connection->SendBuffer,
+                Connection,
                 (uint32_t)Req->TotalLength);
         if (Buf == NULL) {
             return QUIC_STATUS_OUT_OF_MEMORY;
@@ -660,6 +664,8 @@ QuicStreamSendFlush(
 
         if (Stream->Connection->Settings.SendBufferingEnabled) {
             QuicSendBufferFill(Stream->Connection);
+        } else {
+            QuicSendBufferUpdatePressure(Stream->Connection);
         }
 
         CXPLAT_DBG_ASSERT(Stream->SendRequests != NULL);
@@ -686,12 +692,15 @@ QuicStreamCopyFromSendRequests(
     _In_ QUIC_STREAM* Stream,
     _In_ uint64_t Offset,
     _Out_writes_bytes_(Len) uint8_t* Buf,
-    _In_range_(>, 0) uint16_t Len
+    _In_range_(>, 0) uint16_t Len,
+    _Inout_ QUIC_PACKET_BUILDER* Builder
     )
 {
     //
     // Copies up to Len stream bytes starting at Offset from the noncontiguous
-    // send request queue into a contiguous frame buffer.
+    // send request queue into a contiguous frame buffer. If the packet builder
+    // allows it, the copy is instead deferred until the packet is encrypted,
+    // so that the data is encrypted directly from the send request buffers.
     //
 
     CXPLAT_DBG_ASSERT(Len > 0);
@@ -743,7 +752,10 @@ QuicStreamCopyFromSendRequests(
         uint32_t BufferLeft = Req->Buffers[CurIndex].Length - (uint32_t)CurOffset;
         uint16_t CopyLength = Len < BufferLeft ? Len : (uint16_t)BufferLeft;
         CXPLAT_DBG_ASSERT(CopyLength > 0);
-        CxPlatCopyMemory(Buf, Req->Buffers[CurIndex].Buffer + CurOffset, CopyLength);
+        if (!QuicPacketBuilderAddGatherSegment(
+                Builder, Buf, Req->Buffers[CurIndex].Buffer + CurOffset, CopyLength)) {
+            CxPlatCopyMemory(Buf, Req->Buffers[CurIndex].Buffer + CurOffset, CopyLength);
+        }
         Len -= CopyLength;
         Buf += CopyLength;
 
@@ -782,9 +794,10 @@ QuicStreamWriteOneFrame(
     _Inout_ uint16_t* FramePayloadBytes,
     _Inout_ uint16_t* FrameBytes,
     _Out_writes_bytes_(*FrameBytes) uint8_t* Buffer,
-    _Inout_ QUIC_SENT_PACKET_METADATA* PacketMetadata
+    _Inout_ QUIC_PACKET_BUILDER* Builder
     )
 {
+    QUIC_SENT_PACKET_METADATA* PacketMetadata = Builder->Metadata;
     QUIC_STREAM_EX Frame = { FALSE, ExplicitDataLength, Stream->ID, Offset, 0, NULL };
     uint16_t HeaderLength = 0;
 
@@ -820,7 +833,7 @@ QuicStreamWriteOneFrame(
         }
         Frame.Data = Buffer + HeaderLength;
         QuicStreamCopyFromSendRequests(
-            Stream, Offset, (uint8_t*)Frame.Data, (uint16_t)Frame.Length);
+            Stream, Offset, (uint8_t*)Frame.Data, (uint16_t)Frame.Length, Builder);
         Stream->Connection->Stats.Send.TotalStreamBytes += Frame.Length;
     }
 
@@ -892,12 +905,13 @@ void
 QuicStreamWriteStreamFrames(
     _In_ QUIC_STREAM* Stream,
     _In_ BOOLEAN ExplicitDataLength,
-    _Inout_ QUIC_SENT_PACKET_METADATA* PacketMetadata,
+    _Inout_ QUIC_PACKET_BUILDER* Builder,
     _Inout_ uint16_t* BufferLength,
     _Out_writes_bytes_(*BufferLength) uint8_t* Buffer
     )
 {
     QUIC_SEND* Send = &Stream->Connection->Send;
+    QUIC_SENT_PACKET_METADATA* PacketMetadata = Builder->Metadata;
     uint16_t BytesWritten = 0;
 
     //
@@ -995,7 +1009,7 @@ QuicStreamWriteStreamFrames(
             &FramePayloadBytes,
             &FrameBytes,
             Buffer + BytesWritten,
-            PacketMetadata);
+            Builder);
 
         BOOLEAN ExitLoop = FALSE;
 
@@ -1194,7 +1208,7 @@ QuicStreamSendWrite(
         QuicStreamWriteStreamFrames(
             Stream,
             IsInitial,
-            Builder->Metadata,
+            Builder,
             &StreamFrameLength,
             Builder->Datagram->Buffer + Builder->DatagramLength);
 
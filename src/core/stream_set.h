@@ -189,6 +189,18 @@ QuicStreamSetNewLocalStream(
     _In_ QUIC_STREAM* Stream
     );
 
+//
+// Looks up an existing stream by ID. Returns NULL if it doesn't exist (yet or
+// anymore).
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+_Ret_maybenull_
+QUIC_STREAM*
+QuicStreamSetLookupStream(
+    _Inout_ QUIC_STREAM_SET* StreamSet,
+    _In_ uint64_t ID
+    );
+
 //
 // Does a look up for a peer's stream object, by the stream ID. It may create
 // new streams up to StreamId if the CreateIfMissing flag is set.
@@ -0,0 +1,253 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Unit tests for BBR congestion control, including simulated bottleneck
+    links used to compare goodput and retransmit rate of BBRv3 against CUBIC
+    and BBR.
+
+--*/
+
+#include "main.h"
+#ifdef QUIC_CLOG
+#include "BbrTest.cpp.clog.h"
+#endif
+
+#include "MockConnection.h"
+#include "NetworkSimulator.h"
+
+TEST(BbrTest, InitializeBbr3)
+{
+    QUIC_CONNECTION Connection;
+    QUIC_SETTINGS_INTERNAL Settings{};
+    Settings.InitialWindowPackets = 10;
+
+    InitializeMockConnection(Connection, 1280);
+    Settings.CongestionControlAlgorithm = QUIC_CONGESTION_CONTROL_ALGORITHM_BBR;
+    QuicCongestionControlInitialize(&Connection.CongestionControl, &Settings);
+    ASSERT_STREQ(Connection.CongestionControl.Name, "BBR");
+    ASSERT_FALSE(Connection.CongestionControl.Bbr.IsBbr3);
+    ASSERT_EQ(Connection.CongestionControl.QuicCongestionControlOnEcn, nullptr);
+
+    InitializeMockConnection(Connection, 1280);
+    Settings.CongestionControlAlgorithm = QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3;
+    QuicCongestionControlInitialize(&Connection.CongestionControl, &Settings);
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Connection.CongestionControl.Bbr;
+    ASSERT_STREQ(Connection.CongestionControl.Name, "BBRv3");
+    ASSERT_TRUE(Bbr->IsBbr3);
+    ASSERT_NE(Connection.CongestionControl.QuicCongestionControlOnEcn, nullptr);
+    ASSERT_TRUE(Bbr->BwProbeSamples);
+    ASSERT_EQ(Bbr->InflightHi, UINT32_MAX);
+    ASSERT_EQ(Bbr->InflightLo, UINT32_MAX);
+    ASSERT_EQ(Bbr->BandwidthLo, UINT64_MAX);
+    ASSERT_EQ(Bbr->CwndGain, 512u);
+    ASSERT_GT(Bbr->CongestionWindow, 0u);
+}
+
+//
+// Excessive loss during STARTUP must end STARTUP and bound the inflight.
+//
+TEST(BbrTest, Bbr3StartupLossSetsInflightHi)
+{
+    QUIC_CONNECTION Connection;
+    QUIC_SETTINGS_INTERNAL Settings{};
+    Settings.InitialWindowPackets = 10;
+    Settings.CongestionControlAlgorithm = QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3;
+
+    InitializeMockConnection(Connection, 1280);
+    QuicCongestionControlInitialize(&Connection.CongestionControl, &Settings);
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Connection.CongestionControl.Bbr;
+
+    QuicCongestionControlOnDataSent(&Connection.CongestionControl, 10000);
+
+    QUIC_LOSS_EVENT LossEvent;
+    CxPlatZeroMemory(&LossEvent, sizeof(LossEvent));
+    LossEvent.LargestPacketNumberLost = 5;
+    LossEvent.LargestSentPacketNumber = 10;
+    LossEvent.NumRetransmittableBytes = 1000; // 10%
+    QuicCongestionControlOnDataLost(&Connection.CongestionControl, &LossEvent);
+
+    ASSERT_TRUE(Bbr->BtlbwFound);
+    ASSERT_TRUE(Bbr->LossInRound);
+    ASSERT_FALSE(Bbr->BwProbeSamples);
+    ASSERT_EQ(Bbr->InflightHi, 10000u);
+}
+
+//
+// Loss below the 2% threshold must not be treated as a full pipe.
+//
+TEST(BbrTest, Bbr3ToleratesLowLoss)
+{
+    QUIC_CONNECTION Connection;
+    QUIC_SETTINGS_INTERNAL Settings{};
+    Settings.InitialWindowPackets = 10;
+    Settings.CongestionControlAlgorithm = QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3;
+
+    InitializeMockConnection(Connection, 1280);
+    QuicCongestionControlInitialize(&Connection.CongestionControl, &Settings);
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Connection.CongestionControl.Bbr;
+
+    QuicCongestionControlOnDataSent(&Connection.CongestionControl, 100000);
+
+    QUIC_LOSS_EVENT LossEvent;
+    CxPlatZeroMemory(&LossEvent, sizeof(LossEvent));
+    LossEvent.LargestPacketNumberLost = 5;
+    LossEvent.LargestSentPacketNumber = 100;
+    LossEvent.NumRetransmittableBytes = 1000; // 1%
+    QuicCongestionControlOnDataLost(&Connection.CongestionControl, &LossEvent);
+
+    ASSERT_FALSE(Bbr->BtlbwFound);
+    ASSERT_TRUE(Bbr->BwProbeSamples);
+    ASSERT_EQ(Bbr->InflightHi, UINT32_MAX);
+}
+
+TEST(BbrTest, Bbr3EcnAccounting)
+{
+    QUIC_CONNECTION Connection;
+    QUIC_SETTINGS_INTERNAL Settings{};
+    Settings.InitialWindowPackets = 10;
+    Settings.CongestionControlAlgorithm = QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3;
+
+    InitializeMockConnection(Connection, 1280);
+    QuicCongestionControlInitialize(&Connection.CongestionControl, &Settings);
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Connection.CongestionControl.Bbr;
+
+    QUIC_ECN_EVENT EcnEvent;
+    CxPlatZeroMemory(&EcnEvent, sizeof(EcnEvent));
+    EcnEvent.LargestPacketNumberAcked = 5;
+    EcnEvent.LargestSentPacketNumber = 10;
+    EcnEvent.CePacketCount = 2;
+    QuicCongestionControlOnEcn(&Connection.CongestionControl, &EcnEvent);
+    QuicCongestionControlOnEcn(&Connection.CongestionControl, &EcnEvent);
+
+    ASSERT_TRUE(Bbr->EcnInRound);
+    ASSERT_EQ(Bbr->RoundCePackets, 4u);
+    ASSERT_EQ(Connection.Stats.Send.EcnCongestionCount, 1u); // Once per round
+}
+
+//
+// The pacing allowance is the bandwidth estimate (bits per second) times the
+// pacing gain and the time since the last send, in bytes. A large estimate
+// over a long idle time saturates rather than wrapping.
+//
+TEST(BbrTest, PacingSendAllowance)
+{
+    QUIC_CONNECTION Connection;
+    QUIC_SETTINGS_INTERNAL Settings{};
+    Settings.InitialWindowPackets = 10;
+    Settings.CongestionControlAlgorithm = QUIC_CONGESTION_CONTROL_ALGORITHM_BBR;
+
+    InitializeMockConnection(Connection, 1280);
+    Connection.Settings.PacingEnabled = TRUE;
+    QuicCongestionControlInitialize(&Connection.CongestionControl, &Settings);
+    QUIC_CONGESTION_CONTROL* Cc = &Connection.CongestionControl;
+    QUIC_CONGESTION_CONTROL_BBR* Bbr = &Cc->Bbr;
+
+    const uint64_t BytesPerSec = 5 * 1000 * 1000;
+    Bbr->BbrState = BBR_STATE_PROBE_BW;
+    Bbr->PacingGain = 256; // GAIN_UNIT
+    Bbr->MinRtt = 40 * 1000;
+    Bbr->CongestionWindow = 1000 * 1000;
+    QuicSlidingWindowExtremumUpdateMax(
+        &Bbr->BandwidthFilter.WindowedMaxFilter, BytesPerSec * 8, 0);
+
+    ASSERT_EQ(QuicCongestionControlGetSendAllowance(Cc, 1000, TRUE), 5000u);
+    ASSERT_EQ(QuicCongestionControlGetSendAllowance(Cc, 2000, TRUE), 10000u);
+
+    Bbr->PacingGain = 512;
+    ASSERT_EQ(QuicCongestionControlGetSendAllowance(Cc, 1000, TRUE), 10000u);
+
+    //
+    // 20 GB (10 GB/s at a gain of 2 for a second) doesn't fit in 32 bits; the
+    // allowance is still capped at a quarter of the window.
+    //
+    QuicSlidingWindowExtremumUpdateMax(
+        &Bbr->BandwidthFilter.WindowedMaxFilter, 10000ull * 1000 * 1000 * 8, 1);
+    ASSERT_EQ(
+        QuicCongestionControlGetSendAllowance(Cc, 1000 * 1000, TRUE),
+        Bbr->CongestionWindow / 4);
+
+    //
+    // After 20 minutes idle at 10 Gbps, the time since the last send is
+    // clamped to the RTT instead of wrapping the allowance.
+    //
+    Bbr->PacingGain = 739; // 2.89
+    QuicSlidingWindowExtremumReset(&Bbr->BandwidthFilter.WindowedMaxFilter);
+    QuicSlidingWindowExtremumUpdateMax(
+        &Bbr->BandwidthFilter.WindowedMaxFilter, 10ull * 1000 * 1000 * 1000, 2);
+    ASSERT_EQ(
+        QuicCongestionControlGetSendAllowance(Cc, 20ull * 60 * 1000 * 1000, TRUE),
+        Bbr->CongestionWindow / 4);
+    Bbr->CongestionWindow = UINT32_MAX;
+    ASSERT_EQ(
+        QuicCongestionControlGetSendAllowance(Cc, 20ull * 60 * 1000 * 1000, TRUE),
+        10ull * 1000 * 1000 * 1000 / 8 * 739 / 256 * Bbr->MinRtt / (1000 * 1000));
+}
+
+//
+// With a buffer of a few BDPs, every algorithm should fill the link; BBRv3
+// should not lose more than CUBIC does to fill it.
+//
+TEST(BbrTest, SimulatedLinkDeepBuffer)
+{
+    SimLinkConfig Config = { kSimRate, kSimRttUs, 4 * kSimBdp, 0, 0, 0, 0, 0, kSimDurationUs };
+
+    SimLinkResult Cubic = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC);
+    SimLinkResult Bbr3 = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3);
+
+    ASSERT_GT(Cubic.GoodputBytesPerSec, kSimRate * 85 / 100);
+    ASSERT_GT(Bbr3.GoodputBytesPerSec, kSimRate * 85 / 100);
+    ASSERT_LE(Bbr3.RetransmitRate, Cubic.RetransmitRate + 0.01);
+}
+
+//
+// A buffer of a quarter BDP: BBR (v1) ignores loss and keeps overflowing the
+// queue, while BBRv3 bounds its inflight and keeps retransmits low without
+// giving up goodput.
+//
+TEST(BbrTest, SimulatedLinkShallowBuffer)
+{
+    SimLinkConfig Config = { kSimRate, kSimRttUs, kSimBdp / 4, 0, 0, 0, 0, 0, kSimDurationUs };
+
+    SimLinkResult Cubic = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC);
+    SimLinkResult Bbr = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_BBR);
+    SimLinkResult Bbr3 = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3);
+
+    ASSERT_GT(Bbr3.GoodputBytesPerSec, kSimRate * 80 / 100);
+    ASSERT_GE(Bbr3.GoodputBytesPerSec, Cubic.GoodputBytesPerSec * 9 / 10);
+    ASSERT_LT(Bbr3.RetransmitRate, 0.02);
+    ASSERT_LT(Bbr3.RetransmitRate, Bbr.RetransmitRate);
+}
+
+//
+// 1% random (non-congestive) loss is below BBRv3's 2% loss threshold, so it
+// neither backs off from the link nor adds queue overflows on top of it.
+//
+TEST(BbrTest, SimulatedLinkRandomLoss)
+{
+    SimLinkConfig Config = { kSimRate, kSimRttUs, kSimBdp, 0, 10000, 0, 0, 0, kSimDurationUs };
+
+    SimLinkResult Cubic = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC);
+    SimLinkResult Bbr3 = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3);
+
+    ASSERT_GT(Bbr3.GoodputBytesPerSec, kSimRate * 85 / 100);
+    ASSERT_LT(Bbr3.RetransmitRate, 0.02);
+    ASSERT_LT(Bbr3.RetransmitRate, Cubic.RetransmitRate);
+}
+
+//
+// With ECN marking well before the queue overflows, BBRv3 should react to the
+// marks and (almost) never overflow the queue.
+//
+TEST(BbrTest, SimulatedLinkEcn)
+{
+    SimLinkConfig Config = { kSimRate, kSimRttUs, 2 * kSimBdp, kSimBdp / 4, 0, 0, 0, 0, kSimDurationUs };
+
+    SimLinkResult Bbr3 = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3);
+
+    ASSERT_GT(Bbr3.GoodputBytesPerSec, kSimRate * 85 / 100);
+    ASSERT_LT(Bbr3.RetransmitRate, 0.005);
+}
@@ -0,0 +1,389 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Unit tests for the binding's listener selection and retry tokens.
+
+--*/
+
+#include "main.h"
+#ifdef QUIC_CLOG
+#include "BindingTest.cpp.clog.h"
+#endif
+
+#include <memory>
+#include <string>
+#include <vector>
+
+struct MockListener {
+    QUIC_LISTENER Listener;
+    uint8_t AlpnList[256];
+    MockListener(const char* Address, std::initializer_list<const char*> Alpns) {
+        CxPlatZeroMemory(&Listener, sizeof(Listener));
+        if (Address != nullptr) {
+            EXPECT_TRUE(QuicAddrFromString(Address, 443, &Listener.LocalAddress));
+            Listener.WildCard = QuicAddrIsWildCard(&Listener.LocalAddress);
+        } else {
+            Listener.WildCard = TRUE;
+        }
+        uint16_t Length = 0;
+        for (auto Alpn : Alpns) {
+            AlpnList[Length] = (uint8_t)strlen(Alpn);
+            CxPlatCopyMemory(AlpnList + Length + 1, Alpn, AlpnList[Length]);
+            Length += 1 + AlpnList[Length];
+        }
+        Listener.AlpnList = AlpnList;
+        Listener.AlpnListLength = Length;
+        CxPlatRefInitialize(&Listener.StartRefCount);
+    }
+};
+
+struct MockBinding {
+    QUIC_BINDING Binding;
+    QUIC_PARTITION Partition;
+    QUIC_CONNECTION Connection;
+    std::vector<std::unique_ptr<MockListener>> Listeners;
+    MockBinding() {
+        CxPlatZeroMemory(&Binding, sizeof(Binding));
+        CxPlatDispatchRwLockInitialize(&Binding.RwLock);
+        CxPlatListInitializeHead(&Binding.Listeners);
+        //
+        // The CID lookup isn't used by these tests.
+        //
+        CxPlatDispatchRwLockInitialize(&Binding.Lookup.RwLock);
+        Binding.Lookup.MaximizePartitioning = TRUE;
+        CxPlatZeroMemory(&Partition, sizeof(Partition));
+        CxPlatZeroMemory(&Connection, sizeof(Connection));
+        Connection.Partition = &Partition;
+    }
+    ~MockBinding() {
+        for (auto& Listener : Listeners) {
+            QuicBindingUnregisterListener(&Binding, &Listener->Listener);
+        }
+        CxPlatDispatchRwLockUninitialize(&Binding.Lookup.RwLock);
+        if (Binding.ListenerAlpnTable != nullptr) {
+            CxPlatHashtableUninitialize(Binding.ListenerAlpnTable);
+        }
+        CxPlatDispatchRwLockUninitialize(&Binding.RwLock);
+    }
+    QUIC_STATUS Register(const char* Address, std::initializer_list<const char*> Alpns, QUIC_LISTENER** Listener = nullptr) {
+        auto Mock = std::make_unique<MockListener>(Address, Alpns);
+        QUIC_STATUS Status = QuicBindingRegisterListener(&Binding, &Mock->Listener);
+        if (QUIC_SUCCEEDED(Status)) {
+            if (Listener != nullptr) {
+                *Listener = &Mock->Listener;
+            }
+            Listeners.push_back(std::move(Mock));
+        }
+        return Status;
+    }
+    void Unregister(QUIC_LISTENER* Listener) {
+        for (auto it = Listeners.begin(); it != Listeners.end(); ++it) {
+            if (&(*it)->Listener == Listener) {
+                QuicBindingUnregisterListener(&Binding, Listener);
+                Listeners.erase(it);
+                return;
+            }
+        }
+    }
+    QUIC_LISTENER* Get(const char* Address, std::initializer_list<const char*> ClientAlpns, std::string* NegotiatedAlpn = nullptr) {
+        uint8_t ClientAlpnList[256];
+        uint16_t Length = 0;
+        for (auto Alpn : ClientAlpns) {
+            ClientAlpnList[Length] = (uint8_t)strlen(Alpn);
+            CxPlatCopyMemory(ClientAlpnList + Length + 1, Alpn, ClientAlpnList[Length]);
+            Length += 1 + ClientAlpnList[Length];
+        }
+        QUIC_ADDR LocalAddress;
+        EXPECT_TRUE(QuicAddrFromString(Address, 443, &LocalAddress));
+        QUIC_NEW_CONNECTION_INFO Info;
+        CxPlatZeroMemory(&Info, sizeof(Info));
+        Info.LocalAddress = &LocalAddress;
+        Info.ClientAlpnList = ClientAlpnList;
+        Info.ClientAlpnListLength = Length;
+        QUIC_LISTENER* Listener = QuicBindingGetListener(&Binding, &Connection, &Info);
+        if (Listener != nullptr) {
+            CxPlatRefDecrement(&Listener->StartRefCount);
+            if (NegotiatedAlpn != nullptr) {
+                NegotiatedAlpn->assign((const char*)Info.NegotiatedAlpn, Info.NegotiatedAlpnLength);
+            }
+        }
+        return Listener;
+    }
+};
+
+TEST(BindingTest, NoListeners)
+{
+    MockBinding Binding;
+    ASSERT_EQ(nullptr, Binding.Get("192.0.2.1", {"a"}));
+    ASSERT_EQ(nullptr, Binding.Binding.ListenerAlpnTable);
+
+    QUIC_LISTENER* Listener;
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, Binding.Register(nullptr, {"a"}, &Listener));
+    ASSERT_NE(nullptr, Binding.Binding.ListenerAlpnTable);
+    ASSERT_EQ(Listener, Binding.Get("192.0.2.1", {"a"}));
+}
+
+TEST(BindingTest, SelectsListenerByAlpn)
+{
+    MockBinding Binding;
+    QUIC_LISTENER *A, *B;
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, Binding.Register(nullptr, {"a"}, &A));
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, Binding.Register(nullptr, {"b", "bb"}, &B));
+
+    std::string Alpn;
+    ASSERT_EQ(A, Binding.Get("192.0.2.1", {"a"}, &Alpn));
+    ASSERT_EQ("a", Alpn);
+    ASSERT_EQ(B, Binding.Get("2001:db8::1", {"x", "bb"}, &Alpn));
+    ASSERT_EQ("bb", Alpn);
+    ASSERT_EQ(nullptr, Binding.Get("192.0.2.1", {"c"}));
+    ASSERT_EQ(nullptr, Binding.Get("192.0.2.1", {"aa"}));
+    ASSERT_EQ(2, Binding.Partition.PerfCounters[QUIC_PERF_COUNTER_CONN_NO_ALPN]);
+}
+
+TEST(BindingTest, NegotiatesListenerPreferredAlpn)
+{
+    MockBinding Binding;
+    QUIC_LISTENER* Listener;
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, Binding.Register(nullptr, {"h3", "h3-29"}, &Listener));
+
+    std::string Alpn;
+    ASSERT_EQ(Listener, Binding.Get("192.0.2.1", {"h3-29", "h3"}, &Alpn));
+    ASSERT_EQ("h3", Alpn);
+}
+
+TEST(BindingTest, SpecificAddressBeforeWildCard)
+{
+    MockBinding Binding;
+    QUIC_LISTENER *WildCard, *Specific, *V6;
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, Binding.Register(nullptr, {"a", "b"}, &WildCard));
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, Binding.Register("192.0.2.1", {"a"}, &Specific));
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, Binding.Register("::", {"b"}, &V6));
+
+    ASSERT_EQ(Specific, Binding.Get("192.0.2.1", {"a"}));
+    ASSERT_EQ(WildCard, Binding.Get("192.0.2.2", {"a"}));
+    ASSERT_EQ(V6, Binding.Get("2001:db8::1", {"b"}));
+    ASSERT_EQ(WildCard, Binding.Get("192.0.2.1", {"b"}));
+
+    //
+    // The listener order wins over the client's ALPN order.
+    //
+    ASSERT_EQ(Specific, Binding.Get("192.0.2.1", {"b", "a"}));
+
+    Binding.Unregister(Specific);
+    ASSERT_EQ(WildCard, Binding.Get("192.0.2.1", {"a"}));
+}
+
+TEST(BindingTest, RejectsAlpnInUse)
+{
+    MockBinding Binding;
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, Binding.Register(nullptr, {"a", "b"}));
+    ASSERT_EQ(QUIC_STATUS_ALPN_IN_USE, Binding.Register(nullptr, {"c", "b"}));
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, Binding.Register(nullptr, {"c"}));
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, Binding.Register("192.0.2.1", {"a"}));
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, Binding.Register("192.0.2.2", {"a"}));
+    ASSERT_EQ(QUIC_STATUS_ALPN_IN_USE, Binding.Register("192.0.2.2", {"a"}));
+}
+
+static void
+RegisterManyListeners(
+    MockBinding& Binding,
+    uint32_t ListenerCount,
+    std::vector<std::string>& Alpns,
+    std::vector<QUIC_LISTENER*>& Listeners
+    )
+{
+    for (uint32_t i = 0; i < ListenerCount; ++i) {
+        char Alpn[32];
+        sprintf_s(Alpn, sizeof(Alpn), "proto-%u", i);
+        Alpns.push_back(Alpn);
+        QUIC_LISTENER* Listener;
+        ASSERT_EQ(QUIC_STATUS_SUCCESS, Binding.Register(nullptr, {Alpns.back().c_str()}, &Listener));
+        Listeners.push_back(Listener);
+    }
+}
+
+TEST(BindingTest, ManyListeners)
+{
+    const uint32_t ListenerCount = 500;
+
+    MockBinding Binding;
+    std::vector<std::string> Alpns;
+    std::vector<QUIC_LISTENER*> Listeners;
+    ASSERT_NO_FATAL_FAILURE(RegisterManyListeners(Binding, ListenerCount, Alpns, Listeners));
+
+    for (uint32_t i = 0; i < ListenerCount; ++i) {
+        ASSERT_EQ(Listeners[i], Binding.Get("192.0.2.1", {"h3", Alpns[i].c_str()}));
+    }
+}
+
+//
+// Timing only, so it's disabled by default to keep it out of CI. Run it with
+// --gtest_also_run_disabled_tests --gtest_filter=*ManyListenersBenchmark.
+//
+TEST(BindingTest, DISABLED_ManyListenersBenchmark)
+{
+    const uint32_t ListenerCount = 500;
+    const uint32_t Iterations = 200;
+
+    MockBinding Binding;
+    std::vector<std::string> Alpns;
+    std::vector<QUIC_LISTENER*> Listeners;
+    ASSERT_NO_FATAL_FAILURE(RegisterManyListeners(Binding, ListenerCount, Alpns, Listeners));
+
+    uint64_t Start = CxPlatTimeUs64();
+    for (uint32_t j = 0; j < Iterations; ++j) {
+        for (uint32_t i = 0; i < ListenerCount; ++i) {
+            ASSERT_EQ(Listeners[i], Binding.Get("192.0.2.1", {"h3", Alpns[i].c_str()}));
+        }
+    }
+    uint64_t Elapsed = CxPlatTimeDiff64(Start, CxPlatTimeUs64());
+
+    printf("%u listeners: %llu ns per lookup\n",
+        ListenerCount,
+        (unsigned long long)(Elapsed * 1000 / (Iterations * ListenerCount)));
+}
+
+//
+// Retry tokens for random CIDs, encrypted by the first partition as they would
+// be for Retry packets it sends.
+//
+struct RetryTokens {
+    QUIC_PARTITION Partition;
+    uint8_t Cids[QUIC_RETRY_TOKEN_BATCH_SIZE][QUIC_CID_MAX_LENGTH];
+    QUIC_TOKEN_CONTENTS Plaintext;
+    QUIC_TOKEN_CONTENTS Tokens[QUIC_RETRY_TOKEN_BATCH_SIZE];
+    QUIC_RX_PACKET RxPackets[QUIC_RETRY_TOKEN_BATCH_SIZE];
+    QUIC_RX_PACKET* Packets[QUIC_RETRY_TOKEN_BATCH_SIZE];
+    const uint8_t* TokenBuffers[QUIC_RETRY_TOKEN_BATCH_SIZE];
+    QUIC_TOKEN_CONTENTS Decrypted[QUIC_RETRY_TOKEN_BATCH_SIZE];
+    BOOLEAN DecryptResults[QUIC_RETRY_TOKEN_BATCH_SIZE];
+    RetryTokens() {
+        //
+        // The library partitions are only created on lazy initialization, so
+        // use a standalone one with the library's retry key config.
+        //
+        uint8_t ResetHashKey[20];
+        CxPlatRandom(sizeof(ResetHashKey), ResetHashKey);
+        CxPlatZeroMemory(&Partition, sizeof(Partition));
+        EXPECT_FALSE(QUIC_FAILED(
+            QuicPartitionInitialize(
+                &Partition, 0, 0, CXPLAT_HASH_SHA256, ResetHashKey, sizeof(ResetHashKey))));
+        if (MsQuicLib.StatelessRetry.KeyRotationMs == 0) {
+            uint8_t RetrySecret[CXPLAT_AEAD_AES_256_GCM_SIZE];
+            CxPlatRandom(sizeof(RetrySecret), RetrySecret);
+            QUIC_STATELESS_RETRY_CONFIG RetryConfig;
+            RetryConfig.SecretLength = sizeof(RetrySecret);
+            RetryConfig.Secret = RetrySecret;
+            RetryConfig.RotationMs = QUIC_STATELESS_RETRY_KEY_LIFETIME_MS;
+            RetryConfig.Algorithm = QUIC_AEAD_ALGORITHM_AES_256_GCM;
+            EXPECT_FALSE(QUIC_FAILED(QuicLibrarySetRetryKeyConfig(&RetryConfig)));
+        }
+
+        CxPlatZeroMemory(&Plaintext, sizeof(Plaintext));
+        Plaintext.Authenticated.Timestamp = (uint64_t)CxPlatTimeEpochMs64();
+        EXPECT_TRUE(QuicAddrFromString("192.0.2.1", 4433, &Plaintext.Encrypted.RemoteAddress));
+        Plaintext.Encrypted.OrigConnIdLength = 8;
+        CxPlatZeroMemory(RxPackets, sizeof(RxPackets));
+        for (uint32_t i = 0; i < QUIC_RETRY_TOKEN_BATCH_SIZE; ++i) {
+            CxPlatRandom(sizeof(Cids[i]), Cids[i]);
+            Tokens[i] = Plaintext;
+            EXPECT_TRUE(QuicRetryTokenEncrypt(&Partition, Cids[i], &Tokens[i]));
+            RxPackets[i].DestCid = Cids[i];
+            Packets[i] = &RxPackets[i];
+            TokenBuffers[i] = (const uint8_t*)&Tokens[i];
+        }
+    }
+    ~RetryTokens() {
+        QuicPartitionUninitialize(&Partition);
+    }
+    BOOLEAN Decrypt(uint32_t i, QUIC_TOKEN_CONTENTS* Token) {
+        CxPlatDispatchLockAcquire(&Partition.StatelessRetryKeysLock);
+        BOOLEAN Result =
+            QuicRetryTokenDecryptLocked(
+                &Partition, Packets[i]->DestCid, TokenBuffers[i], Token);
+        CxPlatDispatchLockRelease(&Partition.StatelessRetryKeysLock);
+        return Result;
+    }
+    void DecryptBatch() {
+        QuicRetryTokenDecryptBatch(
+            &Partition,
+            QUIC_RETRY_TOKEN_BATCH_SIZE,
+            Packets,
+            TokenBuffers,
+            Decrypted,
+            DecryptResults);
+    }
+};
+
+TEST(BindingTest, RetryTokenBatch)
+{
+    RetryTokens Retry;
+
+    //
+    // Corrupt one token, and deliver another one with the wrong CID.
+    //
+    Retry.Tokens[1].EncryptionTag[0] ^= 1;
+    Retry.RxPackets[2].DestCid = Retry.Cids[3];
+
+    Retry.DecryptBatch();
+
+    for (uint32_t i = 0; i < QUIC_RETRY_TOKEN_BATCH_SIZE; ++i) {
+        const bool Valid = i != 1 && i != 2;
+        ASSERT_EQ(Valid, !!Retry.DecryptResults[i]);
+
+        QUIC_TOKEN_CONTENTS Token;
+        ASSERT_EQ(Valid, !!Retry.Decrypt(i, &Token));
+        if (Valid) {
+            ASSERT_EQ(Retry.Plaintext.Encrypted.OrigConnIdLength, Retry.Decrypted[i].Encrypted.OrigConnIdLength);
+            ASSERT_TRUE(QuicAddrCompare(&Retry.Plaintext.Encrypted.RemoteAddress, &Retry.Decrypted[i].Encrypted.RemoteAddress));
+            ASSERT_EQ(0, memcmp(&Token.Encrypted, &Retry.Decrypted[i].Encrypted, sizeof(Token.Encrypted)));
+        }
+    }
+}
+
+//
+// Timing only, so it's disabled by default to keep it out of CI. Run it with
+// --gtest_also_run_disabled_tests --gtest_filter=*RetryTokenBenchmark.
+// Reports the retry tokens encrypted (one per Retry packet sent) and validated
+// per second on one core.
+//
+TEST(BindingTest, DISABLED_RetryTokenBenchmark)
+{
+    const uint32_t Iterations = 100000;
+    static_assert(Iterations % QUIC_RETRY_TOKEN_BATCH_SIZE == 0, "Whole batches");
+
+    RetryTokens Retry;
+
+    uint64_t Start = CxPlatTimeUs64();
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        QUIC_TOKEN_CONTENTS Token = Retry.Plaintext;
+        ASSERT_TRUE(QuicRetryTokenEncrypt(
+            &Retry.Partition, Retry.Cids[i % QUIC_RETRY_TOKEN_BATCH_SIZE], &Token));
+    }
+    const uint64_t EncryptUs = CxPlatTimeDiff64(Start, CxPlatTimeUs64());
+
+    Start = CxPlatTimeUs64();
+    for (uint32_t i = 0; i < Iterations; ++i) {
+        const uint32_t j = i % QUIC_RETRY_TOKEN_BATCH_SIZE;
+        QUIC_TOKEN_CONTENTS Token;
+        ASSERT_TRUE(Retry.Decrypt(j, &Token));
+    }
+    const uint64_t DecryptUs = CxPlatTimeDiff64(Start, CxPlatTimeUs64());
+
+    Start = CxPlatTimeUs64();
+    for (uint32_t i = 0; i < Iterations; i += QUIC_RETRY_TOKEN_BATCH_SIZE) {
+        Retry.DecryptBatch();
+        ASSERT_TRUE(Retry.DecryptResults[0]);
+    }
+    const uint64_t DecryptBatchUs = CxPlatTimeDiff64(Start, CxPlatTimeUs64());
+
+    printf("Retry tokens per second: %llu encrypted, %llu validated, %llu validated in batches of %u\n",
+        (unsigned long long)(Iterations * 1000000ull / EncryptUs),
+        (unsigned long long)(Iterations * 1000000ull / DecryptUs),
+        (unsigned long long)(Iterations * 1000000ull / DecryptBatchUs),
+        QUIC_RETRY_TOKEN_BATCH_SIZE);
+}
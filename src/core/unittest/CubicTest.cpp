@@ -14,31 +14,7 @@ Abstract:
 #include "CubicTest.cpp.clog.h"
 #endif
 
-//
-// Helper to create a minimal valid connection for testing CUBIC initialization.
-// Uses a real QUIC_CONNECTION structure to ensure proper memory layout when
-// QuicCongestionControlGetConnection() does CXPLAT_CONTAINING_RECORD pointer arithmetic.
-//
-static void InitializeMockConnection(
-    QUIC_CONNECTION& Connection,
-    uint16_t Mtu)
-{
-    // Zero-initialize the entire connection structure
-    CxPlatZeroMemory(&Connection, sizeof(Connection));
-
-    // Initialize only the fields needed by CUBIC functions
-    Connection.Paths[0].Mtu = Mtu;
-    Connection.Paths[0].IsActive = TRUE;
-    Connection.Send.NextPacketNumber = 0;
-
-    // Initialize Settings with defaults
-    Connection.Settings.PacingEnabled = FALSE;  // Disable pacing by default for simpler tests
-    Connection.Settings.HyStartEnabled = FALSE; // Disable HyStart by default
-
-    // Initialize Path fields needed for some functions
-    Connection.Paths[0].GotFirstRttSample = FALSE;
-    Connection.Paths[0].SmoothedRtt = 0;
-}
+#include "MockConnection.h"
 
 //
 // Test 1: Comprehensive initialization verification
@@ -769,3 +745,123 @@ TEST(CubicTest, HyStart_StateTransitions)
                 Cubic->HyStartState <= HYSTART_DONE);
     ASSERT_GE(Cubic->CWndSlowStartGrowthDivisor, 1u);
 }
+
+//
+// Test 18: HyStart++ Non-Paced Growth Limit
+// Scenario: Without pacing, slow start growth per ACK is limited to
+// QUIC_HYSTART_DEFAULT_NON_PACED_GROWTH_LIMIT packets (L from RFC 9406), so a
+// large ACK doesn't release a large burst. With pacing it is not limited.
+//
+TEST(CubicTest, HyStart_NonPacedGrowthLimit)
+{
+    QUIC_CONNECTION Connection;
+    QUIC_SETTINGS_INTERNAL Settings{};
+    Settings.InitialWindowPackets = 10;
+    Settings.SendIdleTimeoutMs = 1000;
+
+    for (BOOLEAN Pacing : { FALSE, TRUE }) {
+        InitializeMockConnection(Connection, 1280);
+        Connection.Settings.HyStartEnabled = TRUE;
+        Connection.Settings.PacingEnabled = Pacing;
+        Connection.Paths[0].GotFirstRttSample = TRUE;
+        Connection.Paths[0].SmoothedRtt = 50000;
+        Connection.Paths[0].MinRtt = 50000;
+
+        CubicCongestionControlInitialize(&Connection.CongestionControl, &Settings);
+        QUIC_CONGESTION_CONTROL_CUBIC* Cubic = &Connection.CongestionControl.Cubic;
+        const uint16_t PacketLength = QuicPathGetDatagramPayloadSize(&Connection.Paths[0]);
+        const uint32_t InitialWindow = Cubic->CongestionWindow;
+        Cubic->BytesInFlight = 20 * PacketLength;
+        Cubic->BytesInFlightMax = 20 * PacketLength;
+
+        QUIC_ACK_EVENT AckEvent;
+        CxPlatZeroMemory(&AckEvent, sizeof(AckEvent));
+        AckEvent.TimeNow = 1000000;
+        AckEvent.LargestAck = 20;
+        AckEvent.LargestSentPacketNumber = 20;
+        AckEvent.NumRetransmittableBytes = 20 * PacketLength;
+        AckEvent.NumTotalAckedRetransmittableBytes = 20 * PacketLength;
+        AckEvent.SmoothedRtt = 50000;
+        AckEvent.MinRtt = 50000;
+        AckEvent.MinRttValid = TRUE;
+        Connection.CongestionControl.QuicCongestionControlOnDataAcknowledged(
+            &Connection.CongestionControl,
+            &AckEvent);
+
+        if (Pacing) {
+            ASSERT_EQ(Cubic->CongestionWindow, InitialWindow + 20u * PacketLength);
+        } else {
+            ASSERT_EQ(
+                Cubic->CongestionWindow,
+                InitialWindow + QUIC_HYSTART_DEFAULT_NON_PACED_GROWTH_LIMIT * PacketLength);
+        }
+    }
+}
+
+//
+// Test 19: SEARCH Slow Start Exit
+// Scenario: While the bytes delivered per RTT keep doubling, slow start
+// continues. Once delivery stays flat (the bottleneck is full) SEARCH exits
+// slow start, even without any RTT increase, and shrinks the window to what
+// was delivered over the last RTT.
+//
+TEST(CubicTest, HyStart_SearchExit)
+{
+    QUIC_CONNECTION Connection;
+    QUIC_SETTINGS_INTERNAL Settings{};
+    Settings.InitialWindowPackets = 10;
+    Settings.SendIdleTimeoutMs = 1000;
+
+    InitializeMockConnection(Connection, 1280);
+    Connection.Settings.HyStartEnabled = TRUE;
+    Connection.Settings.PacingEnabled = TRUE;
+    Connection.Paths[0].GotFirstRttSample = TRUE;
+    Connection.Paths[0].SmoothedRtt = 50000;
+    Connection.Paths[0].MinRtt = 50000;
+
+    CubicCongestionControlInitialize(&Connection.CongestionControl, &Settings);
+    QUIC_CONGESTION_CONTROL_CUBIC* Cubic = &Connection.CongestionControl.Cubic;
+    Cubic->BytesInFlight = 100000000;
+    Cubic->BytesInFlightMax = 100000000;
+
+    QUIC_ACK_EVENT AckEvent;
+    CxPlatZeroMemory(&AckEvent, sizeof(AckEvent));
+    AckEvent.SmoothedRtt = 50000;
+    AckEvent.MinRtt = 50000;
+    AckEvent.MinRttValid = TRUE;
+
+    //
+    // Slow start: one ACK per millisecond, doubling every 50 ms RTT.
+    //
+    uint64_t TimeNow = 1000000;
+    uint32_t BytesPerAck = 1000;
+    for (uint32_t i = 0; i < 300; ++i, TimeNow += 1000) {
+        if (i % 50 == 0 && i != 0) {
+            BytesPerAck *= 2;
+        }
+        AckEvent.TimeNow = TimeNow;
+        AckEvent.NumRetransmittableBytes = BytesPerAck;
+        AckEvent.NumTotalAckedRetransmittableBytes += BytesPerAck;
+        Connection.CongestionControl.QuicCongestionControlOnDataAcknowledged(
+            &Connection.CongestionControl,
+            &AckEvent);
+    }
+    ASSERT_NE(Cubic->HyStartState, HYSTART_DONE);
+    ASSERT_EQ(Cubic->SlowStartThreshold, UINT32_MAX);
+
+    //
+    // The bottleneck is full: delivery stays flat.
+    //
+    for (uint32_t i = 0; i < 300 && Cubic->HyStartState != HYSTART_DONE; ++i, TimeNow += 1000) {
+        AckEvent.TimeNow = TimeNow;
+        AckEvent.NumRetransmittableBytes = BytesPerAck;
+        AckEvent.NumTotalAckedRetransmittableBytes += BytesPerAck;
+        Connection.CongestionControl.QuicCongestionControlOnDataAcknowledged(
+            &Connection.CongestionControl,
+            &AckEvent);
+    }
+    ASSERT_EQ(Cubic->HyStartState, HYSTART_DONE);
+    ASSERT_EQ(Cubic->SlowStartThreshold, Cubic->CongestionWindow);
+    ASSERT_GE(Cubic->CongestionWindow, BytesPerAck * 50u);
+    ASSERT_LE(Cubic->CongestionWindow, BytesPerAck * 56u);
+}
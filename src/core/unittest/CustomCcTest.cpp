@@ -0,0 +1,360 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Unit tests for application supplied (custom) congestion control.
+
+--*/
+
+#include "main.h"
+#ifdef QUIC_CLOG
+#include "CustomCcTest.cpp.clog.h"
+#endif
+
+#include "MockConnection.h"
+
+//
+// A minimal Reno-like algorithm implemented against the public provider
+// interface.
+//
+struct TestCcProviderContext;
+
+struct TestCc {
+    TestCcProviderContext* Context;
+    uint32_t Window;
+    uint32_t AckCount;
+    uint32_t LossCount;
+    uint32_t EcnCount;
+    uint32_t SentBytes;
+    uint64_t LastSmoothedRtt;
+    uint32_t LastBytesInFlight;
+};
+
+struct TestCcProviderContext {
+    QUIC_STATUS CreateStatus;
+    uint32_t CreateCount;
+    uint32_t DeleteCount;
+    TestCc* Last;
+};
+
+static
+QUIC_STATUS
+QUIC_API
+TestCcCreate(
+    _In_opt_ void* ProviderContext,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* State,
+    _Outptr_ void** Instance
+    )
+{
+    TestCcProviderContext* Context = (TestCcProviderContext*)ProviderContext;
+    Context->CreateCount++;
+    if (QUIC_FAILED(Context->CreateStatus)) {
+        return Context->CreateStatus;
+    }
+    TestCc* Cc = new(std::nothrow) TestCc();
+    if (Cc == nullptr) {
+        return QUIC_STATUS_OUT_OF_MEMORY;
+    }
+    Cc->Context = Context;
+    Cc->Window = 10 * State->DatagramPayloadLength;
+    Context->Last = Cc;
+    *Instance = Cc;
+    return QUIC_STATUS_SUCCESS;
+}
+
+static
+void
+QUIC_API
+TestCcDelete(
+    _In_ void* Instance
+    )
+{
+    TestCc* Cc = (TestCc*)Instance;
+    Cc->Context->DeleteCount++;
+    delete Cc;
+}
+
+static
+uint32_t
+QUIC_API
+TestCcGetWindow(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* /* State */
+    )
+{
+    return ((TestCc*)Instance)->Window;
+}
+
+static
+void
+QUIC_API
+TestCcOnDataSent(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* /* State */,
+    _In_ uint32_t SentBytes
+    )
+{
+    ((TestCc*)Instance)->SentBytes += SentBytes;
+}
+
+static
+void
+QUIC_API
+TestCcOnAck(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* State,
+    _In_ const QUIC_CONGESTION_CONTROL_ACK* Ack
+    )
+{
+    TestCc* Cc = (TestCc*)Instance;
+    Cc->AckCount++;
+    Cc->Window += Ack->AckedBytes;
+    Cc->LastSmoothedRtt = State->SmoothedRtt;
+    Cc->LastBytesInFlight = State->BytesInFlight;
+}
+
+static
+void
+QUIC_API
+TestCcOnLoss(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* /* State */,
+    _In_ const QUIC_CONGESTION_CONTROL_LOSS* /* Loss */
+    )
+{
+    TestCc* Cc = (TestCc*)Instance;
+    Cc->LossCount++;
+    Cc->Window /= 2;
+}
+
+static
+void
+QUIC_API
+TestCcOnEcn(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* /* State */,
+    _In_ const QUIC_CONGESTION_CONTROL_ECN* Ecn
+    )
+{
+    ((TestCc*)Instance)->EcnCount += Ecn->CePacketCount;
+}
+
+static QUIC_CONGESTION_CONTROL_PROVIDER GetTestProvider(TestCcProviderContext* Context)
+{
+    QUIC_CONGESTION_CONTROL_PROVIDER Provider;
+    CxPlatZeroMemory(&Provider, sizeof(Provider));
+    Provider.Name = "TestCc";
+    Provider.Context = Context;
+    Provider.Create = TestCcCreate;
+    Provider.Delete = TestCcDelete;
+    Provider.GetCongestionWindow = TestCcGetWindow;
+    Provider.OnDataAcknowledged = TestCcOnAck;
+    Provider.OnDataLost = TestCcOnLoss;
+    Provider.OnDataSent = TestCcOnDataSent;
+    Provider.OnEcn = TestCcOnEcn;
+    return Provider;
+}
+
+TEST(CustomCcTest, Initialize)
+{
+    QUIC_CONNECTION Connection;
+    InitializeMockConnection(Connection, 1280);
+    TestCcProviderContext Context{};
+    QUIC_CONGESTION_CONTROL_PROVIDER Provider = GetTestProvider(&Context);
+
+    QUIC_CONGESTION_CONTROL* Cc = &Connection.CongestionControl;
+    ASSERT_TRUE(CustomCongestionControlInitialize(Cc, &Provider));
+    ASSERT_EQ(Context.CreateCount, 1u);
+    ASSERT_STREQ(Cc->Name, "TestCc");
+    ASSERT_FALSE(Cc->UseEct1);
+
+    const uint16_t PacketLength = QuicPathGetDatagramPayloadSize(&Connection.Paths[0]);
+    ASSERT_EQ(QuicCongestionControlGetCongestionWindow(Cc), 10u * PacketLength);
+    ASSERT_TRUE(QuicCongestionControlCanSend(Cc));
+
+    QuicCongestionControlUninitialize(Cc);
+}
+
+TEST(CustomCcTest, CreateFailure)
+{
+    QUIC_CONNECTION Connection;
+    InitializeMockConnection(Connection, 1280);
+    TestCcProviderContext Context{};
+    Context.CreateStatus = QUIC_STATUS_OUT_OF_MEMORY;
+    QUIC_CONGESTION_CONTROL_PROVIDER Provider = GetTestProvider(&Context);
+
+    ASSERT_FALSE(CustomCongestionControlInitialize(&Connection.CongestionControl, &Provider));
+    ASSERT_EQ(Context.CreateCount, 1u);
+
+    //
+    // No provider registered.
+    //
+    QUIC_CONGESTION_CONTROL_PROVIDER Empty;
+    CxPlatZeroMemory(&Empty, sizeof(Empty));
+    ASSERT_FALSE(CustomCongestionControlInitialize(&Connection.CongestionControl, &Empty));
+}
+
+TEST(CustomCcTest, EventsAreForwarded)
+{
+    QUIC_CONNECTION Connection;
+    InitializeMockConnection(Connection, 1280);
+    Connection.Paths[0].GotFirstRttSample = TRUE;
+    Connection.Paths[0].SmoothedRtt = 25000;
+    TestCcProviderContext Context{};
+    QUIC_CONGESTION_CONTROL_PROVIDER Provider = GetTestProvider(&Context);
+
+    QUIC_CONGESTION_CONTROL* Cc = &Connection.CongestionControl;
+    ASSERT_TRUE(CustomCongestionControlInitialize(Cc, &Provider));
+    TestCc* App = Context.Last;
+    const uint32_t Window = App->Window;
+
+    //
+    // MsQuic tracks bytes in flight and blocks once the window is full.
+    //
+    QuicCongestionControlOnDataSent(Cc, Window);
+    ASSERT_EQ(App->SentBytes, Window);
+    ASSERT_FALSE(QuicCongestionControlCanSend(Cc));
+    ASSERT_EQ(QuicCongestionControlGetSendAllowance(Cc, 0, FALSE), 0u);
+
+    QUIC_ACK_EVENT AckEvent;
+    CxPlatZeroMemory(&AckEvent, sizeof(AckEvent));
+    AckEvent.LargestAck = 5;
+    AckEvent.LargestSentPacketNumber = 10;
+    AckEvent.NumRetransmittableBytes = 2400;
+    ASSERT_TRUE(QuicCongestionControlOnDataAcknowledged(Cc, &AckEvent));
+    ASSERT_EQ(App->AckCount, 1u);
+    ASSERT_EQ(App->LastSmoothedRtt, 25000u);
+    ASSERT_EQ(App->LastBytesInFlight, Window - 2400);
+    ASSERT_EQ(QuicCongestionControlGetCongestionWindow(Cc), Window + 2400);
+    ASSERT_EQ(QuicCongestionControlGetSendAllowance(Cc, 0, FALSE), 2u * 2400);
+
+    QUIC_LOSS_EVENT LossEvent;
+    CxPlatZeroMemory(&LossEvent, sizeof(LossEvent));
+    LossEvent.LargestPacketNumberLost = 6;
+    LossEvent.LargestSentPacketNumber = 10;
+    LossEvent.NumRetransmittableBytes = 1200;
+    QuicCongestionControlOnDataLost(Cc, &LossEvent);
+    ASSERT_EQ(App->LossCount, 1u);
+    ASSERT_EQ(QuicCongestionControlGetCongestionWindow(Cc), (Window + 2400) / 2);
+
+    QUIC_ECN_EVENT EcnEvent;
+    CxPlatZeroMemory(&EcnEvent, sizeof(EcnEvent));
+    EcnEvent.CePacketCount = 3;
+    QuicCongestionControlOnEcn(Cc, &EcnEvent);
+    ASSERT_EQ(App->EcnCount, 3u);
+
+    //
+    // Optional callbacks that aren't provided are no-ops.
+    //
+    ASSERT_FALSE(QuicCongestionControlOnSpuriousCongestionEvent(Cc));
+
+    QuicCongestionControlUninitialize(Cc);
+}
+
+//
+// The window the algorithm reports never drops below the minimum window.
+//
+TEST(CustomCcTest, MinimumWindow)
+{
+    QUIC_CONNECTION Connection;
+    InitializeMockConnection(Connection, 1280);
+    TestCcProviderContext Context{};
+    QUIC_CONGESTION_CONTROL_PROVIDER Provider = GetTestProvider(&Context);
+
+    QUIC_CONGESTION_CONTROL* Cc = &Connection.CongestionControl;
+    ASSERT_TRUE(CustomCongestionControlInitialize(Cc, &Provider));
+
+    QuicCongestionControlOnDataSent(Cc, 1200);
+    QUIC_LOSS_EVENT LossEvent;
+    CxPlatZeroMemory(&LossEvent, sizeof(LossEvent));
+    LossEvent.NumRetransmittableBytes = 1200;
+    for (uint32_t i = 0; i < 10; ++i) {
+        QuicCongestionControlOnDataLost(Cc, &LossEvent);
+        LossEvent.NumRetransmittableBytes = 0;
+    }
+
+    const uint16_t PacketLength = QuicPathGetDatagramPayloadSize(&Connection.Paths[0]);
+    ASSERT_EQ(
+        QuicCongestionControlGetCongestionWindow(Cc),
+        (uint32_t)PacketLength * QUIC_PERSISTENT_CONGESTION_WINDOW_PACKETS);
+
+    QuicCongestionControlUninitialize(Cc);
+}
+
+TEST(CustomCcTest, UninitializeDeletesInstance)
+{
+    QUIC_CONNECTION Connection;
+    InitializeMockConnection(Connection, 1280);
+    TestCcProviderContext Context{};
+    QUIC_CONGESTION_CONTROL_PROVIDER Provider = GetTestProvider(&Context);
+
+    QUIC_CONGESTION_CONTROL* Cc = &Connection.CongestionControl;
+    ASSERT_TRUE(CustomCongestionControlInitialize(Cc, &Provider));
+    ASSERT_NE(Cc->Custom.Instance, nullptr);
+
+    QuicCongestionControlUninitialize(Cc);
+    ASSERT_EQ(Context.DeleteCount, 1u);
+    ASSERT_EQ(Cc->Custom.Instance, nullptr);
+    ASSERT_EQ(Cc->QuicCongestionControlUninitialize, nullptr);
+
+    //
+    // Switching to a built-in algorithm releases the custom state too.
+    //
+    ASSERT_TRUE(CustomCongestionControlInitialize(Cc, &Provider));
+    QUIC_SETTINGS_INTERNAL Settings{};
+    Settings.InitialWindowPackets = 10;
+    Settings.CongestionControlAlgorithm = QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC;
+    QuicCongestionControlInitialize(Cc, &Settings);
+    ASSERT_STREQ(Cc->Name, "Cubic");
+    ASSERT_EQ(Context.CreateCount, 2u);
+    ASSERT_EQ(Context.DeleteCount, 2u);
+}
+
+//
+// The built-in algorithms and the registered provider are all selected
+// through the same provider table.
+//
+TEST(CustomCcTest, SelectsProvider)
+{
+    QUIC_CONNECTION Connection;
+    InitializeMockConnection(Connection, 1280);
+    QUIC_CONGESTION_CONTROL* Cc = &Connection.CongestionControl;
+    QUIC_SETTINGS_INTERNAL Settings{};
+    Settings.InitialWindowPackets = 10;
+    Settings.SendIdleTimeoutMs = 1000;
+
+    const struct {
+        QUIC_CONGESTION_CONTROL_ALGORITHM Algorithm;
+        const char* Name;
+    } BuiltIns[] = {
+        { QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC, "Cubic" },
+        { QUIC_CONGESTION_CONTROL_ALGORITHM_BBR, "BBR" },
+        { QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3, "BBRv3" },
+        { QUIC_CONGESTION_CONTROL_ALGORITHM_PRAGUE, "Prague" },
+    };
+    for (const auto& BuiltIn : BuiltIns) {
+        Settings.CongestionControlAlgorithm = (uint16_t)BuiltIn.Algorithm;
+        QuicCongestionControlInitialize(Cc, &Settings);
+        ASSERT_STREQ(Cc->Name, BuiltIn.Name);
+    }
+
+    //
+    // Without a registered provider, the custom algorithm falls back to Cubic.
+    //
+    Settings.CongestionControlAlgorithm = QUIC_CONGESTION_CONTROL_ALGORITHM_CUSTOM;
+    QuicCongestionControlInitialize(Cc, &Settings);
+    ASSERT_STREQ(Cc->Name, "Cubic");
+
+    TestCcProviderContext Context{};
+    MsQuicLib.CongestionControlProvider = GetTestProvider(&Context);
+    QuicCongestionControlInitialize(Cc, &Settings);
+    CxPlatZeroMemory(&MsQuicLib.CongestionControlProvider, sizeof(MsQuicLib.CongestionControlProvider));
+    ASSERT_STREQ(Cc->Name, "TestCc");
+    ASSERT_EQ(Context.CreateCount, 1u);
+
+    QuicCongestionControlUninitialize(Cc);
+    ASSERT_EQ(Context.DeleteCount, 1u);
+}
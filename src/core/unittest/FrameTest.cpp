@@ -1305,3 +1305,56 @@ TEST_P(ConnectionCloseFrameDecodeTest, DecodeConnectionCloseFrameFail) {
 }
 
 INSTANTIATE_TEST_SUITE_P(FrameTest, ConnectionCloseFrameDecodeTest, ::testing::ValuesIn(ConnectionCloseFrameParams::GenerateDecodeFailParams()));
+
+TEST(FrameTest, DatagramFecSourceFrameEncodeDecode)
+{
+    uint8_t Payload[] = "datagram";
+    QUIC_BUFFER Buffers[2] = {
+        { 4, Payload },
+        { sizeof(Payload) - 4, Payload + 4 }
+    };
+    QUIC_DATAGRAM_FEC_SOURCE_EX DecodedFrame = {0};
+    uint8_t Buffer[32];
+    uint16_t BufferLength = (uint16_t)sizeof(Buffer);
+    uint16_t Offset = 0;
+
+    ASSERT_TRUE(QuicDatagramFecSourceFrameEncodeEx(1000, 7, Buffers, 2, sizeof(Payload), &Offset, BufferLength, Buffer));
+    BufferLength = Offset;
+    ASSERT_EQ(4u, QuicVarIntSize(QUIC_FRAME_DATAGRAM_FEC_SOURCE));
+    Offset = QuicVarIntSize(QUIC_FRAME_DATAGRAM_FEC_SOURCE);
+    ASSERT_TRUE(QuicDatagramFecSourceFrameDecode(BufferLength, Buffer, &Offset, &DecodedFrame));
+
+    ASSERT_EQ(Offset, BufferLength);
+    ASSERT_EQ(1000u, DecodedFrame.Group);
+    ASSERT_EQ(7u, DecodedFrame.Index);
+    ASSERT_EQ(sizeof(Payload), DecodedFrame.Length);
+    ASSERT_EQ(0, memcmp(Payload, DecodedFrame.Data, sizeof(Payload)));
+
+    Offset = QuicVarIntSize(QUIC_FRAME_DATAGRAM_FEC_SOURCE);
+    ASSERT_FALSE(QuicDatagramFecSourceFrameDecode(BufferLength - 1, Buffer, &Offset, &DecodedFrame));
+}
+
+TEST(FrameTest, DatagramFecRepairFrameEncodeDecode)
+{
+    uint8_t Payload[5] = { 1, 2, 3, 4, 5 };
+    QUIC_DATAGRAM_FEC_REPAIR_EX Frame = { 16383, 8, 0x1234, sizeof(Payload), Payload };
+    QUIC_DATAGRAM_FEC_REPAIR_EX DecodedFrame = {0};
+    uint8_t Buffer[32];
+    uint16_t BufferLength = (uint16_t)sizeof(Buffer);
+    uint16_t Offset = 0;
+
+    ASSERT_TRUE(QuicDatagramFecRepairFrameEncode(&Frame, &Offset, BufferLength, Buffer));
+    BufferLength = Offset;
+    Offset = QuicVarIntSize(QUIC_FRAME_DATAGRAM_FEC_REPAIR);
+    ASSERT_TRUE(QuicDatagramFecRepairFrameDecode(BufferLength, Buffer, &Offset, &DecodedFrame));
+
+    ASSERT_EQ(Offset, BufferLength);
+    ASSERT_EQ(Frame.Group, DecodedFrame.Group);
+    ASSERT_EQ(Frame.Count, DecodedFrame.Count);
+    ASSERT_EQ(Frame.LengthXor, DecodedFrame.LengthXor);
+    ASSERT_EQ(Frame.Length, DecodedFrame.Length);
+    ASSERT_EQ(0, memcmp(Payload, DecodedFrame.Data, sizeof(Payload)));
+
+    Offset = QuicVarIntSize(QUIC_FRAME_DATAGRAM_FEC_REPAIR);
+    ASSERT_FALSE(QuicDatagramFecRepairFrameDecode(BufferLength - 1, Buffer, &Offset, &DecodedFrame));
+}
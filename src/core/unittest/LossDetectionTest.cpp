@@ -0,0 +1,150 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Unit tests for the loss detection reordering thresholds.
+
+--*/
+
+#include "main.h"
+#ifdef QUIC_CLOG
+#include "LossDetectionTest.cpp.clog.h"
+#endif
+
+#include "MockConnection.h"
+
+static void InitializeMockLossDetection(
+    QUIC_CONNECTION& Connection)
+{
+    InitializeMockConnection(Connection, 1280);
+
+    QUIC_LOSS_DETECTION* LossDetection = &Connection.LossDetection;
+    LossDetection->TimeReorderEighths = QUIC_TIME_REORDER_EIGHTHS;
+    LossDetection->PacketReorderThreshold = QUIC_PACKET_REORDER_THRESHOLD;
+}
+
+static void SpuriousLoss(
+    QUIC_CONNECTION& Connection,
+    uint64_t PacketNumber)
+{
+    QUIC_SENT_PACKET_METADATA Packet;
+    CxPlatZeroMemory(&Packet, sizeof(Packet));
+    Packet.PacketNumber = PacketNumber;
+    Packet.PacketLength = 1200;
+    QuicLossDetectionOnSpuriousLoss(&Connection.LossDetection, &Packet);
+}
+
+//
+// The packet threshold grows to the observed reordering distance, and the
+// time threshold by a quarter RTT.
+//
+TEST(LossDetectionTest, SpuriousLossGrowsThresholds)
+{
+    QUIC_CONNECTION Connection;
+    InitializeMockLossDetection(Connection);
+    QUIC_LOSS_DETECTION* LossDetection = &Connection.LossDetection;
+    LossDetection->LargestAck = 100;
+    LossDetection->LargestSentPacketNumber = 110;
+
+    SpuriousLoss(Connection, 90);
+
+    ASSERT_EQ(LossDetection->PacketReorderThreshold, 10u);
+    ASSERT_EQ(LossDetection->TimeReorderEighths, QUIC_TIME_REORDER_EIGHTHS + 2);
+    ASSERT_EQ(LossDetection->ReorderAdjustPacketNumber, 111u);
+    ASSERT_EQ(LossDetection->ReorderWindowPersist, QUIC_REORDER_WINDOW_PERSIST);
+    ASSERT_EQ(Connection.Stats.Send.SpuriousLostBytes, 1200u);
+
+    //
+    // A smaller reordering distance doesn't shrink the packet threshold.
+    //
+    SpuriousLoss(Connection, 95);
+    ASSERT_EQ(LossDetection->PacketReorderThreshold, 10u);
+    ASSERT_EQ(Connection.Stats.Send.SpuriousLostBytes, 2400u);
+}
+
+//
+// The time threshold grows at most once per round trip: only for packets
+// sent after it last grew.
+//
+TEST(LossDetectionTest, TimeThresholdGrowsOncePerRound)
+{
+    QUIC_CONNECTION Connection;
+    InitializeMockLossDetection(Connection);
+    QUIC_LOSS_DETECTION* LossDetection = &Connection.LossDetection;
+    LossDetection->LargestAck = 100;
+    LossDetection->LargestSentPacketNumber = 110;
+
+    SpuriousLoss(Connection, 90);
+    SpuriousLoss(Connection, 80);
+    ASSERT_EQ(LossDetection->PacketReorderThreshold, 20u);
+    ASSERT_EQ(LossDetection->TimeReorderEighths, QUIC_TIME_REORDER_EIGHTHS + 2);
+
+    LossDetection->LargestAck = 130;
+    LossDetection->LargestSentPacketNumber = 140;
+    SpuriousLoss(Connection, 111);
+    ASSERT_EQ(LossDetection->TimeReorderEighths, QUIC_TIME_REORDER_EIGHTHS + 4);
+    ASSERT_EQ(LossDetection->ReorderAdjustPacketNumber, 141u);
+}
+
+//
+// Both thresholds stop growing at their maximums.
+//
+TEST(LossDetectionTest, ThresholdsCapped)
+{
+    QUIC_CONNECTION Connection;
+    InitializeMockLossDetection(Connection);
+    QUIC_LOSS_DETECTION* LossDetection = &Connection.LossDetection;
+
+    for (uint32_t i = 0; i < 10; ++i) {
+        LossDetection->LargestAck = 1000 * (i + 1);
+        LossDetection->LargestSentPacketNumber = LossDetection->LargestAck + 10;
+        SpuriousLoss(Connection, LossDetection->ReorderAdjustPacketNumber);
+        ASSERT_LE(LossDetection->PacketReorderThreshold, (uint32_t)QUIC_MAX_PACKET_REORDER_THRESHOLD);
+        ASSERT_LE(LossDetection->TimeReorderEighths, QUIC_MAX_TIME_REORDER_EIGHTHS);
+    }
+
+    ASSERT_EQ(LossDetection->PacketReorderThreshold, (uint32_t)QUIC_MAX_PACKET_REORDER_THRESHOLD);
+    ASSERT_EQ(LossDetection->TimeReorderEighths, QUIC_MAX_TIME_REORDER_EIGHTHS);
+}
+
+//
+// After QUIC_REORDER_WINDOW_PERSIST loss events without a spurious loss, the
+// thresholds return to their initial values. Another spurious loss restarts
+// the count.
+//
+TEST(LossDetectionTest, ThresholdsReset)
+{
+    QUIC_CONNECTION Connection;
+    InitializeMockLossDetection(Connection);
+    QUIC_LOSS_DETECTION* LossDetection = &Connection.LossDetection;
+    LossDetection->LargestAck = 100;
+    LossDetection->LargestSentPacketNumber = 110;
+
+    //
+    // Nothing to reset before any spurious loss.
+    //
+    QuicLossDetectionDecayReorderThresholds(LossDetection);
+    ASSERT_EQ(LossDetection->ReorderWindowPersist, 0);
+    ASSERT_EQ(LossDetection->PacketReorderThreshold, (uint32_t)QUIC_PACKET_REORDER_THRESHOLD);
+
+    SpuriousLoss(Connection, 90);
+    for (uint32_t i = 0; i < QUIC_REORDER_WINDOW_PERSIST / 2; ++i) {
+        QuicLossDetectionDecayReorderThresholds(LossDetection);
+    }
+    SpuriousLoss(Connection, 90);
+    ASSERT_EQ(LossDetection->ReorderWindowPersist, QUIC_REORDER_WINDOW_PERSIST);
+
+    for (uint32_t i = 0; i < QUIC_REORDER_WINDOW_PERSIST - 1; ++i) {
+        QuicLossDetectionDecayReorderThresholds(LossDetection);
+        ASSERT_EQ(LossDetection->PacketReorderThreshold, 10u);
+        ASSERT_EQ(LossDetection->TimeReorderEighths, QUIC_TIME_REORDER_EIGHTHS + 2);
+    }
+
+    QuicLossDetectionDecayReorderThresholds(LossDetection);
+    ASSERT_EQ(LossDetection->ReorderWindowPersist, 0);
+    ASSERT_EQ(LossDetection->PacketReorderThreshold, (uint32_t)QUIC_PACKET_REORDER_THRESHOLD);
+    ASSERT_EQ(LossDetection->TimeReorderEighths, QUIC_TIME_REORDER_EIGHTHS);
+}
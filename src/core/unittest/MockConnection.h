@@ -0,0 +1,32 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Mock connection helper shared by the congestion control and loss detection
+    unit tests.
+
+--*/
+
+#pragma once
+
+//
+// Initializes a minimal valid connection for testing. Uses a real
+// QUIC_CONNECTION structure to ensure proper memory layout when
+// QuicCongestionControlGetConnection() and QuicLossDetectionGetConnection() do
+// CXPLAT_CONTAINING_RECORD pointer arithmetic. Everything not set here (such as
+// HyStart or the RTT samples) starts zeroed.
+//
+inline void InitializeMockConnection(
+    QUIC_CONNECTION& Connection,
+    uint16_t Mtu)
+{
+    CxPlatZeroMemory(&Connection, sizeof(Connection));
+    Connection.Paths = &Connection.InitialPath;
+
+    Connection.Paths[0].Mtu = Mtu;
+    Connection.Paths[0].IsActive = TRUE;
+    Connection.Settings.PacingEnabled = FALSE; // Disable pacing by default for simpler tests
+}
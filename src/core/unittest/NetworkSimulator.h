@@ -0,0 +1,415 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    A deterministic, in-process network simulator for congestion control
+    benchmarking. A single flow is driven through a bottleneck link on a
+    virtual clock, so a run takes a fraction of its simulated time and only
+    depends on its configuration (and the algorithms' own randomized probing).
+
+--*/
+
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <queue>
+#include <vector>
+
+#include "MockConnection.h"
+
+//
+// The link: a fixed rate bottleneck with a drop-tail queue, followed by a
+// fixed propagation delay (covering both directions) with optional jitter.
+// Packets may additionally be dropped at random, CE marked above a queue
+// threshold, or held back to arrive out of order.
+//
+struct SimLinkConfig {
+    uint64_t RateBytesPerSec;
+    uint64_t RttUs;                 // Base round trip time, without queuing
+    uint32_t QueueLimitBytes;
+    uint32_t EcnThresholdBytes;     // 0 to disable ECN marking
+    uint32_t RandomLossPerMillion;
+    uint64_t JitterUs;              // Uniform extra delay, in order delivery
+    uint32_t ReorderPerMillion;     // Packets held back by ReorderDelayUs
+    uint64_t ReorderDelayUs;
+    uint64_t DurationUs;
+};
+
+struct SimLinkResult {
+    uint64_t BytesSent;
+    uint64_t BytesAcked;            // Excludes late ACKs of packets declared lost
+    uint64_t BytesLost;             // Declared lost, including spurious losses
+    uint64_t BytesSpuriouslyLost;   // Declared lost but later acknowledged
+    uint64_t GoodputBytesPerSec;
+    double RetransmitRate;
+    uint64_t RttP50Us;
+    uint64_t RttP90Us;
+    uint64_t RttP99Us;
+};
+
+//
+// 40 Mbps with a 40 ms RTT: a BDP of 200 KB.
+//
+static const uint64_t kSimRate = 5 * 1000 * 1000;
+static const uint64_t kSimRttUs = 40 * 1000;
+static const uint32_t kSimBdp = (uint32_t)(kSimRate * kSimRttUs / 1000000);
+static const uint64_t kSimDurationUs = 8 * 1000 * 1000;
+
+class SimLink {
+
+    struct SimPacket {
+        QUIC_SENT_PACKET_METADATA* Metadata;
+        bool CeMarked;
+        bool Acked;
+        bool DeclaredLost;
+    };
+
+    struct SimDelivery {
+        uint64_t AckTime;
+        uint64_t PacketNumber;
+        bool operator>(const SimDelivery& Other) const {
+            return AckTime != Other.AckTime ?
+                AckTime > Other.AckTime : PacketNumber > Other.PacketNumber;
+        }
+    };
+
+    const uint64_t TickUs = 100;
+    const uint64_t StartTimeUs = 1000000;
+
+    SimLinkConfig Config;
+    QUIC_CONNECTION* Connection;
+    QUIC_CONGESTION_CONTROL* Cc;
+    uint16_t PacketLength;
+
+    std::deque<SimPacket> Outstanding; // Indexed by packet number - FirstPacketNumber
+    std::deque<uint64_t> Queue;        // Packets waiting at the bottleneck
+    std::priority_queue<SimDelivery, std::vector<SimDelivery>, std::greater<SimDelivery>>
+        Deliveries;                    // Packets whose ACK is on its way back
+    uint64_t FirstPacketNumber {0};
+    uint64_t NextPacketNumber {0};
+    uint64_t QueueBytes {0};
+    uint64_t LinkCredit {0}; // bytes * 1e6
+    uint64_t LastInOrderAckTime {0};
+    uint64_t LastSendTime {0};
+    bool LastSendTimeValid {false};
+    uint64_t LossTimeoutUs {0};
+    uint32_t RandomState {0x2545F491};
+
+    uint64_t TotalBytesSent {0};
+    uint64_t TotalBytesAcked {0};
+    uint64_t TotalBytesSentAtLastAck {0};
+    uint64_t TimeOfLastPacketAcked {0};
+    uint64_t TimeOfLastAckedPacketSent {0};
+    uint64_t BytesLost {0};
+    uint64_t BytesSpuriouslyLost {0};
+    std::vector<uint64_t> RttSamples;
+
+    SimPacket& Get(uint64_t PacketNumber) {
+        return Outstanding[(size_t)(PacketNumber - FirstPacketNumber)];
+    }
+
+    uint32_t NextRandom() {
+        RandomState = RandomState * 1103515245 + 12345;
+        return (RandomState >> 8) % 1000000;
+    }
+
+    void Send(uint64_t Now) {
+        QUIC_SENT_PACKET_METADATA* Metadata =
+            (QUIC_SENT_PACKET_METADATA*)CXPLAT_ALLOC_NONPAGED(
+                sizeof(QUIC_SENT_PACKET_METADATA), QUIC_POOL_TEST);
+        ASSERT_NE(Metadata, nullptr);
+        CxPlatZeroMemory(Metadata, sizeof(*Metadata));
+
+        Metadata->PacketNumber = NextPacketNumber++;
+        Metadata->PacketLength = PacketLength;
+        Metadata->SentTime = Now;
+        Metadata->Flags.IsAppLimited = QuicCongestionControlIsAppLimited(Cc);
+        TotalBytesSent += PacketLength;
+        Metadata->TotalBytesSent = TotalBytesSent;
+        if (TimeOfLastPacketAcked) {
+            Metadata->Flags.HasLastAckedPacketInfo = TRUE;
+            Metadata->LastAckedPacketInfo.SentTime = TimeOfLastAckedPacketSent;
+            Metadata->LastAckedPacketInfo.AckTime = TimeOfLastPacketAcked;
+            Metadata->LastAckedPacketInfo.AdjustedAckTime = TimeOfLastPacketAcked;
+            Metadata->LastAckedPacketInfo.TotalBytesSent = TotalBytesSentAtLastAck;
+            Metadata->LastAckedPacketInfo.TotalBytesAcked = TotalBytesAcked;
+        }
+        Connection->LossDetection.LargestSentPacketNumber = Metadata->PacketNumber;
+        Connection->Send.NextPacketNumber = NextPacketNumber;
+
+        QuicCongestionControlOnDataSent(Cc, PacketLength);
+
+        SimPacket Packet = { Metadata, false, false, false };
+        if (QueueBytes + PacketLength > Config.QueueLimitBytes ||
+            (Config.RandomLossPerMillion != 0 && NextRandom() < Config.RandomLossPerMillion)) {
+            //
+            // Dropped packets never get a delivery; loss detection finds them.
+            //
+        } else {
+            Packet.CeMarked =
+                Config.EcnThresholdBytes != 0 && QueueBytes >= Config.EcnThresholdBytes;
+            QueueBytes += PacketLength;
+            Queue.push_back(Metadata->PacketNumber);
+        }
+        Outstanding.push_back(Packet);
+    }
+
+    void ServeQueue(uint64_t Now) {
+        if (Queue.empty()) {
+            LinkCredit = 0;
+            return;
+        }
+        LinkCredit += Config.RateBytesPerSec * TickUs;
+        while (!Queue.empty() && LinkCredit >= (uint64_t)PacketLength * 1000000) {
+            LinkCredit -= (uint64_t)PacketLength * 1000000;
+            QueueBytes -= PacketLength;
+
+            uint64_t AckTime = Now + Config.RttUs;
+            if (Config.JitterUs != 0) {
+                AckTime += NextRandom() % (Config.JitterUs + 1);
+            }
+            if (Config.ReorderPerMillion != 0 && NextRandom() < Config.ReorderPerMillion) {
+                AckTime += Config.ReorderDelayUs;
+            } else {
+                //
+                // Jitter alone doesn't reorder packets.
+                //
+                AckTime = CXPLAT_MAX(AckTime, LastInOrderAckTime);
+                LastInOrderAckTime = AckTime;
+            }
+            Deliveries.push({ AckTime, Queue.front() });
+            Queue.pop_front();
+        }
+    }
+
+    //
+    // A packet is lost once three later packets were acknowledged, or once it
+    // has been outstanding for longer than the worst case delivery time.
+    //
+    void DetectLoss(uint64_t Now, uint64_t LargestAck, bool LargestAckValid) {
+        uint32_t LostBytes = 0;
+        uint64_t LargestLost = 0;
+        for (auto& Packet : Outstanding) {
+            if (Packet.Acked || Packet.DeclaredLost) {
+                continue;
+            }
+            if (!(LargestAckValid && Packet.Metadata->PacketNumber + 3 <= LargestAck) &&
+                Now - Packet.Metadata->SentTime < LossTimeoutUs) {
+                break;
+            }
+            LostBytes += Packet.Metadata->PacketLength;
+            LargestLost = Packet.Metadata->PacketNumber;
+            Packet.DeclaredLost = true;
+        }
+
+        if (LostBytes != 0) {
+            BytesLost += LostBytes;
+            QUIC_LOSS_EVENT LossEvent;
+            CxPlatZeroMemory(&LossEvent, sizeof(LossEvent));
+            LossEvent.LargestPacketNumberLost = LargestLost;
+            LossEvent.LargestSentPacketNumber = NextPacketNumber - 1;
+            LossEvent.NumRetransmittableBytes = LostBytes;
+            QuicCongestionControlOnDataLost(Cc, &LossEvent);
+        }
+    }
+
+    void ProcessAcks(uint64_t Now) {
+        std::vector<uint64_t> Acked;
+        while (!Deliveries.empty() && Deliveries.top().AckTime <= Now) {
+            const uint64_t PacketNumber = Deliveries.top().PacketNumber;
+            Deliveries.pop();
+            if (PacketNumber < FirstPacketNumber || Get(PacketNumber).DeclaredLost) {
+                //
+                // Already retransmitted; the data is delivered twice.
+                //
+                BytesSpuriouslyLost += PacketLength;
+                continue;
+            }
+            Acked.push_back(PacketNumber);
+        }
+
+        if (Acked.empty()) {
+            DetectLoss(Now, 0, false);
+            return;
+        }
+        std::sort(Acked.begin(), Acked.end());
+
+        QUIC_SENT_PACKET_METADATA* AckedPackets = NULL;
+        QUIC_SENT_PACKET_METADATA** Tail = &AckedPackets;
+        uint32_t AckedBytes = 0;
+        uint32_t CePackets = 0;
+        uint64_t MinRtt = UINT64_MAX;
+        uint64_t LargestAck = 0;
+        BOOLEAN LargestAppLimited = FALSE;
+
+        for (uint64_t PacketNumber : Acked) {
+            SimPacket& Packet = Get(PacketNumber);
+            QUIC_SENT_PACKET_METADATA* Metadata = Packet.Metadata;
+
+            *Tail = Metadata;
+            Tail = &Metadata->Next;
+            AckedBytes += Metadata->PacketLength;
+            CePackets += Packet.CeMarked ? 1 : 0;
+            MinRtt = CXPLAT_MIN(MinRtt, Now - Metadata->SentTime);
+            RttSamples.push_back(Now - Metadata->SentTime);
+            LargestAck = Metadata->PacketNumber;
+            LargestAppLimited = Metadata->Flags.IsAppLimited;
+
+            TotalBytesAcked += Metadata->PacketLength;
+            TotalBytesSentAtLastAck = Metadata->TotalBytesSent;
+            TimeOfLastPacketAcked = Now;
+            TimeOfLastAckedPacketSent = Metadata->SentTime;
+            Packet.Acked = true;
+        }
+
+        QUIC_PATH* Path = &Connection->Paths[0];
+        if (!Path->GotFirstRttSample) {
+            Path->GotFirstRttSample = TRUE;
+            Path->SmoothedRtt = MinRtt;
+            Path->MinRtt = MinRtt;
+        } else {
+            Path->SmoothedRtt = (7 * Path->SmoothedRtt + MinRtt) / 8;
+            Path->MinRtt = CXPLAT_MIN(Path->MinRtt, MinRtt);
+        }
+        Path->LatestRttSample = MinRtt;
+
+        if (CePackets != 0) {
+            QUIC_ECN_EVENT EcnEvent;
+            CxPlatZeroMemory(&EcnEvent, sizeof(EcnEvent));
+            EcnEvent.LargestPacketNumberAcked = LargestAck;
+            EcnEvent.LargestSentPacketNumber = NextPacketNumber - 1;
+            EcnEvent.CePacketCount = CePackets;
+            QuicCongestionControlOnEcn(Cc, &EcnEvent);
+        }
+
+        const uint64_t PrevBytesLost = BytesLost;
+        DetectLoss(Now, LargestAck, true);
+
+        QUIC_ACK_EVENT AckEvent;
+        CxPlatZeroMemory(&AckEvent, sizeof(AckEvent));
+        AckEvent.TimeNow = Now;
+        AckEvent.LargestAck = LargestAck;
+        AckEvent.LargestSentPacketNumber = NextPacketNumber - 1;
+        AckEvent.NumTotalAckedRetransmittableBytes = TotalBytesAcked;
+        AckEvent.NumRetransmittableBytes = AckedBytes;
+        AckEvent.AckedPackets = AckedPackets;
+        AckEvent.SmoothedRtt = Path->SmoothedRtt;
+        AckEvent.MinRtt = MinRtt;
+        AckEvent.MinRttValid = TRUE;
+        AckEvent.AdjustedAckTime = Now;
+        AckEvent.HasLoss = BytesLost != PrevBytesLost;
+        AckEvent.IsLargestAckedPacketAppLimited = LargestAppLimited;
+        QuicCongestionControlOnDataAcknowledged(Cc, &AckEvent);
+
+        while (!Outstanding.empty() &&
+               (Outstanding.front().Acked || Outstanding.front().DeclaredLost)) {
+            CXPLAT_FREE(Outstanding.front().Metadata, QUIC_POOL_TEST);
+            Outstanding.pop_front();
+            FirstPacketNumber++;
+        }
+    }
+
+    uint64_t RttPercentile(uint32_t Percent) {
+        if (RttSamples.empty()) {
+            return 0;
+        }
+        const size_t Index = (RttSamples.size() - 1) * Percent / 100;
+        std::nth_element(RttSamples.begin(), RttSamples.begin() + Index, RttSamples.end());
+        return RttSamples[Index];
+    }
+
+public:
+
+    SimLink(
+        const SimLinkConfig& LinkConfig,
+        QUIC_CONNECTION* Conn
+        ) : Config(LinkConfig), Connection(Conn), Cc(&Conn->CongestionControl) {
+        PacketLength = QuicPathGetDatagramPayloadSize(&Connection->Paths[0]);
+        LossTimeoutUs =
+            2 * (Config.RttUs + Config.QueueLimitBytes * 1000000ull / Config.RateBytesPerSec) +
+            Config.JitterUs + Config.ReorderDelayUs;
+    }
+
+    ~SimLink() {
+        for (auto& Packet : Outstanding) {
+            CXPLAT_FREE(Packet.Metadata, QUIC_POOL_TEST);
+        }
+    }
+
+    SimLinkResult Run() {
+        const uint64_t EndTime = StartTimeUs + Config.DurationUs;
+        for (uint64_t Now = StartTimeUs; Now < EndTime; Now += TickUs) {
+            ServeQueue(Now);
+            ProcessAcks(Now);
+
+            //
+            // Like the send path, flush once per pacing interval.
+            //
+            if ((LastSendTimeValid && Now - LastSendTime < QUIC_SEND_PACING_INTERVAL) ||
+                !QuicCongestionControlCanSend(Cc)) {
+                continue;
+            }
+            uint32_t Allowance =
+                QuicCongestionControlGetSendAllowance(
+                    Cc, Now - LastSendTime, LastSendTimeValid);
+            if (Allowance == 0) {
+                continue;
+            }
+            while (Allowance > 0 && QuicCongestionControlCanSend(Cc)) {
+                Send(Now);
+                Allowance = Allowance > PacketLength ? Allowance - PacketLength : 0;
+            }
+            LastSendTime = Now;
+            LastSendTimeValid = true;
+        }
+
+        SimLinkResult Result;
+        Result.BytesSent = TotalBytesSent;
+        Result.BytesAcked = TotalBytesAcked;
+        Result.BytesLost = BytesLost;
+        Result.BytesSpuriouslyLost = BytesSpuriouslyLost;
+        Result.GoodputBytesPerSec = TotalBytesAcked * 1000000 / Config.DurationUs;
+        Result.RetransmitRate = TotalBytesSent ? (double)BytesLost / TotalBytesSent : 0;
+        Result.RttP50Us = RttPercentile(50);
+        Result.RttP90Us = RttPercentile(90);
+        Result.RttP99Us = RttPercentile(99);
+        return Result;
+    }
+};
+
+inline SimLinkResult RunSimulatedLink(
+    const SimLinkConfig& Config,
+    QUIC_CONGESTION_CONTROL_ALGORITHM Algorithm,
+    BOOLEAN HyStartEnabled = FALSE)
+{
+    QUIC_CONNECTION* Connection =
+        (QUIC_CONNECTION*)CXPLAT_ALLOC_NONPAGED(sizeof(QUIC_CONNECTION), QUIC_POOL_TEST);
+    EXPECT_NE(Connection, nullptr);
+    if (Connection == nullptr) {
+        return SimLinkResult{};
+    }
+    InitializeMockConnection(*Connection, 1500);
+    Connection->Settings.PacingEnabled = TRUE;
+    Connection->Settings.HyStartEnabled = HyStartEnabled;
+    Connection->Settings.CongestionControlAlgorithm = (uint16_t)Algorithm;
+
+    QUIC_SETTINGS_INTERNAL Settings{};
+    Settings.InitialWindowPackets = 10;
+    Settings.SendIdleTimeoutMs = 1000;
+    Settings.CongestionControlAlgorithm = (uint16_t)Algorithm;
+    QuicCongestionControlInitialize(&Connection->CongestionControl, &Settings);
+
+    SimLinkResult Result;
+    {
+        SimLink Link(Config, Connection);
+        Result = Link.Run();
+    }
+
+    QuicCongestionControlUninitialize(&Connection->CongestionControl);
+    CXPLAT_FREE(Connection, QUIC_POOL_TEST);
+    return Result;
+}
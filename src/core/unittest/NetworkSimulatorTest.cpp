@@ -0,0 +1,178 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Congestion control scenarios run over the deterministic network simulator.
+
+--*/
+
+#include "main.h"
+#ifdef QUIC_CLOG
+#include "NetworkSimulatorTest.cpp.clog.h"
+#endif
+
+#include "NetworkSimulator.h"
+
+#include <string>
+
+struct SimScenario {
+    const char* Name;
+    SimLinkConfig Config;
+};
+
+static const SimScenario Scenarios[] = {
+    { "DeepBuffer",    { kSimRate, kSimRttUs, 4 * kSimBdp, 0, 0, 0, 0, 0, kSimDurationUs } },
+    { "ShallowBuffer", { kSimRate, kSimRttUs, kSimBdp / 4, 0, 0, 0, 0, 0, kSimDurationUs } },
+    { "RandomLoss",    { kSimRate, kSimRttUs, kSimBdp, 0, 10000, 0, 0, 0, kSimDurationUs } },
+    { "Ecn",           { kSimRate, kSimRttUs, 2 * kSimBdp, kSimBdp / 4, 0, 0, 0, 0, kSimDurationUs } },
+    { "Jitter",        { kSimRate, kSimRttUs, kSimBdp, 0, 0, 10000, 0, 0, kSimDurationUs } },
+    { "Reordering",    { kSimRate, kSimRttUs, kSimBdp, 0, 0, 0, 10000, 5000, kSimDurationUs } },
+};
+
+static const QUIC_CONGESTION_CONTROL_ALGORITHM Algorithms[] = {
+    QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC,
+    QUIC_CONGESTION_CONTROL_ALGORITHM_BBR,
+    QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3,
+    QUIC_CONGESTION_CONTROL_ALGORITHM_PRAGUE,
+};
+
+static const char* AlgorithmName(QUIC_CONGESTION_CONTROL_ALGORITHM Algorithm)
+{
+    switch (Algorithm) {
+    case QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC: return "cubic";
+    case QUIC_CONGESTION_CONTROL_ALGORITHM_BBR: return "bbr";
+    case QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3: return "bbr3";
+    case QUIC_CONGESTION_CONTROL_ALGORITHM_PRAGUE: return "prague";
+    default: return "unknown";
+    }
+}
+
+//
+// Runs every algorithm over every scenario. Only reordering declares packets
+// lost that later show up, and with ECN marking ahead of the queue limit
+// nothing is dropped at all. Every algorithm keeps the link at least 85% busy
+// except Prague where loss isn't preceded by marks: it treats each loss as a
+// classic congestion signal and doesn't regain its window between them.
+//
+TEST(NetworkSimulatorTest, Scenarios)
+{
+    for (const auto& Scenario : Scenarios) {
+        for (auto Algorithm : Algorithms) {
+            SCOPED_TRACE(std::string(Scenario.Name) + " " + AlgorithmName(Algorithm));
+            SimLinkResult Result = RunSimulatedLink(Scenario.Config, Algorithm);
+
+            ASSERT_GT(Result.BytesAcked, 0u);
+            ASSERT_LE(Result.BytesAcked + Result.BytesLost, Result.BytesSent);
+            ASSERT_LE(Result.GoodputBytesPerSec, Scenario.Config.RateBytesPerSec);
+            ASSERT_GE(Result.RttP50Us, Scenario.Config.RttUs);
+            ASSERT_LE(Result.RttP50Us, Result.RttP90Us);
+            ASSERT_LE(Result.RttP90Us, Result.RttP99Us);
+
+            if (Scenario.Config.ReorderPerMillion != 0) {
+                ASSERT_GT(Result.BytesSpuriouslyLost, 0u);
+            } else {
+                ASSERT_EQ(Result.BytesSpuriouslyLost, 0u);
+            }
+
+            if (Scenario.Config.EcnThresholdBytes != 0) {
+                ASSERT_EQ(Result.BytesLost, 0u);
+                ASSERT_EQ(Result.RetransmitRate, 0.0);
+            }
+
+            const BOOLEAN UnmarkedLoss =
+                Scenario.Config.RandomLossPerMillion != 0 ||
+                Scenario.Config.ReorderPerMillion != 0;
+            if (Algorithm != QUIC_CONGESTION_CONTROL_ALGORITHM_PRAGUE || !UnmarkedLoss) {
+                ASSERT_GE(Result.GoodputBytesPerSec, Scenario.Config.RateBytesPerSec * 85 / 100);
+            }
+        }
+    }
+}
+
+//
+// The path itself is deterministic, so an algorithm without randomized
+// probing produces identical results on every run.
+//
+TEST(NetworkSimulatorTest, Deterministic)
+{
+    SimLinkConfig Config = { kSimRate, kSimRttUs, kSimBdp, 0, 10000, 5000, 10000, 5000, kSimDurationUs / 4 };
+
+    SimLinkResult First = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC);
+    SimLinkResult Second = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC);
+
+    ASSERT_EQ(First.BytesSent, Second.BytesSent);
+    ASSERT_EQ(First.BytesAcked, Second.BytesAcked);
+    ASSERT_EQ(First.BytesLost, Second.BytesLost);
+    ASSERT_EQ(First.BytesSpuriouslyLost, Second.BytesSpuriouslyLost);
+    ASSERT_EQ(First.RttP50Us, Second.RttP50Us);
+    ASSERT_EQ(First.RttP99Us, Second.RttP99Us);
+}
+
+//
+// Jitter delays packets but keeps them in order, so it never causes spurious
+// losses.
+//
+TEST(NetworkSimulatorTest, JitterKeepsOrder)
+{
+    SimLinkConfig Config = { kSimRate, kSimRttUs, kSimBdp, 0, 0, 10000, 0, 0, kSimDurationUs / 4 };
+
+    SimLinkResult Result = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC);
+
+    ASSERT_EQ(Result.BytesSpuriouslyLost, 0u);
+    ASSERT_GT(Result.RttP99Us, Result.RttP50Us);
+}
+
+//
+// Packets held back by more than the packet reordering threshold are declared
+// lost and then acknowledged late.
+//
+TEST(NetworkSimulatorTest, ReorderingCausesSpuriousLoss)
+{
+    SimLinkConfig Config = { kSimRate, kSimRttUs, kSimBdp, 0, 0, 0, 10000, 5000, kSimDurationUs / 4 };
+
+    SimLinkResult Result = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC);
+
+    ASSERT_GT(Result.BytesSpuriouslyLost, 0u);
+    ASSERT_LE(Result.BytesSpuriouslyLost, Result.BytesLost);
+}
+
+//
+// With a shallow L4S marking threshold in front of a deep buffer, Prague
+// keeps the queue (and so the RTT) short without giving up goodput, while
+// CUBIC, which only reacts to loss there, fills the buffer.
+//
+TEST(NetworkSimulatorTest, PragueKeepsQueueShort)
+{
+    const uint32_t MarkingThreshold = kSimBdp / 4; // 10 ms of queue
+    SimLinkConfig L4sConfig = { kSimRate, kSimRttUs, 4 * kSimBdp, MarkingThreshold, 0, 0, 0, 0, kSimDurationUs };
+    SimLinkConfig ClassicConfig = { kSimRate, kSimRttUs, 4 * kSimBdp, 0, 0, 0, 0, 0, kSimDurationUs };
+
+    SimLinkResult Prague = RunSimulatedLink(L4sConfig, QUIC_CONGESTION_CONTROL_ALGORITHM_PRAGUE);
+    SimLinkResult Cubic = RunSimulatedLink(ClassicConfig, QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC);
+
+    ASSERT_GT(Prague.GoodputBytesPerSec, kSimRate * 90 / 100);
+    ASSERT_LT(Prague.RetransmitRate, 0.005);
+    ASSERT_LT(Prague.RttP90Us, kSimRttUs + 2 * MarkingThreshold * 1000000ull / kSimRate);
+    ASSERT_LT(Prague.RttP50Us, Cubic.RttP50Us);
+}
+
+//
+// Slow start with pacing fills a deep buffer before the delay increase shows
+// up in HyStart++'s RTT samples. SEARCH exits on the delivery rate instead,
+// before the queue overflows.
+//
+TEST(NetworkSimulatorTest, CubicSlowStartExit)
+{
+    SimLinkConfig Config = { kSimRate, kSimRttUs, 4 * kSimBdp, 0, 0, 0, 0, 0, kSimDurationUs / 2 };
+
+    SimLinkResult Classic = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC, FALSE);
+    SimLinkResult HyStart = RunSimulatedLink(Config, QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC, TRUE);
+
+    ASSERT_GT(Classic.BytesLost, 0u);
+    ASSERT_LT(HyStart.BytesLost, Classic.BytesLost / 10);
+    ASSERT_LT(HyStart.RttP50Us, Classic.RttP50Us);
+    ASSERT_GT(HyStart.GoodputBytesPerSec, Classic.GoodputBytesPerSec * 95 / 100);
+}
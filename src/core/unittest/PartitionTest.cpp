@@ -48,3 +48,45 @@ TEST(PartitionTest, RandomPartitionId)
 
     MsQuicLib.PartitionCount = OldPartitionCount;
 }
+
+TEST(PartitionTest, StatelessOperTokenBucket)
+{
+    QUIC_PARTITION Partition;
+    CxPlatZeroMemory(&Partition, sizeof(Partition));
+    CxPlatDispatchLockInitialize(&Partition.StatelessOperRateLock);
+    Partition.StatelessOperTokens = QUIC_STATELESS_OPERATION_BURST;
+    const uint32_t TimeMs = 0xFFFFFF00; // Exercise wrap around.
+    Partition.StatelessOperRefillTimeMs = TimeMs;
+
+    //
+    // The burst is available up front, then the bucket runs dry.
+    //
+    for (uint32_t i = 0; i < QUIC_STATELESS_OPERATION_BURST; ++i) {
+        ASSERT_TRUE(QuicPartitionTryConsumeStatelessOperToken(&Partition, TimeMs));
+    }
+    ASSERT_FALSE(QuicPartitionTryConsumeStatelessOperToken(&Partition, TimeMs));
+
+    //
+    // An older time doesn't refill the bucket.
+    //
+    ASSERT_FALSE(QuicPartitionTryConsumeStatelessOperToken(&Partition, TimeMs - 1000));
+
+    //
+    // One millisecond refills at the configured rate.
+    //
+    const uint32_t PerMs = QUIC_STATELESS_OPERATION_RATE / 1000;
+    for (uint32_t i = 0; i < PerMs; ++i) {
+        ASSERT_TRUE(QuicPartitionTryConsumeStatelessOperToken(&Partition, TimeMs + 1));
+    }
+    ASSERT_FALSE(QuicPartitionTryConsumeStatelessOperToken(&Partition, TimeMs + 1));
+
+    //
+    // A long idle period only refills up to the burst.
+    //
+    for (uint32_t i = 0; i < QUIC_STATELESS_OPERATION_BURST; ++i) {
+        ASSERT_TRUE(QuicPartitionTryConsumeStatelessOperToken(&Partition, TimeMs + 60000));
+    }
+    ASSERT_FALSE(QuicPartitionTryConsumeStatelessOperToken(&Partition, TimeMs + 60000));
+
+    CxPlatDispatchLockUninitialize(&Partition.StatelessOperRateLock);
+}
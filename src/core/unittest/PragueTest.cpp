@@ -0,0 +1,218 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Unit tests for the Prague (L4S) congestion control.
+
+--*/
+
+#include "main.h"
+#ifdef QUIC_CLOG
+#include "PragueTest.cpp.clog.h"
+#endif
+
+#include "MockConnection.h"
+
+static void InitializePrague(
+    QUIC_CONNECTION& Connection)
+{
+    QUIC_SETTINGS_INTERNAL Settings{};
+    Settings.InitialWindowPackets = 10;
+    Settings.SendIdleTimeoutMs = 1000;
+    Settings.CongestionControlAlgorithm = QUIC_CONGESTION_CONTROL_ALGORITHM_PRAGUE;
+
+    InitializeMockConnection(Connection, 1280);
+    QuicCongestionControlInitialize(&Connection.CongestionControl, &Settings);
+}
+
+static void AckBytes(
+    QUIC_CONGESTION_CONTROL* Cc,
+    uint32_t Bytes,
+    uint64_t LargestAck,
+    uint64_t LargestSent)
+{
+    QUIC_ACK_EVENT AckEvent;
+    CxPlatZeroMemory(&AckEvent, sizeof(AckEvent));
+    AckEvent.TimeNow = CxPlatTimeUs64();
+    AckEvent.LargestAck = LargestAck;
+    AckEvent.LargestSentPacketNumber = LargestSent;
+    AckEvent.NumRetransmittableBytes = Bytes;
+    AckEvent.SmoothedRtt = 10000;
+    QuicCongestionControlOnDataAcknowledged(Cc, &AckEvent);
+}
+
+static void CeMark(
+    QUIC_CONGESTION_CONTROL* Cc,
+    uint32_t CePackets,
+    uint64_t LargestAck,
+    uint64_t LargestSent)
+{
+    QUIC_ECN_EVENT EcnEvent;
+    CxPlatZeroMemory(&EcnEvent, sizeof(EcnEvent));
+    EcnEvent.LargestPacketNumberAcked = LargestAck;
+    EcnEvent.LargestSentPacketNumber = LargestSent;
+    EcnEvent.CePacketCount = CePackets;
+    QuicCongestionControlOnEcn(Cc, &EcnEvent);
+}
+
+TEST(PragueTest, Initialize)
+{
+    QUIC_CONNECTION Connection;
+    InitializePrague(Connection);
+
+    QUIC_CONGESTION_CONTROL* Cc = &Connection.CongestionControl;
+    const uint16_t PacketLength = QuicPathGetDatagramPayloadSize(&Connection.Paths[0]);
+
+    ASSERT_STREQ(Cc->Name, "Prague");
+    ASSERT_TRUE(Cc->UseEct1);
+    ASSERT_NE(Cc->QuicCongestionControlOnEcn, nullptr);
+    ASSERT_EQ(Cc->Prague.CongestionWindow, PacketLength * 10u);
+    ASSERT_EQ(Cc->Prague.SlowStartThreshold, UINT32_MAX);
+    ASSERT_EQ(Cc->Prague.Alpha, PRAGUE_ALPHA_MAX);
+    ASSERT_TRUE(QuicCongestionControlCanSend(Cc));
+}
+
+TEST(PragueTest, ClassicAlgorithmsUseEct0)
+{
+    QUIC_CONNECTION Connection;
+    QUIC_SETTINGS_INTERNAL Settings{};
+    Settings.InitialWindowPackets = 10;
+    InitializeMockConnection(Connection, 1280);
+
+    Settings.CongestionControlAlgorithm = QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC;
+    QuicCongestionControlInitialize(&Connection.CongestionControl, &Settings);
+    ASSERT_FALSE(Connection.CongestionControl.UseEct1);
+
+    Settings.CongestionControlAlgorithm = QUIC_CONGESTION_CONTROL_ALGORITHM_BBR;
+    QuicCongestionControlInitialize(&Connection.CongestionControl, &Settings);
+    ASSERT_FALSE(Connection.CongestionControl.UseEct1);
+}
+
+//
+// The window shrinks by alpha/2 on CE, at most once per round trip.
+//
+TEST(PragueTest, CeReductionIsProportionalToAlpha)
+{
+    QUIC_CONNECTION Connection;
+    InitializePrague(Connection);
+    QUIC_CONGESTION_CONTROL* Cc = &Connection.CongestionControl;
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    Prague->CongestionWindow = 100000;
+    Prague->Alpha = PRAGUE_ALPHA_MAX / 4;
+    QuicCongestionControlOnDataSent(Cc, 50000);
+
+    CeMark(Cc, 1, 10, 40);
+    ASSERT_EQ(Prague->CongestionWindow, 100000u - 100000u / 8);
+    ASSERT_EQ(Prague->SlowStartThreshold, Prague->CongestionWindow);
+    ASSERT_EQ(Connection.Stats.Send.EcnCongestionCount, 1u);
+
+    //
+    // More marks for packets sent before the reduction are ignored.
+    //
+    const uint32_t Reduced = Prague->CongestionWindow;
+    CeMark(Cc, 3, 40, 60);
+    ASSERT_EQ(Prague->CongestionWindow, Reduced);
+    ASSERT_EQ(Connection.Stats.Send.EcnCongestionCount, 1u);
+
+    //
+    // A mark on a packet sent after it triggers the next reduction.
+    //
+    CeMark(Cc, 1, 41, 80);
+    ASSERT_LT(Prague->CongestionWindow, Reduced);
+    ASSERT_EQ(Connection.Stats.Send.EcnCongestionCount, 2u);
+}
+
+//
+// Alpha converges to the fraction of CE marked bytes per round trip.
+//
+TEST(PragueTest, AlphaTracksMarkedFraction)
+{
+    QUIC_CONNECTION Connection;
+    InitializePrague(Connection);
+    QUIC_CONGESTION_CONTROL* Cc = &Connection.CongestionControl;
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+    const uint16_t PacketLength = QuicPathGetDatagramPayloadSize(&Connection.Paths[0]);
+
+    uint64_t PacketNumber = 0;
+    for (uint32_t Round = 0; Round < 200; ++Round) {
+        //
+        // 20 packets per round, 2 of which are CE marked (10%).
+        //
+        const uint64_t RoundStart = PacketNumber;
+        QuicCongestionControlOnDataSent(Cc, 20 * PacketLength);
+        PacketNumber += 20;
+        CeMark(Cc, 2, RoundStart + 1, PacketNumber - 1);
+        AckBytes(Cc, 20 * PacketLength, PacketNumber - 1, PacketNumber - 1);
+    }
+
+    const uint32_t Expected = PRAGUE_ALPHA_MAX / 10;
+    ASSERT_GT(Prague->Alpha, Expected - PRAGUE_ALPHA_MAX / 50);
+    ASSERT_LT(Prague->Alpha, Expected + PRAGUE_ALPHA_MAX / 50);
+
+    //
+    // With no more marks, alpha decays back towards zero.
+    //
+    for (uint32_t Round = 0; Round < 200; ++Round) {
+        QuicCongestionControlOnDataSent(Cc, 20 * PacketLength);
+        PacketNumber += 20;
+        AckBytes(Cc, 20 * PacketLength, PacketNumber - 1, PacketNumber - 1);
+    }
+    ASSERT_LT(Prague->Alpha, PRAGUE_ALPHA_MAX / 50);
+}
+
+TEST(PragueTest, LossHalvesWindow)
+{
+    QUIC_CONNECTION Connection;
+    InitializePrague(Connection);
+    QUIC_CONGESTION_CONTROL* Cc = &Connection.CongestionControl;
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+
+    Prague->CongestionWindow = 100000;
+    QuicCongestionControlOnDataSent(Cc, 20000);
+
+    QUIC_LOSS_EVENT LossEvent;
+    CxPlatZeroMemory(&LossEvent, sizeof(LossEvent));
+    LossEvent.LargestPacketNumberLost = 5;
+    LossEvent.LargestSentPacketNumber = 15;
+    LossEvent.NumRetransmittableBytes = 1200;
+    QuicCongestionControlOnDataLost(Cc, &LossEvent);
+
+    ASSERT_EQ(Prague->CongestionWindow, 50000u);
+    ASSERT_EQ(Prague->SlowStartThreshold, 50000u);
+    ASSERT_TRUE(Prague->IsInRecovery);
+    ASSERT_EQ(Connection.Stats.Send.CongestionCount, 1u);
+
+    //
+    // CE marks during loss recovery don't reduce the window further.
+    //
+    CeMark(Cc, 1, 10, 15);
+    ASSERT_EQ(Prague->CongestionWindow, 50000u);
+
+    QuicCongestionControlOnSpuriousCongestionEvent(Cc);
+    ASSERT_EQ(Prague->CongestionWindow, 100000u);
+}
+
+TEST(PragueTest, AdditiveIncrease)
+{
+    QUIC_CONNECTION Connection;
+    InitializePrague(Connection);
+    QUIC_CONGESTION_CONTROL* Cc = &Connection.CongestionControl;
+    QUIC_CONGESTION_CONTROL_PRAGUE* Prague = &Cc->Prague;
+    const uint16_t PacketLength = QuicPathGetDatagramPayloadSize(&Connection.Paths[0]);
+
+    Prague->CongestionWindow = Prague->SlowStartThreshold = 20 * PacketLength;
+    Prague->BytesInFlightMax = Prague->CongestionWindow;
+
+    //
+    // A full window of acknowledged bytes grows the window by one packet.
+    //
+    for (uint32_t i = 0; i < 20; ++i) {
+        QuicCongestionControlOnDataSent(Cc, PacketLength);
+        AckBytes(Cc, PacketLength, i, i);
+    }
+    ASSERT_EQ(Prague->CongestionWindow, 21u * PacketLength);
+}
@@ -159,6 +159,47 @@ struct RecvBuffer {
         Dump();
         return Status;
     }
+    uint8_t* GetInOrderWriteBuffer(
+        _In_ uint64_t WriteOffset,
+        _In_ uint16_t WriteLength
+        ) {
+        return QuicRecvBufferGetInOrderWriteBuffer(&RecvBuf, WriteOffset, WriteLength);
+    }
+    //
+    // Mimics decrypting directly into the receive buffer: the data is placed
+    // where the buffer says it goes and then written from there.
+    //
+    QUIC_STATUS WriteInPlace(
+        _In_ uint64_t WriteOffset,
+        _In_ uint16_t WriteLength,
+        _Inout_ uint64_t* WriteQuota,
+        _Out_ BOOLEAN* NewDataReady
+        ) {
+        uint8_t* Destination = GetInOrderWriteBuffer(WriteOffset, WriteLength);
+        if (Destination == nullptr) {
+            return QUIC_STATUS_INVALID_STATE;
+        }
+        for (uint16_t i = 0; i < WriteLength; ++i) {
+            Destination[i] = (uint8_t)(WriteOffset + i);
+        }
+        uint64_t SizeNeeded = 0;
+        uint64_t QuotaConsumed = 0;
+        auto Status =
+            QuicRecvBufferWrite(
+                &RecvBuf,
+                WriteOffset,
+                WriteLength,
+                Destination,
+                *WriteQuota,
+                &QuotaConsumed,
+                NewDataReady,
+                &SizeNeeded);
+        if (QUIC_SUCCEEDED(Status)) {
+            *WriteQuota = QuotaConsumed;
+        }
+        Dump();
+        return Status;
+    }
     void Read(
         _Out_ uint64_t* BufferOffset,
         _Inout_ uint32_t* BufferCount,
@@ -2152,6 +2193,80 @@ TEST(AppOwnedBuffersTest, FreeBufferBeforeDrain)
     RecvBuf.Drain(8);
 }
 
+TEST(AppOwnedBuffersTest, InOrderWriteBuffer)
+{
+    RecvBuffer RecvBuf;
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, RecvBuf.Initialize(QUIC_RECV_BUF_MODE_APP_OWNED, false, 0, 0));
+
+    //
+    // No buffer space provided yet.
+    //
+    ASSERT_EQ(nullptr, RecvBuf.GetInOrderWriteBuffer(0, 8));
+
+    std::array<uint8_t, 16> Buffer{};
+    std::vector ChunkSizes{8u, 8u};
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, RecvBuf.ProvideChunks(ChunkSizes, Buffer.size(), Buffer.data()));
+
+    ASSERT_EQ(Buffer.data(), RecvBuf.GetInOrderWriteBuffer(0, 8));
+    ASSERT_EQ(nullptr, RecvBuf.GetInOrderWriteBuffer(0, 9)); // Straddles two chunks
+    ASSERT_EQ(nullptr, RecvBuf.GetInOrderWriteBuffer(1, 4)); // Not in order
+    ASSERT_EQ(nullptr, RecvBuf.GetInOrderWriteBuffer(8, 8)); // Not in order
+
+    uint64_t InOutWriteLength = DEF_TEST_BUFFER_LENGTH;
+    BOOLEAN NewDataReady = FALSE;
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, RecvBuf.WriteInPlace(0, 6, &InOutWriteLength, &NewDataReady));
+    ASSERT_TRUE(NewDataReady);
+    ASSERT_EQ(6ull, InOutWriteLength);
+
+    ASSERT_EQ(Buffer.data() + 6, RecvBuf.GetInOrderWriteBuffer(6, 2));
+    ASSERT_EQ(nullptr, RecvBuf.GetInOrderWriteBuffer(6, 4));
+    ASSERT_EQ(nullptr, RecvBuf.GetInOrderWriteBuffer(6, 11)); // Past the end of the buffer space
+
+    //
+    // Nothing is handed out while there is out of order data buffered.
+    //
+    InOutWriteLength = DEF_TEST_BUFFER_LENGTH;
+    NewDataReady = FALSE;
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, RecvBuf.Write(10, 2, &InOutWriteLength, &NewDataReady));
+    ASSERT_FALSE(NewDataReady);
+    ASSERT_EQ(nullptr, RecvBuf.GetInOrderWriteBuffer(6, 2));
+
+    InOutWriteLength = DEF_TEST_BUFFER_LENGTH;
+    NewDataReady = FALSE;
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, RecvBuf.Write(6, 4, &InOutWriteLength, &NewDataReady));
+    ASSERT_TRUE(NewDataReady);
+
+    uint32_t LengthList[] = {8, 4};
+    BOOLEAN ExternalReferences[] = {TRUE, TRUE};
+    RecvBuf.ReadAndCheck(2, LengthList, 0, 8, 2, ExternalReferences);
+    RecvBuf.Drain(12);
+
+    //
+    // Write the rest of the second chunk in place.
+    //
+    ASSERT_EQ(Buffer.data() + 12, RecvBuf.GetInOrderWriteBuffer(12, 4));
+    InOutWriteLength = DEF_TEST_BUFFER_LENGTH;
+    NewDataReady = FALSE;
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, RecvBuf.WriteInPlace(12, 4, &InOutWriteLength, &NewDataReady));
+    ASSERT_TRUE(NewDataReady);
+    LengthList[0] = 4;
+    ExternalReferences[0] = TRUE;
+    RecvBuf.ReadAndCheck(1, LengthList, 4, 4, 1, ExternalReferences);
+    RecvBuf.Drain(4);
+}
+
+TEST_P(WithMode, InOrderWriteBufferOnlyAppOwned)
+{
+    RecvBuffer RecvBuf;
+    ASSERT_EQ(QUIC_STATUS_SUCCESS, RecvBuf.Initialize(GetParam()));
+    uint8_t* Destination = RecvBuf.GetInOrderWriteBuffer(0, 8);
+    if (GetParam() == QUIC_RECV_BUF_MODE_APP_OWNED) {
+        ASSERT_NE(nullptr, Destination);
+    } else {
+        ASSERT_EQ(nullptr, Destination);
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(
     RecvBufferTest,
     WithMode,
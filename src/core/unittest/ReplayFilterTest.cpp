@@ -0,0 +1,117 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Unit tests for the 0-RTT replay filter.
+
+--*/
+
+#include "main.h"
+#ifdef QUIC_CLOG
+#include "ReplayFilterTest.cpp.clog.h"
+#endif
+
+#define TEST_FILTER_SIZE (64 * 1024)
+#define TEST_WINDOW 1000
+
+struct ReplayFilterScope {
+    QUIC_REPLAY_FILTER Filter;
+    uint64_t Key[2];
+    ReplayFilterScope() {
+        QuicReplayFilterInitialize(&Filter);
+        CxPlatRandom(sizeof(Key), Key);
+    }
+    ~ReplayFilterScope() { QuicReplayFilterUninitialize(&Filter); }
+    bool TestAndSet(const uint8_t* Random, uint64_t TimeNow, uint32_t Size = TEST_FILTER_SIZE) {
+        uint64_t Hash[2];
+        QuicReplayFilterHash(Key, 32, Random, Hash);
+        return QuicReplayFilterTestAndSet(&Filter, Hash, Size, TEST_WINDOW, TimeNow) != FALSE;
+    }
+};
+
+struct ClientRandom {
+    uint8_t Value[32];
+    ClientRandom() { CxPlatRandom(sizeof(Value), Value); }
+};
+
+TEST(ReplayFilterTest, DetectsReplay)
+{
+    ReplayFilterScope Filter;
+    ClientRandom A, B;
+
+    ASSERT_FALSE(Filter.TestAndSet(A.Value, 0));
+    ASSERT_TRUE(Filter.TestAndSet(A.Value, 1));
+    ASSERT_FALSE(Filter.TestAndSet(B.Value, 1));
+    ASSERT_TRUE(Filter.TestAndSet(B.Value, 2));
+}
+
+TEST(ReplayFilterTest, RemembersForWindow)
+{
+    ReplayFilterScope Filter;
+    ClientRandom A, B;
+
+    ASSERT_FALSE(Filter.TestAndSet(A.Value, 0));
+    ASSERT_FALSE(Filter.TestAndSet(B.Value, TEST_WINDOW)); // Starts a new generation.
+    ASSERT_TRUE(Filter.TestAndSet(A.Value, 2 * TEST_WINDOW - 1));
+}
+
+TEST(ReplayFilterTest, ForgetsAfterTwoGenerations)
+{
+    ReplayFilterScope Filter;
+    ClientRandom A, B, C;
+
+    ASSERT_FALSE(Filter.TestAndSet(A.Value, 0));
+    ASSERT_FALSE(Filter.TestAndSet(B.Value, TEST_WINDOW));
+    ASSERT_FALSE(Filter.TestAndSet(C.Value, 2 * TEST_WINDOW));
+    ASSERT_FALSE(Filter.TestAndSet(A.Value, 2 * TEST_WINDOW));
+    ASSERT_TRUE(Filter.TestAndSet(B.Value, 2 * TEST_WINDOW));
+}
+
+TEST(ReplayFilterTest, ForgetsAfterIdle)
+{
+    ReplayFilterScope Filter;
+    ClientRandom A;
+
+    ASSERT_FALSE(Filter.TestAndSet(A.Value, 0));
+    ASSERT_FALSE(Filter.TestAndSet(A.Value, 2 * TEST_WINDOW));
+}
+
+TEST(ReplayFilterTest, SizeRoundedDown)
+{
+    ReplayFilterScope Filter;
+    ClientRandom A;
+
+    ASSERT_FALSE(Filter.TestAndSet(A.Value, 0, 1000));
+    ASSERT_EQ(512u * 8, Filter.Filter.BitCount);
+}
+
+TEST(ReplayFilterTest, FalsePositiveRate)
+{
+    //
+    // With 4 bits per value, a 64KB generation holds ~40,000 ClientHellos for
+    // a false positive rate of ~0.5%. The probes are added to the filter too,
+    // so the measured rate creeps a little higher than that, but stays under
+    // 1%.
+    //
+    const uint32_t FillCount = 40000;
+    const uint32_t ProbeCount = 10000;
+    ReplayFilterScope Filter;
+
+    for (uint32_t i = 0; i < FillCount; ++i) {
+        ClientRandom Random;
+        Filter.TestAndSet(Random.Value, 0);
+    }
+
+    uint32_t FalsePositives = 0;
+    for (uint32_t i = 0; i < ProbeCount; ++i) {
+        ClientRandom Random;
+        if (Filter.TestAndSet(Random.Value, 0)) {
+            FalsePositives++;
+        }
+    }
+
+    ASSERT_LT(FalsePositives, ProbeCount / 100);
+}
@@ -0,0 +1,153 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Unit tests for the server-side session cache.
+
+--*/
+
+#include "main.h"
+#ifdef QUIC_CLOG
+#include "SessionCacheTest.cpp.clog.h"
+#endif
+
+#define TEST_TICKET_LENGTH 100
+#define TEST_ENTRY_SIZE (sizeof(QUIC_SESSION_CACHE_ENTRY) + TEST_TICKET_LENGTH)
+#define TEST_LIFETIME 1000
+
+struct SessionCacheScope {
+    QUIC_SESSION_CACHE Cache;
+    SessionCacheScope(uint32_t MaxByteCount = 16 * TEST_ENTRY_SIZE) {
+        EXPECT_EQ(
+            QUIC_STATUS_SUCCESS,
+            QuicSessionCacheInitialize(&Cache, MaxByteCount, TEST_LIFETIME));
+    }
+    ~SessionCacheScope() { QuicSessionCacheUninitialize(&Cache); }
+    operator QUIC_SESSION_CACHE* () { return &Cache; }
+};
+
+struct TestSession {
+    uint8_t Id[QUIC_SESSION_CACHE_ID_LENGTH];
+    uint8_t Ticket[TEST_TICKET_LENGTH];
+    TestSession(uint8_t Value) {
+        CxPlatRandom(sizeof(Id), Id);
+        memset(Ticket, Value, sizeof(Ticket));
+    }
+    void Insert(QUIC_SESSION_CACHE* Cache, uint64_t TimeNow) {
+        TEST_QUIC_SUCCEEDED(
+            QuicSessionCacheInsert(Cache, Id, sizeof(Ticket), Ticket, TimeNow));
+    }
+    bool Remove(QUIC_SESSION_CACHE* Cache, uint64_t TimeNow) {
+        QUIC_SESSION_CACHE_ENTRY* Entry = QuicSessionCacheRemove(Cache, Id, TimeNow);
+        if (Entry == nullptr) {
+            return false;
+        }
+        EXPECT_EQ(sizeof(Ticket), Entry->TicketLength);
+        EXPECT_EQ(0, memcmp(Ticket, Entry->Ticket, sizeof(Ticket)));
+        QuicSessionCacheEntryFree(Entry);
+        return true;
+    }
+};
+
+TEST(SessionCacheTest, SingleUse)
+{
+    SessionCacheScope Cache;
+    TestSession Session(1);
+
+    Session.Insert(Cache, 0);
+    ASSERT_EQ(1u, Cache.Cache.EntryCount);
+    ASSERT_TRUE(Session.Remove(Cache, 1));
+    ASSERT_FALSE(Session.Remove(Cache, 1));
+    ASSERT_EQ(0u, Cache.Cache.EntryCount);
+    ASSERT_EQ(0u, Cache.Cache.ByteCount);
+}
+
+TEST(SessionCacheTest, UnknownId)
+{
+    SessionCacheScope Cache;
+    TestSession Session(1);
+    TestSession Other(2);
+
+    Session.Insert(Cache, 0);
+    ASSERT_FALSE(Other.Remove(Cache, 1));
+    ASSERT_TRUE(Session.Remove(Cache, 1));
+}
+
+TEST(SessionCacheTest, Expiration)
+{
+    SessionCacheScope Cache;
+    TestSession Session1(1);
+    TestSession Session2(2);
+
+    Session1.Insert(Cache, 0);
+    Session2.Insert(Cache, 0);
+    ASSERT_TRUE(Session1.Remove(Cache, TEST_LIFETIME - 1));
+    ASSERT_FALSE(Session2.Remove(Cache, TEST_LIFETIME));
+    ASSERT_EQ(0u, Cache.Cache.EntryCount);
+}
+
+TEST(SessionCacheTest, InsertEvictsExpired)
+{
+    SessionCacheScope Cache;
+    TestSession Old1(1);
+    TestSession Old2(2);
+    TestSession New(3);
+
+    Old1.Insert(Cache, 0);
+    Old2.Insert(Cache, TEST_LIFETIME / 2);
+    New.Insert(Cache, TEST_LIFETIME);
+
+    //
+    // Only the session that had expired by the insert is gone.
+    //
+    ASSERT_EQ(2u, Cache.Cache.EntryCount);
+    ASSERT_EQ(2 * TEST_ENTRY_SIZE, Cache.Cache.ByteCount);
+    ASSERT_FALSE(Old1.Remove(Cache, 0));
+    ASSERT_TRUE(Old2.Remove(Cache, TEST_LIFETIME));
+    ASSERT_TRUE(New.Remove(Cache, TEST_LIFETIME));
+}
+
+TEST(SessionCacheTest, LruEviction)
+{
+    const uint32_t Capacity = 4;
+    SessionCacheScope Cache(Capacity * TEST_ENTRY_SIZE);
+    TestSession Sessions[Capacity + 2] = { 0, 1, 2, 3, 4, 5 };
+    for (uint32_t i = 0; i < Capacity + 2; ++i) {
+        Sessions[i].Insert(Cache, i);
+        ASSERT_LE(Cache.Cache.ByteCount, Capacity * TEST_ENTRY_SIZE);
+    }
+    ASSERT_EQ(Capacity, Cache.Cache.EntryCount);
+
+    //
+    // The least recently issued sessions were evicted to make room.
+    //
+    ASSERT_FALSE(Sessions[0].Remove(Cache, Capacity + 2));
+    ASSERT_FALSE(Sessions[1].Remove(Cache, Capacity + 2));
+    for (uint32_t i = 2; i < Capacity + 2; ++i) {
+        ASSERT_TRUE(Sessions[i].Remove(Cache, Capacity + 2));
+    }
+}
+
+TEST(SessionCacheTest, TicketTooLarge)
+{
+    SessionCacheScope Cache(TEST_ENTRY_SIZE - 1);
+    TestSession Session(1);
+
+    ASSERT_EQ(
+        QUIC_STATUS_BUFFER_TOO_SMALL,
+        QuicSessionCacheInsert(
+            Cache, Session.Id, sizeof(Session.Ticket), Session.Ticket, 0));
+    ASSERT_EQ(0u, Cache.Cache.EntryCount);
+}
+
+TEST(SessionCacheTest, UninitializeFreesSessions)
+{
+    SessionCacheScope Cache;
+    for (uint8_t i = 0; i < 8; ++i) {
+        TestSession(i).Insert(Cache, i);
+    }
+    ASSERT_EQ(8u, Cache.Cache.EntryCount);
+}
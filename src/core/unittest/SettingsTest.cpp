@@ -129,6 +129,15 @@ TEST(SettingsTest, TestAllSettingsFieldsSet)
     SETTINGS_FEATURE_SET_TEST(OneWayDelayEnabled, QuicSettingsSettingsToInternal);
     SETTINGS_FEATURE_SET_TEST(NetStatsEventEnabled, QuicSettingsSettingsToInternal);
     SETTINGS_FEATURE_SET_TEST(StreamMultiReceiveEnabled, QuicSettingsSettingsToInternal);
+    SETTINGS_FEATURE_SET_TEST(AdaptiveAckFrequencyEnabled, QuicSettingsSettingsToInternal);
+    SETTINGS_FEATURE_SET_TEST(EncryptInCopyEnabled, QuicSettingsSettingsToInternal);
+    SETTINGS_FEATURE_SET_TEST(DecryptToAppBuffersEnabled, QuicSettingsSettingsToInternal);
+    SETTINGS_FEATURE_SET_TEST(DatagramFecEnabled, QuicSettingsSettingsToInternal);
+    SETTINGS_FEATURE_SET_TEST(DatagramReceiveBatchEnabled, QuicSettingsSettingsToInternal);
+    SETTINGS_FEATURE_SET_TEST(TlsOffloadEnabled, QuicSettingsSettingsToInternal);
+    SETTINGS_FEATURE_SET_TEST(ServerSessionCacheEnabled, QuicSettingsSettingsToInternal);
+    SETTINGS_FEATURE_SET_TEST(ReplayFilterEnabled, QuicSettingsSettingsToInternal);
+    SETTINGS_FEATURE_SET_TEST(KeySharePoolEnabled, QuicSettingsSettingsToInternal);
 
     // Bias field count on behalf of erstwhile ReservedRioEnabled
     FieldCount++;
@@ -147,6 +156,9 @@ TEST(SettingsTest, TestAllGlobalSettingsFieldsSet)
     SETTINGS_FEATURE_SET_TEST(RetryMemoryLimit, QuicSettingsGlobalSettingsToInternal);
     SETTINGS_FEATURE_SET_TEST(LoadBalancingMode, QuicSettingsGlobalSettingsToInternal);
     SETTINGS_FEATURE_SET_TEST(FixedServerID, QuicSettingsGlobalSettingsToInternal);
+    SETTINGS_FEATURE_SET_TEST(ReplayFilterSize, QuicSettingsGlobalSettingsToInternal);
+    SETTINGS_FEATURE_SET_TEST(ReplayFilterWindowMs, QuicSettingsGlobalSettingsToInternal);
+    SETTINGS_FEATURE_SET_TEST(InitialRateLimit, QuicSettingsGlobalSettingsToInternal);
 
     Settings.IsSetFlags = 0;
     Settings.IsSet.RESERVED = ~Settings.IsSet.RESERVED;
@@ -220,6 +232,15 @@ TEST(SettingsTest, TestAllSettingsFieldsGet)
     SETTINGS_FEATURE_GET_TEST(OneWayDelayEnabled, QuicSettingsGetSettings);
     SETTINGS_FEATURE_GET_TEST(NetStatsEventEnabled, QuicSettingsGetSettings);
     SETTINGS_FEATURE_GET_TEST(StreamMultiReceiveEnabled, QuicSettingsGetSettings);
+    SETTINGS_FEATURE_GET_TEST(AdaptiveAckFrequencyEnabled, QuicSettingsGetSettings);
+    SETTINGS_FEATURE_GET_TEST(EncryptInCopyEnabled, QuicSettingsGetSettings);
+    SETTINGS_FEATURE_GET_TEST(DecryptToAppBuffersEnabled, QuicSettingsGetSettings);
+    SETTINGS_FEATURE_GET_TEST(DatagramFecEnabled, QuicSettingsGetSettings);
+    SETTINGS_FEATURE_GET_TEST(DatagramReceiveBatchEnabled, QuicSettingsGetSettings);
+    SETTINGS_FEATURE_GET_TEST(TlsOffloadEnabled, QuicSettingsGetSettings);
+    SETTINGS_FEATURE_GET_TEST(ServerSessionCacheEnabled, QuicSettingsGetSettings);
+    SETTINGS_FEATURE_GET_TEST(ReplayFilterEnabled, QuicSettingsGetSettings);
+    SETTINGS_FEATURE_GET_TEST(KeySharePoolEnabled, QuicSettingsGetSettings);
 
     // Bias field count on behalf of erstwhile ReservedRioEnabled
     FieldCount++;
@@ -239,6 +260,9 @@ TEST(SettingsTest, TestAllGlobalSettingsFieldsGet)
     SETTINGS_FEATURE_GET_TEST(RetryMemoryLimit, QuicSettingsGetGlobalSettings);
     SETTINGS_FEATURE_GET_TEST(LoadBalancingMode, QuicSettingsGetGlobalSettings);
     SETTINGS_FEATURE_GET_TEST(FixedServerID, QuicSettingsGetGlobalSettings);
+    SETTINGS_FEATURE_GET_TEST(ReplayFilterSize, QuicSettingsGetGlobalSettings);
+    SETTINGS_FEATURE_GET_TEST(ReplayFilterWindowMs, QuicSettingsGetGlobalSettings);
+    SETTINGS_FEATURE_GET_TEST(InitialRateLimit, QuicSettingsGetGlobalSettings);
 
     Settings.IsSetFlags = 0;
     Settings.IsSet.RESERVED = ~Settings.IsSet.RESERVED;
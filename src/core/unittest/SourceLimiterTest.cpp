@@ -0,0 +1,105 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    Unit tests for the source prefix rate limiter.
+
+--*/
+
+#include "main.h"
+#ifdef QUIC_CLOG
+#include "SourceLimiterTest.cpp.clog.h"
+#endif
+
+#define TEST_RATE 100
+
+struct SourceLimiterScope {
+    QUIC_SOURCE_LIMITER Limiter;
+    SourceLimiterScope() { QuicSourceLimiterInitialize(&Limiter); }
+    ~SourceLimiterScope() { QuicSourceLimiterUninitialize(&Limiter); }
+    bool TryAcquire(const char* Address, uint32_t TimeMs) {
+        QUIC_ADDR Addr;
+        EXPECT_TRUE(QuicAddrFromString(Address, 443, &Addr));
+        return QuicSourceLimiterTryAcquire(&Limiter, &Addr, TEST_RATE, TimeMs) != FALSE;
+    }
+    uint32_t Burst(const char* Address, uint32_t TimeMs) {
+        uint32_t Count = 0;
+        while (Count <= 2 * TEST_RATE && TryAcquire(Address, TimeMs)) {
+            Count++;
+        }
+        return Count;
+    }
+};
+
+TEST(SourceLimiterTest, AllowsOneSecondBurst)
+{
+    SourceLimiterScope Limiter;
+    ASSERT_EQ((uint32_t)TEST_RATE, Limiter.Burst("192.0.2.1", 1000));
+    ASSERT_FALSE(Limiter.TryAcquire("192.0.2.1", 1000));
+}
+
+TEST(SourceLimiterTest, LimitsWholeIPv4Prefix)
+{
+    SourceLimiterScope Limiter;
+    ASSERT_EQ((uint32_t)TEST_RATE, Limiter.Burst("192.0.2.1", 1000));
+    ASSERT_FALSE(Limiter.TryAcquire("192.0.2.200", 1000));
+    ASSERT_TRUE(Limiter.TryAcquire("192.0.3.1", 1000));
+}
+
+TEST(SourceLimiterTest, LimitsWholeIPv6Prefix)
+{
+    SourceLimiterScope Limiter;
+    ASSERT_EQ((uint32_t)TEST_RATE, Limiter.Burst("2001:db8:1::1", 1000));
+    ASSERT_FALSE(Limiter.TryAcquire("2001:db8:1:ffff::2", 1000));
+    ASSERT_TRUE(Limiter.TryAcquire("2001:db8:2::1", 1000));
+}
+
+TEST(SourceLimiterTest, RefillsAtRate)
+{
+    SourceLimiterScope Limiter;
+    ASSERT_EQ((uint32_t)TEST_RATE, Limiter.Burst("192.0.2.1", 1000));
+
+    //
+    // 100 packets per second is one every 10 ms.
+    //
+    ASSERT_FALSE(Limiter.TryAcquire("192.0.2.1", 1009));
+    ASSERT_TRUE(Limiter.TryAcquire("192.0.2.1", 1010));
+    ASSERT_FALSE(Limiter.TryAcquire("192.0.2.1", 1010));
+    ASSERT_EQ(5u, Limiter.Burst("192.0.2.1", 1060));
+
+    //
+    // An older time from another processor doesn't refill anything.
+    //
+    ASSERT_FALSE(Limiter.TryAcquire("192.0.2.1", 1050));
+
+    //
+    // After being idle, only a burst's worth is allowed.
+    //
+    ASSERT_EQ((uint32_t)TEST_RATE, Limiter.Burst("192.0.2.1", 100000));
+}
+
+TEST(SourceLimiterTest, HeavyHitterDoesNotStarveOthers)
+{
+    //
+    // Many distinct prefixes share cells with each other, but with the
+    // conservative update, light prefixes shouldn't be taken for heavy ones.
+    //
+    SourceLimiterScope Limiter;
+    ASSERT_EQ((uint32_t)TEST_RATE, Limiter.Burst("198.51.100.1", 1000));
+
+    uint32_t Denied = 0;
+    for (uint32_t i = 0; i < 2000; ++i) {
+        char Address[32];
+        sprintf_s(Address, sizeof(Address), "10.%u.%u.1", i / 256, i % 256);
+        for (uint32_t j = 0; j < 10; ++j) {
+            if (!Limiter.TryAcquire(Address, 1000)) {
+                Denied++;
+            }
+        }
+    }
+    ASSERT_EQ(0u, Denied);
+    ASSERT_FALSE(Limiter.TryAcquire("198.51.100.1", 1000));
+}
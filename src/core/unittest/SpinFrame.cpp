@@ -35,6 +35,8 @@ union QuicV1Frames {
     QUIC_ACK_FREQUENCY_EX AckFrequencyFrame;
     QUIC_RELIABLE_RESET_STREAM_EX ReliableResetStreamFrame;
     QUIC_TIMESTAMP_EX TimestampFrame;
+    QUIC_DATAGRAM_FEC_SOURCE_EX DatagramFecSourceFrame;
+    QUIC_DATAGRAM_FEC_REPAIR_EX DatagramFecRepairFrame;
 };
 
 TEST(SpinFrame, SpinFrame1000000)
@@ -241,6 +243,20 @@ TEST(SpinFrame, SpinFrame1000000)
                     FailedDecodes++;
                 }
                 break;
+            case QUIC_FRAME_DATAGRAM_FEC_SOURCE:
+                if (QuicDatagramFecSourceFrameDecode(BufferLength, Buffer, &Offset, &DecodedFrame.DatagramFecSourceFrame)) {
+                    SuccessfulDecodes++;
+                } else {
+                    FailedDecodes++;
+                }
+                break;
+            case QUIC_FRAME_DATAGRAM_FEC_REPAIR:
+                if (QuicDatagramFecRepairFrameDecode(BufferLength, Buffer, &Offset, &DecodedFrame.DatagramFecRepairFrame)) {
+                    SuccessfulDecodes++;
+                } else {
+                    FailedDecodes++;
+                }
+                break;
             default:
                 ASSERT_TRUE(FALSE) << "You have a test bug. FrameType: " << (QUIC_FRAME_TYPE) FrameType << " doesn't have a matching case.";
                 break;
@@ -90,6 +90,10 @@ std::ostream& operator << (std::ostream& o, const QUIC_FRAME_TYPE& type) {
             return o << "QUIC_FRAME_IMMEDIATE_ACK";
         case QUIC_FRAME_RELIABLE_RESET_STREAM:
             return o << "QUIC_FRAME_RELIABLE_RESET_STREAM";
+        case QUIC_FRAME_DATAGRAM_FEC_SOURCE:
+            return o << "QUIC_FRAME_DATAGRAM_FEC_SOURCE";
+        case QUIC_FRAME_DATAGRAM_FEC_REPAIR:
+            return o << "QUIC_FRAME_DATAGRAM_FEC_REPAIR";
         default:
             return o << "UNRECOGNIZED_FRAME_TYPE(" << (uint32_t) type << ")";
     }
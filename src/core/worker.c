@@ -435,6 +435,7 @@ QuicWorkerQueueOperation(
         const QUIC_BINDING* Binding = Operation->STATELESS.Context->Binding;
         const QUIC_RX_PACKET* Packet = Operation->STATELESS.Context->Packet;
         QuicPacketLogDrop(Binding, Packet, "Worker operation limit reached");
+        QuicPerfCounterIncrement(Worker->Partition, QUIC_PERF_COUNTER_STATELESS_OPER_DROPPED);
         QuicOperationFree(Operation);
     } else if (WakeWorkerThread) {
         QuicWorkerThreadWake(Worker);
@@ -658,12 +659,23 @@ QuicWorkerProcessConnection(
         QuicConnDrainOperations(Connection, &StillHasPriorityWork) | Connection->State.UpdateWorker;
     Connection->WorkerThreadID = 0;
 
+    //
+    // If the drain handed TLS processing off to the crypto pool, the pool
+    // queues the connection again once it completes. Until then, it must not
+    // be processed here.
+    //
+    const BOOLEAN TlsOffloadPending = Connection->Crypto.TlsOffloadPending;
+
     //
     // Determine whether the connection needs to be requeued.
     //
     CxPlatDispatchLockAcquire(&Worker->Lock);
     Connection->WorkerProcessing = FALSE;
-    Connection->HasQueuedWork |= StillHasWorkToDo;
+    if (TlsOffloadPending) {
+        Connection->HasQueuedWork = FALSE;
+    } else {
+        Connection->HasQueuedWork |= StillHasWorkToDo;
+    }
 
     BOOLEAN DoneWithConnection = TRUE;
     if (!Connection->State.UpdateWorker) {
@@ -715,6 +727,14 @@ QuicWorkerProcessConnection(
         //
         QuicConnRelease(Connection, QUIC_CONN_REF_WORKER);
     }
+
+    if (TlsOffloadPending) {
+        //
+        // Now that the worker is completely done with the connection, hand
+        // it off. The crypto pool holds its own reference.
+        //
+        QuicCryptoPoolQueue(&MsQuicLib.CryptoPool, &Connection->Crypto);
+    }
 }
 
 _IRQL_requires_max_(PASSIVE_LEVEL)
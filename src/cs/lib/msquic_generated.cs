@@ -199,6 +199,7 @@ namespace Microsoft.Quic
         CANCEL_ON_LOSS = 0x0020,
         PRIORITY_WORK = 0x0040,
         CANCEL_ON_BLOCKED = 0x0080,
+        DGRAM_FEC_FLUSH = 0x0100,
     }
 
     internal enum QUIC_DATAGRAM_SEND_STATE
@@ -508,6 +509,9 @@ namespace Microsoft.Quic
     {
         CUBIC,
         BBR,
+        BBR3,
+        PRAGUE,
+        CUSTOM,
         MAX,
     }
 
@@ -924,6 +928,36 @@ namespace Microsoft.Quic
 
         [NativeTypeName("uint32_t")]
         internal uint RttVariance;
+
+        [NativeTypeName("uint64_t")]
+        internal ulong RecvWindowBytes;
+
+        [NativeTypeName("uint32_t")]
+        internal uint RecvWindowGrowCount;
+
+        [NativeTypeName("uint32_t")]
+        internal uint RecvWindowShrinkCount;
+
+        [NativeTypeName("uint32_t")]
+        internal uint RecvWindowBudgetLimitedCount;
+
+        [NativeTypeName("uint64_t")]
+        internal ulong SendSpuriousLostBytes;
+
+        [NativeTypeName("uint32_t")]
+        internal uint SendSpuriousCongestionCount;
+
+        [NativeTypeName("uint32_t")]
+        internal uint SendPacketReorderThreshold;
+
+        [NativeTypeName("uint32_t")]
+        internal uint SendDatagramFecRepairCount;
+
+        [NativeTypeName("uint32_t")]
+        internal uint RecvDatagramFecRecoveredCount;
+
+        [NativeTypeName("uint32_t")]
+        internal uint SendDatagramExpiredCount;
     }
 
     internal partial struct QUIC_NETWORK_STATISTICS
@@ -994,6 +1028,14 @@ namespace Microsoft.Quic
         SEND_STATELESS_RETRY,
         CONN_LOAD_REJECT,
         LISTEN_QUEUE_DEPTH,
+        SEND_BUFFER_BYTES,
+        SEND_BUFFER_BUDGET_EXHAUSTED,
+        SESSION_CACHE_HIT,
+        SESSION_CACHE_MISS,
+        CONN_HANDSHAKE_NO_AMP_STALL,
+        STATELESS_OPER_COMPLETED,
+        STATELESS_OPER_DROPPED,
+        CONN_INITIAL_RATE_LIMITED,
         MAX,
     }
 
@@ -1032,6 +1074,15 @@ namespace Microsoft.Quic
         [NativeTypeName("uint32_t")]
         internal uint FixedServerID;
 
+        [NativeTypeName("uint32_t")]
+        internal uint ReplayFilterSize;
+
+        [NativeTypeName("uint32_t")]
+        internal uint ReplayFilterWindowMs;
+
+        [NativeTypeName("uint32_t")]
+        internal uint InitialRateLimit;
+
         internal ref ulong IsSetFlags
         {
             get
@@ -1105,17 +1156,59 @@ namespace Microsoft.Quic
                     }
                 }
 
-                [NativeTypeName("uint64_t : 61")]
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong ReplayFilterSize
+                {
+                    get
+                    {
+                        return (_bitfield >> 3) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 3)) | ((value & 0x1UL) << 3);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong ReplayFilterWindowMs
+                {
+                    get
+                    {
+                        return (_bitfield >> 4) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 4)) | ((value & 0x1UL) << 4);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong InitialRateLimit
+                {
+                    get
+                    {
+                        return (_bitfield >> 5) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 5)) | ((value & 0x1UL) << 5);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 58")]
                 internal ulong RESERVED
                 {
                     get
                     {
-                        return (_bitfield >> 3) & 0x1FFFFFFFUL;
+                        return (_bitfield >> 6) & 0x3FFFFFFUL;
                     }
 
                     set
                     {
-                        _bitfield = (_bitfield & ~(0x1FFFFFFFUL << 3)) | ((value & 0x1FFFFFFFUL) << 3);
+                        _bitfield = (_bitfield & ~(0x3FFFFFFUL << 6)) | ((value & 0x3FFFFFFUL) << 6);
                     }
                 }
             }
@@ -1461,6 +1554,123 @@ namespace Microsoft.Quic
             }
         }
 
+        internal ulong AdaptiveAckFrequencyEnabled
+        {
+            get
+            {
+                return Anonymous2.Anonymous.AdaptiveAckFrequencyEnabled;
+            }
+
+            set
+            {
+                Anonymous2.Anonymous.AdaptiveAckFrequencyEnabled = value;
+            }
+        }
+
+        internal ulong EncryptInCopyEnabled
+        {
+            get
+            {
+                return Anonymous2.Anonymous.EncryptInCopyEnabled;
+            }
+
+            set
+            {
+                Anonymous2.Anonymous.EncryptInCopyEnabled = value;
+            }
+        }
+
+        internal ulong DecryptToAppBuffersEnabled
+        {
+            get
+            {
+                return Anonymous2.Anonymous.DecryptToAppBuffersEnabled;
+            }
+
+            set
+            {
+                Anonymous2.Anonymous.DecryptToAppBuffersEnabled = value;
+            }
+        }
+
+        internal ulong DatagramFecEnabled
+        {
+            get
+            {
+                return Anonymous2.Anonymous.DatagramFecEnabled;
+            }
+
+            set
+            {
+                Anonymous2.Anonymous.DatagramFecEnabled = value;
+            }
+        }
+
+        internal ulong DatagramReceiveBatchEnabled
+        {
+            get
+            {
+                return Anonymous2.Anonymous.DatagramReceiveBatchEnabled;
+            }
+
+            set
+            {
+                Anonymous2.Anonymous.DatagramReceiveBatchEnabled = value;
+            }
+        }
+
+        internal ulong TlsOffloadEnabled
+        {
+            get
+            {
+                return Anonymous2.Anonymous.TlsOffloadEnabled;
+            }
+
+            set
+            {
+                Anonymous2.Anonymous.TlsOffloadEnabled = value;
+            }
+        }
+
+        internal ulong ServerSessionCacheEnabled
+        {
+            get
+            {
+                return Anonymous2.Anonymous.ServerSessionCacheEnabled;
+            }
+
+            set
+            {
+                Anonymous2.Anonymous.ServerSessionCacheEnabled = value;
+            }
+        }
+
+        internal ulong ReplayFilterEnabled
+        {
+            get
+            {
+                return Anonymous2.Anonymous.ReplayFilterEnabled;
+            }
+
+            set
+            {
+                Anonymous2.Anonymous.ReplayFilterEnabled = value;
+            }
+        }
+
+        internal ulong KeySharePoolEnabled
+        {
+            get
+            {
+                return Anonymous2.Anonymous.KeySharePoolEnabled;
+            }
+
+            set
+            {
+                Anonymous2.Anonymous.KeySharePoolEnabled = value;
+            }
+        }
+
         internal ulong ReservedFlags
         {
             get
@@ -2133,17 +2343,143 @@ namespace Microsoft.Quic
                     }
                 }
 
-                [NativeTypeName("uint64_t : 18")]
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong AdaptiveAckFrequencyEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 46) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 46)) | ((value & 0x1UL) << 46);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong EncryptInCopyEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 47) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 47)) | ((value & 0x1UL) << 47);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong DecryptToAppBuffersEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 48) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 48)) | ((value & 0x1UL) << 48);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong DatagramFecEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 49) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 49)) | ((value & 0x1UL) << 49);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong DatagramReceiveBatchEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 50) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 50)) | ((value & 0x1UL) << 50);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong TlsOffloadEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 51) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 51)) | ((value & 0x1UL) << 51);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong ServerSessionCacheEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 52) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 52)) | ((value & 0x1UL) << 52);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong ReplayFilterEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 53) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 53)) | ((value & 0x1UL) << 53);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong KeySharePoolEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 54) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 54)) | ((value & 0x1UL) << 54);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 9")]
                 internal ulong RESERVED
                 {
                     get
                     {
-                        return (_bitfield >> 46) & 0x3FFFFUL;
+                        return (_bitfield >> 55) & 0x1FFUL;
                     }
 
                     set
                     {
-                        _bitfield = (_bitfield & ~(0x3FFFFUL << 46)) | ((value & 0x3FFFFUL) << 46);
+                        _bitfield = (_bitfield & ~(0x1FFUL << 55)) | ((value & 0x1FFUL) << 55);
                     }
                 }
             }
@@ -2290,17 +2626,143 @@ namespace Microsoft.Quic
                     }
                 }
 
-                [NativeTypeName("uint64_t : 55")]
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong AdaptiveAckFrequencyEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 9) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 9)) | ((value & 0x1UL) << 9);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong EncryptInCopyEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 10) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 10)) | ((value & 0x1UL) << 10);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong DecryptToAppBuffersEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 11) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 11)) | ((value & 0x1UL) << 11);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong DatagramFecEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 12) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 12)) | ((value & 0x1UL) << 12);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong DatagramReceiveBatchEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 13) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 13)) | ((value & 0x1UL) << 13);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong TlsOffloadEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 14) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 14)) | ((value & 0x1UL) << 14);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong ServerSessionCacheEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 15) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 15)) | ((value & 0x1UL) << 15);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong ReplayFilterEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 16) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 16)) | ((value & 0x1UL) << 16);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 1")]
+                internal ulong KeySharePoolEnabled
+                {
+                    get
+                    {
+                        return (_bitfield >> 17) & 0x1UL;
+                    }
+
+                    set
+                    {
+                        _bitfield = (_bitfield & ~(0x1UL << 17)) | ((value & 0x1UL) << 17);
+                    }
+                }
+
+                [NativeTypeName("uint64_t : 46")]
                 internal ulong ReservedFlags
                 {
                     get
                     {
-                        return (_bitfield >> 9) & 0x7FFFFFUL;
+                        return (_bitfield >> 18) & 0x3FFFUL;
                     }
 
                     set
                     {
-                        _bitfield = (_bitfield & ~(0x7FFFFFUL << 9)) | ((value & 0x7FFFFFUL) << 9);
+                        _bitfield = (_bitfield & ~(0x3FFFUL << 18)) | ((value & 0x3FFFUL) << 18);
                     }
                 }
             }
@@ -2470,6 +2932,134 @@ namespace Microsoft.Quic
         internal byte* Secret;
     }
 
+    internal partial struct QUIC_CONGESTION_CONTROL_STATE
+    {
+        [NativeTypeName("uint64_t")]
+        internal ulong SmoothedRtt;
+
+        [NativeTypeName("uint64_t")]
+        internal ulong MinRtt;
+
+        [NativeTypeName("uint64_t")]
+        internal ulong RttVariance;
+
+        [NativeTypeName("uint64_t")]
+        internal ulong LatestRtt;
+
+        [NativeTypeName("uint32_t")]
+        internal uint BytesInFlight;
+
+        [NativeTypeName("uint32_t")]
+        internal uint BytesInFlightMax;
+
+        [NativeTypeName("uint16_t")]
+        internal ushort DatagramPayloadLength;
+
+        [NativeTypeName("BOOLEAN")]
+        internal byte GotFirstRttSample;
+
+        [NativeTypeName("BOOLEAN")]
+        internal byte PacingEnabled;
+    }
+
+    internal partial struct QUIC_CONGESTION_CONTROL_ACK
+    {
+        [NativeTypeName("uint64_t")]
+        internal ulong TimeNow;
+
+        [NativeTypeName("uint64_t")]
+        internal ulong LargestAck;
+
+        [NativeTypeName("uint64_t")]
+        internal ulong LargestSentPacketNumber;
+
+        [NativeTypeName("uint64_t")]
+        internal ulong TotalAckedBytes;
+
+        [NativeTypeName("uint64_t")]
+        internal ulong MinRtt;
+
+        [NativeTypeName("uint32_t")]
+        internal uint AckedBytes;
+
+        [NativeTypeName("BOOLEAN")]
+        internal byte MinRttValid;
+
+        [NativeTypeName("BOOLEAN")]
+        internal byte HasLoss;
+
+        [NativeTypeName("BOOLEAN")]
+        internal byte IsImplicit;
+    }
+
+    internal partial struct QUIC_CONGESTION_CONTROL_LOSS
+    {
+        [NativeTypeName("uint64_t")]
+        internal ulong LargestPacketNumberLost;
+
+        [NativeTypeName("uint64_t")]
+        internal ulong LargestSentPacketNumber;
+
+        [NativeTypeName("uint32_t")]
+        internal uint LostBytes;
+
+        [NativeTypeName("BOOLEAN")]
+        internal byte PersistentCongestion;
+    }
+
+    internal partial struct QUIC_CONGESTION_CONTROL_ECN
+    {
+        [NativeTypeName("uint64_t")]
+        internal ulong LargestPacketNumberAcked;
+
+        [NativeTypeName("uint64_t")]
+        internal ulong LargestSentPacketNumber;
+
+        [NativeTypeName("uint32_t")]
+        internal uint CePacketCount;
+    }
+
+    internal unsafe partial struct QUIC_CONGESTION_CONTROL_PROVIDER
+    {
+        [NativeTypeName("const char *")]
+        internal sbyte* Name;
+
+        internal void* Context;
+
+        [NativeTypeName("BOOLEAN")]
+        internal byte UseEct1;
+
+        [NativeTypeName("QUIC_CONGESTION_CONTROL_CREATE_FN")]
+        internal delegate* unmanaged[Cdecl]<void*, QUIC_CONGESTION_CONTROL_STATE*, void**, int> Create;
+
+        [NativeTypeName("QUIC_CONGESTION_CONTROL_DELETE_FN")]
+        internal delegate* unmanaged[Cdecl]<void*, void> Delete;
+
+        [NativeTypeName("QUIC_CONGESTION_CONTROL_GET_WINDOW_FN")]
+        internal delegate* unmanaged[Cdecl]<void*, QUIC_CONGESTION_CONTROL_STATE*, uint> GetCongestionWindow;
+
+        [NativeTypeName("QUIC_CONGESTION_CONTROL_ON_ACK_FN")]
+        internal delegate* unmanaged[Cdecl]<void*, QUIC_CONGESTION_CONTROL_STATE*, QUIC_CONGESTION_CONTROL_ACK*, void> OnDataAcknowledged;
+
+        [NativeTypeName("QUIC_CONGESTION_CONTROL_ON_LOSS_FN")]
+        internal delegate* unmanaged[Cdecl]<void*, QUIC_CONGESTION_CONTROL_STATE*, QUIC_CONGESTION_CONTROL_LOSS*, void> OnDataLost;
+
+        [NativeTypeName("QUIC_CONGESTION_CONTROL_RESET_FN")]
+        internal delegate* unmanaged[Cdecl]<void*, QUIC_CONGESTION_CONTROL_STATE*, byte, void> Reset;
+
+        [NativeTypeName("QUIC_CONGESTION_CONTROL_GET_SEND_ALLOWANCE_FN")]
+        internal delegate* unmanaged[Cdecl]<void*, QUIC_CONGESTION_CONTROL_STATE*, ulong, byte, uint> GetSendAllowance;
+
+        [NativeTypeName("QUIC_CONGESTION_CONTROL_ON_DATA_SENT_FN")]
+        internal delegate* unmanaged[Cdecl]<void*, QUIC_CONGESTION_CONTROL_STATE*, uint, void> OnDataSent;
+
+        [NativeTypeName("QUIC_CONGESTION_CONTROL_ON_ECN_FN")]
+        internal delegate* unmanaged[Cdecl]<void*, QUIC_CONGESTION_CONTROL_STATE*, QUIC_CONGESTION_CONTROL_ECN*, void> OnEcn;
+
+        [NativeTypeName("QUIC_CONGESTION_CONTROL_ON_SPURIOUS_FN")]
+        internal delegate* unmanaged[Cdecl]<void*, QUIC_CONGESTION_CONTROL_STATE*, void> OnSpuriousCongestionEvent;
+    }
+
     internal unsafe partial struct QUIC_SCHANNEL_CREDENTIAL_ATTRIBUTE_W
     {
         [NativeTypeName("unsigned long")]
@@ -2651,6 +3241,8 @@ namespace Microsoft.Quic
         RELIABLE_RESET_NEGOTIATED = 16,
         ONE_WAY_DELAY_NEGOTIATED = 17,
         NETWORK_STATISTICS = 18,
+        SEND_BUFFER_PRESSURE = 19,
+        DATAGRAMS_RECEIVED = 20,
     }
 
     internal partial struct QUIC_CONNECTION_EVENT
@@ -2812,6 +3404,22 @@ namespace Microsoft.Quic
             }
         }
 
+        internal ref _Anonymous_e__Union._SEND_BUFFER_PRESSURE_e__Struct SEND_BUFFER_PRESSURE
+        {
+            get
+            {
+                return ref MemoryMarshal.GetReference(MemoryMarshal.CreateSpan(ref Anonymous.SEND_BUFFER_PRESSURE, 1));
+            }
+        }
+
+        internal ref _Anonymous_e__Union._DATAGRAMS_RECEIVED_e__Struct DATAGRAMS_RECEIVED
+        {
+            get
+            {
+                return ref MemoryMarshal.GetReference(MemoryMarshal.CreateSpan(ref Anonymous.DATAGRAMS_RECEIVED, 1));
+            }
+        }
+
         [StructLayout(LayoutKind.Explicit)]
         internal partial struct _Anonymous_e__Union
         {
@@ -2890,6 +3498,14 @@ namespace Microsoft.Quic
             [FieldOffset(0)]
             internal QUIC_NETWORK_STATISTICS NETWORK_STATISTICS;
 
+            [FieldOffset(0)]
+            [NativeTypeName("struct (anonymous struct)")]
+            internal _SEND_BUFFER_PRESSURE_e__Struct SEND_BUFFER_PRESSURE;
+
+            [FieldOffset(0)]
+            [NativeTypeName("struct (anonymous struct)")]
+            internal _DATAGRAMS_RECEIVED_e__Struct DATAGRAMS_RECEIVED;
+
             internal unsafe partial struct _CONNECTED_e__Struct
             {
                 [NativeTypeName("BOOLEAN")]
@@ -3079,6 +3695,26 @@ namespace Microsoft.Quic
                 [NativeTypeName("BOOLEAN")]
                 internal byte ReceiveNegotiated;
             }
+
+            internal partial struct _SEND_BUFFER_PRESSURE_e__Struct
+            {
+                [NativeTypeName("BOOLEAN")]
+                internal byte Paused;
+
+                [NativeTypeName("uint64_t")]
+                internal ulong BufferLimit;
+            }
+
+            internal unsafe partial struct _DATAGRAMS_RECEIVED_e__Struct
+            {
+                [NativeTypeName("const QUIC_BUFFER *")]
+                internal QUIC_BUFFER* Buffers;
+
+                [NativeTypeName("uint32_t")]
+                internal uint BufferCount;
+
+                internal QUIC_RECEIVE_FLAGS Flags;
+            }
         }
     }
 
@@ -3400,6 +4036,25 @@ namespace Microsoft.Quic
         }
     }
 
+    internal unsafe partial struct QUIC_DATAGRAM_SEND_INFO
+    {
+        [NativeTypeName("const QUIC_BUFFER *")]
+        internal QUIC_BUFFER* Buffers;
+
+        [NativeTypeName("uint32_t")]
+        internal uint BufferCount;
+
+        internal QUIC_SEND_FLAGS Flags;
+
+        [NativeTypeName("uint8_t")]
+        internal byte PriorityClass;
+
+        [NativeTypeName("uint32_t")]
+        internal uint LifetimeMs;
+
+        internal void* ClientSendContext;
+    }
+
     [System.Flags]
     internal enum QUIC_CONNECTION_POOL_FLAGS
     {
@@ -3559,6 +4214,9 @@ namespace Microsoft.Quic
 
         [NativeTypeName("QUIC_REGISTRATION_CLOSE2_FN")]
         internal delegate* unmanaged[Cdecl]<QUIC_HANDLE*, delegate* unmanaged[Cdecl]<void*, void>, void*, void> RegistrationClose2;
+
+        [NativeTypeName("QUIC_DATAGRAM_SEND_BATCH_FN")]
+        internal delegate* unmanaged[Cdecl]<QUIC_HANDLE*, QUIC_DATAGRAM_SEND_INFO*, uint, int> DatagramSendBatch;
     }
 
     internal static unsafe partial class MsQuic
@@ -3660,6 +4318,18 @@ namespace Microsoft.Quic
         [NativeTypeName("#define QUIC_PARAM_GLOBAL_STATELESS_RETRY_CONFIG 0x0100000D")]
         internal const uint QUIC_PARAM_GLOBAL_STATELESS_RETRY_CONFIG = 0x0100000D;
 
+        [NativeTypeName("#define QUIC_PARAM_GLOBAL_SEND_BUFFER_BUDGET 0x0100000E")]
+        internal const uint QUIC_PARAM_GLOBAL_SEND_BUFFER_BUDGET = 0x0100000E;
+
+        [NativeTypeName("#define QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT 0x0100000F")]
+        internal const uint QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT = 0x0100000F;
+
+        [NativeTypeName("#define QUIC_PARAM_GLOBAL_CONGESTION_CONTROL_PROVIDER 0x01000010")]
+        internal const uint QUIC_PARAM_GLOBAL_CONGESTION_CONTROL_PROVIDER = 0x01000010;
+
+        [NativeTypeName("#define QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET 0x02000001")]
+        internal const uint QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET = 0x02000001;
+
         [NativeTypeName("#define QUIC_PARAM_CONFIGURATION_SETTINGS 0x03000000")]
         internal const uint QUIC_PARAM_CONFIGURATION_SETTINGS = 0x03000000;
 
@@ -3804,6 +4474,9 @@ namespace Microsoft.Quic
         [NativeTypeName("#define QUIC_PARAM_STREAM_RELIABLE_OFFSET 0x08000005")]
         internal const uint QUIC_PARAM_STREAM_RELIABLE_OFFSET = 0x08000005;
 
+        [NativeTypeName("#define QUIC_DATAGRAM_PRIORITY_CLASS_MAX 3")]
+        internal const uint QUIC_DATAGRAM_PRIORITY_CLASS_MAX = 3;
+
         [NativeTypeName("#define QUIC_API_VERSION_2 2")]
         internal const uint QUIC_API_VERSION_2 = 2;
     }
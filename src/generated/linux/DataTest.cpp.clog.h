@@ -1,9 +1,46 @@
 #ifndef CLOG_DO_NOT_INCLUDE_HEADER
 #include <clog.h>
 #endif
+#undef TRACEPOINT_PROVIDER
+#define TRACEPOINT_PROVIDER CLOG_DATATEST_CPP
+#undef TRACEPOINT_PROBE_DYNAMIC_LINKAGE
+#define  TRACEPOINT_PROBE_DYNAMIC_LINKAGE
+#undef TRACEPOINT_INCLUDE
+#define TRACEPOINT_INCLUDE "DataTest.cpp.clog.h.lttng.h"
+#if !defined(DEF_CLOG_DATATEST_CPP) || defined(TRACEPOINT_HEADER_MULTI_READ)
+#define DEF_CLOG_DATATEST_CPP
+#include <lttng/tracepoint.h>
+#define __int64 __int64_t
+#include "DataTest.cpp.clog.h.lttng.h"
+#endif
+#include <lttng/tracepoint-event.h>
+#ifndef _clog_MACRO_QuicTraceLogInfo
+#define _clog_MACRO_QuicTraceLogInfo  1
+#define QuicTraceLogInfo(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
+/*----------------------------------------------------------
+// Decoder Ring for TestAckFrequencyAckFrames
+// [test] ACK frames received: %llu default, %llu adaptive
+// QuicTraceLogInfo(
+        TestAckFrequencyAckFrames,
+        "[test] ACK frames received: %llu default, %llu adaptive",
+        (unsigned long long)DefaultAckFrames,
+        (unsigned long long)AdaptiveAckFrames);
+// arg2 = arg2 = (unsigned long long)DefaultAckFrames = arg2
+// arg3 = arg3 = (unsigned long long)AdaptiveAckFrames = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_TestAckFrequencyAckFrames
+#define _clog_4_ARGS_TRACE_TestAckFrequencyAckFrames(uniqueId, encoded_arg_string, arg2, arg3)\
+tracepoint(CLOG_DATATEST_CPP, TestAckFrequencyAckFrames , arg2, arg3);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,23 @@
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for TestAckFrequencyAckFrames
+// [test] ACK frames received: %llu default, %llu adaptive
+// QuicTraceLogInfo(
+        TestAckFrequencyAckFrames,
+        "[test] ACK frames received: %llu default, %llu adaptive",
+        (unsigned long long)DefaultAckFrames,
+        (unsigned long long)AdaptiveAckFrames);
+// arg2 = arg2 = (unsigned long long)DefaultAckFrames = arg2
+// arg3 = arg3 = (unsigned long long)AdaptiveAckFrames = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_DATATEST_CPP, TestAckFrequencyAckFrames,
+    TP_ARGS(
+        unsigned long long, arg2,
+        unsigned long long, arg3), 
+    TP_FIELDS(
+        ctf_integer(uint64_t, arg2, arg2)
+        ctf_integer(uint64_t, arg3, arg3)
+    )
+)
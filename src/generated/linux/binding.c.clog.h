@@ -33,11 +33,11 @@ extern "C" {
 // Decoder Ring for BindingListenerAlreadyRegistered
 // [bind][%p] Listener (%p) already registered on ALPN
 // QuicTraceLogWarning(
-                BindingListenerAlreadyRegistered,
-                "[bind][%p] Listener (%p) already registered on ALPN",
-                Binding, ExistingListener);
+                    BindingListenerAlreadyRegistered,
+                    "[bind][%p] Listener (%p) already registered on ALPN",
+                    Binding, ExistingEntry->Listener);
 // arg2 = arg2 = Binding = arg2
-// arg3 = arg3 = ExistingListener = arg3
+// arg3 = arg3 = ExistingEntry->Listener = arg3
 ----------------------------------------------------------*/
 #ifndef _clog_4_ARGS_TRACE_BindingListenerAlreadyRegistered
 #define _clog_4_ARGS_TRACE_BindingListenerAlreadyRegistered(uniqueId, encoded_arg_string, arg2, arg3)\
@@ -5,11 +5,11 @@
 // Decoder Ring for BindingListenerAlreadyRegistered
 // [bind][%p] Listener (%p) already registered on ALPN
 // QuicTraceLogWarning(
-                BindingListenerAlreadyRegistered,
-                "[bind][%p] Listener (%p) already registered on ALPN",
-                Binding, ExistingListener);
+                    BindingListenerAlreadyRegistered,
+                    "[bind][%p] Listener (%p) already registered on ALPN",
+                    Binding, ExistingEntry->Listener);
 // arg2 = arg2 = Binding = arg2
-// arg3 = arg3 = ExistingListener = arg3
+// arg3 = arg3 = ExistingEntry->Listener = arg3
 ----------------------------------------------------------*/
 TRACEPOINT_EVENT(CLOG_BINDING_C, BindingListenerAlreadyRegistered,
     TP_ARGS(
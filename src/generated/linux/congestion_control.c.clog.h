@@ -41,6 +41,24 @@ tracepoint(CLOG_CONGESTION_CONTROL_C, InvalidCongestionControlAlgorithm , arg1,
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for CustomCongestionControlUnavailable
+// [conn][%p] Custom congestion control unavailable, fallback to Cubic
+// QuicTraceLogConnWarning(
+            CustomCongestionControlUnavailable,
+            QuicCongestionControlGetConnection(Cc),
+            "Custom congestion control unavailable, fallback to Cubic");
+// arg1 = arg1 = QuicCongestionControlGetConnection(Cc) = arg1
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_CustomCongestionControlUnavailable
+#define _clog_3_ARGS_TRACE_CustomCongestionControlUnavailable(uniqueId, arg1, encoded_arg_string)\
+tracepoint(CLOG_CONGESTION_CONTROL_C, CustomCongestionControlUnavailable , arg1);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,3 +21,22 @@ TRACEPOINT_EVENT(CLOG_CONGESTION_CONTROL_C, InvalidCongestionControlAlgorithm,
         ctf_integer(unsigned short, arg3, arg3)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for CustomCongestionControlUnavailable
+// [conn][%p] Custom congestion control unavailable, fallback to Cubic
+// QuicTraceLogConnWarning(
+            CustomCongestionControlUnavailable,
+            QuicCongestionControlGetConnection(Cc),
+            "Custom congestion control unavailable, fallback to Cubic");
+// arg1 = arg1 = QuicCongestionControlGetConnection(Cc) = arg1
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_CONGESTION_CONTROL_C, CustomCongestionControlUnavailable,
+    TP_ARGS(
+        const void *, arg1), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+    )
+)
@@ -2201,6 +2201,28 @@ tracepoint(CLOG_CONNECTION_C, ConnLocalAddrRemoved , arg2, arg3_len, arg3);\
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for UpdatePeerAckFrequency
+// [conn][%p] Updating peer ACK frequency to %hhu packets, %u ms
+// QuicTraceLogConnInfo(
+            UpdatePeerAckFrequency,
+            Connection,
+            "Updating peer ACK frequency to %hhu packets, %u ms",
+            NewPacketTolerance,
+            NewMaxAckDelayMs);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = NewPacketTolerance = arg3
+// arg4 = arg4 = NewMaxAckDelayMs = arg4
+----------------------------------------------------------*/
+#ifndef _clog_5_ARGS_TRACE_UpdatePeerAckFrequency
+#define _clog_5_ARGS_TRACE_UpdatePeerAckFrequency(uniqueId, arg1, encoded_arg_string, arg3, arg4)\
+tracepoint(CLOG_CONNECTION_C, UpdatePeerAckFrequency , arg1, arg3, arg4);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
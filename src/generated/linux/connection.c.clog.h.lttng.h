@@ -2482,3 +2482,30 @@ TRACEPOINT_EVENT(CLOG_CONNECTION_C, ConnLocalAddrRemoved,
         ctf_sequence(char, arg3, arg3, unsigned int, arg3_len)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for UpdatePeerAckFrequency
+// [conn][%p] Updating peer ACK frequency to %hhu packets, %u ms
+// QuicTraceLogConnInfo(
+            UpdatePeerAckFrequency,
+            Connection,
+            "Updating peer ACK frequency to %hhu packets, %u ms",
+            NewPacketTolerance,
+            NewMaxAckDelayMs);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = NewPacketTolerance = arg3
+// arg4 = arg4 = NewMaxAckDelayMs = arg4
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_CONNECTION_C, UpdatePeerAckFrequency,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned char, arg3,
+        unsigned int, arg4), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(unsigned char, arg3, arg3)
+        ctf_integer(unsigned int, arg4, arg4)
+    )
+)
@@ -601,6 +601,46 @@ tracepoint(CLOG_CRYPTO_C, ConnKeyPhaseChange , arg2, arg3);\
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for TlsOffloadStart
+// [conn][%p] Offloading %u bytes of TLS data
+// QuicTraceLogConnVerbose(
+        TlsOffloadStart,
+        Connection,
+        "Offloading %u bytes of TLS data",
+        Buffer.Length);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Buffer.Length = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_TlsOffloadStart
+#define _clog_4_ARGS_TRACE_TlsOffloadStart(uniqueId, arg1, encoded_arg_string, arg3)\
+tracepoint(CLOG_CRYPTO_C, TlsOffloadStart , arg1, arg3);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for TlsOffloadComplete
+// [conn][%p] TLS offload complete, %u bytes consumed
+// QuicTraceLogConnVerbose(
+        TlsOffloadComplete,
+        QuicCryptoGetConnection(Crypto),
+        "TLS offload complete, %u bytes consumed",
+        Crypto->TlsOffloadBufferLength);
+// arg1 = arg1 = QuicCryptoGetConnection(Crypto) = arg1
+// arg3 = arg3 = Crypto->TlsOffloadBufferLength = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_TlsOffloadComplete
+#define _clog_4_ARGS_TRACE_TlsOffloadComplete(uniqueId, arg1, encoded_arg_string, arg3)\
+tracepoint(CLOG_CRYPTO_C, TlsOffloadComplete , arg1, arg3);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
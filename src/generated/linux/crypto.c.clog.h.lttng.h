@@ -660,3 +660,49 @@ TRACEPOINT_EVENT(CLOG_CRYPTO_C, ConnKeyPhaseChange,
         ctf_integer(unsigned char, arg3, arg3)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for TlsOffloadStart
+// [conn][%p] Offloading %u bytes of TLS data
+// QuicTraceLogConnVerbose(
+        TlsOffloadStart,
+        Connection,
+        "Offloading %u bytes of TLS data",
+        Buffer.Length);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Buffer.Length = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_CRYPTO_C, TlsOffloadStart,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned int, arg3), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(unsigned int, arg3, arg3)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for TlsOffloadComplete
+// [conn][%p] TLS offload complete, %u bytes consumed
+// QuicTraceLogConnVerbose(
+        TlsOffloadComplete,
+        QuicCryptoGetConnection(Crypto),
+        "TLS offload complete, %u bytes consumed",
+        Crypto->TlsOffloadBufferLength);
+// arg1 = arg1 = QuicCryptoGetConnection(Crypto) = arg1
+// arg3 = arg3 = Crypto->TlsOffloadBufferLength = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_CRYPTO_C, TlsOffloadComplete,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned int, arg3), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(unsigned int, arg3, arg3)
+    )
+)
@@ -0,0 +1,71 @@
+#ifndef CLOG_DO_NOT_INCLUDE_HEADER
+#include <clog.h>
+#endif
+#undef TRACEPOINT_PROVIDER
+#define TRACEPOINT_PROVIDER CLOG_CRYPTO_POOL_C
+#undef TRACEPOINT_PROBE_DYNAMIC_LINKAGE
+#define  TRACEPOINT_PROBE_DYNAMIC_LINKAGE
+#undef TRACEPOINT_INCLUDE
+#define TRACEPOINT_INCLUDE "crypto_pool.c.clog.h.lttng.h"
+#if !defined(DEF_CLOG_CRYPTO_POOL_C) || defined(TRACEPOINT_HEADER_MULTI_READ)
+#define DEF_CLOG_CRYPTO_POOL_C
+#include <lttng/tracepoint.h>
+#define __int64 __int64_t
+#include "crypto_pool.c.clog.h.lttng.h"
+#endif
+#include <lttng/tracepoint-event.h>
+#ifndef _clog_MACRO_QuicTraceEvent
+#define _clog_MACRO_QuicTraceEvent  1
+#define QuicTraceEvent(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
+#endif
+#ifndef _clog_MACRO_QuicTraceLogInfo
+#define _clog_MACRO_QuicTraceLogInfo  1
+#define QuicTraceLogInfo(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*----------------------------------------------------------
+// Decoder Ring for LibraryErrorStatus
+// [ lib] ERROR, %u, %s.
+// QuicTraceEvent(
+                    LibraryErrorStatus,
+                    "[ lib] ERROR, %u, %s.",
+                    Status,
+                    "CxPlatThreadCreate (crypto pool)");
+// arg2 = arg2 = Status = arg2
+// arg3 = arg3 = "CxPlatThreadCreate (crypto pool)" = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_LibraryErrorStatus
+#define _clog_4_ARGS_TRACE_LibraryErrorStatus(uniqueId, encoded_arg_string, arg2, arg3)\
+tracepoint(CLOG_CRYPTO_POOL_C, LibraryErrorStatus , arg2, arg3);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for CryptoPoolStarted
+// [ lib] Crypto pool started with %u threads
+// QuicTraceLogInfo(
+                CryptoPoolStarted,
+                "[ lib] Crypto pool started with %u threads",
+                Pool->ThreadCount);
+// arg2 = arg2 = Pool->ThreadCount = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_CryptoPoolStarted
+#define _clog_3_ARGS_TRACE_CryptoPoolStarted(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_CRYPTO_POOL_C, CryptoPoolStarted , arg2);\
+
+#endif
+
+
+
+
+#ifdef __cplusplus
+}
+#endif
+#ifdef CLOG_INLINE_IMPLEMENTATION
+#include "quic.clog_crypto_pool.c.clog.h.c"
+#endif
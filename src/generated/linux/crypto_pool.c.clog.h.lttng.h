@@ -0,0 +1,42 @@
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for LibraryErrorStatus
+// [ lib] ERROR, %u, %s.
+// QuicTraceEvent(
+                    LibraryErrorStatus,
+                    "[ lib] ERROR, %u, %s.",
+                    Status,
+                    "CxPlatThreadCreate (crypto pool)");
+// arg2 = arg2 = Status = arg2
+// arg3 = arg3 = "CxPlatThreadCreate (crypto pool)" = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_CRYPTO_POOL_C, LibraryErrorStatus,
+    TP_ARGS(
+        unsigned int, arg2,
+        const char *, arg3), 
+    TP_FIELDS(
+        ctf_integer(unsigned int, arg2, arg2)
+        ctf_string(arg3, arg3)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for CryptoPoolStarted
+// [ lib] Crypto pool started with %u threads
+// QuicTraceLogInfo(
+                CryptoPoolStarted,
+                "[ lib] Crypto pool started with %u threads",
+                Pool->ThreadCount);
+// arg2 = arg2 = Pool->ThreadCount = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_CRYPTO_POOL_C, CryptoPoolStarted,
+    TP_ARGS(
+        unsigned int, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned int, arg2, arg2)
+    )
+)
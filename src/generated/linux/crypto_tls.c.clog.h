@@ -1233,6 +1233,42 @@ tracepoint(CLOG_CRYPTO_TLS_C, ConnErrorStatus , arg2, arg3, arg4);\
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for EncodeTPDatagramFec
+// [conn][%p] TP: Datagram FEC
+// QuicTraceLogConnVerbose(
+            EncodeTPDatagramFec,
+            Connection,
+            "TP: Datagram FEC");
+// arg1 = arg1 = Connection = arg1
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_EncodeTPDatagramFec
+#define _clog_3_ARGS_TRACE_EncodeTPDatagramFec(uniqueId, arg1, encoded_arg_string)\
+tracepoint(CLOG_CRYPTO_TLS_C, EncodeTPDatagramFec , arg1);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for DecodeTPDatagramFec
+// [conn][%p] TP: Datagram FEC
+// QuicTraceLogConnVerbose(
+                DecodeTPDatagramFec,
+                Connection,
+                "TP: Datagram FEC");
+// arg1 = arg1 = Connection = arg1
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_DecodeTPDatagramFec
+#define _clog_3_ARGS_TRACE_DecodeTPDatagramFec(uniqueId, arg1, encoded_arg_string)\
+tracepoint(CLOG_CRYPTO_TLS_C, DecodeTPDatagramFec , arg1);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -1371,3 +1371,41 @@ TRACEPOINT_EVENT(CLOG_CRYPTO_TLS_C, ConnErrorStatus,
         ctf_string(arg4, arg4)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for EncodeTPDatagramFec
+// [conn][%p] TP: Datagram FEC
+// QuicTraceLogConnVerbose(
+            EncodeTPDatagramFec,
+            Connection,
+            "TP: Datagram FEC");
+// arg1 = arg1 = Connection = arg1
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_CRYPTO_TLS_C, EncodeTPDatagramFec,
+    TP_ARGS(
+        const void *, arg1), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for DecodeTPDatagramFec
+// [conn][%p] TP: Datagram FEC
+// QuicTraceLogConnVerbose(
+                DecodeTPDatagramFec,
+                Connection,
+                "TP: Datagram FEC");
+// arg1 = arg1 = Connection = arg1
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_CRYPTO_TLS_C, DecodeTPDatagramFec,
+    TP_ARGS(
+        const void *, arg1), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+    )
+)
@@ -169,6 +169,114 @@ tracepoint(CLOG_DATAGRAM_C, AllocFailure , arg2, arg3);\
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for DatagramFecSendEnabled
+// [conn][%p] Datagram FEC send enabled = %hhu
+// QuicTraceLogConnVerbose(
+            DatagramFecSendEnabled,
+            Connection,
+            "Datagram FEC send enabled = %hhu",
+            FecSendEnabled);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = FecSendEnabled = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_DatagramFecSendEnabled
+#define _clog_4_ARGS_TRACE_DatagramFecSendEnabled(uniqueId, arg1, encoded_arg_string, arg3)\
+tracepoint(CLOG_DATAGRAM_C, DatagramFecSendEnabled , arg1, arg3);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for DatagramFecRepairSent
+// [conn][%p] Sent datagram FEC repair for group %hu (%hhu datagrams, %hu bytes)
+// QuicTraceLogConnVerbose(
+        DatagramFecRepairSent,
+        Connection,
+        "Sent datagram FEC repair for group %hu (%hhu datagrams, %hu bytes)",
+        Encoder->Group,
+        Encoder->Count,
+        Encoder->Length);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Encoder->Group = arg3
+// arg4 = arg4 = Encoder->Count = arg4
+// arg5 = arg5 = Encoder->Length = arg5
+----------------------------------------------------------*/
+#ifndef _clog_6_ARGS_TRACE_DatagramFecRepairSent
+#define _clog_6_ARGS_TRACE_DatagramFecRepairSent(uniqueId, arg1, encoded_arg_string, arg3, arg4, arg5)\
+tracepoint(CLOG_DATAGRAM_C, DatagramFecRepairSent , arg1, arg3, arg4, arg5);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for DatagramFecRecovered
+// [conn][%p] Recovered datagram from FEC group %hu [len=%hu]
+// QuicTraceLogConnVerbose(
+        DatagramFecRecovered,
+        Connection,
+        "Recovered datagram from FEC group %hu [len=%hu]",
+        Group->Group,
+        Group->LengthXor);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Group->Group = arg3
+// arg4 = arg4 = Group->LengthXor = arg4
+----------------------------------------------------------*/
+#ifndef _clog_5_ARGS_TRACE_DatagramFecRecovered
+#define _clog_5_ARGS_TRACE_DatagramFecRecovered(uniqueId, arg1, encoded_arg_string, arg3, arg4)\
+tracepoint(CLOG_DATAGRAM_C, DatagramFecRecovered , arg1, arg3, arg4);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for DatagramSendExpired
+// [conn][%p] Datagram [%p] expired before it was sent
+// QuicTraceLogConnVerbose(
+        DatagramSendExpired,
+        Connection,
+        "Datagram [%p] expired before it was sent",
+        SendRequest);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = SendRequest = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_DatagramSendExpired
+#define _clog_4_ARGS_TRACE_DatagramSendExpired(uniqueId, arg1, encoded_arg_string, arg3)\
+tracepoint(CLOG_DATAGRAM_C, DatagramSendExpired , arg1, arg3);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for IndicateDatagramsReceived
+// [conn][%p] Indicating DATAGRAMS_RECEIVED [count=%u, len=%llu]
+// QuicTraceLogConnVerbose(
+        IndicateDatagramsReceived,
+        Connection,
+        "Indicating DATAGRAMS_RECEIVED [count=%u, len=%llu]",
+        Event.DATAGRAMS_RECEIVED.BufferCount,
+        TotalLength);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Event.DATAGRAMS_RECEIVED.BufferCount = arg3
+// arg4 = arg4 = TotalLength = arg4
+----------------------------------------------------------*/
+#ifndef _clog_5_ARGS_TRACE_IndicateDatagramsReceived
+#define _clog_5_ARGS_TRACE_IndicateDatagramsReceived(uniqueId, arg1, encoded_arg_string, arg3, arg4)\
+tracepoint(CLOG_DATAGRAM_C, IndicateDatagramsReceived , arg1, arg3, arg4);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
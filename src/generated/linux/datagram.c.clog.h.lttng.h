@@ -167,3 +167,134 @@ TRACEPOINT_EVENT(CLOG_DATAGRAM_C, AllocFailure,
         ctf_integer(uint64_t, arg3, arg3)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for DatagramFecSendEnabled
+// [conn][%p] Datagram FEC send enabled = %hhu
+// QuicTraceLogConnVerbose(
+            DatagramFecSendEnabled,
+            Connection,
+            "Datagram FEC send enabled = %hhu",
+            FecSendEnabled);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = FecSendEnabled = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_DATAGRAM_C, DatagramFecSendEnabled,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned char, arg3), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(unsigned char, arg3, arg3)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for DatagramFecRepairSent
+// [conn][%p] Sent datagram FEC repair for group %hu (%hhu datagrams, %hu bytes)
+// QuicTraceLogConnVerbose(
+        DatagramFecRepairSent,
+        Connection,
+        "Sent datagram FEC repair for group %hu (%hhu datagrams, %hu bytes)",
+        Encoder->Group,
+        Encoder->Count,
+        Encoder->Length);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Encoder->Group = arg3
+// arg4 = arg4 = Encoder->Count = arg4
+// arg5 = arg5 = Encoder->Length = arg5
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_DATAGRAM_C, DatagramFecRepairSent,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned short, arg3,
+        unsigned char, arg4,
+        unsigned short, arg5), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(unsigned short, arg3, arg3)
+        ctf_integer(unsigned char, arg4, arg4)
+        ctf_integer(unsigned short, arg5, arg5)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for DatagramFecRecovered
+// [conn][%p] Recovered datagram from FEC group %hu [len=%hu]
+// QuicTraceLogConnVerbose(
+        DatagramFecRecovered,
+        Connection,
+        "Recovered datagram from FEC group %hu [len=%hu]",
+        Group->Group,
+        Group->LengthXor);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Group->Group = arg3
+// arg4 = arg4 = Group->LengthXor = arg4
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_DATAGRAM_C, DatagramFecRecovered,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned short, arg3,
+        unsigned short, arg4), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(unsigned short, arg3, arg3)
+        ctf_integer(unsigned short, arg4, arg4)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for DatagramSendExpired
+// [conn][%p] Datagram [%p] expired before it was sent
+// QuicTraceLogConnVerbose(
+        DatagramSendExpired,
+        Connection,
+        "Datagram [%p] expired before it was sent",
+        SendRequest);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = SendRequest = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_DATAGRAM_C, DatagramSendExpired,
+    TP_ARGS(
+        const void *, arg1,
+        const void *, arg3), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer_hex(uint64_t, arg3, (uint64_t)arg3)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for IndicateDatagramsReceived
+// [conn][%p] Indicating DATAGRAMS_RECEIVED [count=%u, len=%llu]
+// QuicTraceLogConnVerbose(
+        IndicateDatagramsReceived,
+        Connection,
+        "Indicating DATAGRAMS_RECEIVED [count=%u, len=%llu]",
+        Event.DATAGRAMS_RECEIVED.BufferCount,
+        TotalLength);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Event.DATAGRAMS_RECEIVED.BufferCount = arg3
+// arg4 = arg4 = TotalLength = arg4
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_DATAGRAM_C, IndicateDatagramsReceived,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned int, arg3,
+        unsigned long long, arg4), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(unsigned int, arg3, arg3)
+        ctf_integer(uint64_t, arg4, arg4)
+    )
+)
@@ -1341,6 +1341,106 @@ tracepoint(CLOG_FRAME_C, ConnError , arg2, arg3);\
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for FrameLogDatagramFecSourceInvalid
+// [%c][%cX][%llu]   DATAGRAM_FEC_SOURCE [Invalid]
+// QuicTraceLogVerbose(
+                FrameLogDatagramFecSourceInvalid,
+                "[%c][%cX][%llu]   DATAGRAM_FEC_SOURCE [Invalid]",
+                PtkConnPre(Connection),
+                PktRxPre(Rx),
+                PacketNumber);
+// arg2 = arg2 = PtkConnPre(Connection) = arg2
+// arg3 = arg3 = PktRxPre(Rx) = arg3
+// arg4 = arg4 = PacketNumber = arg4
+----------------------------------------------------------*/
+#ifndef _clog_5_ARGS_TRACE_FrameLogDatagramFecSourceInvalid
+#define _clog_5_ARGS_TRACE_FrameLogDatagramFecSourceInvalid(uniqueId, encoded_arg_string, arg2, arg3, arg4)\
+tracepoint(CLOG_FRAME_C, FrameLogDatagramFecSourceInvalid , arg2, arg3, arg4);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for FrameLogDatagramFecSource
+// [%c][%cX][%llu]   DATAGRAM_FEC_SOURCE Group:%llu Index:%llu Len:%hu
+// QuicTraceLogVerbose(
+            FrameLogDatagramFecSource,
+            "[%c][%cX][%llu]   DATAGRAM_FEC_SOURCE Group:%llu Index:%llu Len:%hu",
+            PtkConnPre(Connection),
+            PktRxPre(Rx),
+            PacketNumber,
+            Frame.Group,
+            Frame.Index,
+            (uint16_t)Frame.Length);
+// arg2 = arg2 = PtkConnPre(Connection) = arg2
+// arg3 = arg3 = PktRxPre(Rx) = arg3
+// arg4 = arg4 = PacketNumber = arg4
+// arg5 = arg5 = Frame.Group = arg5
+// arg6 = arg6 = Frame.Index = arg6
+// arg7 = arg7 = (uint16_t)Frame.Length = arg7
+----------------------------------------------------------*/
+#ifndef _clog_8_ARGS_TRACE_FrameLogDatagramFecSource
+#define _clog_8_ARGS_TRACE_FrameLogDatagramFecSource(uniqueId, encoded_arg_string, arg2, arg3, arg4, arg5, arg6, arg7)\
+tracepoint(CLOG_FRAME_C, FrameLogDatagramFecSource , arg2, arg3, arg4, arg5, arg6, arg7);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for FrameLogDatagramFecRepairInvalid
+// [%c][%cX][%llu]   DATAGRAM_FEC_REPAIR [Invalid]
+// QuicTraceLogVerbose(
+                FrameLogDatagramFecRepairInvalid,
+                "[%c][%cX][%llu]   DATAGRAM_FEC_REPAIR [Invalid]",
+                PtkConnPre(Connection),
+                PktRxPre(Rx),
+                PacketNumber);
+// arg2 = arg2 = PtkConnPre(Connection) = arg2
+// arg3 = arg3 = PktRxPre(Rx) = arg3
+// arg4 = arg4 = PacketNumber = arg4
+----------------------------------------------------------*/
+#ifndef _clog_5_ARGS_TRACE_FrameLogDatagramFecRepairInvalid
+#define _clog_5_ARGS_TRACE_FrameLogDatagramFecRepairInvalid(uniqueId, encoded_arg_string, arg2, arg3, arg4)\
+tracepoint(CLOG_FRAME_C, FrameLogDatagramFecRepairInvalid , arg2, arg3, arg4);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for FrameLogDatagramFecRepair
+// [%c][%cX][%llu]   DATAGRAM_FEC_REPAIR Group:%llu Count:%llu Len:%hu
+// QuicTraceLogVerbose(
+            FrameLogDatagramFecRepair,
+            "[%c][%cX][%llu]   DATAGRAM_FEC_REPAIR Group:%llu Count:%llu Len:%hu",
+            PtkConnPre(Connection),
+            PktRxPre(Rx),
+            PacketNumber,
+            Frame.Group,
+            Frame.Count,
+            (uint16_t)Frame.Length);
+// arg2 = arg2 = PtkConnPre(Connection) = arg2
+// arg3 = arg3 = PktRxPre(Rx) = arg3
+// arg4 = arg4 = PacketNumber = arg4
+// arg5 = arg5 = Frame.Group = arg5
+// arg6 = arg6 = Frame.Count = arg6
+// arg7 = arg7 = (uint16_t)Frame.Length = arg7
+----------------------------------------------------------*/
+#ifndef _clog_8_ARGS_TRACE_FrameLogDatagramFecRepair
+#define _clog_8_ARGS_TRACE_FrameLogDatagramFecRepair(uniqueId, encoded_arg_string, arg2, arg3, arg4, arg5, arg6, arg7)\
+tracepoint(CLOG_FRAME_C, FrameLogDatagramFecRepair , arg2, arg3, arg4, arg5, arg6, arg7);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
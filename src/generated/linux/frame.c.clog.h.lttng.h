@@ -1695,3 +1695,135 @@ TRACEPOINT_EVENT(CLOG_FRAME_C, ConnError,
         ctf_string(arg3, arg3)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for FrameLogDatagramFecSourceInvalid
+// [%c][%cX][%llu]   DATAGRAM_FEC_SOURCE [Invalid]
+// QuicTraceLogVerbose(
+                FrameLogDatagramFecSourceInvalid,
+                "[%c][%cX][%llu]   DATAGRAM_FEC_SOURCE [Invalid]",
+                PtkConnPre(Connection),
+                PktRxPre(Rx),
+                PacketNumber);
+// arg2 = arg2 = PtkConnPre(Connection) = arg2
+// arg3 = arg3 = PktRxPre(Rx) = arg3
+// arg4 = arg4 = PacketNumber = arg4
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_FRAME_C, FrameLogDatagramFecSourceInvalid,
+    TP_ARGS(
+        unsigned char, arg2,
+        unsigned char, arg3,
+        unsigned long long, arg4), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+        ctf_integer(unsigned char, arg3, arg3)
+        ctf_integer(uint64_t, arg4, arg4)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for FrameLogDatagramFecSource
+// [%c][%cX][%llu]   DATAGRAM_FEC_SOURCE Group:%llu Index:%llu Len:%hu
+// QuicTraceLogVerbose(
+            FrameLogDatagramFecSource,
+            "[%c][%cX][%llu]   DATAGRAM_FEC_SOURCE Group:%llu Index:%llu Len:%hu",
+            PtkConnPre(Connection),
+            PktRxPre(Rx),
+            PacketNumber,
+            Frame.Group,
+            Frame.Index,
+            (uint16_t)Frame.Length);
+// arg2 = arg2 = PtkConnPre(Connection) = arg2
+// arg3 = arg3 = PktRxPre(Rx) = arg3
+// arg4 = arg4 = PacketNumber = arg4
+// arg5 = arg5 = Frame.Group = arg5
+// arg6 = arg6 = Frame.Index = arg6
+// arg7 = arg7 = (uint16_t)Frame.Length = arg7
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_FRAME_C, FrameLogDatagramFecSource,
+    TP_ARGS(
+        unsigned char, arg2,
+        unsigned char, arg3,
+        unsigned long long, arg4,
+        unsigned long long, arg5,
+        unsigned long long, arg6,
+        unsigned short, arg7), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+        ctf_integer(unsigned char, arg3, arg3)
+        ctf_integer(uint64_t, arg4, arg4)
+        ctf_integer(uint64_t, arg5, arg5)
+        ctf_integer(uint64_t, arg6, arg6)
+        ctf_integer(unsigned short, arg7, arg7)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for FrameLogDatagramFecRepairInvalid
+// [%c][%cX][%llu]   DATAGRAM_FEC_REPAIR [Invalid]
+// QuicTraceLogVerbose(
+                FrameLogDatagramFecRepairInvalid,
+                "[%c][%cX][%llu]   DATAGRAM_FEC_REPAIR [Invalid]",
+                PtkConnPre(Connection),
+                PktRxPre(Rx),
+                PacketNumber);
+// arg2 = arg2 = PtkConnPre(Connection) = arg2
+// arg3 = arg3 = PktRxPre(Rx) = arg3
+// arg4 = arg4 = PacketNumber = arg4
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_FRAME_C, FrameLogDatagramFecRepairInvalid,
+    TP_ARGS(
+        unsigned char, arg2,
+        unsigned char, arg3,
+        unsigned long long, arg4), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+        ctf_integer(unsigned char, arg3, arg3)
+        ctf_integer(uint64_t, arg4, arg4)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for FrameLogDatagramFecRepair
+// [%c][%cX][%llu]   DATAGRAM_FEC_REPAIR Group:%llu Count:%llu Len:%hu
+// QuicTraceLogVerbose(
+            FrameLogDatagramFecRepair,
+            "[%c][%cX][%llu]   DATAGRAM_FEC_REPAIR Group:%llu Count:%llu Len:%hu",
+            PtkConnPre(Connection),
+            PktRxPre(Rx),
+            PacketNumber,
+            Frame.Group,
+            Frame.Count,
+            (uint16_t)Frame.Length);
+// arg2 = arg2 = PtkConnPre(Connection) = arg2
+// arg3 = arg3 = PktRxPre(Rx) = arg3
+// arg4 = arg4 = PacketNumber = arg4
+// arg5 = arg5 = Frame.Group = arg5
+// arg6 = arg6 = Frame.Count = arg6
+// arg7 = arg7 = (uint16_t)Frame.Length = arg7
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_FRAME_C, FrameLogDatagramFecRepair,
+    TP_ARGS(
+        unsigned char, arg2,
+        unsigned char, arg3,
+        unsigned long long, arg4,
+        unsigned long long, arg5,
+        unsigned long long, arg6,
+        unsigned short, arg7), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+        ctf_integer(unsigned char, arg3, arg3)
+        ctf_integer(uint64_t, arg4, arg4)
+        ctf_integer(uint64_t, arg5, arg5)
+        ctf_integer(uint64_t, arg6, arg6)
+        ctf_integer(unsigned short, arg7, arg7)
+    )
+)
@@ -0,0 +1,129 @@
+#ifndef CLOG_DO_NOT_INCLUDE_HEADER
+#include <clog.h>
+#endif
+#undef TRACEPOINT_PROVIDER
+#define TRACEPOINT_PROVIDER CLOG_KEYSHARE_OPENSSL_C
+#undef TRACEPOINT_PROBE_DYNAMIC_LINKAGE
+#define  TRACEPOINT_PROBE_DYNAMIC_LINKAGE
+#undef TRACEPOINT_INCLUDE
+#define TRACEPOINT_INCLUDE "keyshare_openssl.c.clog.h.lttng.h"
+#if !defined(DEF_CLOG_KEYSHARE_OPENSSL_C) || defined(TRACEPOINT_HEADER_MULTI_READ)
+#define DEF_CLOG_KEYSHARE_OPENSSL_C
+#include <lttng/tracepoint.h>
+#define __int64 __int64_t
+#include "keyshare_openssl.c.clog.h.lttng.h"
+#endif
+#include <lttng/tracepoint-event.h>
+#ifndef _clog_MACRO_QuicTraceEvent
+#define _clog_MACRO_QuicTraceEvent  1
+#define QuicTraceEvent(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
+#endif
+#ifndef _clog_MACRO_QuicTraceLogInfo
+#define _clog_MACRO_QuicTraceLogInfo  1
+#define QuicTraceLogInfo(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*----------------------------------------------------------
+// Decoder Ring for KeySharePoolStopped
+// [ lib] Key share pool stopped, %llu hits, %llu misses
+// QuicTraceLogInfo(
+            KeySharePoolStopped,
+            "[ lib] Key share pool stopped, %llu hits, %llu misses",
+            Hits,
+            Misses);
+// arg2 = arg2 = Hits = arg2
+// arg3 = arg3 = Misses = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_KeySharePoolStopped
+#define _clog_4_ARGS_TRACE_KeySharePoolStopped(uniqueId, encoded_arg_string, arg2, arg3)\
+tracepoint(CLOG_KEYSHARE_OPENSSL_C, KeySharePoolStopped , arg2, arg3);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for AllocFailure
+// Allocation of '%s' failed. (%llu bytes)
+// QuicTraceEvent(
+            AllocFailure,
+            "Allocation of '%s' failed. (%llu bytes)",
+            "key share pool",
+            KeySharePool.ShardCount * sizeof(CXPLAT_KEY_SHARE_SHARD));
+// arg2 = arg2 = "key share pool" = arg2
+// arg3 = arg3 = KeySharePool.ShardCount * sizeof(CXPLAT_KEY_SHARE_SHARD) = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_AllocFailure
+#define _clog_4_ARGS_TRACE_AllocFailure(uniqueId, encoded_arg_string, arg2, arg3)\
+tracepoint(CLOG_KEYSHARE_OPENSSL_C, AllocFailure , arg2, arg3);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for KeySharePoolStarted
+// [ lib] Key share pool started with %u shards
+// QuicTraceLogInfo(
+        KeySharePoolStarted,
+        "[ lib] Key share pool started with %u shards",
+        KeySharePool.ShardCount);
+// arg2 = arg2 = KeySharePool.ShardCount = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_KeySharePoolStarted
+#define _clog_3_ARGS_TRACE_KeySharePoolStarted(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_KEYSHARE_OPENSSL_C, KeySharePoolStarted , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for LibraryErrorStatus
+// [ lib] ERROR, %u, %s.
+// QuicTraceEvent(
+                        LibraryErrorStatus,
+                        "[ lib] ERROR, %u, %s.",
+                        ERR_get_error(),
+                        "Key share generation failed");
+// arg2 = arg2 = ERR_get_error() = arg2
+// arg3 = arg3 = "Key share generation failed" = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_LibraryErrorStatus
+#define _clog_4_ARGS_TRACE_LibraryErrorStatus(uniqueId, encoded_arg_string, arg2, arg3)\
+tracepoint(CLOG_KEYSHARE_OPENSSL_C, LibraryErrorStatus , arg2, arg3);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for LibraryError
+// [ lib] ERROR, %s.
+// QuicTraceEvent(
+            LibraryError,
+            "[ lib] ERROR, %s.",
+            "OSSL_PROVIDER_query_operation(KEYMGMT) failed");
+// arg2 = arg2 = "OSSL_PROVIDER_query_operation(KEYMGMT) failed" = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_LibraryError
+#define _clog_3_ARGS_TRACE_LibraryError(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_KEYSHARE_OPENSSL_C, LibraryError , arg2);\
+
+#endif
+
+
+
+
+#ifdef __cplusplus
+}
+#endif
+#ifdef CLOG_INLINE_IMPLEMENTATION
+#include "quic.clog_keyshare_openssl.c.clog.h.c"
+#endif
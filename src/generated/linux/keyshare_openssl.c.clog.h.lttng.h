@@ -0,0 +1,107 @@
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for KeySharePoolStopped
+// [ lib] Key share pool stopped, %llu hits, %llu misses
+// QuicTraceLogInfo(
+            KeySharePoolStopped,
+            "[ lib] Key share pool stopped, %llu hits, %llu misses",
+            Hits,
+            Misses);
+// arg2 = arg2 = Hits = arg2
+// arg3 = arg3 = Misses = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_KEYSHARE_OPENSSL_C, KeySharePoolStopped,
+    TP_ARGS(
+        unsigned long long, arg2,
+        unsigned long long, arg3), 
+    TP_FIELDS(
+        ctf_integer(uint64_t, arg2, arg2)
+        ctf_integer(uint64_t, arg3, arg3)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for AllocFailure
+// Allocation of '%s' failed. (%llu bytes)
+// QuicTraceEvent(
+            AllocFailure,
+            "Allocation of '%s' failed. (%llu bytes)",
+            "key share pool",
+            KeySharePool.ShardCount * sizeof(CXPLAT_KEY_SHARE_SHARD));
+// arg2 = arg2 = "key share pool" = arg2
+// arg3 = arg3 = KeySharePool.ShardCount * sizeof(CXPLAT_KEY_SHARE_SHARD) = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_KEYSHARE_OPENSSL_C, AllocFailure,
+    TP_ARGS(
+        const char *, arg2,
+        unsigned long long, arg3), 
+    TP_FIELDS(
+        ctf_string(arg2, arg2)
+        ctf_integer(uint64_t, arg3, arg3)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for KeySharePoolStarted
+// [ lib] Key share pool started with %u shards
+// QuicTraceLogInfo(
+        KeySharePoolStarted,
+        "[ lib] Key share pool started with %u shards",
+        KeySharePool.ShardCount);
+// arg2 = arg2 = KeySharePool.ShardCount = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_KEYSHARE_OPENSSL_C, KeySharePoolStarted,
+    TP_ARGS(
+        unsigned int, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned int, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for LibraryErrorStatus
+// [ lib] ERROR, %u, %s.
+// QuicTraceEvent(
+                        LibraryErrorStatus,
+                        "[ lib] ERROR, %u, %s.",
+                        ERR_get_error(),
+                        "Key share generation failed");
+// arg2 = arg2 = ERR_get_error() = arg2
+// arg3 = arg3 = "Key share generation failed" = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_KEYSHARE_OPENSSL_C, LibraryErrorStatus,
+    TP_ARGS(
+        unsigned int, arg2,
+        const char *, arg3), 
+    TP_FIELDS(
+        ctf_integer(unsigned int, arg2, arg2)
+        ctf_string(arg3, arg3)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for LibraryError
+// [ lib] ERROR, %s.
+// QuicTraceEvent(
+            LibraryError,
+            "[ lib] ERROR, %s.",
+            "OSSL_PROVIDER_query_operation(KEYMGMT) failed");
+// arg2 = arg2 = "OSSL_PROVIDER_query_operation(KEYMGMT) failed" = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_KEYSHARE_OPENSSL_C, LibraryError,
+    TP_ARGS(
+        const char *, arg2), 
+    TP_FIELDS(
+        ctf_string(arg2, arg2)
+    )
+)
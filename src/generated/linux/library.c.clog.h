@@ -736,6 +736,76 @@ tracepoint(CLOG_LIBRARY_C, ApiExit );\
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for LibrarySendBufferBudgetSet
+// [ lib] Updated send buffer budget = %llu
+// QuicTraceLogInfo(
+            LibrarySendBufferBudgetSet,
+            "[ lib] Updated send buffer budget = %llu",
+            MsQuicLib.SendBufferBudget);
+// arg2 = arg2 = MsQuicLib.SendBufferBudget = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_LibrarySendBufferBudgetSet
+#define _clog_3_ARGS_TRACE_LibrarySendBufferBudgetSet(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_LIBRARY_C, LibrarySendBufferBudgetSet , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for LibraryRecvMemoryLimitSet
+// [ lib] Updated receive memory limit = %llu bytes
+// QuicTraceLogInfo(
+            LibraryRecvMemoryLimitSet,
+            "[ lib] Updated receive memory limit = %llu bytes",
+            MsQuicLib.RecvMemoryLimit);
+// arg2 = arg2 = MsQuicLib.RecvMemoryLimit = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_LibraryRecvMemoryLimitSet
+#define _clog_3_ARGS_TRACE_LibraryRecvMemoryLimitSet(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_LIBRARY_C, LibraryRecvMemoryLimitSet , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for LibraryCongestionControlProviderSetAfterInUse
+// [ lib] Tried to change congestion control provider after library in use!
+// QuicTraceLogError(
+                LibraryCongestionControlProviderSetAfterInUse,
+                "[ lib] Tried to change congestion control provider after library in use!");
+----------------------------------------------------------*/
+#ifndef _clog_2_ARGS_TRACE_LibraryCongestionControlProviderSetAfterInUse
+#define _clog_2_ARGS_TRACE_LibraryCongestionControlProviderSetAfterInUse(uniqueId, encoded_arg_string)\
+tracepoint(CLOG_LIBRARY_C, LibraryCongestionControlProviderSetAfterInUse );\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for LibraryCongestionControlProviderSet
+// [ lib] Updated congestion control provider = %s
+// QuicTraceLogInfo(
+            LibraryCongestionControlProviderSet,
+            "[ lib] Updated congestion control provider = %s",
+            Provider->Name != NULL ? Provider->Name : "Custom");
+// arg2 = arg2 = Provider->Name != NULL ? Provider->Name : "Custom" = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_LibraryCongestionControlProviderSet
+#define _clog_3_ARGS_TRACE_LibraryCongestionControlProviderSet(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_LIBRARY_C, LibraryCongestionControlProviderSet , arg2);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
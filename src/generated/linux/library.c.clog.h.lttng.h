@@ -737,3 +737,76 @@ TRACEPOINT_EVENT(CLOG_LIBRARY_C, ApiExit,
     TP_FIELDS(
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for LibrarySendBufferBudgetSet
+// [ lib] Updated send buffer budget = %llu
+// QuicTraceLogInfo(
+            LibrarySendBufferBudgetSet,
+            "[ lib] Updated send buffer budget = %llu",
+            MsQuicLib.SendBufferBudget);
+// arg2 = arg2 = MsQuicLib.SendBufferBudget = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_LIBRARY_C, LibrarySendBufferBudgetSet,
+    TP_ARGS(
+        unsigned long long, arg2), 
+    TP_FIELDS(
+        ctf_integer(uint64_t, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for LibraryRecvMemoryLimitSet
+// [ lib] Updated receive memory limit = %llu bytes
+// QuicTraceLogInfo(
+            LibraryRecvMemoryLimitSet,
+            "[ lib] Updated receive memory limit = %llu bytes",
+            MsQuicLib.RecvMemoryLimit);
+// arg2 = arg2 = MsQuicLib.RecvMemoryLimit = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_LIBRARY_C, LibraryRecvMemoryLimitSet,
+    TP_ARGS(
+        unsigned long long, arg2), 
+    TP_FIELDS(
+        ctf_integer(uint64_t, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for LibraryCongestionControlProviderSetAfterInUse
+// [ lib] Tried to change congestion control provider after library in use!
+// QuicTraceLogError(
+                LibraryCongestionControlProviderSetAfterInUse,
+                "[ lib] Tried to change congestion control provider after library in use!");
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_LIBRARY_C, LibraryCongestionControlProviderSetAfterInUse,
+    TP_ARGS(
+), 
+    TP_FIELDS(
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for LibraryCongestionControlProviderSet
+// [ lib] Updated congestion control provider = %s
+// QuicTraceLogInfo(
+            LibraryCongestionControlProviderSet,
+            "[ lib] Updated congestion control provider = %s",
+            Provider->Name != NULL ? Provider->Name : "Custom");
+// arg2 = arg2 = Provider->Name != NULL ? Provider->Name : "Custom" = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_LIBRARY_C, LibraryCongestionControlProviderSet,
+    TP_ARGS(
+        const char *, arg2), 
+    TP_FIELDS(
+        ctf_string(arg2, arg2)
+    )
+)
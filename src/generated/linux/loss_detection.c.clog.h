@@ -524,6 +524,46 @@ tracepoint(CLOG_LOSS_DETECTION_C, ConnEcnFailed , arg2, arg3, arg4, arg5, arg6,
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for ReorderThresholdReset
+// [conn][%p] Reordering thresholds reset
+// QuicTraceLogConnVerbose(
+                    ReorderThresholdReset,
+                    Connection,
+                    "Reordering thresholds reset");
+// arg1 = arg1 = Connection = arg1
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_ReorderThresholdReset
+#define _clog_3_ARGS_TRACE_ReorderThresholdReset(uniqueId, arg1, encoded_arg_string)\
+tracepoint(CLOG_LOSS_DETECTION_C, ReorderThresholdReset , arg1);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for ReorderThresholdUpdated
+// [conn][%p] Reordering thresholds updated: %u packets, %hhu/8 RTT
+// QuicTraceLogConnVerbose(
+        ReorderThresholdUpdated,
+        Connection,
+        "Reordering thresholds updated: %u packets, %hhu/8 RTT",
+        LossDetection->PacketReorderThreshold,
+        LossDetection->TimeReorderEighths);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = LossDetection->PacketReorderThreshold = arg3
+// arg4 = arg4 = LossDetection->TimeReorderEighths = arg4
+----------------------------------------------------------*/
+#ifndef _clog_5_ARGS_TRACE_ReorderThresholdUpdated
+#define _clog_5_ARGS_TRACE_ReorderThresholdUpdated(uniqueId, arg1, encoded_arg_string, arg3, arg4)\
+tracepoint(CLOG_LOSS_DETECTION_C, ReorderThresholdUpdated , arg1, arg3, arg4);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -582,3 +582,49 @@ TRACEPOINT_EVENT(CLOG_LOSS_DETECTION_C, ConnEcnFailed,
         ctf_integer(unsigned short, arg8, arg8)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for ReorderThresholdReset
+// [conn][%p] Reordering thresholds reset
+// QuicTraceLogConnVerbose(
+                    ReorderThresholdReset,
+                    Connection,
+                    "Reordering thresholds reset");
+// arg1 = arg1 = Connection = arg1
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_LOSS_DETECTION_C, ReorderThresholdReset,
+    TP_ARGS(
+        const void *, arg1), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for ReorderThresholdUpdated
+// [conn][%p] Reordering thresholds updated: %u packets, %hhu/8 RTT
+// QuicTraceLogConnVerbose(
+        ReorderThresholdUpdated,
+        Connection,
+        "Reordering thresholds updated: %u packets, %hhu/8 RTT",
+        LossDetection->PacketReorderThreshold,
+        LossDetection->TimeReorderEighths);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = LossDetection->PacketReorderThreshold = arg3
+// arg4 = arg4 = LossDetection->TimeReorderEighths = arg4
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_LOSS_DETECTION_C, ReorderThresholdUpdated,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned int, arg3,
+        unsigned char, arg4), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(unsigned int, arg3, arg3)
+        ctf_integer(unsigned char, arg4, arg4)
+    )
+)
@@ -22,6 +22,10 @@
 #define _clog_MACRO_QuicTraceLogConnVerbose  1
 #define QuicTraceLogConnVerbose(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
 #endif
+#ifndef _clog_MACRO_QuicTraceLogConnWarning
+#define _clog_MACRO_QuicTraceLogConnWarning  1
+#define QuicTraceLogConnWarning(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -163,6 +167,52 @@ tracepoint(CLOG_MTU_DISCOVERY_C, MtuIncorrectSize , arg1, arg3, arg4, arg5);\
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for MtuCachedMtuFound
+// [conn][%p] Path[%hhu] Mtu Discovery Cached MTU: mtu=%hu, ceiling=%hhu
+// QuicTraceLogConnInfo(
+            MtuCachedMtuFound,
+            Connection,
+            "Path[%hhu] Mtu Discovery Cached MTU: mtu=%hu, ceiling=%hhu",
+            Path->ID,
+            CachedMtu,
+            IsCeiling);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Path->ID = arg3
+// arg4 = arg4 = CachedMtu = arg4
+// arg5 = arg5 = IsCeiling = arg5
+----------------------------------------------------------*/
+#ifndef _clog_6_ARGS_TRACE_MtuCachedMtuFound
+#define _clog_6_ARGS_TRACE_MtuCachedMtuFound(uniqueId, arg1, encoded_arg_string, arg3, arg4, arg5)\
+tracepoint(CLOG_MTU_DISCOVERY_C, MtuCachedMtuFound , arg1, arg3, arg4, arg5);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for MtuBlackHoleDetected
+// [conn][%p] Path[%hhu] Mtu Discovery Black Hole Detected at MTU %hu
+// QuicTraceLogConnWarning(
+        MtuBlackHoleDetected,
+        Connection,
+        "Path[%hhu] Mtu Discovery Black Hole Detected at MTU %hu",
+        Path->ID,
+        Path->Mtu);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Path->ID = arg3
+// arg4 = arg4 = Path->Mtu = arg4
+----------------------------------------------------------*/
+#ifndef _clog_5_ARGS_TRACE_MtuBlackHoleDetected
+#define _clog_5_ARGS_TRACE_MtuBlackHoleDetected(uniqueId, arg1, encoded_arg_string, arg3, arg4)\
+tracepoint(CLOG_MTU_DISCOVERY_C, MtuBlackHoleDetected , arg1, arg3, arg4);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
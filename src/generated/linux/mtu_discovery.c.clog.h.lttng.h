@@ -172,3 +172,61 @@ TRACEPOINT_EVENT(CLOG_MTU_DISCOVERY_C, MtuIncorrectSize,
         ctf_integer(unsigned int, arg5, arg5)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for MtuCachedMtuFound
+// [conn][%p] Path[%hhu] Mtu Discovery Cached MTU: mtu=%hu, ceiling=%hhu
+// QuicTraceLogConnInfo(
+            MtuCachedMtuFound,
+            Connection,
+            "Path[%hhu] Mtu Discovery Cached MTU: mtu=%hu, ceiling=%hhu",
+            Path->ID,
+            CachedMtu,
+            IsCeiling);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Path->ID = arg3
+// arg4 = arg4 = CachedMtu = arg4
+// arg5 = arg5 = IsCeiling = arg5
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_MTU_DISCOVERY_C, MtuCachedMtuFound,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned char, arg3,
+        unsigned short, arg4,
+        unsigned char, arg5), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(unsigned char, arg3, arg3)
+        ctf_integer(unsigned short, arg4, arg4)
+        ctf_integer(unsigned char, arg5, arg5)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for MtuBlackHoleDetected
+// [conn][%p] Path[%hhu] Mtu Discovery Black Hole Detected at MTU %hu
+// QuicTraceLogConnWarning(
+        MtuBlackHoleDetected,
+        Connection,
+        "Path[%hhu] Mtu Discovery Black Hole Detected at MTU %hu",
+        Path->ID,
+        Path->Mtu);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Path->ID = arg3
+// arg4 = arg4 = Path->Mtu = arg4
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_MTU_DISCOVERY_C, MtuBlackHoleDetected,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned char, arg3,
+        unsigned short, arg4), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(unsigned char, arg3, arg3)
+        ctf_integer(unsigned short, arg4, arg4)
+    )
+)
@@ -144,3 +144,26 @@ TRACEPOINT_EVENT(CLOG_PATH_C, PathQeoDisabled,
         ctf_integer(unsigned char, arg3, arg3)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for AllocFailure
+// Allocation of '%s' failed. (%llu bytes)
+// QuicTraceEvent(
+            AllocFailure,
+            "Allocation of '%s' failed. (%llu bytes)",
+            "paths",
+            QUIC_MAX_PATH_COUNT * sizeof(QUIC_PATH));
+// arg2 = arg2 = "paths" = arg2
+// arg3 = arg3 = QUIC_MAX_PATH_COUNT * sizeof(QUIC_PATH) = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_PATH_C, AllocFailure,
+    TP_ARGS(
+        const char *, arg2,
+        unsigned long long, arg3), 
+    TP_FIELDS(
+        ctf_string(arg2, arg2)
+        ctf_integer(uint64_t, arg3, arg3)
+    )
+)
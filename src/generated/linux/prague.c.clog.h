@@ -0,0 +1,187 @@
+#ifndef CLOG_DO_NOT_INCLUDE_HEADER
+#include <clog.h>
+#endif
+#undef TRACEPOINT_PROVIDER
+#define TRACEPOINT_PROVIDER CLOG_PRAGUE_C
+#undef TRACEPOINT_PROBE_DYNAMIC_LINKAGE
+#define  TRACEPOINT_PROBE_DYNAMIC_LINKAGE
+#undef TRACEPOINT_INCLUDE
+#define TRACEPOINT_INCLUDE "prague.c.clog.h.lttng.h"
+#if !defined(DEF_CLOG_PRAGUE_C) || defined(TRACEPOINT_HEADER_MULTI_READ)
+#define DEF_CLOG_PRAGUE_C
+#include <lttng/tracepoint.h>
+#define __int64 __int64_t
+#include "prague.c.clog.h.lttng.h"
+#endif
+#include <lttng/tracepoint-event.h>
+#ifndef _clog_MACRO_QuicTraceLogConnVerbose
+#define _clog_MACRO_QuicTraceLogConnVerbose  1
+#define QuicTraceLogConnVerbose(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
+#endif
+#ifndef _clog_MACRO_QuicTraceEvent
+#define _clog_MACRO_QuicTraceEvent  1
+#define QuicTraceEvent(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*----------------------------------------------------------
+// Decoder Ring for PragueAlphaUpdate
+// [conn][%p] Prague: Alpha=%u CeFraction=%u CongestionWindow=%u
+// QuicTraceLogConnVerbose(
+        PragueAlphaUpdate,
+        QuicCongestionControlGetConnection(Cc),
+        "Prague: Alpha=%u CeFraction=%u CongestionWindow=%u",
+        Prague->Alpha,
+        Fraction,
+        Prague->CongestionWindow);
+// arg1 = arg1 = QuicCongestionControlGetConnection(Cc) = arg1
+// arg3 = arg3 = Prague->Alpha = arg3
+// arg4 = arg4 = Fraction = arg4
+// arg5 = arg5 = Prague->CongestionWindow = arg5
+----------------------------------------------------------*/
+#ifndef _clog_6_ARGS_TRACE_PragueAlphaUpdate
+#define _clog_6_ARGS_TRACE_PragueAlphaUpdate(uniqueId, arg1, encoded_arg_string, arg3, arg4, arg5)\
+tracepoint(CLOG_PRAGUE_C, PragueAlphaUpdate , arg1, arg3, arg4, arg5);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for ConnRecoveryExit
+// [conn][%p] Recovery complete
+// QuicTraceEvent(
+                ConnRecoveryExit,
+                "[conn][%p] Recovery complete",
+                Connection);
+// arg2 = arg2 = Connection = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_ConnRecoveryExit
+#define _clog_3_ARGS_TRACE_ConnRecoveryExit(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_PRAGUE_C, ConnRecoveryExit , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for ConnPersistentCongestion
+// [conn][%p] Persistent congestion event
+// QuicTraceEvent(
+                ConnPersistentCongestion,
+                "[conn][%p] Persistent congestion event",
+                Connection);
+// arg2 = arg2 = Connection = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_ConnPersistentCongestion
+#define _clog_3_ARGS_TRACE_ConnPersistentCongestion(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_PRAGUE_C, ConnPersistentCongestion , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for PragueEcnReduction
+// [conn][%p] Prague: CE reduction Alpha=%u CongestionWindow=%u
+// QuicTraceLogConnVerbose(
+            PragueEcnReduction,
+            Connection,
+            "Prague: CE reduction Alpha=%u CongestionWindow=%u",
+            Prague->Alpha,
+            Prague->CongestionWindow);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Prague->Alpha = arg3
+// arg4 = arg4 = Prague->CongestionWindow = arg4
+----------------------------------------------------------*/
+#ifndef _clog_5_ARGS_TRACE_PragueEcnReduction
+#define _clog_5_ARGS_TRACE_PragueEcnReduction(uniqueId, arg1, encoded_arg_string, arg3, arg4)\
+tracepoint(CLOG_PRAGUE_C, PragueEcnReduction , arg1, arg3, arg4);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for ConnSpuriousCongestion
+// [conn][%p] Spurious congestion event
+// QuicTraceEvent(
+        ConnSpuriousCongestion,
+        "[conn][%p] Spurious congestion event",
+        Connection);
+// arg2 = arg2 = Connection = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_ConnSpuriousCongestion
+#define _clog_3_ARGS_TRACE_ConnSpuriousCongestion(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_PRAGUE_C, ConnSpuriousCongestion , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for ConnOutFlowStatsV2
+// [conn][%p] OUT: BytesSent=%llu InFlight=%u CWnd=%u ConnFC=%llu ISB=%llu PostedBytes=%llu SRtt=%llu 1Way=%llu
+// QuicTraceEvent(
+        ConnOutFlowStatsV2,
+        "[conn][%p] OUT: BytesSent=%llu InFlight=%u CWnd=%u ConnFC=%llu ISB=%llu PostedBytes=%llu SRtt=%llu 1Way=%llu",
+        Connection,
+        Connection->Stats.Send.TotalBytes,
+        Prague->BytesInFlight,
+        Prague->CongestionWindow,
+        Connection->Send.PeerMaxData - Connection->Send.OrderedStreamBytesSent,
+        Connection->SendBuffer.IdealBytes,
+        Connection->SendBuffer.PostedBytes,
+        Path->GotFirstRttSample ? Path->SmoothedRtt : 0,
+        Path->OneWayDelay);
+// arg2 = arg2 = Connection = arg2
+// arg3 = arg3 = Connection->Stats.Send.TotalBytes = arg3
+// arg4 = arg4 = Prague->BytesInFlight = arg4
+// arg5 = arg5 = Prague->CongestionWindow = arg5
+// arg6 = arg6 = Connection->Send.PeerMaxData - Connection->Send.OrderedStreamBytesSent = arg6
+// arg7 = arg7 = Connection->SendBuffer.IdealBytes = arg7
+// arg8 = arg8 = Connection->SendBuffer.PostedBytes = arg8
+// arg9 = arg9 = Path->GotFirstRttSample ? Path->SmoothedRtt : 0 = arg9
+// arg10 = arg10 = Path->OneWayDelay = arg10
+----------------------------------------------------------*/
+#ifndef _clog_11_ARGS_TRACE_ConnOutFlowStatsV2
+#define _clog_11_ARGS_TRACE_ConnOutFlowStatsV2(uniqueId, encoded_arg_string, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10)\
+tracepoint(CLOG_PRAGUE_C, ConnOutFlowStatsV2 , arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for ConnCongestionV2
+// [conn][%p] Congestion event: IsEcn=%hu
+// QuicTraceEvent(
+            ConnCongestionV2,
+            "[conn][%p] Congestion event: IsEcn=%hu",
+            Connection,
+            FALSE);
+// arg2 = arg2 = Connection = arg2
+// arg3 = arg3 = FALSE = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_ConnCongestionV2
+#define _clog_4_ARGS_TRACE_ConnCongestionV2(uniqueId, encoded_arg_string, arg2, arg3)\
+tracepoint(CLOG_PRAGUE_C, ConnCongestionV2 , arg2, arg3);\
+
+#endif
+
+
+
+
+#ifdef __cplusplus
+}
+#endif
+#ifdef CLOG_INLINE_IMPLEMENTATION
+#include "quic.clog_prague.c.clog.h.c"
+#endif
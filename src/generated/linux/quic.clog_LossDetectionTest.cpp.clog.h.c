@@ -0,0 +1 @@
+#include <clog.h>
@@ -179,6 +179,26 @@ tracepoint(CLOG_REGISTRATION_C, RegistrationRundownV2 , arg2, arg3, arg4);\
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for RegistrationSendBufferBudgetSet
+// [ reg][%p] Updated send buffer budget = %llu
+// QuicTraceLogInfo(
+            RegistrationSendBufferBudgetSet,
+            "[ reg][%p] Updated send buffer budget = %llu",
+            Registration,
+            Registration->SendBufferBudget);
+// arg2 = arg2 = Registration = arg2
+// arg3 = arg3 = Registration->SendBufferBudget = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_RegistrationSendBufferBudgetSet
+#define _clog_4_ARGS_TRACE_RegistrationSendBufferBudgetSet(uniqueId, encoded_arg_string, arg2, arg3)\
+tracepoint(CLOG_REGISTRATION_C, RegistrationSendBufferBudgetSet , arg2, arg3);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -171,3 +171,26 @@ TRACEPOINT_EVENT(CLOG_REGISTRATION_C, RegistrationRundownV2,
         ctf_integer(unsigned int, arg4, arg4)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for RegistrationSendBufferBudgetSet
+// [ reg][%p] Updated send buffer budget = %llu
+// QuicTraceLogInfo(
+            RegistrationSendBufferBudgetSet,
+            "[ reg][%p] Updated send buffer budget = %llu",
+            Registration,
+            Registration->SendBufferBudget);
+// arg2 = arg2 = Registration = arg2
+// arg3 = arg3 = Registration->SendBufferBudget = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_REGISTRATION_C, RegistrationSendBufferBudgetSet,
+    TP_ARGS(
+        const void *, arg2,
+        unsigned long long, arg3), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg2, (uint64_t)arg2)
+        ctf_integer(uint64_t, arg3, arg3)
+    )
+)
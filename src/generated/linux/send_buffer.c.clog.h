@@ -22,6 +22,10 @@
 #define _clog_MACRO_QuicTraceEvent  1
 #define QuicTraceEvent(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
 #endif
+#ifndef _clog_MACRO_QuicTraceLogConnVerbose
+#define _clog_MACRO_QuicTraceLogConnVerbose  1
+#define QuicTraceLogConnVerbose(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -65,6 +69,28 @@ tracepoint(CLOG_SEND_BUFFER_C, AllocFailure , arg2, arg3);\
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for IndicateSendBufferPressure
+// [conn][%p] Indicating QUIC_CONNECTION_EVENT_SEND_BUFFER_PRESSURE [Paused=%hhu, Limit=%llu]
+// QuicTraceLogConnVerbose(
+        IndicateSendBufferPressure,
+        Connection,
+        "Indicating QUIC_CONNECTION_EVENT_SEND_BUFFER_PRESSURE [Paused=%hhu, Limit=%llu]",
+        Paused,
+        Limit);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Paused = arg3
+// arg4 = arg4 = Limit = arg4
+----------------------------------------------------------*/
+#ifndef _clog_5_ARGS_TRACE_IndicateSendBufferPressure
+#define _clog_5_ARGS_TRACE_IndicateSendBufferPressure(uniqueId, arg1, encoded_arg_string, arg3, arg4)\
+tracepoint(CLOG_SEND_BUFFER_C, IndicateSendBufferPressure , arg1, arg3, arg4);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
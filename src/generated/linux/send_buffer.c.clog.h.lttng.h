@@ -44,3 +44,30 @@ TRACEPOINT_EVENT(CLOG_SEND_BUFFER_C, AllocFailure,
         ctf_integer(uint64_t, arg3, arg3)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for IndicateSendBufferPressure
+// [conn][%p] Indicating QUIC_CONNECTION_EVENT_SEND_BUFFER_PRESSURE [Paused=%hhu, Limit=%llu]
+// QuicTraceLogConnVerbose(
+        IndicateSendBufferPressure,
+        Connection,
+        "Indicating QUIC_CONNECTION_EVENT_SEND_BUFFER_PRESSURE [Paused=%hhu, Limit=%llu]",
+        Paused,
+        Limit);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Paused = arg3
+// arg4 = arg4 = Limit = arg4
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SEND_BUFFER_C, IndicateSendBufferPressure,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned char, arg3,
+        unsigned long long, arg4), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(unsigned char, arg3, arg3)
+        ctf_integer(uint64_t, arg4, arg4)
+    )
+)
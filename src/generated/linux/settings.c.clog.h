@@ -1027,6 +1027,186 @@ tracepoint(CLOG_SETTINGS_C, AllocFailure , arg2, arg3);\
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for SettingAdaptiveAckFrequencyEnabled
+// [sett] AdaptiveAckFrequencyEnabled= %hhu
+// QuicTraceLogVerbose(SettingAdaptiveAckFrequencyEnabled, "[sett] AdaptiveAckFrequencyEnabled= %hhu", Settings->AdaptiveAckFrequencyEnabled);
+// arg2 = arg2 = Settings->AdaptiveAckFrequencyEnabled = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_SettingAdaptiveAckFrequencyEnabled
+#define _clog_3_ARGS_TRACE_SettingAdaptiveAckFrequencyEnabled(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_SETTINGS_C, SettingAdaptiveAckFrequencyEnabled , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingEncryptInCopyEnabled
+// [sett] EncryptInCopyEnabled   = %hhu
+// QuicTraceLogVerbose(SettingEncryptInCopyEnabled,    "[sett] EncryptInCopyEnabled   = %hhu", Settings->EncryptInCopyEnabled);
+// arg2 = arg2 = Settings->EncryptInCopyEnabled = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_SettingEncryptInCopyEnabled
+#define _clog_3_ARGS_TRACE_SettingEncryptInCopyEnabled(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_SETTINGS_C, SettingEncryptInCopyEnabled , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingDecryptToAppBuffersEnabled
+// [sett] DecryptToAppBuffersEnabled = %hhu
+// QuicTraceLogVerbose(SettingDecryptToAppBuffersEnabled,  "[sett] DecryptToAppBuffersEnabled = %hhu", Settings->DecryptToAppBuffersEnabled);
+// arg2 = arg2 = Settings->DecryptToAppBuffersEnabled = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_SettingDecryptToAppBuffersEnabled
+#define _clog_3_ARGS_TRACE_SettingDecryptToAppBuffersEnabled(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_SETTINGS_C, SettingDecryptToAppBuffersEnabled , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingDatagramFecEnabled
+// [sett] DatagramFecEnabled     = %hhu
+// QuicTraceLogVerbose(SettingDatagramFecEnabled,          "[sett] DatagramFecEnabled     = %hhu", Settings->DatagramFecEnabled);
+// arg2 = arg2 = Settings->DatagramFecEnabled = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_SettingDatagramFecEnabled
+#define _clog_3_ARGS_TRACE_SettingDatagramFecEnabled(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_SETTINGS_C, SettingDatagramFecEnabled , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingDatagramReceiveBatchEnabled
+// [sett] DatagramReceiveBatchEnabled = %hhu
+// QuicTraceLogVerbose(SettingDatagramReceiveBatchEnabled, "[sett] DatagramReceiveBatchEnabled = %hhu", Settings->DatagramReceiveBatchEnabled);
+// arg2 = arg2 = Settings->DatagramReceiveBatchEnabled = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_SettingDatagramReceiveBatchEnabled
+#define _clog_3_ARGS_TRACE_SettingDatagramReceiveBatchEnabled(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_SETTINGS_C, SettingDatagramReceiveBatchEnabled , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingTlsOffloadEnabled
+// [sett] TlsOffloadEnabled      = %hhu
+// QuicTraceLogVerbose(SettingTlsOffloadEnabled,           "[sett] TlsOffloadEnabled      = %hhu", Settings->TlsOffloadEnabled);
+// arg2 = arg2 = Settings->TlsOffloadEnabled = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_SettingTlsOffloadEnabled
+#define _clog_3_ARGS_TRACE_SettingTlsOffloadEnabled(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_SETTINGS_C, SettingTlsOffloadEnabled , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingServerSessionCacheEnabled
+// [sett] ServerSessionCacheEnabled = %hhu
+// QuicTraceLogVerbose(SettingServerSessionCacheEnabled,   "[sett] ServerSessionCacheEnabled = %hhu", Settings->ServerSessionCacheEnabled);
+// arg2 = arg2 = Settings->ServerSessionCacheEnabled = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_SettingServerSessionCacheEnabled
+#define _clog_3_ARGS_TRACE_SettingServerSessionCacheEnabled(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_SETTINGS_C, SettingServerSessionCacheEnabled , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingDumpReplayFilterSize
+// [sett] ReplayFilterSize       = %u
+// QuicTraceLogVerbose(SettingDumpReplayFilterSize,        "[sett] ReplayFilterSize       = %u", Settings->ReplayFilterSize);
+// arg2 = arg2 = Settings->ReplayFilterSize = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_SettingDumpReplayFilterSize
+#define _clog_3_ARGS_TRACE_SettingDumpReplayFilterSize(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_SETTINGS_C, SettingDumpReplayFilterSize , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingDumpReplayFilterWindowMs
+// [sett] ReplayFilterWindowMs   = %u
+// QuicTraceLogVerbose(SettingDumpReplayFilterWindowMs,    "[sett] ReplayFilterWindowMs   = %u", Settings->ReplayFilterWindowMs);
+// arg2 = arg2 = Settings->ReplayFilterWindowMs = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_SettingDumpReplayFilterWindowMs
+#define _clog_3_ARGS_TRACE_SettingDumpReplayFilterWindowMs(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_SETTINGS_C, SettingDumpReplayFilterWindowMs , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingReplayFilterEnabled
+// [sett] ReplayFilterEnabled    = %hhu
+// QuicTraceLogVerbose(SettingReplayFilterEnabled,         "[sett] ReplayFilterEnabled    = %hhu", Settings->ReplayFilterEnabled);
+// arg2 = arg2 = Settings->ReplayFilterEnabled = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_SettingReplayFilterEnabled
+#define _clog_3_ARGS_TRACE_SettingReplayFilterEnabled(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_SETTINGS_C, SettingReplayFilterEnabled , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingKeySharePoolEnabled
+// [sett] KeySharePoolEnabled    = %hhu
+// QuicTraceLogVerbose(SettingKeySharePoolEnabled,         "[sett] KeySharePoolEnabled    = %hhu", Settings->KeySharePoolEnabled);
+// arg2 = arg2 = Settings->KeySharePoolEnabled = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_SettingKeySharePoolEnabled
+#define _clog_3_ARGS_TRACE_SettingKeySharePoolEnabled(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_SETTINGS_C, SettingKeySharePoolEnabled , arg2);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingDumpInitialRateLimit
+// [sett] InitialRateLimit       = %u
+// QuicTraceLogVerbose(SettingDumpInitialRateLimit,        "[sett] InitialRateLimit       = %u", Settings->InitialRateLimit);
+// arg2 = arg2 = Settings->InitialRateLimit = arg2
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_SettingDumpInitialRateLimit
+#define _clog_3_ARGS_TRACE_SettingDumpInitialRateLimit(uniqueId, encoded_arg_string, arg2)\
+tracepoint(CLOG_SETTINGS_C, SettingDumpInitialRateLimit , arg2);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
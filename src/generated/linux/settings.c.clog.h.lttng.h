@@ -1080,3 +1080,195 @@ TRACEPOINT_EVENT(CLOG_SETTINGS_C, AllocFailure,
         ctf_integer(uint64_t, arg3, arg3)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingAdaptiveAckFrequencyEnabled
+// [sett] AdaptiveAckFrequencyEnabled= %hhu
+// QuicTraceLogVerbose(SettingAdaptiveAckFrequencyEnabled, "[sett] AdaptiveAckFrequencyEnabled= %hhu", Settings->AdaptiveAckFrequencyEnabled);
+// arg2 = arg2 = Settings->AdaptiveAckFrequencyEnabled = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SETTINGS_C, SettingAdaptiveAckFrequencyEnabled,
+    TP_ARGS(
+        unsigned char, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingEncryptInCopyEnabled
+// [sett] EncryptInCopyEnabled   = %hhu
+// QuicTraceLogVerbose(SettingEncryptInCopyEnabled,    "[sett] EncryptInCopyEnabled   = %hhu", Settings->EncryptInCopyEnabled);
+// arg2 = arg2 = Settings->EncryptInCopyEnabled = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SETTINGS_C, SettingEncryptInCopyEnabled,
+    TP_ARGS(
+        unsigned char, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingDecryptToAppBuffersEnabled
+// [sett] DecryptToAppBuffersEnabled = %hhu
+// QuicTraceLogVerbose(SettingDecryptToAppBuffersEnabled,  "[sett] DecryptToAppBuffersEnabled = %hhu", Settings->DecryptToAppBuffersEnabled);
+// arg2 = arg2 = Settings->DecryptToAppBuffersEnabled = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SETTINGS_C, SettingDecryptToAppBuffersEnabled,
+    TP_ARGS(
+        unsigned char, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingDatagramFecEnabled
+// [sett] DatagramFecEnabled     = %hhu
+// QuicTraceLogVerbose(SettingDatagramFecEnabled,          "[sett] DatagramFecEnabled     = %hhu", Settings->DatagramFecEnabled);
+// arg2 = arg2 = Settings->DatagramFecEnabled = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SETTINGS_C, SettingDatagramFecEnabled,
+    TP_ARGS(
+        unsigned char, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingDatagramReceiveBatchEnabled
+// [sett] DatagramReceiveBatchEnabled = %hhu
+// QuicTraceLogVerbose(SettingDatagramReceiveBatchEnabled, "[sett] DatagramReceiveBatchEnabled = %hhu", Settings->DatagramReceiveBatchEnabled);
+// arg2 = arg2 = Settings->DatagramReceiveBatchEnabled = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SETTINGS_C, SettingDatagramReceiveBatchEnabled,
+    TP_ARGS(
+        unsigned char, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingTlsOffloadEnabled
+// [sett] TlsOffloadEnabled      = %hhu
+// QuicTraceLogVerbose(SettingTlsOffloadEnabled,           "[sett] TlsOffloadEnabled      = %hhu", Settings->TlsOffloadEnabled);
+// arg2 = arg2 = Settings->TlsOffloadEnabled = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SETTINGS_C, SettingTlsOffloadEnabled,
+    TP_ARGS(
+        unsigned char, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingServerSessionCacheEnabled
+// [sett] ServerSessionCacheEnabled = %hhu
+// QuicTraceLogVerbose(SettingServerSessionCacheEnabled,   "[sett] ServerSessionCacheEnabled = %hhu", Settings->ServerSessionCacheEnabled);
+// arg2 = arg2 = Settings->ServerSessionCacheEnabled = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SETTINGS_C, SettingServerSessionCacheEnabled,
+    TP_ARGS(
+        unsigned char, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingDumpReplayFilterSize
+// [sett] ReplayFilterSize       = %u
+// QuicTraceLogVerbose(SettingDumpReplayFilterSize,        "[sett] ReplayFilterSize       = %u", Settings->ReplayFilterSize);
+// arg2 = arg2 = Settings->ReplayFilterSize = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SETTINGS_C, SettingDumpReplayFilterSize,
+    TP_ARGS(
+        unsigned int, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned int, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingDumpReplayFilterWindowMs
+// [sett] ReplayFilterWindowMs   = %u
+// QuicTraceLogVerbose(SettingDumpReplayFilterWindowMs,    "[sett] ReplayFilterWindowMs   = %u", Settings->ReplayFilterWindowMs);
+// arg2 = arg2 = Settings->ReplayFilterWindowMs = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SETTINGS_C, SettingDumpReplayFilterWindowMs,
+    TP_ARGS(
+        unsigned int, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned int, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingReplayFilterEnabled
+// [sett] ReplayFilterEnabled    = %hhu
+// QuicTraceLogVerbose(SettingReplayFilterEnabled,         "[sett] ReplayFilterEnabled    = %hhu", Settings->ReplayFilterEnabled);
+// arg2 = arg2 = Settings->ReplayFilterEnabled = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SETTINGS_C, SettingReplayFilterEnabled,
+    TP_ARGS(
+        unsigned char, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingKeySharePoolEnabled
+// [sett] KeySharePoolEnabled    = %hhu
+// QuicTraceLogVerbose(SettingKeySharePoolEnabled,         "[sett] KeySharePoolEnabled    = %hhu", Settings->KeySharePoolEnabled);
+// arg2 = arg2 = Settings->KeySharePoolEnabled = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SETTINGS_C, SettingKeySharePoolEnabled,
+    TP_ARGS(
+        unsigned char, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned char, arg2, arg2)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for SettingDumpInitialRateLimit
+// [sett] InitialRateLimit       = %u
+// QuicTraceLogVerbose(SettingDumpInitialRateLimit,        "[sett] InitialRateLimit       = %u", Settings->InitialRateLimit);
+// arg2 = arg2 = Settings->InitialRateLimit = arg2
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_SETTINGS_C, SettingDumpInitialRateLimit,
+    TP_ARGS(
+        unsigned int, arg2), 
+    TP_FIELDS(
+        ctf_integer(unsigned int, arg2, arg2)
+    )
+)
@@ -30,6 +30,10 @@
 #define _clog_MACRO_QuicTraceEvent  1
 #define QuicTraceEvent(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
 #endif
+#ifndef _clog_MACRO_QuicTraceLogConnVerbose
+#define _clog_MACRO_QuicTraceLogConnVerbose  1
+#define QuicTraceLogConnVerbose(a, ...) _clog_CAT(_clog_ARGN_SELECTOR(__VA_ARGS__), _clog_CAT(_,a(#a, __VA_ARGS__)))
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -575,6 +579,64 @@ tracepoint(CLOG_STREAM_RECV_C, StreamAppReceiveComplete , arg2, arg3);\
 
 
 
+/*----------------------------------------------------------
+// Decoder Ring for ShrinkRxWindow
+// [strm][%p] Shrinking idle RX window to %u
+// QuicTraceLogStreamVerbose(
+            ShrinkRxWindow,
+            Stream,
+            "Shrinking idle RX window to %u",
+            Stream->RecvWindow);
+// arg1 = arg1 = Stream = arg1
+// arg3 = arg3 = Stream->RecvWindow = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_ShrinkRxWindow
+#define _clog_4_ARGS_TRACE_ShrinkRxWindow(uniqueId, arg1, encoded_arg_string, arg3)\
+tracepoint(CLOG_STREAM_RECV_C, ShrinkRxWindow , arg1, arg3);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for RxWindowBudgetLimited
+// [strm][%p] RX window growth limited by receive memory budget
+// QuicTraceLogStreamVerbose(
+        RxWindowBudgetLimited,
+        Stream,
+        "RX window growth limited by receive memory budget");
+// arg1 = arg1 = Stream = arg1
+----------------------------------------------------------*/
+#ifndef _clog_3_ARGS_TRACE_RxWindowBudgetLimited
+#define _clog_3_ARGS_TRACE_RxWindowBudgetLimited(uniqueId, arg1, encoded_arg_string)\
+tracepoint(CLOG_STREAM_RECV_C, RxWindowBudgetLimited , arg1);\
+
+#endif
+
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for IncreaseConnRxWindow
+// [conn][%p] Increasing connection RX window to %llu
+// QuicTraceLogConnVerbose(
+        IncreaseConnRxWindow,
+        Connection,
+        "Increasing connection RX window to %llu",
+        Connection->Send.MaxDataWindow);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Connection->Send.MaxDataWindow = arg3
+----------------------------------------------------------*/
+#ifndef _clog_4_ARGS_TRACE_IncreaseConnRxWindow
+#define _clog_4_ARGS_TRACE_IncreaseConnRxWindow(uniqueId, arg1, encoded_arg_string, arg3)\
+tracepoint(CLOG_STREAM_RECV_C, IncreaseConnRxWindow , arg1, arg3);\
+
+#endif
+
+
+
+
 #ifdef __cplusplus
 }
 #endif
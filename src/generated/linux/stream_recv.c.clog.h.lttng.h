@@ -606,3 +606,68 @@ TRACEPOINT_EVENT(CLOG_STREAM_RECV_C, StreamAppReceiveComplete,
         ctf_integer(uint64_t, arg3, arg3)
     )
 )
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for ShrinkRxWindow
+// [strm][%p] Shrinking idle RX window to %u
+// QuicTraceLogStreamVerbose(
+            ShrinkRxWindow,
+            Stream,
+            "Shrinking idle RX window to %u",
+            Stream->RecvWindow);
+// arg1 = arg1 = Stream = arg1
+// arg3 = arg3 = Stream->RecvWindow = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_STREAM_RECV_C, ShrinkRxWindow,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned int, arg3), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(unsigned int, arg3, arg3)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for RxWindowBudgetLimited
+// [strm][%p] RX window growth limited by receive memory budget
+// QuicTraceLogStreamVerbose(
+        RxWindowBudgetLimited,
+        Stream,
+        "RX window growth limited by receive memory budget");
+// arg1 = arg1 = Stream = arg1
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_STREAM_RECV_C, RxWindowBudgetLimited,
+    TP_ARGS(
+        const void *, arg1), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+    )
+)
+
+
+
+/*----------------------------------------------------------
+// Decoder Ring for IncreaseConnRxWindow
+// [conn][%p] Increasing connection RX window to %llu
+// QuicTraceLogConnVerbose(
+        IncreaseConnRxWindow,
+        Connection,
+        "Increasing connection RX window to %llu",
+        Connection->Send.MaxDataWindow);
+// arg1 = arg1 = Connection = arg1
+// arg3 = arg3 = Connection->Send.MaxDataWindow = arg3
+----------------------------------------------------------*/
+TRACEPOINT_EVENT(CLOG_STREAM_RECV_C, IncreaseConnRxWindow,
+    TP_ARGS(
+        const void *, arg1,
+        unsigned long long, arg3), 
+    TP_FIELDS(
+        ctf_integer_hex(uint64_t, arg1, (uint64_t)arg1)
+        ctf_integer(uint64_t, arg3, arg3)
+    )
+)
@@ -249,6 +249,7 @@ typedef enum QUIC_SEND_FLAGS {
     QUIC_SEND_FLAG_CANCEL_ON_LOSS           = 0x0020,   // Indicates that a stream is to be cancelled when packet loss is detected.
     QUIC_SEND_FLAG_PRIORITY_WORK            = 0x0040,   // Higher priority than other connection work.
     QUIC_SEND_FLAG_CANCEL_ON_BLOCKED        = 0x0080,   // Indicates that a frame should be dropped when it can't be sent immediately.
+    QUIC_SEND_FLAG_DGRAM_FEC_FLUSH          = 0x0100,   // Indicates the datagram ends a burst, so its FEC repair is sent right after it.
 } QUIC_SEND_FLAGS;
 
 DEFINE_ENUM_FLAG_OPERATORS(QUIC_SEND_FLAGS)
@@ -511,6 +512,9 @@ typedef enum QUIC_CONGESTION_CONTROL_ALGORITHM {
     QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC,
 #ifdef QUIC_API_ENABLE_PREVIEW_FEATURES
     QUIC_CONGESTION_CONTROL_ALGORITHM_BBR,
+    QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3,
+    QUIC_CONGESTION_CONTROL_ALGORITHM_PRAGUE,   // L4S, requires EcnEnabled
+    QUIC_CONGESTION_CONTROL_ALGORITHM_CUSTOM,   // See QUIC_PARAM_GLOBAL_CONGESTION_CONTROL_PROVIDER
 #endif
     QUIC_CONGESTION_CONTROL_ALGORITHM_MAX,
 } QUIC_CONGESTION_CONTROL_ALGORITHM;
@@ -637,6 +641,19 @@ typedef struct QUIC_STATISTICS_V2 {
 
     uint32_t RttVariance;                   // In microseconds
 
+    uint64_t RecvWindowBytes;               // Current connection-wide receive (flow control) window.
+    uint32_t RecvWindowGrowCount;           // Number of times auto-tuning grew a receive window.
+    uint32_t RecvWindowShrinkCount;         // Number of times auto-tuning shrank an idle stream's receive window.
+    uint32_t RecvWindowBudgetLimitedCount;  // Number of receive window increases denied by the memory budget.
+
+    uint64_t SendSpuriousLostBytes;         // Bytes declared lost that were acknowledged later.
+    uint32_t SendSpuriousCongestionCount;   // Number of congestion events undone because all their losses were spurious.
+    uint32_t SendPacketReorderThreshold;    // Current packet reordering threshold of loss detection.
+
+    uint32_t SendDatagramFecRepairCount;    // Number of datagram FEC repair frames sent.
+    uint32_t RecvDatagramFecRecoveredCount; // Number of lost datagrams recovered from FEC repair frames.
+    uint32_t SendDatagramExpiredCount;      // Number of datagrams dropped because their lifetime expired before they were sent.
+
     // N.B. New fields must be appended to end
 
 } QUIC_STATISTICS_V2;
@@ -659,6 +676,10 @@ typedef struct QUIC_NETWORK_STATISTICS
 #define QUIC_STATISTICS_V2_SIZE_2   QUIC_STRUCT_SIZE_THRU_FIELD(QUIC_STATISTICS_V2, DestCidUpdateCount)     // MsQuic v2.1 final size
 #define QUIC_STATISTICS_V2_SIZE_3   QUIC_STRUCT_SIZE_THRU_FIELD(QUIC_STATISTICS_V2, SendEcnCongestionCount) // MsQuic v2.2 final size
 #define QUIC_STATISTICS_V2_SIZE_4   QUIC_STRUCT_SIZE_THRU_FIELD(QUIC_STATISTICS_V2, RttVariance)            // MsQuic v2.5 final size
+#define QUIC_STATISTICS_V2_SIZE_5   QUIC_STRUCT_SIZE_THRU_FIELD(QUIC_STATISTICS_V2, RecvWindowBudgetLimitedCount)
+#define QUIC_STATISTICS_V2_SIZE_6   QUIC_STRUCT_SIZE_THRU_FIELD(QUIC_STATISTICS_V2, SendPacketReorderThreshold)
+#define QUIC_STATISTICS_V2_SIZE_7   QUIC_STRUCT_SIZE_THRU_FIELD(QUIC_STATISTICS_V2, RecvDatagramFecRecoveredCount)
+#define QUIC_STATISTICS_V2_SIZE_8   QUIC_STRUCT_SIZE_THRU_FIELD(QUIC_STATISTICS_V2, SendDatagramExpiredCount) // MsQuic v2.6 final size
 
 typedef struct QUIC_LISTENER_STATISTICS {
 
@@ -703,6 +724,14 @@ typedef enum QUIC_PERFORMANCE_COUNTERS {
     QUIC_PERF_COUNTER_SEND_STATELESS_RETRY, // Total stateless retry packets sent ever.
     QUIC_PERF_COUNTER_CONN_LOAD_REJECT,     // Total connections rejected due to worker load.
     QUIC_PERF_COUNTER_LISTEN_QUEUE_DEPTH,   // Current listeners queued for processing.
+    QUIC_PERF_COUNTER_SEND_BUFFER_BYTES,    // Current bytes buffered for stream sends.
+    QUIC_PERF_COUNTER_SEND_BUFFER_BUDGET_EXHAUSTED, // Total times a connection's send buffering was limited by a budget.
+    QUIC_PERF_COUNTER_SESSION_CACHE_HIT,    // Total resumption tickets found in the server session cache.
+    QUIC_PERF_COUNTER_SESSION_CACHE_MISS,   // Total resumption tickets not found in the server session cache.
+    QUIC_PERF_COUNTER_CONN_HANDSHAKE_NO_AMP_STALL, // Total server handshakes completed without waiting on amplification protection.
+    QUIC_PERF_COUNTER_STATELESS_OPER_COMPLETED, // Total stateless operations (version negotiation, reset, retry) sent.
+    QUIC_PERF_COUNTER_STATELESS_OPER_DROPPED, // Total stateless operations dropped for rate or queue limits.
+    QUIC_PERF_COUNTER_CONN_INITIAL_RATE_LIMITED, // Total Initial packets dropped by the source prefix rate limit.
     QUIC_PERF_COUNTER_MAX,
 } QUIC_PERFORMANCE_COUNTERS;
 
@@ -726,12 +755,24 @@ typedef struct QUIC_GLOBAL_SETTINGS {
             uint64_t RetryMemoryLimit                       : 1;
             uint64_t LoadBalancingMode                      : 1;
             uint64_t FixedServerID                          : 1;
+#ifdef QUIC_API_ENABLE_PREVIEW_FEATURES
+            uint64_t ReplayFilterSize                       : 1;
+            uint64_t ReplayFilterWindowMs                   : 1;
+            uint64_t InitialRateLimit                       : 1;
+            uint64_t RESERVED                               : 58;
+#else
             uint64_t RESERVED                               : 61;
+#endif
         } IsSet;
     };
     uint16_t RetryMemoryLimit;
     uint16_t LoadBalancingMode;
     uint32_t FixedServerID;
+#ifdef QUIC_API_ENABLE_PREVIEW_FEATURES
+    uint32_t ReplayFilterSize;
+    uint32_t ReplayFilterWindowMs;
+    uint32_t InitialRateLimit;
+#endif
 } QUIC_GLOBAL_SETTINGS;
 
 typedef struct QUIC_SETTINGS {
@@ -786,7 +827,16 @@ typedef struct QUIC_SETTINGS {
             uint64_t XdpEnabled                             : 1;
             uint64_t QTIPEnabled                            : 1;
             uint64_t ReservedRioEnabled                     : 1;
-            uint64_t RESERVED                               : 18;
+            uint64_t AdaptiveAckFrequencyEnabled            : 1;
+            uint64_t EncryptInCopyEnabled                   : 1;
+            uint64_t DecryptToAppBuffersEnabled             : 1;
+            uint64_t DatagramFecEnabled                     : 1;
+            uint64_t DatagramReceiveBatchEnabled            : 1;
+            uint64_t TlsOffloadEnabled                      : 1;
+            uint64_t ServerSessionCacheEnabled              : 1;
+            uint64_t ReplayFilterEnabled                    : 1;
+            uint64_t KeySharePoolEnabled                    : 1;
+            uint64_t RESERVED                               : 9;
 #else
             uint64_t RESERVED                               : 26;
 #endif
@@ -840,7 +890,16 @@ typedef struct QUIC_SETTINGS {
             uint64_t XdpEnabled                : 1;
             uint64_t QTIPEnabled               : 1;
             uint64_t ReservedRioEnabled        : 1;
-            uint64_t ReservedFlags             : 55;
+            uint64_t AdaptiveAckFrequencyEnabled : 1;
+            uint64_t EncryptInCopyEnabled      : 1;
+            uint64_t DecryptToAppBuffersEnabled : 1;
+            uint64_t DatagramFecEnabled        : 1;
+            uint64_t DatagramReceiveBatchEnabled : 1;
+            uint64_t TlsOffloadEnabled         : 1;
+            uint64_t ServerSessionCacheEnabled : 1;
+            uint64_t ReplayFilterEnabled       : 1;
+            uint64_t KeySharePoolEnabled       : 1;
+            uint64_t ReservedFlags             : 46;
 #else
             uint64_t ReservedFlags             : 63;
 #endif
@@ -900,6 +959,167 @@ typedef struct QUIC_STATELESS_RETRY_CONFIG {
         const uint8_t* Secret;          // Secret to generate the key.
 } QUIC_STATELESS_RETRY_CONFIG;
 
+#ifdef QUIC_API_ENABLE_PREVIEW_FEATURES
+//
+// Application supplied congestion control algorithm, used by connections
+// configured with QUIC_CONGESTION_CONTROL_ALGORITHM_CUSTOM.
+//
+// MsQuic keeps track of the bytes in flight and probe exemptions and decides
+// whether a packet may be sent by comparing bytes in flight against the
+// window returned by GetCongestionWindow. The algorithm only has to maintain
+// its window (and optionally its own pacing) from the events below. All
+// callbacks for a connection are serialized on the connection's worker.
+//
+// The built-in algorithms aren't available through this interface (they work
+// directly on the connection's internal state) and are only selected with
+// CongestionControlAlgorithm.
+//
+
+//
+// Read-only view of the connection state passed to each callback. Times are
+// in microseconds.
+//
+typedef struct QUIC_CONGESTION_CONTROL_STATE {
+    uint64_t SmoothedRtt;
+    uint64_t MinRtt;
+    uint64_t RttVariance;
+    uint64_t LatestRtt;
+    uint32_t BytesInFlight;
+    uint32_t BytesInFlightMax;
+    uint16_t DatagramPayloadLength;
+    BOOLEAN GotFirstRttSample;
+    BOOLEAN PacingEnabled;
+} QUIC_CONGESTION_CONTROL_STATE;
+
+typedef struct QUIC_CONGESTION_CONTROL_ACK {
+    uint64_t TimeNow;                   // Microseconds
+    uint64_t LargestAck;
+    uint64_t LargestSentPacketNumber;
+    uint64_t TotalAckedBytes;           // Over the connection's lifetime
+    uint64_t MinRtt;                    // Smallest RTT sample of this ACK, if MinRttValid
+    uint32_t AckedBytes;
+    BOOLEAN MinRttValid;
+    BOOLEAN HasLoss;
+    BOOLEAN IsImplicit;
+} QUIC_CONGESTION_CONTROL_ACK;
+
+typedef struct QUIC_CONGESTION_CONTROL_LOSS {
+    uint64_t LargestPacketNumberLost;
+    uint64_t LargestSentPacketNumber;
+    uint32_t LostBytes;
+    BOOLEAN PersistentCongestion;
+} QUIC_CONGESTION_CONTROL_LOSS;
+
+typedef struct QUIC_CONGESTION_CONTROL_ECN {
+    uint64_t LargestPacketNumberAcked;
+    uint64_t LargestSentPacketNumber;
+    uint32_t CePacketCount;             // Newly CE marked packets
+} QUIC_CONGESTION_CONTROL_ECN;
+
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_STATUS
+(QUIC_API * QUIC_CONGESTION_CONTROL_CREATE_FN)(
+    _In_opt_ void* ProviderContext,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* State,
+    _Outptr_ void** Instance
+    );
+
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+(QUIC_API * QUIC_CONGESTION_CONTROL_DELETE_FN)(
+    _In_ void* Instance
+    );
+
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+(QUIC_API * QUIC_CONGESTION_CONTROL_RESET_FN)(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* State,
+    _In_ BOOLEAN FullReset
+    );
+
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint32_t
+(QUIC_API * QUIC_CONGESTION_CONTROL_GET_WINDOW_FN)(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* State
+    );
+
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+uint32_t
+(QUIC_API * QUIC_CONGESTION_CONTROL_GET_SEND_ALLOWANCE_FN)(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* State,
+    _In_ uint64_t TimeSinceLastSend,    // Microseconds
+    _In_ BOOLEAN TimeSinceLastSendValid
+    );
+
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+(QUIC_API * QUIC_CONGESTION_CONTROL_ON_DATA_SENT_FN)(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* State,
+    _In_ uint32_t SentBytes
+    );
+
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+(QUIC_API * QUIC_CONGESTION_CONTROL_ON_ACK_FN)(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* State,
+    _In_ const QUIC_CONGESTION_CONTROL_ACK* Ack
+    );
+
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+(QUIC_API * QUIC_CONGESTION_CONTROL_ON_LOSS_FN)(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* State,
+    _In_ const QUIC_CONGESTION_CONTROL_LOSS* Loss
+    );
+
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+(QUIC_API * QUIC_CONGESTION_CONTROL_ON_ECN_FN)(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* State,
+    _In_ const QUIC_CONGESTION_CONTROL_ECN* Ecn
+    );
+
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+void
+(QUIC_API * QUIC_CONGESTION_CONTROL_ON_SPURIOUS_FN)(
+    _In_ void* Instance,
+    _In_ const QUIC_CONGESTION_CONTROL_STATE* State
+    );
+
+typedef struct QUIC_CONGESTION_CONTROL_PROVIDER {
+    const char* Name;                                   // Must outlive the library
+    void* Context;                                      // Passed to Create
+    BOOLEAN UseEct1;                                    // Mark packets ECT(1) (L4S)
+    QUIC_CONGESTION_CONTROL_CREATE_FN Create;           // Required
+    QUIC_CONGESTION_CONTROL_DELETE_FN Delete;           // Required
+    QUIC_CONGESTION_CONTROL_GET_WINDOW_FN GetCongestionWindow; // Required
+    QUIC_CONGESTION_CONTROL_ON_ACK_FN OnDataAcknowledged;      // Required
+    QUIC_CONGESTION_CONTROL_ON_LOSS_FN OnDataLost;             // Required
+    QUIC_CONGESTION_CONTROL_RESET_FN Reset;                    // Optional
+    QUIC_CONGESTION_CONTROL_GET_SEND_ALLOWANCE_FN GetSendAllowance; // Optional, window / RTT pacing if NULL
+    QUIC_CONGESTION_CONTROL_ON_DATA_SENT_FN OnDataSent;        // Optional
+    QUIC_CONGESTION_CONTROL_ON_ECN_FN OnEcn;                   // Optional
+    QUIC_CONGESTION_CONTROL_ON_SPURIOUS_FN OnSpuriousCongestionEvent; // Optional
+} QUIC_CONGESTION_CONTROL_PROVIDER;
+#endif
+
 //
 // Functions for associating application contexts with QUIC handles. MsQuic
 // provides no explicit synchronization between parallel calls to these
@@ -973,10 +1193,18 @@ void
 #define QUIC_PARAM_GLOBAL_STATELESS_RESET_KEY           0x0100000B  // uint8_t[] - Array size is QUIC_STATELESS_RESET_KEY_LENGTH
 #define QUIC_PARAM_GLOBAL_STATISTICS_V2_SIZES           0x0100000C  // uint32_t[] - Array of sizes for each QUIC_STATISTICS_V2 version. Get-only. Pass a buffer of uint32_t, output count is variable. See documentation for details.
 #define QUIC_PARAM_GLOBAL_STATELESS_RETRY_CONFIG        0x0100000D  // QUIC_STATELESS_RETRY_CONFIG
+#ifdef QUIC_API_ENABLE_PREVIEW_FEATURES
+#define QUIC_PARAM_GLOBAL_SEND_BUFFER_BUDGET            0x0100000E  // uint64_t - bytes, 0 means unlimited
+#define QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT           0x0100000F  // uint16_t - out of UINT16_MAX, 0 means unlimited
+#define QUIC_PARAM_GLOBAL_CONGESTION_CONTROL_PROVIDER   0x01000010  // QUIC_CONGESTION_CONTROL_PROVIDER - set before library in use
+#endif
 
 //
 // Parameters for Registration.
 //
+#ifdef QUIC_API_ENABLE_PREVIEW_FEATURES
+#define QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET      0x02000001  // uint64_t - bytes, 0 means unlimited
+#endif
 
 //
 // Parameters for Configuration.
@@ -1339,6 +1567,8 @@ typedef enum QUIC_CONNECTION_EVENT_TYPE {
     QUIC_CONNECTION_EVENT_RELIABLE_RESET_NEGOTIATED         = 16,   // Only indicated if QUIC_SETTINGS.ReliableResetEnabled is TRUE.
     QUIC_CONNECTION_EVENT_ONE_WAY_DELAY_NEGOTIATED          = 17,   // Only indicated if QUIC_SETTINGS.OneWayDelayEnabled is TRUE.
     QUIC_CONNECTION_EVENT_NETWORK_STATISTICS                = 18,   // Only indicated if QUIC_SETTINGS.EnableNetStatsEvent is TRUE.
+    QUIC_CONNECTION_EVENT_SEND_BUFFER_PRESSURE              = 19,   // Only indicated if a send buffer budget is configured.
+    QUIC_CONNECTION_EVENT_DATAGRAMS_RECEIVED                = 20,   // Only indicated if QUIC_SETTINGS.DatagramReceiveBatchEnabled is TRUE.
 #endif
 } QUIC_CONNECTION_EVENT_TYPE;
 
@@ -1422,6 +1652,16 @@ typedef struct QUIC_CONNECTION_EVENT {
             BOOLEAN ReceiveNegotiated;          // TRUE if receiving one-way delay timestamps is negotiated.
         } ONE_WAY_DELAY_NEGOTIATED;
         QUIC_NETWORK_STATISTICS NETWORK_STATISTICS;
+        struct {
+            BOOLEAN Paused;                     // TRUE if the app should pause producing send data.
+            uint64_t BufferLimit;               // The connection's current share of the send buffer budget.
+        } SEND_BUFFER_PRESSURE;
+        struct {
+            _Field_size_(BufferCount)
+            const QUIC_BUFFER* Buffers;         // One buffer per datagram, valid only during the callback.
+            uint32_t BufferCount;
+            QUIC_RECEIVE_FLAGS Flags;           // Applies to all the datagrams.
+        } DATAGRAMS_RECEIVED;
 #endif
     };
 } QUIC_CONNECTION_EVENT;
@@ -1771,6 +2011,34 @@ QUIC_STATUS
     _In_opt_ void* ClientSendContext
     );
 
+#ifdef QUIC_API_ENABLE_PREVIEW_FEATURES
+#define QUIC_DATAGRAM_PRIORITY_CLASS_MAX    3   // QUIC_SEND_FLAG_DGRAM_PRIORITY uses this class.
+
+typedef struct QUIC_DATAGRAM_SEND_INFO {
+    _Field_size_(BufferCount)
+    const QUIC_BUFFER* Buffers;
+    uint32_t BufferCount;
+    QUIC_SEND_FLAGS Flags;
+    uint8_t PriorityClass;          // 0 (default) to QUIC_DATAGRAM_PRIORITY_CLASS_MAX. Higher classes are sent first.
+    uint32_t LifetimeMs;            // Dropped instead of sent once queued this long. 0 means no limit.
+    void* ClientSendContext;
+} QUIC_DATAGRAM_SEND_INFO;
+
+//
+// Sends a batch of unreliable datagrams on the connection. Either all of the
+// datagrams are queued or none are.
+//
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_STATUS
+(QUIC_API * QUIC_DATAGRAM_SEND_BATCH_FN)(
+    _In_ _Pre_defensive_ HQUIC Connection,
+    _In_reads_(DatagramCount) _Pre_defensive_
+        const QUIC_DATAGRAM_SEND_INFO* const Datagrams,
+    _In_ uint32_t DatagramCount
+    );
+#endif
+
 //
 // Connection Pool API
 //
@@ -1884,6 +2152,7 @@ typedef struct QUIC_API_TABLE {
     QUIC_EXECUTION_POLL_FN              ExecutionPoll;      // Available from v2.5
 #endif // _KERNEL_MODE
     QUIC_REGISTRATION_CLOSE2_FN         RegistrationClose2; // Available from v2.6
+    QUIC_DATAGRAM_SEND_BATCH_FN         DatagramSendBatch;  // Available from v2.6
 #endif // QUIC_API_ENABLE_PREVIEW_FEATURES
 
 } QUIC_API_TABLE;
@@ -680,6 +680,11 @@ public:
     MsQuicGlobalSettings& SetRetryMemoryLimit(uint16_t Value) { RetryMemoryLimit = Value; IsSet.RetryMemoryLimit = TRUE; return *this; }
     MsQuicGlobalSettings& SetLoadBalancingMode(uint16_t Value) { LoadBalancingMode = Value; IsSet.LoadBalancingMode = TRUE; return *this; }
     MsQuicGlobalSettings& SetFixedServerID(uint32_t Value) { FixedServerID = Value; IsSet.FixedServerID = TRUE; return *this; }
+#ifdef QUIC_API_ENABLE_PREVIEW_FEATURES
+    MsQuicGlobalSettings& SetReplayFilterSize(uint32_t Value) { ReplayFilterSize = Value; IsSet.ReplayFilterSize = TRUE; return *this; }
+    MsQuicGlobalSettings& SetReplayFilterWindowMs(uint32_t Value) { ReplayFilterWindowMs = Value; IsSet.ReplayFilterWindowMs = TRUE; return *this; }
+    MsQuicGlobalSettings& SetInitialRateLimit(uint32_t Value) { InitialRateLimit = Value; IsSet.InitialRateLimit = TRUE; return *this; }
+#endif
 
     QUIC_STATUS Set() const noexcept {
         const QUIC_GLOBAL_SETTINGS* Settings = this;
@@ -738,6 +743,15 @@ public:
     MsQuicSettings& SetOneWayDelayEnabled(bool value) { OneWayDelayEnabled = value; IsSet.OneWayDelayEnabled = TRUE; return *this; }
     MsQuicSettings& SetNetStatsEventEnabled(bool value) { NetStatsEventEnabled = value; IsSet.NetStatsEventEnabled = TRUE; return *this; }
     MsQuicSettings& SetStreamMultiReceiveEnabled(bool value) { StreamMultiReceiveEnabled = value; IsSet.StreamMultiReceiveEnabled = TRUE; return *this; }
+    MsQuicSettings& SetAdaptiveAckFrequencyEnabled(bool value) { AdaptiveAckFrequencyEnabled = value; IsSet.AdaptiveAckFrequencyEnabled = TRUE; return *this; }
+    MsQuicSettings& SetEncryptInCopyEnabled(bool value) { EncryptInCopyEnabled = value; IsSet.EncryptInCopyEnabled = TRUE; return *this; }
+    MsQuicSettings& SetDecryptToAppBuffersEnabled(bool value) { DecryptToAppBuffersEnabled = value; IsSet.DecryptToAppBuffersEnabled = TRUE; return *this; }
+    MsQuicSettings& SetDatagramFecEnabled(bool value) { DatagramFecEnabled = value; IsSet.DatagramFecEnabled = TRUE; return *this; }
+    MsQuicSettings& SetDatagramReceiveBatchEnabled(bool value) { DatagramReceiveBatchEnabled = value; IsSet.DatagramReceiveBatchEnabled = TRUE; return *this; }
+    MsQuicSettings& SetTlsOffloadEnabled(bool value) { TlsOffloadEnabled = value; IsSet.TlsOffloadEnabled = TRUE; return *this; }
+    MsQuicSettings& SetServerSessionCacheEnabled(bool value) { ServerSessionCacheEnabled = value; IsSet.ServerSessionCacheEnabled = TRUE; return *this; }
+    MsQuicSettings& SetReplayFilterEnabled(bool value) { ReplayFilterEnabled = value; IsSet.ReplayFilterEnabled = TRUE; return *this; }
+    MsQuicSettings& SetKeySharePoolEnabled(bool value) { KeySharePoolEnabled = value; IsSet.KeySharePoolEnabled = TRUE; return *this; }
 #endif
 
     QUIC_STATUS
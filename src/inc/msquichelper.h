@@ -199,6 +199,14 @@ DumpMsQuicPerfCounters(
     printf("  SEND_STATELESS_RESET:  %llu\n", (unsigned long long)Counters[QUIC_PERF_COUNTER_SEND_STATELESS_RESET]);
     printf("  SEND_STATELESS_RETRY:  %llu\n", (unsigned long long)Counters[QUIC_PERF_COUNTER_SEND_STATELESS_RETRY]);
     printf("  CONN_LOAD_REJECT:      %llu\n", (unsigned long long)Counters[QUIC_PERF_COUNTER_CONN_LOAD_REJECT]);
+    printf("  SEND_BUFFER_BYTES:     %llu\n", (unsigned long long)Counters[QUIC_PERF_COUNTER_SEND_BUFFER_BYTES]);
+    printf("  SEND_BUFFER_BUDGET_EXHAUSTED: %llu\n", (unsigned long long)Counters[QUIC_PERF_COUNTER_SEND_BUFFER_BUDGET_EXHAUSTED]);
+    printf("  SESSION_CACHE_HIT:     %llu\n", (unsigned long long)Counters[QUIC_PERF_COUNTER_SESSION_CACHE_HIT]);
+    printf("  SESSION_CACHE_MISS:    %llu\n", (unsigned long long)Counters[QUIC_PERF_COUNTER_SESSION_CACHE_MISS]);
+    printf("  CONN_HANDSHAKE_NO_AMP_STALL: %llu\n", (unsigned long long)Counters[QUIC_PERF_COUNTER_CONN_HANDSHAKE_NO_AMP_STALL]);
+    printf("  STATELESS_OPER_COMPLETED: %llu\n", (unsigned long long)Counters[QUIC_PERF_COUNTER_STATELESS_OPER_COMPLETED]);
+    printf("  STATELESS_OPER_DROPPED: %llu\n", (unsigned long long)Counters[QUIC_PERF_COUNTER_STATELESS_OPER_DROPPED]);
+    printf("  CONN_INITIAL_RATE_LIMITED: %llu\n", (unsigned long long)Counters[QUIC_PERF_COUNTER_CONN_INITIAL_RATE_LIMITED]);
 }
 
 //
@@ -310,6 +310,39 @@ CxPlatEncrypt(
         uint8_t* Buffer
     );
 
+//
+// A range of plaintext, located outside of the buffer being encrypted, that is
+// to be encrypted into the buffer at the given offset.
+//
+typedef struct CXPLAT_CRYPT_SEGMENT {
+    const uint8_t* Source;
+    uint16_t Offset;
+    uint16_t Length;
+} CXPLAT_CRYPT_SEGMENT;
+
+//
+// Same as CxPlatEncrypt, except that the plaintext for each segment is read
+// from the segment's source instead of from 'Buffer'. This allows encrypting
+// directly from another buffer without first copying it into place. Segments
+// must be sorted by offset and not overlap.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_STATUS
+CxPlatEncryptGather(
+    _In_ CXPLAT_KEY* Key,
+    _In_reads_bytes_(CXPLAT_IV_LENGTH)
+        const uint8_t* const Iv,
+    _In_ uint16_t AuthDataLength,
+    _In_reads_bytes_opt_(AuthDataLength)
+        const uint8_t* const AuthData,
+    _In_ uint8_t SegmentCount,
+    _In_reads_opt_(SegmentCount)
+        const CXPLAT_CRYPT_SEGMENT* Segments,
+    _In_ uint16_t BufferLength,
+    _Inout_updates_bytes_(BufferLength)
+        uint8_t* Buffer
+    );
+
 //
 // Decrypts buffer with the given key. 'BufferLength' is the full encrypted
 // payload length on input. On output, the length shrinks by
@@ -329,6 +362,60 @@ CxPlatDecrypt(
         uint8_t* Buffer
     );
 
+//
+// The number of leading plaintext bytes CxPlatDecryptRedirect decrypts in place
+// before asking the caller where to write the rest.
+//
+#define CXPLAT_DECRYPT_REDIRECT_PEEK_LENGTH 32
+
+//
+// Invoked by CxPlatDecryptRedirect once the first 'PeekLength' bytes of the
+// plaintext are available in place. Returns where the plaintext starting at
+// '*RedirectOffset' (which must be at most 'PeekLength') should be written
+// to, or NULL to decrypt everything in place.
+//
+// N.B. The plaintext has NOT been authenticated when this is called (except
+// with BCrypt), so it may only be used to pick a destination.
+//
+typedef
+_IRQL_requires_max_(DISPATCH_LEVEL)
+_Function_class_(CXPLAT_DECRYPT_REDIRECT_CALLBACK)
+uint8_t*
+(CXPLAT_DECRYPT_REDIRECT_CALLBACK)(
+    _In_ void* Context,
+    _In_ uint16_t PlainTextLength,
+    _In_ uint16_t PeekLength,
+    _In_reads_bytes_(PeekLength)
+        const uint8_t* PlainText,
+    _Out_ uint16_t* RedirectOffset
+    );
+
+typedef CXPLAT_DECRYPT_REDIRECT_CALLBACK *CXPLAT_DECRYPT_REDIRECT_CALLBACK_HANDLER;
+
+//
+// Same as CxPlatDecrypt, except that the tail of the plaintext may be written
+// directly to a caller chosen location outside of 'Buffer' instead of in
+// place. The bytes of 'Buffer' past the redirect offset are left undefined.
+// If decryption fails, the redirected destination may have been written to.
+//
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_STATUS
+CxPlatDecryptRedirect(
+    _In_ CXPLAT_KEY* Key,
+    _In_reads_bytes_(CXPLAT_IV_LENGTH)
+        const uint8_t* const Iv,
+    _In_ uint16_t AuthDataLength,
+    _In_reads_bytes_opt_(AuthDataLength)
+        const uint8_t* const AuthData,
+    _In_ uint16_t BufferLength,
+    _Inout_updates_bytes_(BufferLength)
+        uint8_t* Buffer,
+    _In_opt_ CXPLAT_DECRYPT_REDIRECT_CALLBACK_HANDLER Callback,
+    _In_opt_ void* Context,
+    _Out_ uint16_t* RedirectOffset,
+    _Outptr_result_maybenull_ uint8_t** RedirectBuffer
+    );
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 QUIC_STATUS
 CxPlatHpKeyCreate(
@@ -162,6 +162,15 @@ typedef struct CXPLAT_SLIST_ENTRY {
 #define QUIC_POOL_TLS_AUX_DATA              '05cQ' // Qc50 - QUIC TLS Backing Aux data
 #define QUIC_POOL_TLS_RECORD_ENTRY          '15cQ' // Qc51 - QUIC TLS Backing Record storage
 #define QUIC_POOL_CIDSLIST                  '25cQ' // Qc52 - QUIC CID SLIST Entry
+#define QUIC_POOL_DATAGRAM_FEC              '35cQ' // Qc53 - QUIC datagram FEC state
+#define QUIC_POOL_DATAGRAM_RECV_BATCH       '45cQ' // Qc54 - QUIC datagram receive batch
+#define QUIC_POOL_SESSION_CACHE             '55cQ' // Qc55 - QUIC server session cache entry
+#define QUIC_POOL_REPLAY_FILTER             '65cQ' // Qc56 - QUIC 0-RTT replay filter
+#define QUIC_POOL_TLS_KEY_SHARE             '75cQ' // Qc57 - QUIC Platform TLS key share pool
+#define QUIC_POOL_SOURCE_LIMITER            '85cQ' // Qc58 - QUIC source prefix rate limiter
+#define QUIC_POOL_PATHS                     '95cQ' // Qc59 - QUIC connection path array
+#define QUIC_POOL_LISTENER_ALPN             'A5cQ' // Qc5A - QUIC listener ALPN index entries
+#define QUIC_POOL_TLS_OFFLOAD_CALLBACK      'B5cQ' // Qc5B - QUIC TLS callback deferred from the crypto pool
 
 typedef enum CXPLAT_THREAD_FLAGS {
     CXPLAT_THREAD_FLAG_NONE               = 0x0000,
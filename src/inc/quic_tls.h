@@ -57,6 +57,7 @@ typedef enum CXPLAT_TLS_CREDENTIAL_FLAGS {
 
     CXPLAT_TLS_CREDENTIAL_FLAG_NONE                 = 0x0000,
     CXPLAT_TLS_CREDENTIAL_FLAG_DISABLE_RESUMPTION   = 0x0001,   // Server only
+    CXPLAT_TLS_CREDENTIAL_FLAG_KEY_SHARE_POOL       = 0x0002,   // Server only
 
 } CXPLAT_TLS_CREDENTIAL_FLAGS;
 
@@ -529,6 +530,30 @@ QuicTlsPopulateOffloadKeys(
     _Inout_ CXPLAT_QEO_CONNECTION* Offload
     );
 
+#ifdef QUIC_TEST_APIS
+
+//
+// Test interface for the OpenSSL key share pool.
+//
+typedef struct CXPLAT_KEY_SHARE_POOL_STATS {
+
+    uint64_t Hits;      // Key shares handed out from the pool.
+    uint64_t Misses;    // Key shares generated because the pool was empty.
+    uint64_t Refilled;  // Keys added to the pool by the refill thread.
+    uint32_t Available; // Keys currently pooled, over all shards and groups.
+
+} CXPLAT_KEY_SHARE_POOL_STATS;
+
+//
+// Returns FALSE if the pool isn't running.
+//
+BOOLEAN
+CxPlatKeySharePoolGetStats(
+    _Out_ CXPLAT_KEY_SHARE_POOL_STATS* Stats
+    );
+
+#endif // QUIC_TEST_APIS
+
 #if defined(__cplusplus)
 }
 #endif
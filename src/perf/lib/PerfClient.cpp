@@ -188,6 +188,8 @@ PerfClient::Init(
     TryGetValue(argc, argv, "rc", &RepeatConnections);
     TryGetValue(argc, argv, "rstream", &RepeatStreams);
     TryGetValue(argc, argv, "rs", &RepeatStreams);
+    TryGetValue(argc, argv, "storm", &StormCount);
+    TryGetValue(argc, argv, "resume", &ResumeConnections);
 
     if ((RepeatConnections || RepeatStreams) && !RunTime) {
         WriteOutput("Must specify a 'runtime' if using a repeat parameter!\n");
@@ -203,6 +205,14 @@ PerfClient::Init(
             WriteOutput("TCP mode doesn't support CIBIR!\n");
             return QUIC_STATUS_INVALID_PARAMETER;
         }
+        if (StormCount) {
+            WriteOutput("TCP mode doesn't support 'storm'!\n");
+            return QUIC_STATUS_INVALID_PARAMETER;
+        }
+        if (ResumeConnections) {
+            WriteOutput("TCP mode doesn't support 'resume'!\n");
+            return QUIC_STATUS_INVALID_PARAMETER;
+        }
     }
 
     if ((Upload || Download) && !StreamCount) {
@@ -323,6 +333,10 @@ PerfClient::Start(
         if (ConnectionCount % WorkerCount > i) {
             Worker->ConnectionsQueued++;
         }
+        Worker->StormQueued = StormCount / WorkerCount;
+        if (StormCount % WorkerCount > i) {
+            Worker->StormQueued++;
+        }
 
         // Build up target hostname.
         Worker->Target.reset(new(std::nothrow) char[TargetLen + 10]);
@@ -376,6 +390,20 @@ PerfClient::Wait(
     unsigned long long CompletedConnections = GetConnectedConnections();
     unsigned long long CompletedStreams = GetStreamsCompleted();
 
+    if (StormCount && RunTime) {
+        unsigned long long HPS = GetStormHandshakes() * 1000 * 1000 / RunTime;
+        WriteOutput("Storm: %llu HPS\n", HPS);
+    }
+
+    if (ResumeConnections && RunTime) {
+        unsigned long long Resumed = GetConnectionsResumed();
+        unsigned long long Handshakes = CompletedConnections + GetStormHandshakes();
+        WriteOutput(
+            "Resumed: %llu HPS (%llu%% of handshakes)\n",
+            Resumed * 1000 * 1000 / RunTime,
+            Resumed * 100 / Handshakes);
+    }
+
     if (PrintIoRate) {
         if (CompletedConnections) {
             unsigned long long HPS = CompletedConnections * 1000 * 1000 / RunTime;
@@ -389,6 +417,9 @@ PerfClient::Wait(
         unsigned long long UploadRate = GetUploadRate();
         if (UploadRate) {
             WriteOutput("Result: Upload %llu kbps.\n", UploadRate);
+            if (!UseTCP) {
+                WriteOutput("Ack Frames: %llu received\n", (unsigned long long)GetAckFramesReceived());
+            }
         }
         unsigned long long DownloadRate = GetDownloadRate();
         if (DownloadRate) {
@@ -458,6 +489,9 @@ PerfClientWorker::WorkerThread() {
         while (Client->Running && ConnectionsCreated < ConnectionsQueued) {
             StartNewConnection();
         }
+        while (Client->Running && StormActive < StormQueued) {
+            StartNewStormConnection();
+        }
         WakeEvent.WaitForever();
     }
 }
@@ -469,6 +503,51 @@ PerfClientWorker::StartNewConnection() {
     ConnectionPool.Alloc(*Client, *this)->Initialize();
 }
 
+void
+PerfClientWorker::StartNewStormConnection() {
+    InterlockedIncrement64((int64_t*)&StormActive);
+    ConnectionPool.Alloc(*Client, *this, true)->Initialize();
+}
+
+void
+PerfClientWorker::OnStormConnectionComplete() {
+    InterlockedDecrement64((int64_t*)&StormActive);
+    if (Client->Running) {
+        WakeEvent.Set(); // Replace it with a new one.
+    }
+}
+
+void
+PerfClientWorker::SaveResumptionTicket(
+    _In_ uint32_t Length,
+    _In_reads_(Length) const uint8_t* Ticket
+    ) {
+    UniquePtr<uint8_t[]> NewTicket(new(std::nothrow) uint8_t[Length]);
+    if (!NewTicket) {
+        return;
+    }
+    CxPlatCopyMemory(NewTicket.get(), Ticket, Length);
+    Lock.Acquire();
+    ResumptionTicket.reset(NewTicket.release());
+    ResumptionTicketLength = Length;
+    Lock.Release();
+}
+
+UniquePtr<uint8_t[]>
+PerfClientWorker::TakeResumptionTicket(
+    _Out_ uint32_t* Length
+    ) {
+    //
+    // Each ticket is only used once, as the server may only accept it once.
+    //
+    Lock.Acquire();
+    UniquePtr<uint8_t[]> Ticket(ResumptionTicket.release());
+    *Length = ResumptionTicketLength;
+    ResumptionTicketLength = 0;
+    Lock.Release();
+    return Ticket;
+}
+
 void
 PerfClientWorker::OnConnectionComplete() {
     InterlockedIncrement64((int64_t*)&ConnectionsCompleted);
@@ -607,6 +686,24 @@ PerfClientConnection::Initialize() {
             return;
         }
 
+        if (Client.ResumeConnections) {
+            uint32_t TicketLength;
+            UniquePtr<uint8_t[]> Ticket = Worker.TakeResumptionTicket(&TicketLength);
+            if (Ticket) {
+                Status =
+                    MsQuic->SetParam(
+                        Handle,
+                        QUIC_PARAM_CONN_RESUMPTION_TICKET,
+                        TicketLength,
+                        Ticket.get());
+                if (QUIC_FAILED(Status)) {
+                    WriteOutput("SetResumptionTicket failed, 0x%x\n", Status);
+                    Worker.ConnectionPool.Free(this);
+                    return;
+                }
+            }
+        }
+
         Status =
             MsQuic->ConnectionStart(
                 Handle,
@@ -637,17 +734,48 @@ PerfClientConnection::Initialize() {
 }
 
 void
-PerfClientConnection::OnHandshakeComplete() {
-    InterlockedIncrement64((int64_t*)&Worker.ConnectionsConnected);
-    if (!Client.StreamCount) {
-        WorkerConnComplete = true;
-        Worker.OnConnectionComplete();
-        Shutdown();
+PerfClientConnection::OnHandshakeComplete(bool Resumed) {
+    if (Resumed) {
+        InterlockedIncrement64((int64_t*)&Worker.ConnectionsResumed);
+    }
+    if (Storm) {
+        InterlockedIncrement64((int64_t*)&Worker.StormHandshakes);
     } else {
-        for (uint32_t i = 0; i < Client.StreamCount; ++i) {
-            StartNewStream();
+        InterlockedIncrement64((int64_t*)&Worker.ConnectionsConnected);
+        if (Client.StreamCount) {
+            for (uint32_t i = 0; i < Client.StreamCount; ++i) {
+                StartNewStream();
+            }
+            return;
         }
     }
+    if (Client.ResumeConnections && !TicketReceived) {
+        WaitingForTicket = true; // Keep the connection until the next one can resume from it.
+        return;
+    }
+    OnHandshakeOnlyComplete();
+}
+
+void
+PerfClientConnection::OnHandshakeOnlyComplete() {
+    if (!Storm) {
+        WorkerConnComplete = true;
+        Worker.OnConnectionComplete();
+    }
+    Shutdown();
+}
+
+void
+PerfClientConnection::OnResumptionTicket(
+    _In_ uint32_t Length,
+    _In_reads_(Length) const uint8_t* Ticket
+    ) {
+    TicketReceived = true;
+    Worker.SaveResumptionTicket(Length, Ticket);
+    if (WaitingForTicket) {
+        WaitingForTicket = false;
+        OnHandshakeOnlyComplete();
+    }
 }
 
 void
@@ -667,7 +795,9 @@ PerfClientConnection::OnShutdownComplete() {
         StreamTable.EnumEnd(&Enum);
     }
 
-    if (!WorkerConnComplete) {
+    if (Storm) {
+        Worker.OnStormConnectionComplete();
+    } else if (!WorkerConnComplete) {
         Worker.OnConnectionComplete();
     }
     Worker.ConnectionPool.Free(this);
@@ -748,12 +878,37 @@ PerfClientConnection::ConnectionCallback(
     ) {
     switch (Event->Type) {
     case QUIC_CONNECTION_EVENT_CONNECTED:
-        OnHandshakeComplete();
+        OnHandshakeComplete(Event->CONNECTED.SessionResumed != FALSE);
+        break;
+    case QUIC_CONNECTION_EVENT_RESUMPTION_TICKET_RECEIVED:
+        if (Client.ResumeConnections) {
+            OnResumptionTicket(
+                Event->RESUMPTION_TICKET_RECEIVED.ResumptionTicketLength,
+                Event->RESUMPTION_TICKET_RECEIVED.ResumptionTicket);
+        }
         break;
     case QUIC_CONNECTION_EVENT_SHUTDOWN_COMPLETE:
         if (Client.PrintConnections) {
             QuicPrintConnectionStatistics(MsQuic, Handle);
         }
+        if (Client.PrintThroughput && !Storm) {
+            //
+            // Count the ACKs the server sent for the upload, to measure the
+            // effect of ACK frequency tuning (-ackfreq).
+            //
+            QUIC_STATISTICS_V2 Stats;
+            uint32_t StatsSize = sizeof(Stats);
+            if (QUIC_SUCCEEDED(
+                MsQuic->GetParam(
+                    Handle,
+                    QUIC_PARAM_CONN_STATISTICS_V2,
+                    &StatsSize,
+                    &Stats))) {
+                InterlockedExchangeAdd64(
+                    (int64_t*)&Worker.AckFramesReceived,
+                    (int64_t)Stats.RecvValidAckFrames);
+            }
+        }
         OnShutdownComplete();
         break;
     default:
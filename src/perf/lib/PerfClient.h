@@ -25,11 +25,16 @@ struct PerfClientConnection {
     uint64_t StreamsCreated {0};
     uint64_t StreamsActive {0};
     bool WorkerConnComplete {false}; // Indicated completion to worker
-    PerfClientConnection(_In_ PerfClient& Client, _In_ PerfClientWorker& Worker) : Client(Client), Worker(Worker) { }
+    bool Storm {false}; // Handshake-only connection, not part of the scenario
+    bool TicketReceived {false};
+    bool WaitingForTicket {false}; // Handshake-only, shuts down once the ticket arrives
+    PerfClientConnection(_In_ PerfClient& Client, _In_ PerfClientWorker& Worker, bool Storm = false) : Client(Client), Worker(Worker), Storm(Storm) { }
     ~PerfClientConnection();
     void Initialize();
     void StartNewStream();
-    void OnHandshakeComplete();
+    void OnHandshakeComplete(bool Resumed = false);
+    void OnHandshakeOnlyComplete();
+    void OnResumptionTicket(_In_ uint32_t Length, _In_reads_(Length) const uint8_t* Ticket);
     void OnShutdownComplete();
     void OnStreamShutdown();
     void Shutdown();
@@ -95,6 +100,13 @@ struct QUIC_CACHEALIGN PerfClientWorker {
     uint64_t ConnectionsCompleted {0};
     uint64_t StreamsStarted {0};
     uint64_t StreamsCompleted {0};
+    uint64_t StormQueued {0};
+    uint64_t StormActive {0};
+    uint64_t StormHandshakes {0};
+    uint64_t ConnectionsResumed {0};
+    uint64_t AckFramesReceived {0};
+    UniquePtr<uint8_t[]> ResumptionTicket; // Protected by Lock
+    uint32_t ResumptionTicketLength {0};
     uint64_t UploadRate {0};
     uint64_t DownloadRate {0};
     UniquePtr<char[]> Target;
@@ -112,6 +124,9 @@ struct QUIC_CACHEALIGN PerfClientWorker {
         WakeEvent.Set();
     }
     void OnConnectionComplete();
+    void OnStormConnectionComplete();
+    void SaveResumptionTicket(_In_ uint32_t Length, _In_reads_(Length) const uint8_t* Ticket);
+    UniquePtr<uint8_t[]> TakeResumptionTicket(_Out_ uint32_t* Length);
     static CXPLAT_THREAD_CALLBACK(s_WorkerThread, Context) {
         ((PerfClientWorker*)Context)->WorkerThread();
         CXPLAT_THREAD_RETURN(QUIC_STATUS_SUCCESS);
@@ -126,6 +141,7 @@ private:
         }
     }
     void StartNewConnection();
+    void StartNewStormConnection();
     void WorkerThread();
 };
 
@@ -171,7 +187,11 @@ struct PerfClient {
             .SetSendBufferingEnabled(false)
             .SetCongestionControlAlgorithm(PerfDefaultCongestionControl)
             .SetEcnEnabled(PerfDefaultEcnEnabled)
-            .SetEncryptionOffloadAllowed(PerfDefaultQeoAllowed),
+            .SetEncryptionOffloadAllowed(PerfDefaultQeoAllowed)
+            .SetAdaptiveAckFrequencyEnabled(PerfDefaultAckFrequencyTuning)
+            .SetEncryptInCopyEnabled(PerfDefaultEncryptInCopy)
+            .SetDecryptToAppBuffersEnabled(PerfDefaultDecryptToAppBuffers)
+            .SetTlsOffloadEnabled(PerfDefaultTlsOffload),
         CredentialConfig};
     // Target parameters
     UniquePtr<char[]> Target;
@@ -209,6 +229,8 @@ struct PerfClient {
     uint8_t RepeatConnections {FALSE};
     uint8_t RepeatStreams {FALSE};
     uint64_t RunTime {0};
+    uint32_t StormCount {0};
+    uint8_t ResumeConnections {FALSE};
 
     struct PerfIoBuffer {
         QUIC_BUFFER* Buffer {nullptr};
@@ -260,6 +282,27 @@ struct PerfClient {
         }
         return StreamsCompleted;
     }
+    uint64_t GetStormHandshakes() const {
+        uint64_t StormHandshakes = 0;
+        for (uint32_t i = 0; i < WorkerCount; ++i) {
+            StormHandshakes += Workers[i].StormHandshakes;
+        }
+        return StormHandshakes;
+    }
+    uint64_t GetConnectionsResumed() const {
+        uint64_t ConnectionsResumed = 0;
+        for (uint32_t i = 0; i < WorkerCount; ++i) {
+            ConnectionsResumed += Workers[i].ConnectionsResumed;
+        }
+        return ConnectionsResumed;
+    }
+    uint64_t GetAckFramesReceived() const {
+        uint64_t AckFramesReceived = 0;
+        for (uint32_t i = 0; i < WorkerCount; ++i) {
+            AckFramesReceived += Workers[i].AckFramesReceived;
+        }
+        return AckFramesReceived;
+    }
     uint64_t GetUploadRate() const {
         uint64_t UploadRate = 0;
         for (uint32_t i = 0; i < WorkerCount; ++i) {
@@ -30,6 +30,8 @@ PerfServer::Init(
     }
 
     TryGetValue(argc, argv, "stats", &PrintStats);
+    TryGetValue(argc, argv, "appbuffers", &AppOwnedBuffers);
+    TryGetValue(argc, argv, "resume", &SendResumptionTickets);
 
     const char* LocalAddress = nullptr;
     uint16_t Port = 0;
@@ -164,6 +166,23 @@ PerfServer::Wait(
         CxPlatEventWaitForever(*StopEvent);
     }
     Registration.Shutdown(QUIC_CONNECTION_SHUTDOWN_FLAG_NONE, 0);
+
+    if (PerfDefaultSessionCache) {
+        uint64_t Counters[QUIC_PERF_COUNTER_MAX];
+        uint32_t BufferLength = sizeof(Counters);
+        if (QUIC_SUCCEEDED(
+                MsQuic->GetParam(
+                    nullptr,
+                    QUIC_PARAM_GLOBAL_PERF_COUNTERS,
+                    &BufferLength,
+                    Counters))) {
+            WriteOutput(
+                "Session Cache: %llu hits, %llu misses\n",
+                (unsigned long long)Counters[QUIC_PERF_COUNTER_SESSION_CACHE_HIT],
+                (unsigned long long)Counters[QUIC_PERF_COUNTER_SESSION_CACHE_MISS]);
+        }
+    }
+
     return QUIC_STATUS_SUCCESS;
 }
 
@@ -215,6 +234,12 @@ PerfServer::ConnectionCallback(
     _Inout_ QUIC_CONNECTION_EVENT* Event
     ) {
     switch (Event->Type) {
+    case QUIC_CONNECTION_EVENT_CONNECTED:
+        if (SendResumptionTickets) {
+            MsQuic->ConnectionSendResumptionTicket(
+                ConnectionHandle, QUIC_SEND_RESUMPTION_FLAG_FINAL, 0, nullptr);
+        }
+        break;
     case QUIC_CONNECTION_EVENT_SHUTDOWN_COMPLETE:
         if (!Event->SHUTDOWN_COMPLETE.AppCloseInProgress) {
             if (PrintStats) {
@@ -233,6 +258,14 @@ PerfServer::ConnectionCallback(
                 return ((StreamContext*)Context)->Server->StreamCallback((StreamContext*)Context, Stream, Event);
             };
         MsQuic->SetCallbackHandler(Event->PEER_STREAM_STARTED.Stream, (void*)Handler, Context);
+        if (AppOwnedBuffers) {
+            Context->AppRecvBuffer =
+                (uint8_t*)CXPLAT_ALLOC_NONPAGED(
+                    PERF_APP_RECV_BUFFER_COUNT * PERF_APP_RECV_BUFFER_SIZE, QUIC_POOL_PERF);
+            if (Context->AppRecvBuffer) { // Otherwise just fall back to internal buffers.
+                ProvideAppRecvBuffers(Context, Event->PEER_STREAM_STARTED.Stream);
+            }
+        }
         break;
     }
     default:
@@ -332,6 +365,10 @@ PerfServer::StreamCallback(
                 Context->ResponseSizeSet = true;
             }
         }
+        if (Context->AppRecvBuffer) {
+            Context->AppRecvBytes += Event->RECEIVE.TotalBufferLength;
+            ProvideAppRecvBuffers(Context, StreamHandle);
+        }
         break;
     case QUIC_STREAM_EVENT_SEND_COMPLETE:
         Context->OutstandingBytes -= ((QUIC_BUFFER*)Event->SEND_COMPLETE.ClientContext)->Length;
@@ -379,6 +416,32 @@ PerfServer::StreamCallback(
     return QUIC_STATUS_SUCCESS;
 }
 
+void
+PerfServer::ProvideAppRecvBuffers(
+    _In_ StreamContext* Context,
+    _In_ HQUIC Handle
+    ) {
+    //
+    // The stream's data is consumed in order, so a buffer in the ring can be
+    // given back once everything it was last provided for has been received.
+    //
+    QUIC_BUFFER Buffers[PERF_APP_RECV_BUFFER_COUNT];
+    uint32_t BufferCount = 0;
+    while (BufferCount < PERF_APP_RECV_BUFFER_COUNT &&
+           (Context->AppRecvBuffersProvided < PERF_APP_RECV_BUFFER_COUNT ||
+            Context->AppRecvBytes >=
+                (Context->AppRecvBuffersProvided - PERF_APP_RECV_BUFFER_COUNT + 1) * PERF_APP_RECV_BUFFER_SIZE)) {
+        const uint32_t Index =
+            (uint32_t)(Context->AppRecvBuffersProvided++ % PERF_APP_RECV_BUFFER_COUNT);
+        Buffers[BufferCount].Length = PERF_APP_RECV_BUFFER_SIZE;
+        Buffers[BufferCount].Buffer = Context->AppRecvBuffer + Index * PERF_APP_RECV_BUFFER_SIZE;
+        BufferCount++;
+    }
+    if (BufferCount != 0) {
+        MsQuic->StreamProvideReceiveBuffers(Handle, BufferCount, Buffers);
+    }
+}
+
 void
 PerfServer::SendResponse(
     _In_ StreamContext* Context,
@@ -18,6 +18,13 @@ Abstract:
 class PerfServer;
 struct StreamContext;
 
+//
+// When receiving into app-owned buffers, each stream gets a ring of this many
+// buffers, which are handed back to MsQuic as soon as they are consumed.
+//
+#define PERF_APP_RECV_BUFFER_COUNT          8
+#define PERF_APP_RECV_BUFFER_SIZE           PERF_DEFAULT_IO_SIZE
+
 typedef enum SYNTHETIC_DELAY_TYPE {
     SYNTHETIC_DELAY_FIXED,
     SYNTHETIC_DELAY_VARIABLE
@@ -100,6 +107,11 @@ public:
         );
     void
     SendDelayedResponse(_In_ StreamContext* Context);
+    void
+    ProvideAppRecvBuffers(
+        _In_ StreamContext* Context,
+        _In_ HQUIC Handle
+        );
 
     static CXPLAT_DATAPATH_RECEIVE_CALLBACK DatapathReceive;
     static void DatapathUnreachable(_In_ CXPLAT_SOCKET*, _In_ void*, _In_ const QUIC_ADDR*) { }
@@ -183,11 +195,19 @@ private:
             .SetCongestionControlAlgorithm(PerfDefaultCongestionControl)
             .SetEcnEnabled(PerfDefaultEcnEnabled)
             .SetEncryptionOffloadAllowed(PerfDefaultQeoAllowed)
+            .SetAdaptiveAckFrequencyEnabled(PerfDefaultAckFrequencyTuning)
+            .SetEncryptInCopyEnabled(PerfDefaultEncryptInCopy)
+            .SetDecryptToAppBuffersEnabled(PerfDefaultDecryptToAppBuffers)
+            .SetTlsOffloadEnabled(PerfDefaultTlsOffload)
+            .SetServerSessionCacheEnabled(PerfDefaultSessionCache)
+            .SetKeySharePoolEnabled(PerfDefaultKeySharePool)
             .SetOneWayDelayEnabled(true)};
     MsQuicListener Listener {Registration, CleanUpManual, ListenerCallbackStatic, this};
     QUIC_ADDR LocalAddr;
     CXPLAT_EVENT* StopEvent {nullptr};
     uint8_t PrintStats {FALSE};
+    uint8_t AppOwnedBuffers {FALSE};
+    uint8_t SendResumptionTickets {FALSE};
 
     TcpEngine Engine;
     TcpConfiguration TcpConfig;
@@ -234,6 +254,9 @@ struct StreamContext {
     }
     ~StreamContext() {
         CXPLAT_DBG_ASSERT(RefCount == 0);
+        if (AppRecvBuffer != nullptr) {
+            CXPLAT_FREE(AppRecvBuffer, QUIC_POOL_PERF);
+        }
         if (IsTcp) {
             if (Handle != nullptr) ((TcpConnection*)Handle)->Release();
         } else {
@@ -266,6 +289,9 @@ struct StreamContext {
     uint64_t BytesSent{ 0 };
     uint64_t OutstandingBytes{ 0 };
     QUIC_BUFFER LastBuffer;
+    uint8_t* AppRecvBuffer{ nullptr };
+    uint64_t AppRecvBytes{ 0 };
+    uint64_t AppRecvBuffersProvided{ 0 };
     void* Handle{ nullptr };
     bool IsTcp{ false };
     CXPLAT_REF_COUNT RefCount;
@@ -52,6 +52,12 @@ extern TCP_EXECUTION_PROFILE TcpDefaultExecutionProfile;
 extern QUIC_CONGESTION_CONTROL_ALGORITHM PerfDefaultCongestionControl;
 extern uint8_t PerfDefaultEcnEnabled;
 extern uint8_t PerfDefaultQeoAllowed;
+extern uint8_t PerfDefaultAckFrequencyTuning;
+extern uint8_t PerfDefaultEncryptInCopy;
+extern uint8_t PerfDefaultDecryptToAppBuffers;
+extern uint8_t PerfDefaultTlsOffload;
+extern uint8_t PerfDefaultSessionCache;
+extern uint8_t PerfDefaultKeySharePool;
 extern uint8_t PerfDefaultHighPriority;
 extern uint8_t PerfDefaultAffinitizeThreads;
 extern uint8_t PerfDefaultDscpValue;
@@ -27,6 +27,12 @@ TCP_EXECUTION_PROFILE TcpDefaultExecutionProfile = TCP_EXECUTION_PROFILE_LOW_LAT
 QUIC_CONGESTION_CONTROL_ALGORITHM PerfDefaultCongestionControl = QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC;
 uint8_t PerfDefaultEcnEnabled = false;
 uint8_t PerfDefaultQeoAllowed = false;
+uint8_t PerfDefaultAckFrequencyTuning = false;
+uint8_t PerfDefaultEncryptInCopy = false;
+uint8_t PerfDefaultDecryptToAppBuffers = false;
+uint8_t PerfDefaultTlsOffload = false;
+uint8_t PerfDefaultSessionCache = false;
+uint8_t PerfDefaultKeySharePool = false;
 uint8_t PerfDefaultHighPriority = false;
 uint8_t PerfDefaultAffinitizeThreads = false;
 uint8_t PerfDefaultDscpValue = 0;
@@ -84,6 +90,10 @@ PrintHelp(
         "  -delayType:<fixed/variable>    Optional delay type can be specified in conjunction with the 'delay' argument.\n"
         "                                 'fixed' - introduce the specified delay for each request (default).\n"
         "                                 'variable'- introduce a statistical variability to the specified delay (user mode only).\n"
+        "  -appbuffers:<0/1>        Receive stream data into app-owned buffers. (def:0)\n"
+        "  -resume:<0/1>            Send a resumption ticket to each client after the handshake. (def:0)\n"
+        "  -sessioncache:<0/1>      Keeps resumption state in a server-side session cache instead of in the tickets. (def:0)\n"
+        "  -keysharepool:<0/1>      Takes ECDHE key shares from a pool generated ahead of time. OpenSSL only. (def:0)\n"
         "\n"
         "Client: secnetperf -target:<hostname/ip> [options]\n"
         "\n"
@@ -124,15 +134,21 @@ PrintHelp(
         "  -rconn:<0/1>             Repeat the scenario at the connection level. (def:0)\n"
         "  -rstream:<0/1>           Repeat the scenario at the stream level. (def:0)\n"
         "  -runtime:<####>[unit]    The total runtime, with an optional unit (def unit is us). Only relevant for repeat scenarios. (def:0)\n"
+        "  -storm:<####>            The number of extra, handshake-only connections to keep repeating alongside the scenario. (def:0)\n"
+        "  -resume:<0/1>            Resume each new connection with the last ticket received by its worker. Requires a server with 'resume' enabled. (def:0)\n"
         "\n"
         "Both (client & server) options:\n"
         "  -exec:<profile>          Execution profile to use.\n"
         "                            - {lowlat, maxtput, scavenger, realtime}.\n"
         "  -cc:<algo>               Congestion control algorithm to use.\n"
-        "                            - {cubic, bbr}.\n"
+        "                            - {cubic, bbr, bbr3, prague}.\n"
         "  -pollidle:<time_us>      Amount of time to poll while idle before sleeping (default: 0).\n"
         "  -ecn:<0/1>               Enables/disables sender-side ECN support. (def:0)\n"
         "  -qeo:<0/1>               Allows/disallowes QUIC encryption offload. (def:0)\n"
+        "  -ackfreq:<0/1>           Enables/disables adaptive ACK frequency tuning. (def:0)\n"
+        "  -zerocopy:<0/1>          Enables/disables encrypting directly from the send buffers. (def:0)\n"
+        "  -decryptdirect:<0/1>     Enables/disables decrypting directly into app-owned receive buffers. (def:0)\n"
+        "  -tlsoffload:<0/1>        Enables/disables running TLS handshake processing on the crypto thread pool. (def:0)\n"
 #ifndef _KERNEL_MODE
         "  -io:<mode>               Configures a requested network IO model to be used.\n"
         "                            - {iocp, xdp, qtip, epoll, iouring, kqueue}\n"
@@ -281,8 +297,12 @@ QuicMainStart(
     if (CcName != nullptr) {
         if (IsValue(CcName, "cubic")) {
             PerfDefaultCongestionControl = QUIC_CONGESTION_CONTROL_ALGORITHM_CUBIC;
+        } else if (IsValue(CcName, "bbr3")) {
+            PerfDefaultCongestionControl = QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3;
         } else if (IsValue(CcName, "bbr")) {
             PerfDefaultCongestionControl = QUIC_CONGESTION_CONTROL_ALGORITHM_BBR;
+        } else if (IsValue(CcName, "prague")) {
+            PerfDefaultCongestionControl = QUIC_CONGESTION_CONTROL_ALGORITHM_PRAGUE;
         } else {
             WriteOutput("Failed to parse congestion control algorithm[%s], use cubic as default\n", CcName);
         }
@@ -290,6 +310,12 @@ QuicMainStart(
 
     TryGetValue(argc, argv, "ecn", &PerfDefaultEcnEnabled);
     TryGetValue(argc, argv, "qeo", &PerfDefaultQeoAllowed);
+    TryGetValue(argc, argv, "ackfreq", &PerfDefaultAckFrequencyTuning);
+    TryGetValue(argc, argv, "zerocopy", &PerfDefaultEncryptInCopy);
+    TryGetValue(argc, argv, "decryptdirect", &PerfDefaultDecryptToAppBuffers);
+    TryGetValue(argc, argv, "tlsoffload", &PerfDefaultTlsOffload);
+    TryGetValue(argc, argv, "sessioncache", &PerfDefaultSessionCache);
+    TryGetValue(argc, argv, "keysharepool", &PerfDefaultKeySharePool);
     TryGetValue(argc, argv, "dscp", &PerfDefaultDscpValue);
     if (PerfDefaultDscpValue > CXPLAT_MAX_DSCP) {
         WriteOutput("DSCP Value %u is outside the valid range (0-63). Using 0.\n", PerfDefaultDscpValue);
@@ -468,6 +468,35 @@ CxPlatEncrypt(
     return NtStatusToQuicStatus(Status);
 }
 
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_STATUS
+CxPlatEncryptGather(
+    _In_ CXPLAT_KEY* Key,
+    _In_reads_bytes_(CXPLAT_IV_LENGTH)
+        const uint8_t* const Iv,
+    _In_ uint16_t AuthDataLength,
+    _In_reads_bytes_opt_(AuthDataLength)
+        const uint8_t* const AuthData,
+    _In_ uint8_t SegmentCount,
+    _In_reads_opt_(SegmentCount)
+        const CXPLAT_CRYPT_SEGMENT* Segments,
+    _In_ uint16_t BufferLength,
+    _Inout_updates_bytes_(BufferLength)
+        uint8_t* Buffer
+    )
+{
+    //
+    // BCrypt only supports a single contiguous input per call (without the
+    // more expensive chaining mode), so just copy the segments into place.
+    //
+    for (uint8_t i = 0; i < SegmentCount; ++i) {
+        CXPLAT_DBG_ASSERT(Segments[i].Offset + Segments[i].Length <= BufferLength - CXPLAT_ENCRYPTION_OVERHEAD);
+        CxPlatCopyMemory(Buffer + Segments[i].Offset, Segments[i].Source, Segments[i].Length);
+    }
+
+    return CxPlatEncrypt(Key, Iv, AuthDataLength, AuthData, BufferLength, Buffer);
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 QUIC_STATUS
 CxPlatDecrypt(
@@ -515,6 +544,58 @@ CxPlatDecrypt(
     return NtStatusToQuicStatus(Status);
 }
 
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_STATUS
+CxPlatDecryptRedirect(
+    _In_ CXPLAT_KEY* Key,
+    _In_reads_bytes_(CXPLAT_IV_LENGTH)
+        const uint8_t* const Iv,
+    _In_ uint16_t AuthDataLength,
+    _In_reads_bytes_opt_(AuthDataLength)
+        const uint8_t* const AuthData,
+    _In_ uint16_t BufferLength,
+    _Inout_updates_bytes_(BufferLength)
+        uint8_t* Buffer,
+    _In_opt_ CXPLAT_DECRYPT_REDIRECT_CALLBACK_HANDLER Callback,
+    _In_opt_ void* Context,
+    _Out_ uint16_t* RedirectOffset,
+    _Outptr_result_maybenull_ uint8_t** RedirectBuffer
+    )
+{
+    //
+    // BCrypt can't produce partial plaintext without the more expensive
+    // chaining mode, so decrypt (and authenticate) everything in place first
+    // and then copy the redirected part out.
+    //
+    const uint16_t PlainTextLength = BufferLength - CXPLAT_ENCRYPTION_OVERHEAD;
+    *RedirectOffset = PlainTextLength;
+    *RedirectBuffer = NULL;
+
+    QUIC_STATUS Status =
+        CxPlatDecrypt(Key, Iv, AuthDataLength, AuthData, BufferLength, Buffer);
+    if (QUIC_FAILED(Status) || Callback == NULL ||
+        PlainTextLength <= CXPLAT_DECRYPT_REDIRECT_PEEK_LENGTH) {
+        return Status;
+    }
+
+    uint16_t Split = CXPLAT_DECRYPT_REDIRECT_PEEK_LENGTH;
+    uint8_t* Destination =
+        Callback(
+            Context,
+            PlainTextLength,
+            CXPLAT_DECRYPT_REDIRECT_PEEK_LENGTH,
+            Buffer,
+            &Split);
+    if (Destination != NULL) {
+        CXPLAT_DBG_ASSERT(Split <= CXPLAT_DECRYPT_REDIRECT_PEEK_LENGTH);
+        CxPlatCopyMemory(Destination, Buffer + Split, PlainTextLength - Split);
+        *RedirectOffset = Split;
+        *RedirectBuffer = Destination;
+    }
+
+    return Status;
+}
+
 _IRQL_requires_max_(DISPATCH_LEVEL)
 QUIC_STATUS
 CxPlatHpKeyCreate(
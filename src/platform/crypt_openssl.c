@@ -141,6 +141,8 @@ CxPlatCryptInitialize(
         return QUIC_STATUS_TLS_ERROR;
     }
 
+    CxPlatKeySharePoolInitialize();
+
     //
     // Preload ciphers
     //
@@ -205,6 +207,8 @@ CxPlatCryptUninitialize(
     void
     )
 {
+    CxPlatKeySharePoolUninitialize();
+
     EVP_CIPHER_free(CXPLAT_AES_128_GCM_ALG_HANDLE);
     CXPLAT_AES_128_GCM_ALG_HANDLE = NULL;
     EVP_CIPHER_free(CXPLAT_AES_256_GCM_ALG_HANDLE);
@@ -324,6 +328,35 @@ CxPlatEncrypt(
     _When_(BufferLength <= CXPLAT_ENCRYPTION_OVERHEAD, _Out_writes_bytes_(BufferLength))
         uint8_t* Buffer
     )
+{
+    return
+        CxPlatEncryptGather(
+            Key,
+            Iv,
+            AuthDataLength,
+            AuthData,
+            0,
+            NULL,
+            BufferLength,
+            Buffer);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_STATUS
+CxPlatEncryptGather(
+    _In_ CXPLAT_KEY* Key,
+    _In_reads_bytes_(CXPLAT_IV_LENGTH)
+        const uint8_t* const Iv,
+    _In_ uint16_t AuthDataLength,
+    _In_reads_bytes_opt_(AuthDataLength)
+        const uint8_t* const AuthData,
+    _In_ uint8_t SegmentCount,
+    _In_reads_opt_(SegmentCount)
+        const CXPLAT_CRYPT_SEGMENT* Segments,
+    _In_ uint16_t BufferLength,
+    _Inout_updates_bytes_(BufferLength)
+        uint8_t* Buffer
+    )
 {
     CXPLAT_DBG_ASSERT(CXPLAT_ENCRYPTION_OVERHEAD <= BufferLength);
 
@@ -351,12 +384,50 @@ CxPlatEncrypt(
         return QUIC_STATUS_TLS_ERROR;
     }
 
-    if (EVP_EncryptUpdate(CipherCtx, Buffer, &OutLen, Buffer, (int)PlainTextLength) != 1) {
-        QuicTraceEvent(
-            LibraryError,
-            "[ lib] ERROR, %s.",
-            "EVP_EncryptUpdate (Cipher) failed");
-        return QUIC_STATUS_TLS_ERROR;
+    //
+    // AEAD ciphers are stream ciphers as far as the plaintext is concerned, so
+    // the plaintext can be fed in as any number of (in order) pieces, each of
+    // which is either already in place or copied in by the encryption itself.
+    //
+    uint16_t Offset = 0;
+    for (uint32_t i = 0; i <= SegmentCount; ++i) {
+        const uint16_t End =
+            i < SegmentCount ? Segments[i].Offset : PlainTextLength;
+        CXPLAT_DBG_ASSERT(End >= Offset);
+        CXPLAT_DBG_ASSERT(End <= PlainTextLength);
+
+        if (End > Offset &&
+            EVP_EncryptUpdate(
+                CipherCtx,
+                Buffer + Offset,
+                &OutLen,
+                Buffer + Offset,
+                (int)(End - Offset)) != 1) {
+            QuicTraceEvent(
+                LibraryError,
+                "[ lib] ERROR, %s.",
+                "EVP_EncryptUpdate (Cipher) failed");
+            return QUIC_STATUS_TLS_ERROR;
+        }
+
+        if (i == SegmentCount) {
+            break;
+        }
+
+        CXPLAT_DBG_ASSERT(Segments[i].Offset + Segments[i].Length <= PlainTextLength);
+        if (EVP_EncryptUpdate(
+                CipherCtx,
+                Buffer + Segments[i].Offset,
+                &OutLen,
+                Segments[i].Source,
+                (int)Segments[i].Length) != 1) {
+            QuicTraceEvent(
+                LibraryError,
+                "[ lib] ERROR, %s.",
+                "EVP_EncryptUpdate (Cipher) failed");
+            return QUIC_STATUS_TLS_ERROR;
+        }
+        Offset = Segments[i].Offset + Segments[i].Length;
     }
 
     if (EVP_EncryptFinal_ex(CipherCtx, Tag, &OutLen) != 1) {
@@ -394,6 +465,40 @@ CxPlatDecrypt(
     _Inout_updates_bytes_(BufferLength)
         uint8_t* Buffer
     )
+{
+    uint16_t RedirectOffset;
+    uint8_t* RedirectBuffer;
+    return
+        CxPlatDecryptRedirect(
+            Key,
+            Iv,
+            AuthDataLength,
+            AuthData,
+            BufferLength,
+            Buffer,
+            NULL,
+            NULL,
+            &RedirectOffset,
+            &RedirectBuffer);
+}
+
+_IRQL_requires_max_(DISPATCH_LEVEL)
+QUIC_STATUS
+CxPlatDecryptRedirect(
+    _In_ CXPLAT_KEY* Key,
+    _In_reads_bytes_(CXPLAT_IV_LENGTH)
+        const uint8_t* const Iv,
+    _In_ uint16_t AuthDataLength,
+    _In_reads_bytes_opt_(AuthDataLength)
+        const uint8_t* const AuthData,
+    _In_ uint16_t BufferLength,
+    _Inout_updates_bytes_(BufferLength)
+        uint8_t* Buffer,
+    _In_opt_ CXPLAT_DECRYPT_REDIRECT_CALLBACK_HANDLER Callback,
+    _In_opt_ void* Context,
+    _Out_ uint16_t* RedirectOffset,
+    _Outptr_result_maybenull_ uint8_t** RedirectBuffer
+    )
 {
     CXPLAT_DBG_ASSERT(CXPLAT_ENCRYPTION_OVERHEAD <= BufferLength);
 
@@ -404,6 +509,9 @@ CxPlatDecrypt(
     EVP_CIPHER_CTX* CipherCtx = (EVP_CIPHER_CTX*)Key;
     OSSL_PARAM AlgParam[2];
 
+    *RedirectOffset = CipherTextLength;
+    *RedirectBuffer = NULL;
+
     if (EVP_DecryptInit_ex(CipherCtx, NULL, NULL, NULL, Iv) != 1) {
         QuicTraceEvent(
             LibraryErrorStatus,
@@ -423,7 +531,17 @@ CxPlatDecrypt(
         return QUIC_STATUS_TLS_ERROR;
     }
 
-    if (EVP_DecryptUpdate(CipherCtx, Buffer, &OutLen, Buffer, (int)CipherTextLength) != 1) {
+    //
+    // Without a callback, or if the payload is too small to be worth it,
+    // everything is decrypted in place in a single pass. Otherwise, the first
+    // bytes are decrypted so the callback can pick a destination for the rest.
+    //
+    uint16_t InPlaceLength = CipherTextLength;
+    if (Callback != NULL && CipherTextLength > CXPLAT_DECRYPT_REDIRECT_PEEK_LENGTH) {
+        InPlaceLength = CXPLAT_DECRYPT_REDIRECT_PEEK_LENGTH;
+    }
+
+    if (EVP_DecryptUpdate(CipherCtx, Buffer, &OutLen, Buffer, (int)InPlaceLength) != 1) {
         QuicTraceEvent(
             LibraryErrorStatus,
             "[ lib] ERROR, %u, %s.",
@@ -432,6 +550,39 @@ CxPlatDecrypt(
         return QUIC_STATUS_TLS_ERROR;
     }
 
+    if (InPlaceLength < CipherTextLength) {
+        uint16_t Split = InPlaceLength;
+        uint8_t* Destination =
+            Callback(Context, CipherTextLength, InPlaceLength, Buffer, &Split);
+        uint8_t* Output = Buffer + InPlaceLength;
+
+        if (Destination != NULL) {
+            CXPLAT_DBG_ASSERT(Split <= InPlaceLength);
+            //
+            // Move the part of the redirected range that was already decrypted
+            // in place and then decrypt the rest straight into the destination.
+            //
+            CxPlatCopyMemory(Destination, Buffer + Split, InPlaceLength - Split);
+            Output = Destination + (InPlaceLength - Split);
+            *RedirectOffset = Split;
+            *RedirectBuffer = Destination;
+        }
+
+        if (EVP_DecryptUpdate(
+                CipherCtx,
+                Output,
+                &OutLen,
+                Buffer + InPlaceLength,
+                (int)(CipherTextLength - InPlaceLength)) != 1) {
+            QuicTraceEvent(
+                LibraryErrorStatus,
+                "[ lib] ERROR, %u, %s.",
+                ERR_get_error(),
+                "EVP_DecryptUpdate (Cipher) failed");
+            return QUIC_STATUS_TLS_ERROR;
+        }
+    }
+
     AlgParam[0] = OSSL_PARAM_construct_octet_string("tag", Tag, CXPLAT_ENCRYPTION_OVERHEAD);
     AlgParam[1] = OSSL_PARAM_construct_end();
 
@@ -0,0 +1,934 @@
+/*++
+
+    Copyright (c) Microsoft Corporation.
+    Licensed under the MIT License.
+
+Abstract:
+
+    The key share pool keeps a supply of X25519 and P-256 key pairs generated
+    ahead of time by a background thread, so that a server doesn't have to
+    generate its ephemeral ECDHE key on the handshake path.
+
+    OpenSSL has no public hook for supplying the key share it generates while
+    building the ServerHello, so the pool is exposed as a small built-in
+    provider. It offers the X25519 and EC key management of the default
+    provider, passing every call through except key generation, which hands
+    out a pooled key instead when the request is for a plain key pair of a
+    pooled group. A server SSL_CTX created with the optional property query
+    "?provider=msquic_keyshare" prefers it for key shares and uses the default
+    provider for everything else.
+
+    The pool is sharded by processor to keep the consuming handshakes from
+    contending on a single lock.
+
+--*/
+
+#define QUIC_TEST_APIS 1
+
+#include "platform_internal.h"
+
+#ifdef _WIN32
+#pragma warning(push)
+#pragma warning(disable:4100) // Unreferenced parameter errcode in inline function
+#endif
+#include "openssl/core.h"
+#include "openssl/core_dispatch.h"
+#include "openssl/core_names.h"
+#include "openssl/crypto.h"
+#include "openssl/err.h"
+#include "openssl/params.h"
+#include "openssl/provider.h"
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+#ifdef QUIC_CLOG
+#include "keyshare_openssl.c.clog.h"
+#endif
+
+#define CXPLAT_KEY_SHARE_PROVIDER_NAME "msquic_keyshare"
+
+//
+// The number of keys kept for each algorithm in each shard. The refill thread
+// is woken once a shard drops below half of this.
+//
+#define CXPLAT_KEY_SHARE_POOL_DEPTH 32
+
+//
+// The maximum number of functions in a key management dispatch table.
+//
+#define CXPLAT_KEY_SHARE_MAX_DISPATCH 32
+
+typedef enum CXPLAT_KEY_SHARE_ALG_ID {
+    CXPLAT_KEY_SHARE_ALG_X25519,
+    CXPLAT_KEY_SHARE_ALG_P256,
+    CXPLAT_KEY_SHARE_ALG_COUNT
+} CXPLAT_KEY_SHARE_ALG_ID;
+
+//
+// A key management algorithm wrapped by the provider, along with the default
+// provider's implementation of the functions it intercepts.
+//
+typedef struct CXPLAT_KEY_SHARE_ALG {
+
+    //
+    // The key management name, and the group (for EC) of the keys pooled.
+    //
+    const char* Name;
+    const char* GroupName;
+
+    char AlgorithmNames[64];
+    OSSL_DISPATCH Dispatch[CXPLAT_KEY_SHARE_MAX_DISPATCH];
+
+    OSSL_FUNC_keymgmt_new_fn* New;
+    OSSL_FUNC_keymgmt_free_fn* Free;
+    OSSL_FUNC_keymgmt_get_params_fn* GetParams;
+    OSSL_FUNC_keymgmt_gettable_params_fn* GettableParams;
+    OSSL_FUNC_keymgmt_settable_params_fn* SettableParams;
+    OSSL_FUNC_keymgmt_gen_init_fn* GenInit;
+    OSSL_FUNC_keymgmt_gen_set_template_fn* GenSetTemplate;
+    OSSL_FUNC_keymgmt_gen_set_params_fn* GenSetParams;
+    OSSL_FUNC_keymgmt_gen_settable_params_fn* GenSettableParams;
+    OSSL_FUNC_keymgmt_gen_fn* Gen;
+    OSSL_FUNC_keymgmt_gen_cleanup_fn* GenCleanup;
+
+} CXPLAT_KEY_SHARE_ALG;
+
+typedef struct QUIC_CACHEALIGN CXPLAT_KEY_SHARE_SHARD {
+
+    CXPLAT_LOCK Lock;
+    uint32_t KeyCount[CXPLAT_KEY_SHARE_ALG_COUNT];
+    void* Keys[CXPLAT_KEY_SHARE_ALG_COUNT][CXPLAT_KEY_SHARE_POOL_DEPTH];
+    uint64_t Hits;
+    uint64_t Misses;
+    uint64_t Refilled;
+
+} CXPLAT_KEY_SHARE_SHARD;
+
+//
+// The key generation context handed out by the provider. Wraps the default
+// provider's context and tracks whether the request can be served from the
+// pool.
+//
+typedef struct CXPLAT_KEY_SHARE_GEN_CTX {
+
+    CXPLAT_KEY_SHARE_ALG* Alg;
+    void* Inner;
+    int Selection;
+    BOOLEAN Poolable;
+
+} CXPLAT_KEY_SHARE_GEN_CTX;
+
+typedef struct CXPLAT_KEY_SHARE_CAPABILITY_CTX {
+
+    OSSL_CALLBACK* Callback;
+    void* Arg;
+
+} CXPLAT_KEY_SHARE_CAPABILITY_CTX;
+
+typedef struct CXPLAT_KEY_SHARE_POOL {
+
+    //
+    // Serializes starting and stopping the pool.
+    //
+    CXPLAT_LOCK Lock;
+    BOOLEAN Started;
+    BOOLEAN StartFailed;
+    BOOLEAN Shutdown;
+    BOOLEAN BuiltinAdded;
+
+    OSSL_PROVIDER* DefaultProvider;
+    void* DefaultProviderCtx;
+    OSSL_PROVIDER* Provider;
+
+    CXPLAT_KEY_SHARE_ALG Algs[CXPLAT_KEY_SHARE_ALG_COUNT];
+    OSSL_ALGORITHM KeyMgmt[CXPLAT_KEY_SHARE_ALG_COUNT + 1];
+
+    uint32_t ShardCount;
+    CXPLAT_KEY_SHARE_SHARD* Shards;
+
+    CXPLAT_EVENT RefillEvent;
+    CXPLAT_THREAD RefillThread;
+
+} CXPLAT_KEY_SHARE_POOL;
+
+static CXPLAT_KEY_SHARE_POOL KeySharePool;
+
+CXPLAT_THREAD_CALLBACK(CxPlatKeySharePoolRefillThread, Context);
+
+static
+BOOLEAN
+CxPlatKeySharePoolIsPooledGroup(
+    _In_ const CXPLAT_KEY_SHARE_ALG* Alg,
+    _In_opt_z_ const char* Group
+    )
+{
+    if (Alg->GroupName == NULL) {
+        return TRUE;
+    }
+    return
+        Group != NULL &&
+        (OPENSSL_strcasecmp(Group, "prime256v1") == 0 ||
+         OPENSSL_strcasecmp(Group, "P-256") == 0 ||
+         OPENSSL_strcasecmp(Group, "secp256r1") == 0);
+}
+
+static
+void*
+CxPlatKeySharePoolGenerate(
+    _In_ CXPLAT_KEY_SHARE_ALG* Alg
+    )
+{
+    OSSL_PARAM Params[2] = { OSSL_PARAM_END, OSSL_PARAM_END };
+    if (Alg->GroupName != NULL) {
+        Params[0] =
+            OSSL_PARAM_construct_utf8_string(
+                OSSL_PKEY_PARAM_GROUP_NAME, (char*)Alg->GroupName, 0);
+    }
+
+    void* GenCtx =
+        Alg->GenInit(
+            KeySharePool.DefaultProviderCtx, OSSL_KEYMGMT_SELECT_KEYPAIR, Params);
+    if (GenCtx == NULL) {
+        return NULL;
+    }
+    void* Key = Alg->Gen(GenCtx, NULL, NULL);
+    Alg->GenCleanup(GenCtx);
+    return Key;
+}
+
+//
+// Pops a pooled key from the current processor's shard, if there is one.
+//
+static
+void*
+CxPlatKeySharePoolPop(
+    _In_ CXPLAT_KEY_SHARE_ALG* Alg
+    )
+{
+    if (!KeySharePool.Started) {
+        return NULL;
+    }
+
+    const uint32_t AlgId = (uint32_t)(Alg - KeySharePool.Algs);
+    CXPLAT_KEY_SHARE_SHARD* Shard =
+        &KeySharePool.Shards[CxPlatProcCurrentNumber() % KeySharePool.ShardCount];
+    void* Key = NULL;
+
+    CxPlatLockAcquire(&Shard->Lock);
+    if (Shard->KeyCount[AlgId] != 0) {
+        Key = Shard->Keys[AlgId][--Shard->KeyCount[AlgId]];
+        Shard->Hits++;
+    } else {
+        Shard->Misses++;
+    }
+    const BOOLEAN NeedsRefill =
+        Shard->KeyCount[AlgId] < CXPLAT_KEY_SHARE_POOL_DEPTH / 2;
+    CxPlatLockRelease(&Shard->Lock);
+
+    if (NeedsRefill) {
+        CxPlatEventSet(KeySharePool.RefillEvent);
+    }
+
+    return Key;
+}
+
+//
+// Tops up every shard. Keys are generated outside the shard's lock so the
+// handshakes consuming them aren't held up.
+//
+static
+void
+CxPlatKeySharePoolRefill(
+    void
+    )
+{
+    for (uint32_t i = 0; i < KeySharePool.ShardCount && !KeySharePool.Shutdown; ++i) {
+        CXPLAT_KEY_SHARE_SHARD* Shard = &KeySharePool.Shards[i];
+        for (uint32_t j = 0; j < CXPLAT_KEY_SHARE_ALG_COUNT; ++j) {
+            CXPLAT_KEY_SHARE_ALG* Alg = &KeySharePool.Algs[j];
+            while (!KeySharePool.Shutdown &&
+                Shard->KeyCount[j] < CXPLAT_KEY_SHARE_POOL_DEPTH) {
+                void* Key = CxPlatKeySharePoolGenerate(Alg);
+                if (Key == NULL) {
+                    QuicTraceEvent(
+                        LibraryErrorStatus,
+                        "[ lib] ERROR, %u, %s.",
+                        ERR_get_error(),
+                        "Key share generation failed");
+                    return;
+                }
+                CxPlatLockAcquire(&Shard->Lock);
+                if (Shard->KeyCount[j] < CXPLAT_KEY_SHARE_POOL_DEPTH) {
+                    Shard->Keys[j][Shard->KeyCount[j]++] = Key;
+                    Shard->Refilled++;
+                    Key = NULL;
+                }
+                CxPlatLockRelease(&Shard->Lock);
+                if (Key != NULL) {
+                    Alg->Free(Key);
+                }
+            }
+        }
+    }
+}
+
+CXPLAT_THREAD_CALLBACK(CxPlatKeySharePoolRefillThread, Context)
+{
+    UNREFERENCED_PARAMETER(Context);
+
+    while (!KeySharePool.Shutdown) {
+        CxPlatKeySharePoolRefill();
+        CxPlatEventWaitForever(KeySharePool.RefillEvent);
+    }
+
+    CXPLAT_THREAD_RETURN(QUIC_STATUS_SUCCESS);
+}
+
+//
+// Key management functions.
+//
+
+static
+int
+CxPlatKeySharePoolGenSetParams(
+    void* GenCtx,
+    const OSSL_PARAM Params[]
+    )
+{
+    CXPLAT_KEY_SHARE_GEN_CTX* Ctx = (CXPLAT_KEY_SHARE_GEN_CTX*)GenCtx;
+    for (const OSSL_PARAM* Param = Params; Param != NULL && Param->key != NULL; ++Param) {
+        if (strcmp(Param->key, OSSL_PKEY_PARAM_GROUP_NAME) == 0 &&
+            Param->data_type == OSSL_PARAM_UTF8_STRING) {
+            Ctx->Poolable =
+                (Ctx->Selection & OSSL_KEYMGMT_SELECT_KEYPAIR) != 0 &&
+                CxPlatKeySharePoolIsPooledGroup(Ctx->Alg, (const char*)Param->data);
+        } else {
+            //
+            // Anything else changes the key that would be generated.
+            //
+            Ctx->Poolable = FALSE;
+        }
+    }
+    return Ctx->Alg->GenSetParams(Ctx->Inner, Params);
+}
+
+static
+void*
+CxPlatKeySharePoolGenInit(
+    _In_ CXPLAT_KEY_SHARE_ALG* Alg,
+    int Selection,
+    const OSSL_PARAM Params[]
+    )
+{
+    CXPLAT_KEY_SHARE_GEN_CTX* Ctx =
+        CXPLAT_ALLOC_NONPAGED(sizeof(CXPLAT_KEY_SHARE_GEN_CTX), QUIC_POOL_TLS_KEY_SHARE);
+    if (Ctx == NULL) {
+        return NULL;
+    }
+
+    Ctx->Alg = Alg;
+    Ctx->Selection = Selection;
+    Ctx->Poolable =
+        (Selection & OSSL_KEYMGMT_SELECT_KEYPAIR) != 0 && Alg->GroupName == NULL;
+    Ctx->Inner = Alg->GenInit(KeySharePool.DefaultProviderCtx, Selection, NULL);
+    if (Ctx->Inner == NULL) {
+        CXPLAT_FREE(Ctx, QUIC_POOL_TLS_KEY_SHARE);
+        return NULL;
+    }
+
+    if (Params != NULL && !CxPlatKeySharePoolGenSetParams(Ctx, Params)) {
+        Alg->GenCleanup(Ctx->Inner);
+        CXPLAT_FREE(Ctx, QUIC_POOL_TLS_KEY_SHARE);
+        return NULL;
+    }
+
+    return Ctx;
+}
+
+static
+int
+CxPlatKeySharePoolGenSetTemplate(
+    void* GenCtx,
+    void* Template
+    )
+{
+    CXPLAT_KEY_SHARE_GEN_CTX* Ctx = (CXPLAT_KEY_SHARE_GEN_CTX*)GenCtx;
+    if (Ctx->Alg->GroupName != NULL) {
+        //
+        // This is how libssl asks for a key share in the group of the peer's.
+        //
+        char Group[64] = {0};
+        OSSL_PARAM Params[2] = {
+            OSSL_PARAM_utf8_string(OSSL_PKEY_PARAM_GROUP_NAME, Group, sizeof(Group)),
+            OSSL_PARAM_END
+        };
+        Ctx->Poolable =
+            (Ctx->Selection & OSSL_KEYMGMT_SELECT_KEYPAIR) != 0 &&
+            Ctx->Alg->GetParams(Template, Params) &&
+            CxPlatKeySharePoolIsPooledGroup(Ctx->Alg, Group);
+    }
+    return Ctx->Alg->GenSetTemplate(Ctx->Inner, Template);
+}
+
+static
+void*
+CxPlatKeySharePoolGen(
+    void* GenCtx,
+    OSSL_CALLBACK* Callback,
+    void* CallbackArg
+    )
+{
+    CXPLAT_KEY_SHARE_GEN_CTX* Ctx = (CXPLAT_KEY_SHARE_GEN_CTX*)GenCtx;
+    if (Ctx->Poolable) {
+        void* Key = CxPlatKeySharePoolPop(Ctx->Alg);
+        if (Key != NULL) {
+            return Key;
+        }
+    }
+    return Ctx->Alg->Gen(Ctx->Inner, Callback, CallbackArg);
+}
+
+static
+void
+CxPlatKeySharePoolGenCleanup(
+    void* GenCtx
+    )
+{
+    CXPLAT_KEY_SHARE_GEN_CTX* Ctx = (CXPLAT_KEY_SHARE_GEN_CTX*)GenCtx;
+    if (Ctx != NULL) {
+        Ctx->Alg->GenCleanup(Ctx->Inner);
+        CXPLAT_FREE(Ctx, QUIC_POOL_TLS_KEY_SHARE);
+    }
+}
+
+//
+// The functions taking a provider context need it swapped for the default
+// provider's, so they get one shim per algorithm.
+//
+#define CXPLAT_KEY_SHARE_SHIMS(Id) \
+static void* CxPlatKeySharePoolNew##Id(void* ProvCtx) { \
+    UNREFERENCED_PARAMETER(ProvCtx); \
+    return KeySharePool.Algs[Id].New(KeySharePool.DefaultProviderCtx); \
+} \
+static void* CxPlatKeySharePoolGenInit##Id(void* ProvCtx, int Selection, const OSSL_PARAM Params[]) { \
+    UNREFERENCED_PARAMETER(ProvCtx); \
+    return CxPlatKeySharePoolGenInit(&KeySharePool.Algs[Id], Selection, Params); \
+} \
+static const OSSL_PARAM* CxPlatKeySharePoolGenSettableParams##Id(void* GenCtx, void* ProvCtx) { \
+    UNREFERENCED_PARAMETER(ProvCtx); \
+    return KeySharePool.Algs[Id].GenSettableParams( \
+        GenCtx == NULL ? NULL : ((CXPLAT_KEY_SHARE_GEN_CTX*)GenCtx)->Inner, \
+        KeySharePool.DefaultProviderCtx); \
+} \
+static const OSSL_PARAM* CxPlatKeySharePoolGettableParams##Id(void* ProvCtx) { \
+    UNREFERENCED_PARAMETER(ProvCtx); \
+    return KeySharePool.Algs[Id].GettableParams(KeySharePool.DefaultProviderCtx); \
+} \
+static const OSSL_PARAM* CxPlatKeySharePoolSettableParams##Id(void* ProvCtx) { \
+    UNREFERENCED_PARAMETER(ProvCtx); \
+    return KeySharePool.Algs[Id].SettableParams(KeySharePool.DefaultProviderCtx); \
+}
+
+CXPLAT_KEY_SHARE_SHIMS(0)
+CXPLAT_KEY_SHARE_SHIMS(1)
+
+CXPLAT_STATIC_ASSERT(CXPLAT_KEY_SHARE_ALG_COUNT == 2, "One set of shims per algorithm");
+
+typedef void (*CXPLAT_KEY_SHARE_FN)(void);
+
+static const CXPLAT_KEY_SHARE_FN KeyShareProvCtxShims[CXPLAT_KEY_SHARE_ALG_COUNT][5] = {
+    {
+        (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolNew0,
+        (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolGenInit0,
+        (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolGenSettableParams0,
+        (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolGettableParams0,
+        (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolSettableParams0
+    },
+    {
+        (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolNew1,
+        (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolGenInit1,
+        (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolGenSettableParams1,
+        (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolGettableParams1,
+        (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolSettableParams1
+    }
+};
+
+//
+// Builds the algorithm's dispatch table from the default provider's.
+//
+static
+BOOLEAN
+CxPlatKeySharePoolWrapAlg(
+    _In_ uint32_t AlgId,
+    _In_ const OSSL_ALGORITHM* DefaultAlgs
+    )
+{
+    CXPLAT_KEY_SHARE_ALG* Alg = &KeySharePool.Algs[AlgId];
+    const size_t NameLength = strlen(Alg->Name);
+
+    const OSSL_ALGORITHM* Default = NULL;
+    for (const OSSL_ALGORITHM* Entry = DefaultAlgs; Entry->algorithm_names != NULL; ++Entry) {
+        if (strncmp(Entry->algorithm_names, Alg->Name, NameLength) == 0 &&
+            (Entry->algorithm_names[NameLength] == ':' ||
+             Entry->algorithm_names[NameLength] == '\0')) {
+            Default = Entry;
+            break;
+        }
+    }
+    if (Default == NULL) {
+        return FALSE;
+    }
+    const size_t AlgorithmNamesLength = strlen(Default->algorithm_names);
+    if (AlgorithmNamesLength >= sizeof(Alg->AlgorithmNames)) {
+        return FALSE;
+    }
+    CxPlatCopyMemory(
+        Alg->AlgorithmNames,
+        Default->algorithm_names,
+        AlgorithmNamesLength + 1);
+
+    uint32_t Count = 0;
+    for (const OSSL_DISPATCH* Fn = Default->implementation; Fn->function_id != 0; ++Fn) {
+        CXPLAT_KEY_SHARE_FN Function = Fn->function;
+        switch (Fn->function_id) {
+        case OSSL_FUNC_KEYMGMT_NEW:
+            Alg->New = OSSL_FUNC_keymgmt_new(Fn);
+            Function = KeyShareProvCtxShims[AlgId][0];
+            break;
+        case OSSL_FUNC_KEYMGMT_GEN_INIT:
+            Alg->GenInit = OSSL_FUNC_keymgmt_gen_init(Fn);
+            Function = KeyShareProvCtxShims[AlgId][1];
+            break;
+        case OSSL_FUNC_KEYMGMT_GEN_SETTABLE_PARAMS:
+            Alg->GenSettableParams = OSSL_FUNC_keymgmt_gen_settable_params(Fn);
+            Function = KeyShareProvCtxShims[AlgId][2];
+            break;
+        case OSSL_FUNC_KEYMGMT_GETTABLE_PARAMS:
+            Alg->GettableParams = OSSL_FUNC_keymgmt_gettable_params(Fn);
+            Function = KeyShareProvCtxShims[AlgId][3];
+            break;
+        case OSSL_FUNC_KEYMGMT_SETTABLE_PARAMS:
+            Alg->SettableParams = OSSL_FUNC_keymgmt_settable_params(Fn);
+            Function = KeyShareProvCtxShims[AlgId][4];
+            break;
+        case OSSL_FUNC_KEYMGMT_GEN_SET_TEMPLATE:
+            Alg->GenSetTemplate = OSSL_FUNC_keymgmt_gen_set_template(Fn);
+            Function = (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolGenSetTemplate;
+            break;
+        case OSSL_FUNC_KEYMGMT_GEN_SET_PARAMS:
+            Alg->GenSetParams = OSSL_FUNC_keymgmt_gen_set_params(Fn);
+            Function = (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolGenSetParams;
+            break;
+        case OSSL_FUNC_KEYMGMT_GEN:
+            Alg->Gen = OSSL_FUNC_keymgmt_gen(Fn);
+            Function = (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolGen;
+            break;
+        case OSSL_FUNC_KEYMGMT_GEN_CLEANUP:
+            Alg->GenCleanup = OSSL_FUNC_keymgmt_gen_cleanup(Fn);
+            Function = (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolGenCleanup;
+            break;
+        case OSSL_FUNC_KEYMGMT_GET_PARAMS:
+            Alg->GetParams = OSSL_FUNC_keymgmt_get_params(Fn);
+            break;
+        case OSSL_FUNC_KEYMGMT_FREE:
+            Alg->Free = OSSL_FUNC_keymgmt_free(Fn);
+            break;
+        case OSSL_FUNC_KEYMGMT_LOAD:
+        case OSSL_FUNC_KEYMGMT_SET_PARAMS:
+        case OSSL_FUNC_KEYMGMT_QUERY_OPERATION_NAME:
+        case OSSL_FUNC_KEYMGMT_HAS:
+        case OSSL_FUNC_KEYMGMT_VALIDATE:
+        case OSSL_FUNC_KEYMGMT_MATCH:
+        case OSSL_FUNC_KEYMGMT_IMPORT:
+        case OSSL_FUNC_KEYMGMT_IMPORT_TYPES:
+        case OSSL_FUNC_KEYMGMT_EXPORT:
+        case OSSL_FUNC_KEYMGMT_EXPORT_TYPES:
+        case OSSL_FUNC_KEYMGMT_DUP:
+            //
+            // These take no provider or generation context, so are passed
+            // through as is.
+            //
+            break;
+        default:
+            //
+            // Leave out anything (newer) that might take a context we don't
+            // know to translate.
+            //
+            continue;
+        }
+        if (Count == CXPLAT_KEY_SHARE_MAX_DISPATCH - 1) {
+            return FALSE;
+        }
+        Alg->Dispatch[Count].function_id = Fn->function_id;
+        Alg->Dispatch[Count].function = Function;
+        Count++;
+    }
+    Alg->Dispatch[Count].function_id = 0;
+    Alg->Dispatch[Count].function = NULL;
+
+    //
+    // The others are only called through the dispatch table, so are only
+    // called if the default provider has them.
+    //
+    if (Alg->New == NULL || Alg->Free == NULL || Alg->GenInit == NULL ||
+        Alg->GenSetParams == NULL || Alg->Gen == NULL || Alg->GenCleanup == NULL ||
+        (Alg->GroupName != NULL && Alg->GetParams == NULL)) {
+        return FALSE;
+    }
+
+    KeySharePool.KeyMgmt[AlgId].algorithm_names = Alg->AlgorithmNames;
+    KeySharePool.KeyMgmt[AlgId].property_definition =
+        "provider=" CXPLAT_KEY_SHARE_PROVIDER_NAME;
+    KeySharePool.KeyMgmt[AlgId].implementation = Alg->Dispatch;
+    KeySharePool.KeyMgmt[AlgId].algorithm_description = Default->algorithm_description;
+
+    return TRUE;
+}
+
+//
+// Provider functions.
+//
+
+static
+const OSSL_ALGORITHM*
+CxPlatKeySharePoolQueryOperation(
+    void* ProvCtx,
+    int OperationId,
+    int* NoCache
+    )
+{
+    UNREFERENCED_PARAMETER(ProvCtx);
+    *NoCache = 0;
+    return OperationId == OSSL_OP_KEYMGMT ? KeySharePool.KeyMgmt : NULL;
+}
+
+static
+int
+CxPlatKeySharePoolGroupCapability(
+    const OSSL_PARAM Params[],
+    void* Arg
+    )
+{
+    CXPLAT_KEY_SHARE_CAPABILITY_CTX* Ctx = (CXPLAT_KEY_SHARE_CAPABILITY_CTX*)Arg;
+    const OSSL_PARAM* Param =
+        OSSL_PARAM_locate_const(Params, OSSL_CAPABILITY_TLS_GROUP_ALG);
+    const char* AlgName = NULL;
+    if (Param == NULL || !OSSL_PARAM_get_utf8_string_ptr(Param, &AlgName)) {
+        return 1;
+    }
+    for (uint32_t i = 0; i < CXPLAT_KEY_SHARE_ALG_COUNT; ++i) {
+        if (strcmp(AlgName, KeySharePool.Algs[i].Name) == 0) {
+            return Ctx->Callback(Params, Ctx->Arg);
+        }
+    }
+    return 1;
+}
+
+//
+// libssl only uses a group's key management if it comes from the provider that
+// advertised the group, so the default provider's groups for the wrapped
+// algorithms are advertised again here.
+//
+static
+int
+CxPlatKeySharePoolGetCapabilities(
+    void* ProvCtx,
+    const char* Capability,
+    OSSL_CALLBACK* Callback,
+    void* Arg
+    )
+{
+    UNREFERENCED_PARAMETER(ProvCtx);
+    if (strcmp(Capability, "TLS-GROUP") != 0) {
+        return 1;
+    }
+    CXPLAT_KEY_SHARE_CAPABILITY_CTX Ctx = { Callback, Arg };
+    return
+        OSSL_PROVIDER_get_capabilities(
+            KeySharePool.DefaultProvider,
+            Capability,
+            CxPlatKeySharePoolGroupCapability,
+            &Ctx);
+}
+
+static const OSSL_DISPATCH KeyShareProviderDispatch[] = {
+    { OSSL_FUNC_PROVIDER_QUERY_OPERATION, (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolQueryOperation },
+    { OSSL_FUNC_PROVIDER_GET_CAPABILITIES, (CXPLAT_KEY_SHARE_FN)CxPlatKeySharePoolGetCapabilities },
+    { 0, NULL }
+};
+
+static
+int
+CxPlatKeySharePoolProviderInit(
+    const OSSL_CORE_HANDLE* Handle,
+    const OSSL_DISPATCH* In,
+    const OSSL_DISPATCH** Out,
+    void** ProvCtx
+    )
+{
+    UNREFERENCED_PARAMETER(Handle);
+    UNREFERENCED_PARAMETER(In);
+    *Out = KeyShareProviderDispatch;
+    *ProvCtx = &KeySharePool;
+    return 1;
+}
+
+//
+// Pool management.
+//
+
+void
+CxPlatKeySharePoolInitialize(
+    void
+    )
+{
+    CxPlatLockInitialize(&KeySharePool.Lock);
+    KeySharePool.Started = FALSE;
+    KeySharePool.StartFailed = FALSE;
+    KeySharePool.Shutdown = FALSE;
+    KeySharePool.Algs[CXPLAT_KEY_SHARE_ALG_X25519].Name = "X25519";
+    KeySharePool.Algs[CXPLAT_KEY_SHARE_ALG_X25519].GroupName = NULL;
+    KeySharePool.Algs[CXPLAT_KEY_SHARE_ALG_P256].Name = "EC";
+    KeySharePool.Algs[CXPLAT_KEY_SHARE_ALG_P256].GroupName = "prime256v1";
+}
+
+static
+void
+CxPlatKeySharePoolCleanup(
+    void
+    )
+{
+    if (KeySharePool.Provider != NULL) {
+        OSSL_PROVIDER_unload(KeySharePool.Provider);
+        KeySharePool.Provider = NULL;
+    }
+
+    if (KeySharePool.Shards != NULL) {
+        uint64_t Hits = 0, Misses = 0;
+        for (uint32_t i = 0; i < KeySharePool.ShardCount; ++i) {
+            CXPLAT_KEY_SHARE_SHARD* Shard = &KeySharePool.Shards[i];
+            for (uint32_t j = 0; j < CXPLAT_KEY_SHARE_ALG_COUNT; ++j) {
+                while (Shard->KeyCount[j] != 0) {
+                    KeySharePool.Algs[j].Free(Shard->Keys[j][--Shard->KeyCount[j]]);
+                }
+            }
+            Hits += Shard->Hits;
+            Misses += Shard->Misses;
+            CxPlatLockUninitialize(&Shard->Lock);
+        }
+        QuicTraceLogInfo(
+            KeySharePoolStopped,
+            "[ lib] Key share pool stopped, %llu hits, %llu misses",
+            Hits,
+            Misses);
+        CXPLAT_FREE(KeySharePool.Shards, QUIC_POOL_TLS_KEY_SHARE);
+        KeySharePool.Shards = NULL;
+        KeySharePool.ShardCount = 0;
+    }
+
+    if (KeySharePool.DefaultProvider != NULL) {
+        OSSL_PROVIDER_unload(KeySharePool.DefaultProvider);
+        KeySharePool.DefaultProvider = NULL;
+        KeySharePool.DefaultProviderCtx = NULL;
+    }
+}
+
+void
+CxPlatKeySharePoolUninitialize(
+    void
+    )
+{
+    CxPlatLockAcquire(&KeySharePool.Lock);
+    KeySharePool.Shutdown = TRUE;
+    if (KeySharePool.Started) {
+        CxPlatEventSet(KeySharePool.RefillEvent);
+        CxPlatThreadWait(&KeySharePool.RefillThread);
+        CxPlatThreadDelete(&KeySharePool.RefillThread);
+        CxPlatEventUninitialize(KeySharePool.RefillEvent);
+        KeySharePool.Started = FALSE;
+        CxPlatKeySharePoolCleanup();
+    }
+    CxPlatLockRelease(&KeySharePool.Lock);
+    CxPlatLockUninitialize(&KeySharePool.Lock);
+}
+
+static
+BOOLEAN
+CxPlatKeySharePoolStartLocked(
+    void
+    )
+{
+    KeySharePool.DefaultProvider = OSSL_PROVIDER_load(NULL, "default");
+    if (KeySharePool.DefaultProvider == NULL) {
+        QuicTraceEvent(
+            LibraryErrorStatus,
+            "[ lib] ERROR, %u, %s.",
+            ERR_get_error(),
+            "OSSL_PROVIDER_load(default) failed");
+        return FALSE;
+    }
+    KeySharePool.DefaultProviderCtx =
+        OSSL_PROVIDER_get0_provider_ctx(KeySharePool.DefaultProvider);
+
+    int NoCache = 0;
+    const OSSL_ALGORITHM* DefaultAlgs =
+        OSSL_PROVIDER_query_operation(
+            KeySharePool.DefaultProvider, OSSL_OP_KEYMGMT, &NoCache);
+    if (DefaultAlgs == NULL) {
+        QuicTraceEvent(
+            LibraryError,
+            "[ lib] ERROR, %s.",
+            "OSSL_PROVIDER_query_operation(KEYMGMT) failed");
+        return FALSE;
+    }
+    BOOLEAN Wrapped = TRUE;
+    for (uint32_t i = 0; i < CXPLAT_KEY_SHARE_ALG_COUNT && Wrapped; ++i) {
+        Wrapped = CxPlatKeySharePoolWrapAlg(i, DefaultAlgs);
+    }
+    OSSL_PROVIDER_unquery_operation(
+        KeySharePool.DefaultProvider, OSSL_OP_KEYMGMT, DefaultAlgs);
+    if (!Wrapped) {
+        QuicTraceEvent(
+            LibraryError,
+            "[ lib] ERROR, %s.",
+            "Unsupported default key management");
+        return FALSE;
+    }
+    CxPlatZeroMemory(
+        &KeySharePool.KeyMgmt[CXPLAT_KEY_SHARE_ALG_COUNT], sizeof(OSSL_ALGORITHM));
+
+    KeySharePool.ShardCount = CxPlatProcCount();
+    KeySharePool.Shards =
+        CXPLAT_ALLOC_NONPAGED(
+            KeySharePool.ShardCount * sizeof(CXPLAT_KEY_SHARE_SHARD),
+            QUIC_POOL_TLS_KEY_SHARE);
+    if (KeySharePool.Shards == NULL) {
+        QuicTraceEvent(
+            AllocFailure,
+            "Allocation of '%s' failed. (%llu bytes)",
+            "key share pool",
+            KeySharePool.ShardCount * sizeof(CXPLAT_KEY_SHARE_SHARD));
+        KeySharePool.ShardCount = 0;
+        return FALSE;
+    }
+    CxPlatZeroMemory(
+        KeySharePool.Shards, KeySharePool.ShardCount * sizeof(CXPLAT_KEY_SHARE_SHARD));
+    for (uint32_t i = 0; i < KeySharePool.ShardCount; ++i) {
+        CxPlatLockInitialize(&KeySharePool.Shards[i].Lock);
+    }
+
+    //
+    // Fill the pool before the provider is loaded, so the first handshakes
+    // already have keys to take.
+    //
+    CxPlatKeySharePoolRefill();
+
+    //
+    // OpenSSL can't remove a built-in provider, so it is only added once per
+    // process, and loaded (and unloaded) with each start (and stop).
+    //
+    if (!KeySharePool.BuiltinAdded) {
+        if (!OSSL_PROVIDER_add_builtin(
+                NULL,
+                CXPLAT_KEY_SHARE_PROVIDER_NAME,
+                CxPlatKeySharePoolProviderInit)) {
+            QuicTraceEvent(
+                LibraryErrorStatus,
+                "[ lib] ERROR, %u, %s.",
+                ERR_get_error(),
+                "OSSL_PROVIDER_add_builtin failed");
+            return FALSE;
+        }
+        KeySharePool.BuiltinAdded = TRUE;
+    }
+    KeySharePool.Provider = OSSL_PROVIDER_load(NULL, CXPLAT_KEY_SHARE_PROVIDER_NAME);
+    if (KeySharePool.Provider == NULL) {
+        QuicTraceEvent(
+            LibraryErrorStatus,
+            "[ lib] ERROR, %u, %s.",
+            ERR_get_error(),
+            "OSSL_PROVIDER_load(key share) failed");
+        return FALSE;
+    }
+
+    CxPlatEventInitialize(&KeySharePool.RefillEvent, FALSE, FALSE);
+    CXPLAT_THREAD_CONFIG ThreadConfig = {
+        0,
+        0,
+        "quic_keyshare",
+        CxPlatKeySharePoolRefillThread,
+        NULL
+    };
+    QUIC_STATUS Status =
+        CxPlatThreadCreate(&ThreadConfig, &KeySharePool.RefillThread);
+    if (QUIC_FAILED(Status)) {
+        QuicTraceEvent(
+            LibraryErrorStatus,
+            "[ lib] ERROR, %u, %s.",
+            Status,
+            "CxPlatThreadCreate (key share pool)");
+        CxPlatEventUninitialize(KeySharePool.RefillEvent);
+        return FALSE;
+    }
+
+    QuicTraceLogInfo(
+        KeySharePoolStarted,
+        "[ lib] Key share pool started with %u shards",
+        KeySharePool.ShardCount);
+
+    return TRUE;
+}
+
+BOOLEAN
+CxPlatKeySharePoolStart(
+    void
+    )
+{
+    if (KeySharePool.Started) {
+        return TRUE;
+    }
+
+    CxPlatLockAcquire(&KeySharePool.Lock);
+    if (!KeySharePool.Started && !KeySharePool.StartFailed && !KeySharePool.Shutdown) {
+        if (CxPlatKeySharePoolStartLocked()) {
+            KeySharePool.Started = TRUE;
+        } else {
+            //
+            // Don't retry for every configuration; they just generate their
+            // key shares as usual.
+            //
+            KeySharePool.StartFailed = TRUE;
+            CxPlatKeySharePoolCleanup();
+        }
+    }
+    BOOLEAN Started = KeySharePool.Started;
+    CxPlatLockRelease(&KeySharePool.Lock);
+    return Started;
+}
+
+BOOLEAN
+CxPlatKeySharePoolGetStats(
+    _Out_ CXPLAT_KEY_SHARE_POOL_STATS* Stats
+    )
+{
+    CxPlatZeroMemory(Stats, sizeof(*Stats));
+
+    CxPlatLockAcquire(&KeySharePool.Lock);
+    const BOOLEAN Started = KeySharePool.Started;
+    if (Started) {
+        for (uint32_t i = 0; i < KeySharePool.ShardCount; ++i) {
+            CXPLAT_KEY_SHARE_SHARD* Shard = &KeySharePool.Shards[i];
+            CxPlatLockAcquire(&Shard->Lock);
+            for (uint32_t j = 0; j < CXPLAT_KEY_SHARE_ALG_COUNT; ++j) {
+                Stats->Available += Shard->KeyCount[j];
+            }
+            Stats->Hits += Shard->Hits;
+            Stats->Misses += Shard->Misses;
+            Stats->Refilled += Shard->Refilled;
+            CxPlatLockRelease(&Shard->Lock);
+        }
+    }
+    CxPlatLockRelease(&KeySharePool.Lock);
+
+    return Started;
+}
@@ -718,6 +718,32 @@ CxPlatCryptUninitialize(
     void
     );
 
+//
+// Key share pool (OpenSSL only). Keeps ephemeral ECDHE keys generated ahead of
+// time for servers' TLS handshakes.
+//
+
+#define CXPLAT_KEY_SHARE_POOL_PROPERTY_QUERY "?provider=msquic_keyshare"
+
+void
+CxPlatKeySharePoolInitialize(
+    void
+    );
+
+void
+CxPlatKeySharePoolUninitialize(
+    void
+    );
+
+//
+// Starts the pool on first use. Returns FALSE if the pool couldn't be started,
+// in which case the key shares are generated as usual.
+//
+BOOLEAN
+CxPlatKeySharePoolStart(
+    void
+    );
+
 //
 // Queries the raw datapath stack for the total size needed to allocate the
 // datapath structure.
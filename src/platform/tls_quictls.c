@@ -45,6 +45,25 @@ uint16_t CxPlatTlsTPHeaderSize = 0;
 const size_t OpenSslFilePrefixLength = sizeof("..\\..\\..\\..\\..\\..\\submodules");
 
 #define PFX_PASSWORD_LENGTH 33
+
+//
+// RFC 8879 certificate compression is available from OpenSSL 3.2, when built
+// with at least one of zlib, brotli or zstd.
+//
+#if OPENSSL_VERSION_NUMBER >= 0x30200000L && !defined(OPENSSL_NO_COMP_ALG)
+#define CXPLAT_TLS_CERT_COMPRESSION 1
+
+//
+// Preferred certificate compression algorithms, best ratio first. Algorithms
+// OpenSSL wasn't built with are ignored.
+//
+static int CxPlatTlsCertCompressionAlgs[] = {
+    TLSEXT_comp_cert_brotli,
+    TLSEXT_comp_cert_zstd,
+    TLSEXT_comp_cert_zlib
+};
+#endif
+
 //
 // The QUIC sec config object. Created once per listener on server side and
 // once per connection on client side.
@@ -1071,10 +1090,18 @@ CxPlatTlsSecConfigCreate(
     SecurityConfig->TlsFlags = TlsCredFlags;
 
     //
-    // Create the a SSL context for the security config.
+    // Create the a SSL context for the security config. Servers using the key
+    // share pool prefer its key management for their ephemeral keys.
     //
 
-    SecurityConfig->SSLCtx = SSL_CTX_new(TLS_method());
+    if (!(CredConfigFlags & QUIC_CREDENTIAL_FLAG_CLIENT) &&
+        (TlsCredFlags & CXPLAT_TLS_CREDENTIAL_FLAG_KEY_SHARE_POOL) &&
+        CxPlatKeySharePoolStart()) {
+        SecurityConfig->SSLCtx =
+            SSL_CTX_new_ex(NULL, CXPLAT_KEY_SHARE_POOL_PROPERTY_QUERY, TLS_method());
+    } else {
+        SecurityConfig->SSLCtx = SSL_CTX_new(TLS_method());
+    }
     if (SecurityConfig->SSLCtx == NULL) {
         QuicTraceEvent(
             LibraryErrorStatus,
@@ -1484,6 +1511,41 @@ CxPlatTlsSecConfigCreate(
         }
     }
 
+#ifdef CXPLAT_TLS_CERT_COMPRESSION
+    //
+    // Negotiate certificate compression in both directions, so that a large
+    // certificate chain is less likely to exceed the server's anti-amplification
+    // limit and cost the handshake an extra round trip. Our own certificate is
+    // compressed once here, instead of on every handshake.
+    //
+    Ret =
+        SSL_CTX_set1_cert_comp_preference(
+            SecurityConfig->SSLCtx,
+            CxPlatTlsCertCompressionAlgs,
+            ARRAYSIZE(CxPlatTlsCertCompressionAlgs));
+    if (Ret != 1) {
+        QuicTraceEvent(
+            LibraryErrorStatus,
+            "[ lib] ERROR, %u, %s.",
+            ERR_get_error(),
+            "SSL_CTX_set1_cert_comp_preference failed");
+        Status = QUIC_STATUS_TLS_ERROR;
+        goto Exit;
+    }
+
+    if (CredConfig->Type != QUIC_CREDENTIAL_TYPE_NONE &&
+        !SSL_CTX_compress_certs(SecurityConfig->SSLCtx, 0)) {
+        //
+        // Not fatal; the certificate is just sent uncompressed.
+        //
+        QuicTraceEvent(
+            LibraryErrorStatus,
+            "[ lib] ERROR, %u, %s.",
+            ERR_get_error(),
+            "SSL_CTX_compress_certs failed");
+    }
+#endif
+
     if (CredConfigFlags & QUIC_CREDENTIAL_FLAG_SET_CA_CERTIFICATE_FILE &&
         CredConfig->CaCertificateFile) {
         Ret =
@@ -73,6 +73,34 @@ struct CryptTest : public ::testing::TestWithParam<int32_t>
                     Buffer);
         }
 
+        bool
+        EncryptGather(
+            _In_reads_bytes_(CXPLAT_IV_LENGTH)
+                const uint8_t* const Iv,
+            _In_ uint16_t AuthDataLength,
+            _In_reads_bytes_opt_(AuthDataLength)
+                const uint8_t* const AuthData,
+            _In_ uint8_t SegmentCount,
+            _In_reads_opt_(SegmentCount)
+                const CXPLAT_CRYPT_SEGMENT* Segments,
+            _In_ uint16_t BufferLength,
+            _Inout_updates_bytes_(BufferLength)
+                uint8_t* Buffer
+            )
+        {
+            return
+                QUIC_STATUS_SUCCESS ==
+                CxPlatEncryptGather(
+                    Ptr,
+                    Iv,
+                    AuthDataLength,
+                    AuthData,
+                    SegmentCount,
+                    Segments,
+                    BufferLength,
+                    Buffer);
+        }
+
         bool
         Decrypt(
             _In_reads_bytes_(CXPLAT_IV_LENGTH)
@@ -95,6 +123,37 @@ struct CryptTest : public ::testing::TestWithParam<int32_t>
                     BufferLength,
                     Buffer);
         }
+
+        bool
+        DecryptRedirect(
+            _In_reads_bytes_(CXPLAT_IV_LENGTH)
+                const uint8_t* const Iv,
+            _In_ uint16_t AuthDataLength,
+            _In_reads_bytes_opt_(AuthDataLength)
+                const uint8_t* const AuthData,
+            _In_ uint16_t BufferLength,
+            _Inout_updates_bytes_(BufferLength)
+                uint8_t* Buffer,
+            _In_opt_ CXPLAT_DECRYPT_REDIRECT_CALLBACK_HANDLER Callback,
+            _In_opt_ void* Context,
+            _Out_ uint16_t* RedirectOffset,
+            _Out_ uint8_t** RedirectBuffer
+            )
+        {
+            return
+                QUIC_STATUS_SUCCESS ==
+                CxPlatDecryptRedirect(
+                    Ptr,
+                    Iv,
+                    AuthDataLength,
+                    AuthData,
+                    BufferLength,
+                    Buffer,
+                    Callback,
+                    Context,
+                    RedirectOffset,
+                    RedirectBuffer);
+        }
     };
 
     struct QuicHash
@@ -619,6 +678,192 @@ TEST_P(CryptTest, Encryption)
     ASSERT_FALSE(Key.Decrypt(Iv, sizeof(AuthData), AuthData, sizeof(Buffer), Buffer));
 }
 
+TEST_P(CryptTest, EncryptionGather)
+{
+    int AEAD = GetParam();
+
+    uint8_t RawKey[32];
+    uint8_t Iv[CXPLAT_IV_LENGTH];
+    uint8_t AuthData[12];
+    uint8_t PlainText[128 - CXPLAT_ENCRYPTION_OVERHEAD];
+    uint8_t Expected[128];
+    uint8_t Buffer[128];
+
+    CxPlatRandom(sizeof(RawKey), RawKey);
+    CxPlatRandom(sizeof(Iv), Iv);
+    CxPlatRandom(sizeof(AuthData), AuthData);
+    CxPlatRandom(sizeof(PlainText), PlainText);
+
+    QuicKey Key((CXPLAT_AEAD_TYPE)AEAD, RawKey);
+    if (Key.Ptr == NULL) return;
+
+    memcpy(Expected, PlainText, sizeof(PlainText));
+    ASSERT_TRUE(Key.Encrypt(Iv, sizeof(AuthData), AuthData, sizeof(Expected), Expected));
+
+    //
+    // Only part of the plaintext is in place; the rest comes from the segments
+    // (including odd sized and adjacent ones).
+    //
+    const CXPLAT_CRYPT_SEGMENT Segments[] = {
+        { PlainText + 1, 1, 15 },
+        { PlainText + 16, 16, 17 },
+        { PlainText + 33, 33, 3 },
+        { PlainText + 50, 50, (uint16_t)(sizeof(PlainText) - 50) },
+    };
+    memset(Buffer, 0xFF, sizeof(Buffer));
+    Buffer[0] = PlainText[0];
+    memcpy(Buffer + 36, PlainText + 36, 50 - 36);
+
+    ASSERT_TRUE(
+        Key.EncryptGather(
+            Iv,
+            sizeof(AuthData),
+            AuthData,
+            ARRAYSIZE(Segments),
+            Segments,
+            sizeof(Buffer),
+            Buffer));
+    ASSERT_EQ(0, memcmp(Expected, Buffer, sizeof(Buffer)));
+
+    ASSERT_TRUE(Key.Decrypt(Iv, sizeof(AuthData), AuthData, sizeof(Buffer), Buffer));
+    ASSERT_EQ(0, memcmp(PlainText, Buffer, sizeof(PlainText)));
+
+    //
+    // No segments is the same as a regular encryption.
+    //
+    memcpy(Buffer, PlainText, sizeof(PlainText));
+    ASSERT_TRUE(Key.EncryptGather(Iv, sizeof(AuthData), AuthData, 0, NULL, sizeof(Buffer), Buffer));
+    ASSERT_EQ(0, memcmp(Expected, Buffer, sizeof(Buffer)));
+}
+
+struct DecryptRedirectContext {
+    const uint8_t* ExpectedPeek;
+    uint16_t ExpectedLength;
+    uint16_t Split;
+    uint8_t* Destination;
+    uint32_t CallCount;
+
+    static
+    _IRQL_requires_max_(DISPATCH_LEVEL)
+    _Function_class_(CXPLAT_DECRYPT_REDIRECT_CALLBACK)
+    uint8_t*
+    Callback(
+        _In_ void* Context,
+        _In_ uint16_t PlainTextLength,
+        _In_ uint16_t PeekLength,
+        _In_reads_bytes_(PeekLength)
+            const uint8_t* PlainText,
+        _Out_ uint16_t* RedirectOffset
+        )
+    {
+        auto Ctx = (DecryptRedirectContext*)Context;
+        Ctx->CallCount++;
+        EXPECT_EQ(Ctx->ExpectedLength, PlainTextLength);
+        EXPECT_LE((uint16_t)CXPLAT_DECRYPT_REDIRECT_PEEK_LENGTH, PeekLength);
+        EXPECT_EQ(0, memcmp(Ctx->ExpectedPeek, PlainText, CXPLAT_DECRYPT_REDIRECT_PEEK_LENGTH));
+        *RedirectOffset = Ctx->Split;
+        return Ctx->Destination;
+    }
+};
+
+TEST_P(CryptTest, DecryptionRedirect)
+{
+    int AEAD = GetParam();
+
+    uint8_t RawKey[32];
+    uint8_t Iv[CXPLAT_IV_LENGTH];
+    uint8_t AuthData[12];
+    uint8_t PlainText[128 - CXPLAT_ENCRYPTION_OVERHEAD];
+    uint8_t Encrypted[128];
+    uint8_t Buffer[128];
+    uint8_t Destination[128];
+
+    CxPlatRandom(sizeof(RawKey), RawKey);
+    CxPlatRandom(sizeof(Iv), Iv);
+    CxPlatRandom(sizeof(AuthData), AuthData);
+    CxPlatRandom(sizeof(PlainText), PlainText);
+
+    QuicKey Key((CXPLAT_AEAD_TYPE)AEAD, RawKey);
+    if (Key.Ptr == NULL) return;
+
+    memcpy(Encrypted, PlainText, sizeof(PlainText));
+    ASSERT_TRUE(Key.Encrypt(Iv, sizeof(AuthData), AuthData, sizeof(Encrypted), Encrypted));
+
+    //
+    // Redirect from a few offsets, at and before the end of the peeked bytes.
+    //
+    const uint16_t Splits[] = { 0, 7, CXPLAT_DECRYPT_REDIRECT_PEEK_LENGTH };
+    for (auto Split : Splits) {
+        DecryptRedirectContext Ctx = { PlainText, sizeof(PlainText), Split, Destination, 0 };
+        uint16_t RedirectOffset;
+        uint8_t* RedirectBuffer;
+        memcpy(Buffer, Encrypted, sizeof(Buffer));
+        memset(Destination, 0, sizeof(Destination));
+        ASSERT_TRUE(
+            Key.DecryptRedirect(
+                Iv,
+                sizeof(AuthData),
+                AuthData,
+                sizeof(Buffer),
+                Buffer,
+                DecryptRedirectContext::Callback,
+                &Ctx,
+                &RedirectOffset,
+                &RedirectBuffer));
+        ASSERT_EQ(1u, Ctx.CallCount);
+        ASSERT_EQ(Split, RedirectOffset);
+        ASSERT_EQ(Destination, RedirectBuffer);
+        ASSERT_EQ(0, memcmp(PlainText, Buffer, Split));
+        ASSERT_EQ(0, memcmp(PlainText + Split, Destination, sizeof(PlainText) - Split));
+    }
+
+    //
+    // Declining the redirect decrypts everything in place.
+    //
+    {
+        DecryptRedirectContext Ctx = { PlainText, sizeof(PlainText), 0, NULL, 0 };
+        uint16_t RedirectOffset;
+        uint8_t* RedirectBuffer;
+        memcpy(Buffer, Encrypted, sizeof(Buffer));
+        ASSERT_TRUE(
+            Key.DecryptRedirect(
+                Iv,
+                sizeof(AuthData),
+                AuthData,
+                sizeof(Buffer),
+                Buffer,
+                DecryptRedirectContext::Callback,
+                &Ctx,
+                &RedirectOffset,
+                &RedirectBuffer));
+        ASSERT_EQ(1u, Ctx.CallCount);
+        ASSERT_EQ(nullptr, RedirectBuffer);
+        ASSERT_EQ(0, memcmp(PlainText, Buffer, sizeof(PlainText)));
+    }
+
+    //
+    // Authentication failures are still reported.
+    //
+    {
+        DecryptRedirectContext Ctx = { PlainText, sizeof(PlainText), 0, Destination, 0 };
+        uint16_t RedirectOffset;
+        uint8_t* RedirectBuffer;
+        memcpy(Buffer, Encrypted, sizeof(Buffer));
+        Buffer[sizeof(Buffer) - 1] ^= 0xFF;
+        ASSERT_FALSE(
+            Key.DecryptRedirect(
+                Iv,
+                sizeof(AuthData),
+                AuthData,
+                sizeof(Buffer),
+                Buffer,
+                DecryptRedirectContext::Callback,
+                &Ctx,
+                &RedirectOffset,
+                &RedirectBuffer));
+    }
+}
+
 TEST_P(CryptTest, HashWellKnown)
 {
     int HASH = GetParam();
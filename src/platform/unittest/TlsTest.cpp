@@ -16,6 +16,18 @@
 #pragma warning(pop)
 #endif
 #include <fcntl.h>
+#if QUIC_TEST_OPENSSL_FLAGS
+#ifdef _WIN32
+#pragma warning(push)
+#pragma warning(disable:4100) // Unreferenced parameter errcode in inline function
+#endif
+#include "openssl/evp.h"
+#ifdef _WIN32
+#pragma warning(pop)
+#endif
+#include <set>
+#include <vector>
+#endif
 
 #ifdef QUIC_CLOG
 #include "TlsTest.cpp.clog.h"
@@ -883,6 +895,129 @@ TEST_F(TlsTest, Handshake)
     ASSERT_FALSE(ServerContext.State.SessionResumed);
 }
 
+#if QUIC_TEST_OPENSSL_FLAGS
+
+//
+// Waits for the key share pool's refill thread to add keys past the given
+// count.
+//
+static
+bool
+WaitForKeySharePoolRefill(
+    _In_ uint64_t Refilled
+    )
+{
+    for (uint32_t i = 0; i < 1000; ++i) {
+        CXPLAT_KEY_SHARE_POOL_STATS Stats;
+        if (!CxPlatKeySharePoolGetStats(&Stats)) {
+            return false;
+        }
+        if (Stats.Refilled > Refilled) {
+            return true;
+        }
+        CxPlatSleep(10);
+    }
+    return false;
+}
+
+//
+// Generates a key pair through the key share pool's provider and returns its
+// encoded public key.
+//
+static
+std::vector<uint8_t>
+GenerateKeyShare(
+    _In_z_ const char* Algorithm,
+    _In_opt_z_ const char* Group
+    )
+{
+    std::vector<uint8_t> PublicKey;
+    EVP_PKEY_CTX* Ctx =
+        EVP_PKEY_CTX_new_from_name(NULL, Algorithm, "provider=msquic_keyshare");
+    EVP_PKEY* Key = NULL;
+    if (Ctx != NULL &&
+        EVP_PKEY_keygen_init(Ctx) == 1 &&
+        (Group == NULL || EVP_PKEY_CTX_set_group_name(Ctx, Group) == 1) &&
+        EVP_PKEY_generate(Ctx, &Key) == 1) {
+        uint8_t* Encoded = NULL;
+        size_t EncodedLength = EVP_PKEY_get1_encoded_public_key(Key, &Encoded);
+        PublicKey.assign(Encoded, Encoded + EncodedLength);
+        OPENSSL_free(Encoded);
+    }
+    EVP_PKEY_free(Key);
+    EVP_PKEY_CTX_free(Ctx);
+    return PublicKey;
+}
+
+TEST_F(TlsTest, HandshakeKeySharePool)
+{
+    CxPlatClientSecConfig ClientConfig;
+    CxPlatServerSecConfig ServerConfig(
+        QUIC_CREDENTIAL_FLAG_NONE,
+        QUIC_ALLOWED_CIPHER_SUITE_NONE,
+        CXPLAT_TLS_CREDENTIAL_FLAG_KEY_SHARE_POOL);
+
+    CXPLAT_KEY_SHARE_POOL_STATS Before, After;
+    ASSERT_TRUE(CxPlatKeySharePoolGetStats(&Before));
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        TlsContext ServerContext, ClientContext;
+        ClientContext.InitializeClient(ClientConfig);
+        ServerContext.InitializeServer(ServerConfig);
+        DoHandshake(ServerContext, ClientContext);
+    }
+
+    //
+    // Every server key share went through the pool.
+    //
+    ASSERT_TRUE(CxPlatKeySharePoolGetStats(&After));
+    ASSERT_GE((After.Hits + After.Misses) - (Before.Hits + Before.Misses), 4u);
+}
+
+TEST_F(TlsTest, KeySharePoolRefill)
+{
+    CxPlatServerSecConfig ServerConfig(
+        QUIC_CREDENTIAL_FLAG_NONE,
+        QUIC_ALLOWED_CIPHER_SUITE_NONE,
+        CXPLAT_TLS_CREDENTIAL_FLAG_KEY_SHARE_POOL);
+
+    const struct {
+        const char* Algorithm;
+        const char* Group;
+    } Groups[] = {
+        { "X25519", nullptr },
+        { "EC", "P-256" }
+    };
+    const uint32_t KeyCount = 100;
+
+    for (auto& Group : Groups) {
+        CXPLAT_KEY_SHARE_POOL_STATS Before, After;
+        ASSERT_TRUE(CxPlatKeySharePoolGetStats(&Before));
+
+        //
+        // Drain well past a shard's depth. Pooled keys and keys generated
+        // inline get mixed, and no key may be handed out twice.
+        //
+        std::set<std::vector<uint8_t>> PublicKeys;
+        for (uint32_t i = 0; i < KeyCount; ++i) {
+            auto PublicKey = GenerateKeyShare(Group.Algorithm, Group.Group);
+            ASSERT_FALSE(PublicKey.empty());
+            ASSERT_TRUE(PublicKeys.insert(PublicKey).second);
+        }
+
+        ASSERT_TRUE(CxPlatKeySharePoolGetStats(&After));
+        ASSERT_EQ(KeyCount, (After.Hits + After.Misses) - (Before.Hits + Before.Misses));
+        ASSERT_GT(After.Hits, Before.Hits);
+
+        //
+        // Draining woke the refill thread to top the pool back up.
+        //
+        ASSERT_TRUE(WaitForKeySharePoolRefill(Before.Refilled));
+    }
+}
+
+#endif // QUIC_TEST_OPENSSL_FLAGS
+
 #ifndef QUIC_DISABLE_PFX_TESTS
 TEST_F(TlsTest, HandshakeCertFromFile)
 {
@@ -169,6 +169,10 @@ pub const QUIC_PARAM_GLOBAL_TLS_PROVIDER: u32 = 16777226;
 pub const QUIC_PARAM_GLOBAL_STATELESS_RESET_KEY: u32 = 16777227;
 pub const QUIC_PARAM_GLOBAL_STATISTICS_V2_SIZES: u32 = 16777228;
 pub const QUIC_PARAM_GLOBAL_STATELESS_RETRY_CONFIG: u32 = 16777229;
+pub const QUIC_PARAM_GLOBAL_SEND_BUFFER_BUDGET: u32 = 16777230;
+pub const QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT: u32 = 16777231;
+pub const QUIC_PARAM_GLOBAL_CONGESTION_CONTROL_PROVIDER: u32 = 16777232;
+pub const QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET: u32 = 33554433;
 pub const QUIC_PARAM_CONFIGURATION_SETTINGS: u32 = 50331648;
 pub const QUIC_PARAM_CONFIGURATION_TICKET_KEYS: u32 = 50331649;
 pub const QUIC_PARAM_CONFIGURATION_VERSION_SETTINGS: u32 = 50331650;
@@ -216,6 +220,7 @@ pub const QUIC_PARAM_STREAM_IDEAL_SEND_BUFFER_SIZE: u32 = 134217730;
 pub const QUIC_PARAM_STREAM_PRIORITY: u32 = 134217731;
 pub const QUIC_PARAM_STREAM_STATISTICS: u32 = 134217732;
 pub const QUIC_PARAM_STREAM_RELIABLE_OFFSET: u32 = 134217733;
+pub const QUIC_DATAGRAM_PRIORITY_CLASS_MAX: u32 = 3;
 pub const QUIC_API_VERSION_1: u32 = 1;
 pub const QUIC_API_VERSION_2: u32 = 2;
 pub type BYTE = ::std::os::raw::c_uchar;
@@ -423,6 +428,7 @@ pub const QUIC_SEND_FLAGS_QUIC_SEND_FLAG_DELAY_SEND: QUIC_SEND_FLAGS = 16;
 pub const QUIC_SEND_FLAGS_QUIC_SEND_FLAG_CANCEL_ON_LOSS: QUIC_SEND_FLAGS = 32;
 pub const QUIC_SEND_FLAGS_QUIC_SEND_FLAG_PRIORITY_WORK: QUIC_SEND_FLAGS = 64;
 pub const QUIC_SEND_FLAGS_QUIC_SEND_FLAG_CANCEL_ON_BLOCKED: QUIC_SEND_FLAGS = 128;
+pub const QUIC_SEND_FLAGS_QUIC_SEND_FLAG_DGRAM_FEC_FLUSH: QUIC_SEND_FLAGS = 256;
 pub type QUIC_SEND_FLAGS = ::std::os::raw::c_int;
 pub const QUIC_DATAGRAM_SEND_STATE_QUIC_DATAGRAM_SEND_UNKNOWN: QUIC_DATAGRAM_SEND_STATE = 0;
 pub const QUIC_DATAGRAM_SEND_STATE_QUIC_DATAGRAM_SEND_SENT: QUIC_DATAGRAM_SEND_STATE = 1;
@@ -785,8 +791,14 @@ pub const QUIC_CONGESTION_CONTROL_ALGORITHM_QUIC_CONGESTION_CONTROL_ALGORITHM_CU
     QUIC_CONGESTION_CONTROL_ALGORITHM = 0;
 pub const QUIC_CONGESTION_CONTROL_ALGORITHM_QUIC_CONGESTION_CONTROL_ALGORITHM_BBR:
     QUIC_CONGESTION_CONTROL_ALGORITHM = 1;
-pub const QUIC_CONGESTION_CONTROL_ALGORITHM_QUIC_CONGESTION_CONTROL_ALGORITHM_MAX:
+pub const QUIC_CONGESTION_CONTROL_ALGORITHM_QUIC_CONGESTION_CONTROL_ALGORITHM_BBR3:
     QUIC_CONGESTION_CONTROL_ALGORITHM = 2;
+pub const QUIC_CONGESTION_CONTROL_ALGORITHM_QUIC_CONGESTION_CONTROL_ALGORITHM_PRAGUE:
+    QUIC_CONGESTION_CONTROL_ALGORITHM = 3;
+pub const QUIC_CONGESTION_CONTROL_ALGORITHM_QUIC_CONGESTION_CONTROL_ALGORITHM_CUSTOM:
+    QUIC_CONGESTION_CONTROL_ALGORITHM = 4;
+pub const QUIC_CONGESTION_CONTROL_ALGORITHM_QUIC_CONGESTION_CONTROL_ALGORITHM_MAX:
+    QUIC_CONGESTION_CONTROL_ALGORITHM = 5;
 pub type QUIC_CONGESTION_CONTROL_ALGORITHM = ::std::os::raw::c_int;
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
@@ -1189,10 +1201,20 @@ pub struct QUIC_STATISTICS_V2 {
     pub SendEcnCongestionCount: u32,
     pub HandshakeHopLimitTTL: u8,
     pub RttVariance: u32,
+    pub RecvWindowBytes: u64,
+    pub RecvWindowGrowCount: u32,
+    pub RecvWindowShrinkCount: u32,
+    pub RecvWindowBudgetLimitedCount: u32,
+    pub SendSpuriousLostBytes: u64,
+    pub SendSpuriousCongestionCount: u32,
+    pub SendPacketReorderThreshold: u32,
+    pub SendDatagramFecRepairCount: u32,
+    pub RecvDatagramFecRecoveredCount: u32,
+    pub SendDatagramExpiredCount: u32,
 }
 #[allow(clippy::unnecessary_operation, clippy::identity_op)]
 const _: () = {
-    ["Size of QUIC_STATISTICS_V2"][::std::mem::size_of::<QUIC_STATISTICS_V2>() - 208usize];
+    ["Size of QUIC_STATISTICS_V2"][::std::mem::size_of::<QUIC_STATISTICS_V2>() - 264usize];
     ["Alignment of QUIC_STATISTICS_V2"][::std::mem::align_of::<QUIC_STATISTICS_V2>() - 8usize];
     ["Offset of field: QUIC_STATISTICS_V2::CorrelationId"]
         [::std::mem::offset_of!(QUIC_STATISTICS_V2, CorrelationId) - 0usize];
@@ -1260,6 +1282,26 @@ const _: () = {
         [::std::mem::offset_of!(QUIC_STATISTICS_V2, HandshakeHopLimitTTL) - 200usize];
     ["Offset of field: QUIC_STATISTICS_V2::RttVariance"]
         [::std::mem::offset_of!(QUIC_STATISTICS_V2, RttVariance) - 204usize];
+    ["Offset of field: QUIC_STATISTICS_V2::RecvWindowBytes"]
+        [::std::mem::offset_of!(QUIC_STATISTICS_V2, RecvWindowBytes) - 208usize];
+    ["Offset of field: QUIC_STATISTICS_V2::RecvWindowGrowCount"]
+        [::std::mem::offset_of!(QUIC_STATISTICS_V2, RecvWindowGrowCount) - 216usize];
+    ["Offset of field: QUIC_STATISTICS_V2::RecvWindowShrinkCount"]
+        [::std::mem::offset_of!(QUIC_STATISTICS_V2, RecvWindowShrinkCount) - 220usize];
+    ["Offset of field: QUIC_STATISTICS_V2::RecvWindowBudgetLimitedCount"]
+        [::std::mem::offset_of!(QUIC_STATISTICS_V2, RecvWindowBudgetLimitedCount) - 224usize];
+    ["Offset of field: QUIC_STATISTICS_V2::SendSpuriousLostBytes"]
+        [::std::mem::offset_of!(QUIC_STATISTICS_V2, SendSpuriousLostBytes) - 232usize];
+    ["Offset of field: QUIC_STATISTICS_V2::SendSpuriousCongestionCount"]
+        [::std::mem::offset_of!(QUIC_STATISTICS_V2, SendSpuriousCongestionCount) - 240usize];
+    ["Offset of field: QUIC_STATISTICS_V2::SendPacketReorderThreshold"]
+        [::std::mem::offset_of!(QUIC_STATISTICS_V2, SendPacketReorderThreshold) - 244usize];
+    ["Offset of field: QUIC_STATISTICS_V2::SendDatagramFecRepairCount"]
+        [::std::mem::offset_of!(QUIC_STATISTICS_V2, SendDatagramFecRepairCount) - 248usize];
+    ["Offset of field: QUIC_STATISTICS_V2::RecvDatagramFecRecoveredCount"]
+        [::std::mem::offset_of!(QUIC_STATISTICS_V2, RecvDatagramFecRecoveredCount) - 252usize];
+    ["Offset of field: QUIC_STATISTICS_V2::SendDatagramExpiredCount"]
+        [::std::mem::offset_of!(QUIC_STATISTICS_V2, SendDatagramExpiredCount) - 256usize];
 };
 impl QUIC_STATISTICS_V2 {
     #[inline]
@@ -1677,7 +1719,23 @@ pub const QUIC_PERFORMANCE_COUNTERS_QUIC_PERF_COUNTER_CONN_LOAD_REJECT: QUIC_PER
     31;
 pub const QUIC_PERFORMANCE_COUNTERS_QUIC_PERF_COUNTER_LISTEN_QUEUE_DEPTH:
     QUIC_PERFORMANCE_COUNTERS = 32;
-pub const QUIC_PERFORMANCE_COUNTERS_QUIC_PERF_COUNTER_MAX: QUIC_PERFORMANCE_COUNTERS = 33;
+pub const QUIC_PERFORMANCE_COUNTERS_QUIC_PERF_COUNTER_SEND_BUFFER_BYTES: QUIC_PERFORMANCE_COUNTERS =
+    33;
+pub const QUIC_PERFORMANCE_COUNTERS_QUIC_PERF_COUNTER_SEND_BUFFER_BUDGET_EXHAUSTED:
+    QUIC_PERFORMANCE_COUNTERS = 34;
+pub const QUIC_PERFORMANCE_COUNTERS_QUIC_PERF_COUNTER_SESSION_CACHE_HIT: QUIC_PERFORMANCE_COUNTERS =
+    35;
+pub const QUIC_PERFORMANCE_COUNTERS_QUIC_PERF_COUNTER_SESSION_CACHE_MISS:
+    QUIC_PERFORMANCE_COUNTERS = 36;
+pub const QUIC_PERFORMANCE_COUNTERS_QUIC_PERF_COUNTER_CONN_HANDSHAKE_NO_AMP_STALL:
+    QUIC_PERFORMANCE_COUNTERS = 37;
+pub const QUIC_PERFORMANCE_COUNTERS_QUIC_PERF_COUNTER_STATELESS_OPER_COMPLETED:
+    QUIC_PERFORMANCE_COUNTERS = 38;
+pub const QUIC_PERFORMANCE_COUNTERS_QUIC_PERF_COUNTER_STATELESS_OPER_DROPPED:
+    QUIC_PERFORMANCE_COUNTERS = 39;
+pub const QUIC_PERFORMANCE_COUNTERS_QUIC_PERF_COUNTER_CONN_INITIAL_RATE_LIMITED:
+    QUIC_PERFORMANCE_COUNTERS = 40;
+pub const QUIC_PERFORMANCE_COUNTERS_QUIC_PERF_COUNTER_MAX: QUIC_PERFORMANCE_COUNTERS = 41;
 pub type QUIC_PERFORMANCE_COUNTERS = ::std::os::raw::c_int;
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
@@ -1714,6 +1772,9 @@ pub struct QUIC_GLOBAL_SETTINGS {
     pub RetryMemoryLimit: u16,
     pub LoadBalancingMode: u16,
     pub FixedServerID: u32,
+    pub ReplayFilterSize: u32,
+    pub ReplayFilterWindowMs: u32,
+    pub InitialRateLimit: u32,
 }
 #[repr(C)]
 #[derive(Copy, Clone)]
@@ -1835,14 +1896,113 @@ impl QUIC_GLOBAL_SETTINGS__bindgen_ty_1__bindgen_ty_1 {
         }
     }
     #[inline]
+    pub fn ReplayFilterSize(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(3usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_ReplayFilterSize(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(3usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn ReplayFilterSize_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                3usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_ReplayFilterSize_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                3usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn ReplayFilterWindowMs(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(4usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_ReplayFilterWindowMs(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(4usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn ReplayFilterWindowMs_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                4usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_ReplayFilterWindowMs_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                4usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn InitialRateLimit(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(5usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_InitialRateLimit(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(5usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn InitialRateLimit_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                5usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_InitialRateLimit_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                5usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
     pub fn RESERVED(&self) -> u64 {
-        unsafe { ::std::mem::transmute(self._bitfield_1.get(3usize, 61u8) as u64) }
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(6usize, 58u8) as u64) }
     }
     #[inline]
     pub fn set_RESERVED(&mut self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
-            self._bitfield_1.set(3usize, 61u8, val as u64)
+            self._bitfield_1.set(6usize, 58u8, val as u64)
         }
     }
     #[inline]
@@ -1850,8 +2010,8 @@ impl QUIC_GLOBAL_SETTINGS__bindgen_ty_1__bindgen_ty_1 {
         unsafe {
             ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
                 ::std::ptr::addr_of!((*this)._bitfield_1),
-                3usize,
-                61u8,
+                6usize,
+                58u8,
             ) as u64)
         }
     }
@@ -1861,8 +2021,8 @@ impl QUIC_GLOBAL_SETTINGS__bindgen_ty_1__bindgen_ty_1 {
             let val: u64 = ::std::mem::transmute(val);
             <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
                 ::std::ptr::addr_of_mut!((*this)._bitfield_1),
-                3usize,
-                61u8,
+                6usize,
+                58u8,
                 val as u64,
             )
         }
@@ -1872,6 +2032,9 @@ impl QUIC_GLOBAL_SETTINGS__bindgen_ty_1__bindgen_ty_1 {
         RetryMemoryLimit: u64,
         LoadBalancingMode: u64,
         FixedServerID: u64,
+        ReplayFilterSize: u64,
+        ReplayFilterWindowMs: u64,
+        InitialRateLimit: u64,
         RESERVED: u64,
     ) -> __BindgenBitfieldUnit<[u8; 8usize]> {
         let mut __bindgen_bitfield_unit: __BindgenBitfieldUnit<[u8; 8usize]> = Default::default();
@@ -1887,7 +2050,19 @@ impl QUIC_GLOBAL_SETTINGS__bindgen_ty_1__bindgen_ty_1 {
             let FixedServerID: u64 = unsafe { ::std::mem::transmute(FixedServerID) };
             FixedServerID as u64
         });
-        __bindgen_bitfield_unit.set(3usize, 61u8, {
+        __bindgen_bitfield_unit.set(3usize, 1u8, {
+            let ReplayFilterSize: u64 = unsafe { ::std::mem::transmute(ReplayFilterSize) };
+            ReplayFilterSize as u64
+        });
+        __bindgen_bitfield_unit.set(4usize, 1u8, {
+            let ReplayFilterWindowMs: u64 = unsafe { ::std::mem::transmute(ReplayFilterWindowMs) };
+            ReplayFilterWindowMs as u64
+        });
+        __bindgen_bitfield_unit.set(5usize, 1u8, {
+            let InitialRateLimit: u64 = unsafe { ::std::mem::transmute(InitialRateLimit) };
+            InitialRateLimit as u64
+        });
+        __bindgen_bitfield_unit.set(6usize, 58u8, {
             let RESERVED: u64 = unsafe { ::std::mem::transmute(RESERVED) };
             RESERVED as u64
         });
@@ -1907,7 +2082,7 @@ const _: () = {
 };
 #[allow(clippy::unnecessary_operation, clippy::identity_op)]
 const _: () = {
-    ["Size of QUIC_GLOBAL_SETTINGS"][::std::mem::size_of::<QUIC_GLOBAL_SETTINGS>() - 16usize];
+    ["Size of QUIC_GLOBAL_SETTINGS"][::std::mem::size_of::<QUIC_GLOBAL_SETTINGS>() - 32usize];
     ["Alignment of QUIC_GLOBAL_SETTINGS"][::std::mem::align_of::<QUIC_GLOBAL_SETTINGS>() - 8usize];
     ["Offset of field: QUIC_GLOBAL_SETTINGS::RetryMemoryLimit"]
         [::std::mem::offset_of!(QUIC_GLOBAL_SETTINGS, RetryMemoryLimit) - 8usize];
@@ -1915,6 +2090,12 @@ const _: () = {
         [::std::mem::offset_of!(QUIC_GLOBAL_SETTINGS, LoadBalancingMode) - 10usize];
     ["Offset of field: QUIC_GLOBAL_SETTINGS::FixedServerID"]
         [::std::mem::offset_of!(QUIC_GLOBAL_SETTINGS, FixedServerID) - 12usize];
+    ["Offset of field: QUIC_GLOBAL_SETTINGS::ReplayFilterSize"]
+        [::std::mem::offset_of!(QUIC_GLOBAL_SETTINGS, ReplayFilterSize) - 16usize];
+    ["Offset of field: QUIC_GLOBAL_SETTINGS::ReplayFilterWindowMs"]
+        [::std::mem::offset_of!(QUIC_GLOBAL_SETTINGS, ReplayFilterWindowMs) - 20usize];
+    ["Offset of field: QUIC_GLOBAL_SETTINGS::InitialRateLimit"]
+        [::std::mem::offset_of!(QUIC_GLOBAL_SETTINGS, InitialRateLimit) - 24usize];
 };
 #[repr(C)]
 #[derive(Copy, Clone)]
@@ -3494,190 +3675,496 @@ impl QUIC_SETTINGS__bindgen_ty_1__bindgen_ty_1 {
         }
     }
     #[inline]
-    pub fn RESERVED(&self) -> u64 {
-        unsafe { ::std::mem::transmute(self._bitfield_1.get(46usize, 18u8) as u64) }
+    pub fn AdaptiveAckFrequencyEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(46usize, 1u8) as u64) }
     }
     #[inline]
-    pub fn set_RESERVED(&mut self, val: u64) {
+    pub fn set_AdaptiveAckFrequencyEnabled(&mut self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
-            self._bitfield_1.set(46usize, 18u8, val as u64)
+            self._bitfield_1.set(46usize, 1u8, val as u64)
         }
     }
     #[inline]
-    pub unsafe fn RESERVED_raw(this: *const Self) -> u64 {
+    pub unsafe fn AdaptiveAckFrequencyEnabled_raw(this: *const Self) -> u64 {
         unsafe {
             ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
                 ::std::ptr::addr_of!((*this)._bitfield_1),
                 46usize,
-                18u8,
+                1u8,
             ) as u64)
         }
     }
     #[inline]
-    pub unsafe fn set_RESERVED_raw(this: *mut Self, val: u64) {
+    pub unsafe fn set_AdaptiveAckFrequencyEnabled_raw(this: *mut Self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
             <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
                 ::std::ptr::addr_of_mut!((*this)._bitfield_1),
                 46usize,
-                18u8,
+                1u8,
                 val as u64,
             )
         }
     }
     #[inline]
-    pub fn new_bitfield_1(
-        MaxBytesPerKey: u64,
-        HandshakeIdleTimeoutMs: u64,
-        IdleTimeoutMs: u64,
-        MtuDiscoverySearchCompleteTimeoutUs: u64,
-        TlsClientMaxSendBuffer: u64,
-        TlsServerMaxSendBuffer: u64,
-        StreamRecvWindowDefault: u64,
-        StreamRecvBufferDefault: u64,
-        ConnFlowControlWindow: u64,
-        MaxWorkerQueueDelayUs: u64,
-        MaxStatelessOperations: u64,
-        InitialWindowPackets: u64,
-        SendIdleTimeoutMs: u64,
-        InitialRttMs: u64,
-        MaxAckDelayMs: u64,
-        DisconnectTimeoutMs: u64,
-        KeepAliveIntervalMs: u64,
-        CongestionControlAlgorithm: u64,
-        PeerBidiStreamCount: u64,
-        PeerUnidiStreamCount: u64,
-        MaxBindingStatelessOperations: u64,
-        StatelessOperationExpirationMs: u64,
-        MinimumMtu: u64,
-        MaximumMtu: u64,
-        SendBufferingEnabled: u64,
-        PacingEnabled: u64,
-        MigrationEnabled: u64,
-        DatagramReceiveEnabled: u64,
-        ServerResumptionLevel: u64,
-        MaxOperationsPerDrain: u64,
-        MtuDiscoveryMissingProbeCount: u64,
-        DestCidUpdateIdleTimeoutMs: u64,
-        GreaseQuicBitEnabled: u64,
-        EcnEnabled: u64,
-        HyStartEnabled: u64,
-        StreamRecvWindowBidiLocalDefault: u64,
-        StreamRecvWindowBidiRemoteDefault: u64,
-        StreamRecvWindowUnidiDefault: u64,
-        EncryptionOffloadAllowed: u64,
-        ReliableResetEnabled: u64,
-        OneWayDelayEnabled: u64,
-        NetStatsEventEnabled: u64,
-        StreamMultiReceiveEnabled: u64,
-        XdpEnabled: u64,
-        QTIPEnabled: u64,
-        ReservedRioEnabled: u64,
-        RESERVED: u64,
-    ) -> __BindgenBitfieldUnit<[u8; 8usize]> {
-        let mut __bindgen_bitfield_unit: __BindgenBitfieldUnit<[u8; 8usize]> = Default::default();
-        __bindgen_bitfield_unit.set(0usize, 1u8, {
-            let MaxBytesPerKey: u64 = unsafe { ::std::mem::transmute(MaxBytesPerKey) };
-            MaxBytesPerKey as u64
-        });
-        __bindgen_bitfield_unit.set(1usize, 1u8, {
-            let HandshakeIdleTimeoutMs: u64 =
-                unsafe { ::std::mem::transmute(HandshakeIdleTimeoutMs) };
-            HandshakeIdleTimeoutMs as u64
-        });
-        __bindgen_bitfield_unit.set(2usize, 1u8, {
-            let IdleTimeoutMs: u64 = unsafe { ::std::mem::transmute(IdleTimeoutMs) };
-            IdleTimeoutMs as u64
-        });
-        __bindgen_bitfield_unit.set(3usize, 1u8, {
-            let MtuDiscoverySearchCompleteTimeoutUs: u64 =
-                unsafe { ::std::mem::transmute(MtuDiscoverySearchCompleteTimeoutUs) };
-            MtuDiscoverySearchCompleteTimeoutUs as u64
-        });
-        __bindgen_bitfield_unit.set(4usize, 1u8, {
-            let TlsClientMaxSendBuffer: u64 =
-                unsafe { ::std::mem::transmute(TlsClientMaxSendBuffer) };
-            TlsClientMaxSendBuffer as u64
-        });
-        __bindgen_bitfield_unit.set(5usize, 1u8, {
-            let TlsServerMaxSendBuffer: u64 =
-                unsafe { ::std::mem::transmute(TlsServerMaxSendBuffer) };
-            TlsServerMaxSendBuffer as u64
-        });
-        __bindgen_bitfield_unit.set(6usize, 1u8, {
-            let StreamRecvWindowDefault: u64 =
-                unsafe { ::std::mem::transmute(StreamRecvWindowDefault) };
-            StreamRecvWindowDefault as u64
-        });
-        __bindgen_bitfield_unit.set(7usize, 1u8, {
-            let StreamRecvBufferDefault: u64 =
-                unsafe { ::std::mem::transmute(StreamRecvBufferDefault) };
-            StreamRecvBufferDefault as u64
-        });
-        __bindgen_bitfield_unit.set(8usize, 1u8, {
-            let ConnFlowControlWindow: u64 =
-                unsafe { ::std::mem::transmute(ConnFlowControlWindow) };
-            ConnFlowControlWindow as u64
-        });
-        __bindgen_bitfield_unit.set(9usize, 1u8, {
-            let MaxWorkerQueueDelayUs: u64 =
-                unsafe { ::std::mem::transmute(MaxWorkerQueueDelayUs) };
-            MaxWorkerQueueDelayUs as u64
-        });
-        __bindgen_bitfield_unit.set(10usize, 1u8, {
-            let MaxStatelessOperations: u64 =
-                unsafe { ::std::mem::transmute(MaxStatelessOperations) };
-            MaxStatelessOperations as u64
-        });
-        __bindgen_bitfield_unit.set(11usize, 1u8, {
-            let InitialWindowPackets: u64 = unsafe { ::std::mem::transmute(InitialWindowPackets) };
-            InitialWindowPackets as u64
-        });
-        __bindgen_bitfield_unit.set(12usize, 1u8, {
-            let SendIdleTimeoutMs: u64 = unsafe { ::std::mem::transmute(SendIdleTimeoutMs) };
-            SendIdleTimeoutMs as u64
-        });
-        __bindgen_bitfield_unit.set(13usize, 1u8, {
-            let InitialRttMs: u64 = unsafe { ::std::mem::transmute(InitialRttMs) };
-            InitialRttMs as u64
-        });
-        __bindgen_bitfield_unit.set(14usize, 1u8, {
-            let MaxAckDelayMs: u64 = unsafe { ::std::mem::transmute(MaxAckDelayMs) };
-            MaxAckDelayMs as u64
-        });
-        __bindgen_bitfield_unit.set(15usize, 1u8, {
-            let DisconnectTimeoutMs: u64 = unsafe { ::std::mem::transmute(DisconnectTimeoutMs) };
-            DisconnectTimeoutMs as u64
-        });
-        __bindgen_bitfield_unit.set(16usize, 1u8, {
-            let KeepAliveIntervalMs: u64 = unsafe { ::std::mem::transmute(KeepAliveIntervalMs) };
-            KeepAliveIntervalMs as u64
-        });
-        __bindgen_bitfield_unit.set(17usize, 1u8, {
-            let CongestionControlAlgorithm: u64 =
-                unsafe { ::std::mem::transmute(CongestionControlAlgorithm) };
-            CongestionControlAlgorithm as u64
-        });
-        __bindgen_bitfield_unit.set(18usize, 1u8, {
-            let PeerBidiStreamCount: u64 = unsafe { ::std::mem::transmute(PeerBidiStreamCount) };
-            PeerBidiStreamCount as u64
-        });
-        __bindgen_bitfield_unit.set(19usize, 1u8, {
-            let PeerUnidiStreamCount: u64 = unsafe { ::std::mem::transmute(PeerUnidiStreamCount) };
-            PeerUnidiStreamCount as u64
-        });
-        __bindgen_bitfield_unit.set(20usize, 1u8, {
-            let MaxBindingStatelessOperations: u64 =
-                unsafe { ::std::mem::transmute(MaxBindingStatelessOperations) };
-            MaxBindingStatelessOperations as u64
-        });
-        __bindgen_bitfield_unit.set(21usize, 1u8, {
-            let StatelessOperationExpirationMs: u64 =
-                unsafe { ::std::mem::transmute(StatelessOperationExpirationMs) };
-            StatelessOperationExpirationMs as u64
-        });
-        __bindgen_bitfield_unit.set(22usize, 1u8, {
+    pub fn EncryptInCopyEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(47usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_EncryptInCopyEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(47usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn EncryptInCopyEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                47usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_EncryptInCopyEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                47usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn DecryptToAppBuffersEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(48usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_DecryptToAppBuffersEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(48usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn DecryptToAppBuffersEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                48usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_DecryptToAppBuffersEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                48usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn DatagramFecEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(49usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_DatagramFecEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(49usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn DatagramFecEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                49usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_DatagramFecEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                49usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn DatagramReceiveBatchEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(50usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_DatagramReceiveBatchEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(50usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn DatagramReceiveBatchEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                50usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_DatagramReceiveBatchEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                50usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn TlsOffloadEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(51usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_TlsOffloadEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(51usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn TlsOffloadEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                51usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_TlsOffloadEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                51usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn ServerSessionCacheEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(52usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_ServerSessionCacheEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(52usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn ServerSessionCacheEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                52usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_ServerSessionCacheEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                52usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn ReplayFilterEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(53usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_ReplayFilterEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(53usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn ReplayFilterEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                53usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_ReplayFilterEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                53usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn KeySharePoolEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(54usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_KeySharePoolEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(54usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn KeySharePoolEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                54usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_KeySharePoolEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                54usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn RESERVED(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(55usize, 9u8) as u64) }
+    }
+    #[inline]
+    pub fn set_RESERVED(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(55usize, 9u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn RESERVED_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                55usize,
+                9u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_RESERVED_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                55usize,
+                9u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn new_bitfield_1(
+        MaxBytesPerKey: u64,
+        HandshakeIdleTimeoutMs: u64,
+        IdleTimeoutMs: u64,
+        MtuDiscoverySearchCompleteTimeoutUs: u64,
+        TlsClientMaxSendBuffer: u64,
+        TlsServerMaxSendBuffer: u64,
+        StreamRecvWindowDefault: u64,
+        StreamRecvBufferDefault: u64,
+        ConnFlowControlWindow: u64,
+        MaxWorkerQueueDelayUs: u64,
+        MaxStatelessOperations: u64,
+        InitialWindowPackets: u64,
+        SendIdleTimeoutMs: u64,
+        InitialRttMs: u64,
+        MaxAckDelayMs: u64,
+        DisconnectTimeoutMs: u64,
+        KeepAliveIntervalMs: u64,
+        CongestionControlAlgorithm: u64,
+        PeerBidiStreamCount: u64,
+        PeerUnidiStreamCount: u64,
+        MaxBindingStatelessOperations: u64,
+        StatelessOperationExpirationMs: u64,
+        MinimumMtu: u64,
+        MaximumMtu: u64,
+        SendBufferingEnabled: u64,
+        PacingEnabled: u64,
+        MigrationEnabled: u64,
+        DatagramReceiveEnabled: u64,
+        ServerResumptionLevel: u64,
+        MaxOperationsPerDrain: u64,
+        MtuDiscoveryMissingProbeCount: u64,
+        DestCidUpdateIdleTimeoutMs: u64,
+        GreaseQuicBitEnabled: u64,
+        EcnEnabled: u64,
+        HyStartEnabled: u64,
+        StreamRecvWindowBidiLocalDefault: u64,
+        StreamRecvWindowBidiRemoteDefault: u64,
+        StreamRecvWindowUnidiDefault: u64,
+        EncryptionOffloadAllowed: u64,
+        ReliableResetEnabled: u64,
+        OneWayDelayEnabled: u64,
+        NetStatsEventEnabled: u64,
+        StreamMultiReceiveEnabled: u64,
+        XdpEnabled: u64,
+        QTIPEnabled: u64,
+        ReservedRioEnabled: u64,
+        AdaptiveAckFrequencyEnabled: u64,
+        EncryptInCopyEnabled: u64,
+        DecryptToAppBuffersEnabled: u64,
+        DatagramFecEnabled: u64,
+        DatagramReceiveBatchEnabled: u64,
+        TlsOffloadEnabled: u64,
+        ServerSessionCacheEnabled: u64,
+        ReplayFilterEnabled: u64,
+        KeySharePoolEnabled: u64,
+        RESERVED: u64,
+    ) -> __BindgenBitfieldUnit<[u8; 8usize]> {
+        let mut __bindgen_bitfield_unit: __BindgenBitfieldUnit<[u8; 8usize]> = Default::default();
+        __bindgen_bitfield_unit.set(0usize, 1u8, {
+            let MaxBytesPerKey: u64 = unsafe { ::std::mem::transmute(MaxBytesPerKey) };
+            MaxBytesPerKey as u64
+        });
+        __bindgen_bitfield_unit.set(1usize, 1u8, {
+            let HandshakeIdleTimeoutMs: u64 =
+                unsafe { ::std::mem::transmute(HandshakeIdleTimeoutMs) };
+            HandshakeIdleTimeoutMs as u64
+        });
+        __bindgen_bitfield_unit.set(2usize, 1u8, {
+            let IdleTimeoutMs: u64 = unsafe { ::std::mem::transmute(IdleTimeoutMs) };
+            IdleTimeoutMs as u64
+        });
+        __bindgen_bitfield_unit.set(3usize, 1u8, {
+            let MtuDiscoverySearchCompleteTimeoutUs: u64 =
+                unsafe { ::std::mem::transmute(MtuDiscoverySearchCompleteTimeoutUs) };
+            MtuDiscoverySearchCompleteTimeoutUs as u64
+        });
+        __bindgen_bitfield_unit.set(4usize, 1u8, {
+            let TlsClientMaxSendBuffer: u64 =
+                unsafe { ::std::mem::transmute(TlsClientMaxSendBuffer) };
+            TlsClientMaxSendBuffer as u64
+        });
+        __bindgen_bitfield_unit.set(5usize, 1u8, {
+            let TlsServerMaxSendBuffer: u64 =
+                unsafe { ::std::mem::transmute(TlsServerMaxSendBuffer) };
+            TlsServerMaxSendBuffer as u64
+        });
+        __bindgen_bitfield_unit.set(6usize, 1u8, {
+            let StreamRecvWindowDefault: u64 =
+                unsafe { ::std::mem::transmute(StreamRecvWindowDefault) };
+            StreamRecvWindowDefault as u64
+        });
+        __bindgen_bitfield_unit.set(7usize, 1u8, {
+            let StreamRecvBufferDefault: u64 =
+                unsafe { ::std::mem::transmute(StreamRecvBufferDefault) };
+            StreamRecvBufferDefault as u64
+        });
+        __bindgen_bitfield_unit.set(8usize, 1u8, {
+            let ConnFlowControlWindow: u64 =
+                unsafe { ::std::mem::transmute(ConnFlowControlWindow) };
+            ConnFlowControlWindow as u64
+        });
+        __bindgen_bitfield_unit.set(9usize, 1u8, {
+            let MaxWorkerQueueDelayUs: u64 =
+                unsafe { ::std::mem::transmute(MaxWorkerQueueDelayUs) };
+            MaxWorkerQueueDelayUs as u64
+        });
+        __bindgen_bitfield_unit.set(10usize, 1u8, {
+            let MaxStatelessOperations: u64 =
+                unsafe { ::std::mem::transmute(MaxStatelessOperations) };
+            MaxStatelessOperations as u64
+        });
+        __bindgen_bitfield_unit.set(11usize, 1u8, {
+            let InitialWindowPackets: u64 = unsafe { ::std::mem::transmute(InitialWindowPackets) };
+            InitialWindowPackets as u64
+        });
+        __bindgen_bitfield_unit.set(12usize, 1u8, {
+            let SendIdleTimeoutMs: u64 = unsafe { ::std::mem::transmute(SendIdleTimeoutMs) };
+            SendIdleTimeoutMs as u64
+        });
+        __bindgen_bitfield_unit.set(13usize, 1u8, {
+            let InitialRttMs: u64 = unsafe { ::std::mem::transmute(InitialRttMs) };
+            InitialRttMs as u64
+        });
+        __bindgen_bitfield_unit.set(14usize, 1u8, {
+            let MaxAckDelayMs: u64 = unsafe { ::std::mem::transmute(MaxAckDelayMs) };
+            MaxAckDelayMs as u64
+        });
+        __bindgen_bitfield_unit.set(15usize, 1u8, {
+            let DisconnectTimeoutMs: u64 = unsafe { ::std::mem::transmute(DisconnectTimeoutMs) };
+            DisconnectTimeoutMs as u64
+        });
+        __bindgen_bitfield_unit.set(16usize, 1u8, {
+            let KeepAliveIntervalMs: u64 = unsafe { ::std::mem::transmute(KeepAliveIntervalMs) };
+            KeepAliveIntervalMs as u64
+        });
+        __bindgen_bitfield_unit.set(17usize, 1u8, {
+            let CongestionControlAlgorithm: u64 =
+                unsafe { ::std::mem::transmute(CongestionControlAlgorithm) };
+            CongestionControlAlgorithm as u64
+        });
+        __bindgen_bitfield_unit.set(18usize, 1u8, {
+            let PeerBidiStreamCount: u64 = unsafe { ::std::mem::transmute(PeerBidiStreamCount) };
+            PeerBidiStreamCount as u64
+        });
+        __bindgen_bitfield_unit.set(19usize, 1u8, {
+            let PeerUnidiStreamCount: u64 = unsafe { ::std::mem::transmute(PeerUnidiStreamCount) };
+            PeerUnidiStreamCount as u64
+        });
+        __bindgen_bitfield_unit.set(20usize, 1u8, {
+            let MaxBindingStatelessOperations: u64 =
+                unsafe { ::std::mem::transmute(MaxBindingStatelessOperations) };
+            MaxBindingStatelessOperations as u64
+        });
+        __bindgen_bitfield_unit.set(21usize, 1u8, {
+            let StatelessOperationExpirationMs: u64 =
+                unsafe { ::std::mem::transmute(StatelessOperationExpirationMs) };
+            StatelessOperationExpirationMs as u64
+        });
+        __bindgen_bitfield_unit.set(22usize, 1u8, {
             let MinimumMtu: u64 = unsafe { ::std::mem::transmute(MinimumMtu) };
             MinimumMtu as u64
         });
@@ -3783,336 +4270,673 @@ impl QUIC_SETTINGS__bindgen_ty_1__bindgen_ty_1 {
             let ReservedRioEnabled: u64 = unsafe { ::std::mem::transmute(ReservedRioEnabled) };
             ReservedRioEnabled as u64
         });
-        __bindgen_bitfield_unit.set(46usize, 18u8, {
+        __bindgen_bitfield_unit.set(46usize, 1u8, {
+            let AdaptiveAckFrequencyEnabled: u64 =
+                unsafe { ::std::mem::transmute(AdaptiveAckFrequencyEnabled) };
+            AdaptiveAckFrequencyEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(47usize, 1u8, {
+            let EncryptInCopyEnabled: u64 = unsafe { ::std::mem::transmute(EncryptInCopyEnabled) };
+            EncryptInCopyEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(48usize, 1u8, {
+            let DecryptToAppBuffersEnabled: u64 =
+                unsafe { ::std::mem::transmute(DecryptToAppBuffersEnabled) };
+            DecryptToAppBuffersEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(49usize, 1u8, {
+            let DatagramFecEnabled: u64 = unsafe { ::std::mem::transmute(DatagramFecEnabled) };
+            DatagramFecEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(50usize, 1u8, {
+            let DatagramReceiveBatchEnabled: u64 =
+                unsafe { ::std::mem::transmute(DatagramReceiveBatchEnabled) };
+            DatagramReceiveBatchEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(51usize, 1u8, {
+            let TlsOffloadEnabled: u64 = unsafe { ::std::mem::transmute(TlsOffloadEnabled) };
+            TlsOffloadEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(52usize, 1u8, {
+            let ServerSessionCacheEnabled: u64 =
+                unsafe { ::std::mem::transmute(ServerSessionCacheEnabled) };
+            ServerSessionCacheEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(53usize, 1u8, {
+            let ReplayFilterEnabled: u64 = unsafe { ::std::mem::transmute(ReplayFilterEnabled) };
+            ReplayFilterEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(54usize, 1u8, {
+            let KeySharePoolEnabled: u64 = unsafe { ::std::mem::transmute(KeySharePoolEnabled) };
+            KeySharePoolEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(55usize, 9u8, {
             let RESERVED: u64 = unsafe { ::std::mem::transmute(RESERVED) };
             RESERVED as u64
         });
         __bindgen_bitfield_unit
     }
-}
-#[allow(clippy::unnecessary_operation, clippy::identity_op)]
-const _: () = {
-    ["Size of QUIC_SETTINGS__bindgen_ty_1"]
-        [::std::mem::size_of::<QUIC_SETTINGS__bindgen_ty_1>() - 8usize];
-    ["Alignment of QUIC_SETTINGS__bindgen_ty_1"]
-        [::std::mem::align_of::<QUIC_SETTINGS__bindgen_ty_1>() - 8usize];
-    ["Offset of field: QUIC_SETTINGS__bindgen_ty_1::IsSetFlags"]
-        [::std::mem::offset_of!(QUIC_SETTINGS__bindgen_ty_1, IsSetFlags) - 0usize];
-    ["Offset of field: QUIC_SETTINGS__bindgen_ty_1::IsSet"]
-        [::std::mem::offset_of!(QUIC_SETTINGS__bindgen_ty_1, IsSet) - 0usize];
-};
-#[repr(C)]
-#[derive(Copy, Clone)]
-pub union QUIC_SETTINGS__bindgen_ty_2 {
-    pub Flags: u64,
-    pub __bindgen_anon_1: QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1,
-}
-#[repr(C)]
-#[derive(Debug, Copy, Clone)]
-pub struct QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1 {
-    pub _bitfield_align_1: [u64; 0],
-    pub _bitfield_1: __BindgenBitfieldUnit<[u8; 8usize]>,
-}
-#[allow(clippy::unnecessary_operation, clippy::identity_op)]
-const _: () = {
-    ["Size of QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1"]
-        [::std::mem::size_of::<QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1>() - 8usize];
-    ["Alignment of QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1"]
-        [::std::mem::align_of::<QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1>() - 8usize];
-};
-impl QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1 {
+}
+#[allow(clippy::unnecessary_operation, clippy::identity_op)]
+const _: () = {
+    ["Size of QUIC_SETTINGS__bindgen_ty_1"]
+        [::std::mem::size_of::<QUIC_SETTINGS__bindgen_ty_1>() - 8usize];
+    ["Alignment of QUIC_SETTINGS__bindgen_ty_1"]
+        [::std::mem::align_of::<QUIC_SETTINGS__bindgen_ty_1>() - 8usize];
+    ["Offset of field: QUIC_SETTINGS__bindgen_ty_1::IsSetFlags"]
+        [::std::mem::offset_of!(QUIC_SETTINGS__bindgen_ty_1, IsSetFlags) - 0usize];
+    ["Offset of field: QUIC_SETTINGS__bindgen_ty_1::IsSet"]
+        [::std::mem::offset_of!(QUIC_SETTINGS__bindgen_ty_1, IsSet) - 0usize];
+};
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub union QUIC_SETTINGS__bindgen_ty_2 {
+    pub Flags: u64,
+    pub __bindgen_anon_1: QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1,
+}
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1 {
+    pub _bitfield_align_1: [u64; 0],
+    pub _bitfield_1: __BindgenBitfieldUnit<[u8; 8usize]>,
+}
+#[allow(clippy::unnecessary_operation, clippy::identity_op)]
+const _: () = {
+    ["Size of QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1"]
+        [::std::mem::size_of::<QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1>() - 8usize];
+    ["Alignment of QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1"]
+        [::std::mem::align_of::<QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1>() - 8usize];
+};
+impl QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1 {
+    #[inline]
+    pub fn HyStartEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(0usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_HyStartEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(0usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn HyStartEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                0usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_HyStartEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                0usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn EncryptionOffloadAllowed(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(1usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_EncryptionOffloadAllowed(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(1usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn EncryptionOffloadAllowed_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                1usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_EncryptionOffloadAllowed_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                1usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn ReliableResetEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(2usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_ReliableResetEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(2usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn ReliableResetEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                2usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_ReliableResetEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                2usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn OneWayDelayEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(3usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_OneWayDelayEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(3usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn OneWayDelayEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                3usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_OneWayDelayEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                3usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn NetStatsEventEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(4usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_NetStatsEventEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(4usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn NetStatsEventEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                4usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_NetStatsEventEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                4usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn StreamMultiReceiveEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(5usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_StreamMultiReceiveEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(5usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn StreamMultiReceiveEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                5usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_StreamMultiReceiveEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                5usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn XdpEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(6usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_XdpEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(6usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn XdpEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                6usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_XdpEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                6usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn QTIPEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(7usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_QTIPEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(7usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn QTIPEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                7usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_QTIPEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                7usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
+    #[inline]
+    pub fn ReservedRioEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(8usize, 1u8) as u64) }
+    }
+    #[inline]
+    pub fn set_ReservedRioEnabled(&mut self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            self._bitfield_1.set(8usize, 1u8, val as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn ReservedRioEnabled_raw(this: *const Self) -> u64 {
+        unsafe {
+            ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
+                ::std::ptr::addr_of!((*this)._bitfield_1),
+                8usize,
+                1u8,
+            ) as u64)
+        }
+    }
+    #[inline]
+    pub unsafe fn set_ReservedRioEnabled_raw(this: *mut Self, val: u64) {
+        unsafe {
+            let val: u64 = ::std::mem::transmute(val);
+            <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
+                ::std::ptr::addr_of_mut!((*this)._bitfield_1),
+                8usize,
+                1u8,
+                val as u64,
+            )
+        }
+    }
     #[inline]
-    pub fn HyStartEnabled(&self) -> u64 {
-        unsafe { ::std::mem::transmute(self._bitfield_1.get(0usize, 1u8) as u64) }
+    pub fn AdaptiveAckFrequencyEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(9usize, 1u8) as u64) }
     }
     #[inline]
-    pub fn set_HyStartEnabled(&mut self, val: u64) {
+    pub fn set_AdaptiveAckFrequencyEnabled(&mut self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
-            self._bitfield_1.set(0usize, 1u8, val as u64)
+            self._bitfield_1.set(9usize, 1u8, val as u64)
         }
     }
     #[inline]
-    pub unsafe fn HyStartEnabled_raw(this: *const Self) -> u64 {
+    pub unsafe fn AdaptiveAckFrequencyEnabled_raw(this: *const Self) -> u64 {
         unsafe {
             ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
                 ::std::ptr::addr_of!((*this)._bitfield_1),
-                0usize,
+                9usize,
                 1u8,
             ) as u64)
         }
     }
     #[inline]
-    pub unsafe fn set_HyStartEnabled_raw(this: *mut Self, val: u64) {
+    pub unsafe fn set_AdaptiveAckFrequencyEnabled_raw(this: *mut Self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
             <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
                 ::std::ptr::addr_of_mut!((*this)._bitfield_1),
-                0usize,
+                9usize,
                 1u8,
                 val as u64,
             )
         }
     }
     #[inline]
-    pub fn EncryptionOffloadAllowed(&self) -> u64 {
-        unsafe { ::std::mem::transmute(self._bitfield_1.get(1usize, 1u8) as u64) }
+    pub fn EncryptInCopyEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(10usize, 1u8) as u64) }
     }
     #[inline]
-    pub fn set_EncryptionOffloadAllowed(&mut self, val: u64) {
+    pub fn set_EncryptInCopyEnabled(&mut self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
-            self._bitfield_1.set(1usize, 1u8, val as u64)
+            self._bitfield_1.set(10usize, 1u8, val as u64)
         }
     }
     #[inline]
-    pub unsafe fn EncryptionOffloadAllowed_raw(this: *const Self) -> u64 {
+    pub unsafe fn EncryptInCopyEnabled_raw(this: *const Self) -> u64 {
         unsafe {
             ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
                 ::std::ptr::addr_of!((*this)._bitfield_1),
-                1usize,
+                10usize,
                 1u8,
             ) as u64)
         }
     }
     #[inline]
-    pub unsafe fn set_EncryptionOffloadAllowed_raw(this: *mut Self, val: u64) {
+    pub unsafe fn set_EncryptInCopyEnabled_raw(this: *mut Self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
             <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
                 ::std::ptr::addr_of_mut!((*this)._bitfield_1),
-                1usize,
+                10usize,
                 1u8,
                 val as u64,
             )
         }
     }
     #[inline]
-    pub fn ReliableResetEnabled(&self) -> u64 {
-        unsafe { ::std::mem::transmute(self._bitfield_1.get(2usize, 1u8) as u64) }
+    pub fn DecryptToAppBuffersEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(11usize, 1u8) as u64) }
     }
     #[inline]
-    pub fn set_ReliableResetEnabled(&mut self, val: u64) {
+    pub fn set_DecryptToAppBuffersEnabled(&mut self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
-            self._bitfield_1.set(2usize, 1u8, val as u64)
+            self._bitfield_1.set(11usize, 1u8, val as u64)
         }
     }
     #[inline]
-    pub unsafe fn ReliableResetEnabled_raw(this: *const Self) -> u64 {
+    pub unsafe fn DecryptToAppBuffersEnabled_raw(this: *const Self) -> u64 {
         unsafe {
             ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
                 ::std::ptr::addr_of!((*this)._bitfield_1),
-                2usize,
+                11usize,
                 1u8,
             ) as u64)
         }
     }
     #[inline]
-    pub unsafe fn set_ReliableResetEnabled_raw(this: *mut Self, val: u64) {
+    pub unsafe fn set_DecryptToAppBuffersEnabled_raw(this: *mut Self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
             <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
                 ::std::ptr::addr_of_mut!((*this)._bitfield_1),
-                2usize,
+                11usize,
                 1u8,
                 val as u64,
             )
         }
     }
     #[inline]
-    pub fn OneWayDelayEnabled(&self) -> u64 {
-        unsafe { ::std::mem::transmute(self._bitfield_1.get(3usize, 1u8) as u64) }
+    pub fn DatagramFecEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(12usize, 1u8) as u64) }
     }
     #[inline]
-    pub fn set_OneWayDelayEnabled(&mut self, val: u64) {
+    pub fn set_DatagramFecEnabled(&mut self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
-            self._bitfield_1.set(3usize, 1u8, val as u64)
+            self._bitfield_1.set(12usize, 1u8, val as u64)
         }
     }
     #[inline]
-    pub unsafe fn OneWayDelayEnabled_raw(this: *const Self) -> u64 {
+    pub unsafe fn DatagramFecEnabled_raw(this: *const Self) -> u64 {
         unsafe {
             ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
                 ::std::ptr::addr_of!((*this)._bitfield_1),
-                3usize,
+                12usize,
                 1u8,
             ) as u64)
         }
     }
     #[inline]
-    pub unsafe fn set_OneWayDelayEnabled_raw(this: *mut Self, val: u64) {
+    pub unsafe fn set_DatagramFecEnabled_raw(this: *mut Self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
             <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
                 ::std::ptr::addr_of_mut!((*this)._bitfield_1),
-                3usize,
+                12usize,
                 1u8,
                 val as u64,
             )
         }
     }
     #[inline]
-    pub fn NetStatsEventEnabled(&self) -> u64 {
-        unsafe { ::std::mem::transmute(self._bitfield_1.get(4usize, 1u8) as u64) }
+    pub fn DatagramReceiveBatchEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(13usize, 1u8) as u64) }
     }
     #[inline]
-    pub fn set_NetStatsEventEnabled(&mut self, val: u64) {
+    pub fn set_DatagramReceiveBatchEnabled(&mut self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
-            self._bitfield_1.set(4usize, 1u8, val as u64)
+            self._bitfield_1.set(13usize, 1u8, val as u64)
         }
     }
     #[inline]
-    pub unsafe fn NetStatsEventEnabled_raw(this: *const Self) -> u64 {
+    pub unsafe fn DatagramReceiveBatchEnabled_raw(this: *const Self) -> u64 {
         unsafe {
             ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
                 ::std::ptr::addr_of!((*this)._bitfield_1),
-                4usize,
+                13usize,
                 1u8,
             ) as u64)
         }
     }
     #[inline]
-    pub unsafe fn set_NetStatsEventEnabled_raw(this: *mut Self, val: u64) {
+    pub unsafe fn set_DatagramReceiveBatchEnabled_raw(this: *mut Self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
             <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
                 ::std::ptr::addr_of_mut!((*this)._bitfield_1),
-                4usize,
+                13usize,
                 1u8,
                 val as u64,
             )
         }
     }
     #[inline]
-    pub fn StreamMultiReceiveEnabled(&self) -> u64 {
-        unsafe { ::std::mem::transmute(self._bitfield_1.get(5usize, 1u8) as u64) }
+    pub fn TlsOffloadEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(14usize, 1u8) as u64) }
     }
     #[inline]
-    pub fn set_StreamMultiReceiveEnabled(&mut self, val: u64) {
+    pub fn set_TlsOffloadEnabled(&mut self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
-            self._bitfield_1.set(5usize, 1u8, val as u64)
+            self._bitfield_1.set(14usize, 1u8, val as u64)
         }
     }
     #[inline]
-    pub unsafe fn StreamMultiReceiveEnabled_raw(this: *const Self) -> u64 {
+    pub unsafe fn TlsOffloadEnabled_raw(this: *const Self) -> u64 {
         unsafe {
             ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
                 ::std::ptr::addr_of!((*this)._bitfield_1),
-                5usize,
+                14usize,
                 1u8,
             ) as u64)
         }
     }
     #[inline]
-    pub unsafe fn set_StreamMultiReceiveEnabled_raw(this: *mut Self, val: u64) {
+    pub unsafe fn set_TlsOffloadEnabled_raw(this: *mut Self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
             <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
                 ::std::ptr::addr_of_mut!((*this)._bitfield_1),
-                5usize,
+                14usize,
                 1u8,
                 val as u64,
             )
         }
     }
     #[inline]
-    pub fn XdpEnabled(&self) -> u64 {
-        unsafe { ::std::mem::transmute(self._bitfield_1.get(6usize, 1u8) as u64) }
+    pub fn ServerSessionCacheEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(15usize, 1u8) as u64) }
     }
     #[inline]
-    pub fn set_XdpEnabled(&mut self, val: u64) {
+    pub fn set_ServerSessionCacheEnabled(&mut self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
-            self._bitfield_1.set(6usize, 1u8, val as u64)
+            self._bitfield_1.set(15usize, 1u8, val as u64)
         }
     }
     #[inline]
-    pub unsafe fn XdpEnabled_raw(this: *const Self) -> u64 {
+    pub unsafe fn ServerSessionCacheEnabled_raw(this: *const Self) -> u64 {
         unsafe {
             ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
                 ::std::ptr::addr_of!((*this)._bitfield_1),
-                6usize,
+                15usize,
                 1u8,
             ) as u64)
         }
     }
     #[inline]
-    pub unsafe fn set_XdpEnabled_raw(this: *mut Self, val: u64) {
+    pub unsafe fn set_ServerSessionCacheEnabled_raw(this: *mut Self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
             <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
                 ::std::ptr::addr_of_mut!((*this)._bitfield_1),
-                6usize,
+                15usize,
                 1u8,
                 val as u64,
             )
         }
     }
     #[inline]
-    pub fn QTIPEnabled(&self) -> u64 {
-        unsafe { ::std::mem::transmute(self._bitfield_1.get(7usize, 1u8) as u64) }
+    pub fn ReplayFilterEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(16usize, 1u8) as u64) }
     }
     #[inline]
-    pub fn set_QTIPEnabled(&mut self, val: u64) {
+    pub fn set_ReplayFilterEnabled(&mut self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
-            self._bitfield_1.set(7usize, 1u8, val as u64)
+            self._bitfield_1.set(16usize, 1u8, val as u64)
         }
     }
     #[inline]
-    pub unsafe fn QTIPEnabled_raw(this: *const Self) -> u64 {
+    pub unsafe fn ReplayFilterEnabled_raw(this: *const Self) -> u64 {
         unsafe {
             ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
                 ::std::ptr::addr_of!((*this)._bitfield_1),
-                7usize,
+                16usize,
                 1u8,
             ) as u64)
         }
     }
     #[inline]
-    pub unsafe fn set_QTIPEnabled_raw(this: *mut Self, val: u64) {
+    pub unsafe fn set_ReplayFilterEnabled_raw(this: *mut Self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
             <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
                 ::std::ptr::addr_of_mut!((*this)._bitfield_1),
-                7usize,
+                16usize,
                 1u8,
                 val as u64,
             )
         }
     }
     #[inline]
-    pub fn ReservedRioEnabled(&self) -> u64 {
-        unsafe { ::std::mem::transmute(self._bitfield_1.get(8usize, 1u8) as u64) }
+    pub fn KeySharePoolEnabled(&self) -> u64 {
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(17usize, 1u8) as u64) }
     }
     #[inline]
-    pub fn set_ReservedRioEnabled(&mut self, val: u64) {
+    pub fn set_KeySharePoolEnabled(&mut self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
-            self._bitfield_1.set(8usize, 1u8, val as u64)
+            self._bitfield_1.set(17usize, 1u8, val as u64)
         }
     }
     #[inline]
-    pub unsafe fn ReservedRioEnabled_raw(this: *const Self) -> u64 {
+    pub unsafe fn KeySharePoolEnabled_raw(this: *const Self) -> u64 {
         unsafe {
             ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
                 ::std::ptr::addr_of!((*this)._bitfield_1),
-                8usize,
+                17usize,
                 1u8,
             ) as u64)
         }
     }
     #[inline]
-    pub unsafe fn set_ReservedRioEnabled_raw(this: *mut Self, val: u64) {
+    pub unsafe fn set_KeySharePoolEnabled_raw(this: *mut Self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
             <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
                 ::std::ptr::addr_of_mut!((*this)._bitfield_1),
-                8usize,
+                17usize,
                 1u8,
                 val as u64,
             )
@@ -4120,13 +4944,13 @@ impl QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1 {
     }
     #[inline]
     pub fn ReservedFlags(&self) -> u64 {
-        unsafe { ::std::mem::transmute(self._bitfield_1.get(9usize, 55u8) as u64) }
+        unsafe { ::std::mem::transmute(self._bitfield_1.get(18usize, 46u8) as u64) }
     }
     #[inline]
     pub fn set_ReservedFlags(&mut self, val: u64) {
         unsafe {
             let val: u64 = ::std::mem::transmute(val);
-            self._bitfield_1.set(9usize, 55u8, val as u64)
+            self._bitfield_1.set(18usize, 46u8, val as u64)
         }
     }
     #[inline]
@@ -4134,8 +4958,8 @@ impl QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1 {
         unsafe {
             ::std::mem::transmute(<__BindgenBitfieldUnit<[u8; 8usize]>>::raw_get(
                 ::std::ptr::addr_of!((*this)._bitfield_1),
-                9usize,
-                55u8,
+                18usize,
+                46u8,
             ) as u64)
         }
     }
@@ -4145,8 +4969,8 @@ impl QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1 {
             let val: u64 = ::std::mem::transmute(val);
             <__BindgenBitfieldUnit<[u8; 8usize]>>::raw_set(
                 ::std::ptr::addr_of_mut!((*this)._bitfield_1),
-                9usize,
-                55u8,
+                18usize,
+                46u8,
                 val as u64,
             )
         }
@@ -4162,6 +4986,15 @@ impl QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1 {
         XdpEnabled: u64,
         QTIPEnabled: u64,
         ReservedRioEnabled: u64,
+        AdaptiveAckFrequencyEnabled: u64,
+        EncryptInCopyEnabled: u64,
+        DecryptToAppBuffersEnabled: u64,
+        DatagramFecEnabled: u64,
+        DatagramReceiveBatchEnabled: u64,
+        TlsOffloadEnabled: u64,
+        ServerSessionCacheEnabled: u64,
+        ReplayFilterEnabled: u64,
+        KeySharePoolEnabled: u64,
         ReservedFlags: u64,
     ) -> __BindgenBitfieldUnit<[u8; 8usize]> {
         let mut __bindgen_bitfield_unit: __BindgenBitfieldUnit<[u8; 8usize]> = Default::default();
@@ -4203,7 +5036,47 @@ impl QUIC_SETTINGS__bindgen_ty_2__bindgen_ty_1 {
             let ReservedRioEnabled: u64 = unsafe { ::std::mem::transmute(ReservedRioEnabled) };
             ReservedRioEnabled as u64
         });
-        __bindgen_bitfield_unit.set(9usize, 55u8, {
+        __bindgen_bitfield_unit.set(9usize, 1u8, {
+            let AdaptiveAckFrequencyEnabled: u64 =
+                unsafe { ::std::mem::transmute(AdaptiveAckFrequencyEnabled) };
+            AdaptiveAckFrequencyEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(10usize, 1u8, {
+            let EncryptInCopyEnabled: u64 = unsafe { ::std::mem::transmute(EncryptInCopyEnabled) };
+            EncryptInCopyEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(11usize, 1u8, {
+            let DecryptToAppBuffersEnabled: u64 =
+                unsafe { ::std::mem::transmute(DecryptToAppBuffersEnabled) };
+            DecryptToAppBuffersEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(12usize, 1u8, {
+            let DatagramFecEnabled: u64 = unsafe { ::std::mem::transmute(DatagramFecEnabled) };
+            DatagramFecEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(13usize, 1u8, {
+            let DatagramReceiveBatchEnabled: u64 =
+                unsafe { ::std::mem::transmute(DatagramReceiveBatchEnabled) };
+            DatagramReceiveBatchEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(14usize, 1u8, {
+            let TlsOffloadEnabled: u64 = unsafe { ::std::mem::transmute(TlsOffloadEnabled) };
+            TlsOffloadEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(15usize, 1u8, {
+            let ServerSessionCacheEnabled: u64 =
+                unsafe { ::std::mem::transmute(ServerSessionCacheEnabled) };
+            ServerSessionCacheEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(16usize, 1u8, {
+            let ReplayFilterEnabled: u64 = unsafe { ::std::mem::transmute(ReplayFilterEnabled) };
+            ReplayFilterEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(17usize, 1u8, {
+            let KeySharePoolEnabled: u64 = unsafe { ::std::mem::transmute(KeySharePoolEnabled) };
+            KeySharePoolEnabled as u64
+        });
+        __bindgen_bitfield_unit.set(18usize, 46u8, {
             let ReservedFlags: u64 = unsafe { ::std::mem::transmute(ReservedFlags) };
             ReservedFlags as u64
         });
@@ -4908,6 +5781,241 @@ const _: () = {
     ["Offset of field: QUIC_STATELESS_RETRY_CONFIG::Secret"]
         [::std::mem::offset_of!(QUIC_STATELESS_RETRY_CONFIG, Secret) - 16usize];
 };
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct QUIC_CONGESTION_CONTROL_STATE {
+    pub SmoothedRtt: u64,
+    pub MinRtt: u64,
+    pub RttVariance: u64,
+    pub LatestRtt: u64,
+    pub BytesInFlight: u32,
+    pub BytesInFlightMax: u32,
+    pub DatagramPayloadLength: u16,
+    pub GotFirstRttSample: BOOLEAN,
+    pub PacingEnabled: BOOLEAN,
+}
+#[allow(clippy::unnecessary_operation, clippy::identity_op)]
+const _: () = {
+    ["Size of QUIC_CONGESTION_CONTROL_STATE"]
+        [::std::mem::size_of::<QUIC_CONGESTION_CONTROL_STATE>() - 48usize];
+    ["Alignment of QUIC_CONGESTION_CONTROL_STATE"]
+        [::std::mem::align_of::<QUIC_CONGESTION_CONTROL_STATE>() - 8usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_STATE::SmoothedRtt"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_STATE, SmoothedRtt) - 0usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_STATE::MinRtt"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_STATE, MinRtt) - 8usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_STATE::RttVariance"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_STATE, RttVariance) - 16usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_STATE::LatestRtt"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_STATE, LatestRtt) - 24usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_STATE::BytesInFlight"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_STATE, BytesInFlight) - 32usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_STATE::BytesInFlightMax"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_STATE, BytesInFlightMax) - 36usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_STATE::DatagramPayloadLength"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_STATE, DatagramPayloadLength) - 40usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_STATE::GotFirstRttSample"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_STATE, GotFirstRttSample) - 42usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_STATE::PacingEnabled"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_STATE, PacingEnabled) - 43usize];
+};
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct QUIC_CONGESTION_CONTROL_ACK {
+    pub TimeNow: u64,
+    pub LargestAck: u64,
+    pub LargestSentPacketNumber: u64,
+    pub TotalAckedBytes: u64,
+    pub MinRtt: u64,
+    pub AckedBytes: u32,
+    pub MinRttValid: BOOLEAN,
+    pub HasLoss: BOOLEAN,
+    pub IsImplicit: BOOLEAN,
+}
+#[allow(clippy::unnecessary_operation, clippy::identity_op)]
+const _: () = {
+    ["Size of QUIC_CONGESTION_CONTROL_ACK"]
+        [::std::mem::size_of::<QUIC_CONGESTION_CONTROL_ACK>() - 48usize];
+    ["Alignment of QUIC_CONGESTION_CONTROL_ACK"]
+        [::std::mem::align_of::<QUIC_CONGESTION_CONTROL_ACK>() - 8usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_ACK::TimeNow"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_ACK, TimeNow) - 0usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_ACK::LargestAck"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_ACK, LargestAck) - 8usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_ACK::LargestSentPacketNumber"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_ACK, LargestSentPacketNumber) - 16usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_ACK::TotalAckedBytes"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_ACK, TotalAckedBytes) - 24usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_ACK::MinRtt"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_ACK, MinRtt) - 32usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_ACK::AckedBytes"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_ACK, AckedBytes) - 40usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_ACK::MinRttValid"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_ACK, MinRttValid) - 44usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_ACK::HasLoss"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_ACK, HasLoss) - 45usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_ACK::IsImplicit"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_ACK, IsImplicit) - 46usize];
+};
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct QUIC_CONGESTION_CONTROL_LOSS {
+    pub LargestPacketNumberLost: u64,
+    pub LargestSentPacketNumber: u64,
+    pub LostBytes: u32,
+    pub PersistentCongestion: BOOLEAN,
+}
+#[allow(clippy::unnecessary_operation, clippy::identity_op)]
+const _: () = {
+    ["Size of QUIC_CONGESTION_CONTROL_LOSS"]
+        [::std::mem::size_of::<QUIC_CONGESTION_CONTROL_LOSS>() - 24usize];
+    ["Alignment of QUIC_CONGESTION_CONTROL_LOSS"]
+        [::std::mem::align_of::<QUIC_CONGESTION_CONTROL_LOSS>() - 8usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_LOSS::LargestPacketNumberLost"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_LOSS, LargestPacketNumberLost) - 0usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_LOSS::LargestSentPacketNumber"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_LOSS, LargestSentPacketNumber) - 8usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_LOSS::LostBytes"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_LOSS, LostBytes) - 16usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_LOSS::PersistentCongestion"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_LOSS, PersistentCongestion) - 20usize];
+};
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct QUIC_CONGESTION_CONTROL_ECN {
+    pub LargestPacketNumberAcked: u64,
+    pub LargestSentPacketNumber: u64,
+    pub CePacketCount: u32,
+}
+#[allow(clippy::unnecessary_operation, clippy::identity_op)]
+const _: () = {
+    ["Size of QUIC_CONGESTION_CONTROL_ECN"]
+        [::std::mem::size_of::<QUIC_CONGESTION_CONTROL_ECN>() - 24usize];
+    ["Alignment of QUIC_CONGESTION_CONTROL_ECN"]
+        [::std::mem::align_of::<QUIC_CONGESTION_CONTROL_ECN>() - 8usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_ECN::LargestPacketNumberAcked"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_ECN, LargestPacketNumberAcked) - 0usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_ECN::LargestSentPacketNumber"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_ECN, LargestSentPacketNumber) - 8usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_ECN::CePacketCount"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_ECN, CePacketCount) - 16usize];
+};
+pub type QUIC_CONGESTION_CONTROL_CREATE_FN = ::std::option::Option<
+    unsafe extern "C" fn(
+        ProviderContext: *mut ::std::os::raw::c_void,
+        State: *const QUIC_CONGESTION_CONTROL_STATE,
+        Instance: *mut *mut ::std::os::raw::c_void,
+    ) -> HRESULT,
+>;
+pub type QUIC_CONGESTION_CONTROL_DELETE_FN =
+    ::std::option::Option<unsafe extern "C" fn(Instance: *mut ::std::os::raw::c_void)>;
+pub type QUIC_CONGESTION_CONTROL_RESET_FN = ::std::option::Option<
+    unsafe extern "C" fn(
+        Instance: *mut ::std::os::raw::c_void,
+        State: *const QUIC_CONGESTION_CONTROL_STATE,
+        FullReset: BOOLEAN,
+    ),
+>;
+pub type QUIC_CONGESTION_CONTROL_GET_WINDOW_FN = ::std::option::Option<
+    unsafe extern "C" fn(
+        Instance: *mut ::std::os::raw::c_void,
+        State: *const QUIC_CONGESTION_CONTROL_STATE,
+    ) -> u32,
+>;
+pub type QUIC_CONGESTION_CONTROL_GET_SEND_ALLOWANCE_FN = ::std::option::Option<
+    unsafe extern "C" fn(
+        Instance: *mut ::std::os::raw::c_void,
+        State: *const QUIC_CONGESTION_CONTROL_STATE,
+        TimeSinceLastSend: u64,
+        TimeSinceLastSendValid: BOOLEAN,
+    ) -> u32,
+>;
+pub type QUIC_CONGESTION_CONTROL_ON_DATA_SENT_FN = ::std::option::Option<
+    unsafe extern "C" fn(
+        Instance: *mut ::std::os::raw::c_void,
+        State: *const QUIC_CONGESTION_CONTROL_STATE,
+        SentBytes: u32,
+    ),
+>;
+pub type QUIC_CONGESTION_CONTROL_ON_ACK_FN = ::std::option::Option<
+    unsafe extern "C" fn(
+        Instance: *mut ::std::os::raw::c_void,
+        State: *const QUIC_CONGESTION_CONTROL_STATE,
+        Ack: *const QUIC_CONGESTION_CONTROL_ACK,
+    ),
+>;
+pub type QUIC_CONGESTION_CONTROL_ON_LOSS_FN = ::std::option::Option<
+    unsafe extern "C" fn(
+        Instance: *mut ::std::os::raw::c_void,
+        State: *const QUIC_CONGESTION_CONTROL_STATE,
+        Loss: *const QUIC_CONGESTION_CONTROL_LOSS,
+    ),
+>;
+pub type QUIC_CONGESTION_CONTROL_ON_ECN_FN = ::std::option::Option<
+    unsafe extern "C" fn(
+        Instance: *mut ::std::os::raw::c_void,
+        State: *const QUIC_CONGESTION_CONTROL_STATE,
+        Ecn: *const QUIC_CONGESTION_CONTROL_ECN,
+    ),
+>;
+pub type QUIC_CONGESTION_CONTROL_ON_SPURIOUS_FN = ::std::option::Option<
+    unsafe extern "C" fn(
+        Instance: *mut ::std::os::raw::c_void,
+        State: *const QUIC_CONGESTION_CONTROL_STATE,
+    ),
+>;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct QUIC_CONGESTION_CONTROL_PROVIDER {
+    pub Name: *const ::std::os::raw::c_char,
+    pub Context: *mut ::std::os::raw::c_void,
+    pub UseEct1: BOOLEAN,
+    pub Create: QUIC_CONGESTION_CONTROL_CREATE_FN,
+    pub Delete: QUIC_CONGESTION_CONTROL_DELETE_FN,
+    pub GetCongestionWindow: QUIC_CONGESTION_CONTROL_GET_WINDOW_FN,
+    pub OnDataAcknowledged: QUIC_CONGESTION_CONTROL_ON_ACK_FN,
+    pub OnDataLost: QUIC_CONGESTION_CONTROL_ON_LOSS_FN,
+    pub Reset: QUIC_CONGESTION_CONTROL_RESET_FN,
+    pub GetSendAllowance: QUIC_CONGESTION_CONTROL_GET_SEND_ALLOWANCE_FN,
+    pub OnDataSent: QUIC_CONGESTION_CONTROL_ON_DATA_SENT_FN,
+    pub OnEcn: QUIC_CONGESTION_CONTROL_ON_ECN_FN,
+    pub OnSpuriousCongestionEvent: QUIC_CONGESTION_CONTROL_ON_SPURIOUS_FN,
+}
+#[allow(clippy::unnecessary_operation, clippy::identity_op)]
+const _: () = {
+    ["Size of QUIC_CONGESTION_CONTROL_PROVIDER"]
+        [::std::mem::size_of::<QUIC_CONGESTION_CONTROL_PROVIDER>() - 104usize];
+    ["Alignment of QUIC_CONGESTION_CONTROL_PROVIDER"]
+        [::std::mem::align_of::<QUIC_CONGESTION_CONTROL_PROVIDER>() - 8usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::Name"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_PROVIDER, Name) - 0usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::Context"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_PROVIDER, Context) - 8usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::UseEct1"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_PROVIDER, UseEct1) - 16usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::Create"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_PROVIDER, Create) - 24usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::Delete"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_PROVIDER, Delete) - 32usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::GetCongestionWindow"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_PROVIDER, GetCongestionWindow) - 40usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::OnDataAcknowledged"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_PROVIDER, OnDataAcknowledged) - 48usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::OnDataLost"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_PROVIDER, OnDataLost) - 56usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::Reset"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_PROVIDER, Reset) - 64usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::GetSendAllowance"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_PROVIDER, GetSendAllowance) - 72usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::OnDataSent"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_PROVIDER, OnDataSent) - 80usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::OnEcn"]
+        [::std::mem::offset_of!(QUIC_CONGESTION_CONTROL_PROVIDER, OnEcn) - 88usize];
+    ["Offset of field: QUIC_CONGESTION_CONTROL_PROVIDER::OnSpuriousCongestionEvent"][::std::mem::offset_of!(
+        QUIC_CONGESTION_CONTROL_PROVIDER,
+        OnSpuriousCongestionEvent
+    ) - 96usize];
+};
 pub type QUIC_SET_CONTEXT_FN = ::std::option::Option<
     unsafe extern "C" fn(Handle: HQUIC, Context: *mut ::std::os::raw::c_void),
 >;
@@ -5349,6 +6457,10 @@ pub const QUIC_CONNECTION_EVENT_TYPE_QUIC_CONNECTION_EVENT_ONE_WAY_DELAY_NEGOTIA
     QUIC_CONNECTION_EVENT_TYPE = 17;
 pub const QUIC_CONNECTION_EVENT_TYPE_QUIC_CONNECTION_EVENT_NETWORK_STATISTICS:
     QUIC_CONNECTION_EVENT_TYPE = 18;
+pub const QUIC_CONNECTION_EVENT_TYPE_QUIC_CONNECTION_EVENT_SEND_BUFFER_PRESSURE:
+    QUIC_CONNECTION_EVENT_TYPE = 19;
+pub const QUIC_CONNECTION_EVENT_TYPE_QUIC_CONNECTION_EVENT_DATAGRAMS_RECEIVED:
+    QUIC_CONNECTION_EVENT_TYPE = 20;
 pub type QUIC_CONNECTION_EVENT_TYPE = ::std::os::raw::c_int;
 #[repr(C)]
 #[derive(Copy, Clone)]
@@ -5378,6 +6490,8 @@ pub union QUIC_CONNECTION_EVENT__bindgen_ty_1 {
     pub RELIABLE_RESET_NEGOTIATED: QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_17,
     pub ONE_WAY_DELAY_NEGOTIATED: QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_18,
     pub NETWORK_STATISTICS: QUIC_NETWORK_STATISTICS,
+    pub SEND_BUFFER_PRESSURE: QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_19,
+    pub DATAGRAMS_RECEIVED: QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_20,
 }
 #[repr(C)]
 #[derive(Debug, Copy, Clone)]
@@ -5881,6 +6995,55 @@ const _: () = {
     )
         - 1usize];
 };
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_19 {
+    pub Paused: BOOLEAN,
+    pub BufferLimit: u64,
+}
+#[allow(clippy::unnecessary_operation, clippy::identity_op)]
+const _: () = {
+    ["Size of QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_19"]
+        [::std::mem::size_of::<QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_19>() - 16usize];
+    ["Alignment of QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_19"]
+        [::std::mem::align_of::<QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_19>() - 8usize];
+    ["Offset of field: QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_19::Paused"][::std::mem::offset_of!(
+        QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_19,
+        Paused
+    ) - 0usize];
+    ["Offset of field: QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_19::BufferLimit"][::std::mem::offset_of!(
+        QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_19,
+        BufferLimit
+    )
+        - 8usize];
+};
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_20 {
+    pub Buffers: *const QUIC_BUFFER,
+    pub BufferCount: u32,
+    pub Flags: QUIC_RECEIVE_FLAGS,
+}
+#[allow(clippy::unnecessary_operation, clippy::identity_op)]
+const _: () = {
+    ["Size of QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_20"]
+        [::std::mem::size_of::<QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_20>() - 16usize];
+    ["Alignment of QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_20"]
+        [::std::mem::align_of::<QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_20>() - 8usize];
+    ["Offset of field: QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_20::Buffers"][::std::mem::offset_of!(
+        QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_20,
+        Buffers
+    ) - 0usize];
+    ["Offset of field: QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_20::BufferCount"][::std::mem::offset_of!(
+        QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_20,
+        BufferCount
+    )
+        - 8usize];
+    ["Offset of field: QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_20::Flags"][::std::mem::offset_of!(
+        QUIC_CONNECTION_EVENT__bindgen_ty_1__bindgen_ty_20,
+        Flags
+    ) - 12usize];
+};
 #[allow(clippy::unnecessary_operation, clippy::identity_op)]
 const _: () = {
     ["Size of QUIC_CONNECTION_EVENT__bindgen_ty_1"]
@@ -5951,6 +7114,12 @@ const _: () = {
     ) - 0usize];
     ["Offset of field: QUIC_CONNECTION_EVENT__bindgen_ty_1::NETWORK_STATISTICS"]
         [::std::mem::offset_of!(QUIC_CONNECTION_EVENT__bindgen_ty_1, NETWORK_STATISTICS) - 0usize];
+    ["Offset of field: QUIC_CONNECTION_EVENT__bindgen_ty_1::SEND_BUFFER_PRESSURE"][::std::mem::offset_of!(
+        QUIC_CONNECTION_EVENT__bindgen_ty_1,
+        SEND_BUFFER_PRESSURE
+    ) - 0usize];
+    ["Offset of field: QUIC_CONNECTION_EVENT__bindgen_ty_1::DATAGRAMS_RECEIVED"]
+        [::std::mem::offset_of!(QUIC_CONNECTION_EVENT__bindgen_ty_1, DATAGRAMS_RECEIVED) - 0usize];
 };
 #[allow(clippy::unnecessary_operation, clippy::identity_op)]
 const _: () = {
@@ -6578,6 +7747,41 @@ pub type QUIC_DATAGRAM_SEND_FN = ::std::option::Option<
         ClientSendContext: *mut ::std::os::raw::c_void,
     ) -> HRESULT,
 >;
+#[repr(C)]
+#[derive(Debug, Copy, Clone)]
+pub struct QUIC_DATAGRAM_SEND_INFO {
+    pub Buffers: *const QUIC_BUFFER,
+    pub BufferCount: u32,
+    pub Flags: QUIC_SEND_FLAGS,
+    pub PriorityClass: u8,
+    pub LifetimeMs: u32,
+    pub ClientSendContext: *mut ::std::os::raw::c_void,
+}
+#[allow(clippy::unnecessary_operation, clippy::identity_op)]
+const _: () = {
+    ["Size of QUIC_DATAGRAM_SEND_INFO"][::std::mem::size_of::<QUIC_DATAGRAM_SEND_INFO>() - 32usize];
+    ["Alignment of QUIC_DATAGRAM_SEND_INFO"]
+        [::std::mem::align_of::<QUIC_DATAGRAM_SEND_INFO>() - 8usize];
+    ["Offset of field: QUIC_DATAGRAM_SEND_INFO::Buffers"]
+        [::std::mem::offset_of!(QUIC_DATAGRAM_SEND_INFO, Buffers) - 0usize];
+    ["Offset of field: QUIC_DATAGRAM_SEND_INFO::BufferCount"]
+        [::std::mem::offset_of!(QUIC_DATAGRAM_SEND_INFO, BufferCount) - 8usize];
+    ["Offset of field: QUIC_DATAGRAM_SEND_INFO::Flags"]
+        [::std::mem::offset_of!(QUIC_DATAGRAM_SEND_INFO, Flags) - 12usize];
+    ["Offset of field: QUIC_DATAGRAM_SEND_INFO::PriorityClass"]
+        [::std::mem::offset_of!(QUIC_DATAGRAM_SEND_INFO, PriorityClass) - 16usize];
+    ["Offset of field: QUIC_DATAGRAM_SEND_INFO::LifetimeMs"]
+        [::std::mem::offset_of!(QUIC_DATAGRAM_SEND_INFO, LifetimeMs) - 20usize];
+    ["Offset of field: QUIC_DATAGRAM_SEND_INFO::ClientSendContext"]
+        [::std::mem::offset_of!(QUIC_DATAGRAM_SEND_INFO, ClientSendContext) - 24usize];
+};
+pub type QUIC_DATAGRAM_SEND_BATCH_FN = ::std::option::Option<
+    unsafe extern "C" fn(
+        Connection: HQUIC,
+        Datagrams: *const QUIC_DATAGRAM_SEND_INFO,
+        DatagramCount: u32,
+    ) -> HRESULT,
+>;
 pub const QUIC_CONNECTION_POOL_FLAGS_QUIC_CONNECTION_POOL_FLAG_NONE: QUIC_CONNECTION_POOL_FLAGS = 0;
 pub const QUIC_CONNECTION_POOL_FLAGS_QUIC_CONNECTION_POOL_FLAG_CLOSE_ON_FAILURE:
     QUIC_CONNECTION_POOL_FLAGS = 1;
@@ -6675,10 +7879,11 @@ pub struct QUIC_API_TABLE {
     pub ExecutionDelete: QUIC_EXECUTION_DELETE_FN,
     pub ExecutionPoll: QUIC_EXECUTION_POLL_FN,
     pub RegistrationClose2: QUIC_REGISTRATION_CLOSE2_FN,
+    pub DatagramSendBatch: QUIC_DATAGRAM_SEND_BATCH_FN,
 }
 #[allow(clippy::unnecessary_operation, clippy::identity_op)]
 const _: () = {
-    ["Size of QUIC_API_TABLE"][::std::mem::size_of::<QUIC_API_TABLE>() - 304usize];
+    ["Size of QUIC_API_TABLE"][::std::mem::size_of::<QUIC_API_TABLE>() - 312usize];
     ["Alignment of QUIC_API_TABLE"][::std::mem::align_of::<QUIC_API_TABLE>() - 8usize];
     ["Offset of field: QUIC_API_TABLE::SetContext"]
         [::std::mem::offset_of!(QUIC_API_TABLE, SetContext) - 0usize];
@@ -6760,6 +7965,8 @@ const _: () = {
         [::std::mem::offset_of!(QUIC_API_TABLE, ExecutionPoll) - 288usize];
     ["Offset of field: QUIC_API_TABLE::RegistrationClose2"]
         [::std::mem::offset_of!(QUIC_API_TABLE, RegistrationClose2) - 296usize];
+    ["Offset of field: QUIC_API_TABLE::DatagramSendBatch"]
+        [::std::mem::offset_of!(QUIC_API_TABLE, DatagramSendBatch) - 304usize];
 };
 pub const QUIC_STATUS_SUCCESS: QUIC_STATUS = 0;
 pub const QUIC_STATUS_PENDING: QUIC_STATUS = 459749;
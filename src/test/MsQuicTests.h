@@ -135,6 +135,8 @@ QuicTestMtuDiscovery(
     _In_ BOOLEAN DropServerProbePackets,
     _In_ BOOLEAN RaiseMinimumMtu
     );
+void QuicTestMtuDiscoveryCache();
+void QuicTestMtuBlackHole();
 
 //
 // Path tests
@@ -368,6 +370,27 @@ QuicTestClientBlockedSourcePort(
     const FamilyArgs& Params
     );
 
+void
+QuicTestTlsOffloadHandshake(
+    const FamilyArgs& Params
+    );
+
+void
+QuicTestSessionCacheResumption(
+    const FamilyArgs& Params
+    );
+
+void
+QuicTestHandshakeNoAmplificationStall(
+    const FamilyArgs& Params,
+    const QUIC_CREDENTIAL_CONFIG* ServerCredConfig
+    );
+
+void
+QuicTestHandshakeKeySharePool(
+    const FamilyArgs& Params
+    );
+
 #ifdef QUIC_API_ENABLE_PREVIEW_FEATURES
 void
 QuicTestVNTPOddSize(
@@ -594,6 +617,15 @@ QuicTestAckSendDelay(
     const FamilyArgs& Params
     );
 
+void
+QuicTestSendBufferPressure(
+    const bool& SendBuffering
+    );
+
+void
+QuicTestAdaptiveAckFrequency(
+    );
+
 typedef enum QUIC_ABORT_RECEIVE_TYPE {
     QUIC_ABORT_RECEIVE_PAUSED,
     QUIC_ABORT_RECEIVE_PENDING,
@@ -758,6 +790,21 @@ QuicTestDatagramDrop(
     const FamilyArgs& Params
     );
 
+void
+QuicTestDatagramExpire(
+    const FamilyArgs& Params
+    );
+
+void
+QuicTestDatagramFec(
+    const FamilyArgs& Params
+    );
+
+void
+QuicTestDatagramReceiveBatch(
+    const FamilyArgs& Params
+    );
+
 //
 // Storage tests
 //
@@ -13,6 +13,7 @@
 #include <MsQuicTests.h>
 
 #include <array>
+#include <fstream>
 
 #ifdef QUIC_TEST_DATAPATH_HOOKS_ENABLED
 #pragma message("Test compiled with datapath hooks enabled")
@@ -710,6 +711,24 @@ TEST_P(WithMtuArgs, MtuDiscovery) {
     }
 }
 
+TEST(Mtu, DiscoveryCache) {
+    TestLogger Logger("QuicTestMtuDiscoveryCache");
+    if (TestingKernelMode) {
+        ASSERT_TRUE(InvokeKernelTest(FUNC(QuicTestMtuDiscoveryCache)));
+    } else {
+        QuicTestMtuDiscoveryCache();
+    }
+}
+
+TEST(Mtu, BlackHole) {
+    TestLogger Logger("QuicTestMtuBlackHole");
+    if (TestingKernelMode) {
+        ASSERT_TRUE(InvokeKernelTest(FUNC(QuicTestMtuBlackHole)));
+    } else {
+        QuicTestMtuBlackHole();
+    }
+}
+
 #endif // QUIC_TEST_DATAPATH_HOOKS_ENABLED
 
 TEST(Alpn, ValidAlpnLengths) {
@@ -1638,6 +1657,71 @@ TEST_P(WithFamilyArgs, ClientBlockedSourcePort) {
     }
 }
 
+TEST_P(WithFamilyArgs, TlsOffloadHandshake) {
+    TestLoggerT<ParamType> Logger("QuicTestTlsOffloadHandshake", GetParam());
+    if (TestingKernelMode) {
+        ASSERT_TRUE(InvokeKernelTest(FUNC(QuicTestTlsOffloadHandshake), GetParam()));
+    } else {
+        QuicTestTlsOffloadHandshake(GetParam());
+    }
+}
+
+TEST_P(WithFamilyArgs, SessionCacheResumption) {
+    TestLoggerT<ParamType> Logger("QuicTestSessionCacheResumption", GetParam());
+    if (TestingKernelMode) {
+        ASSERT_TRUE(InvokeKernelTest(FUNC(QuicTestSessionCacheResumption), GetParam()));
+    } else {
+        QuicTestSessionCacheResumption(GetParam());
+    }
+}
+
+TEST_P(WithFamilyArgs, HandshakeNoAmplificationStall) {
+    TestLoggerT<ParamType> Logger("QuicTestHandshakeNoAmplificationStall", GetParam());
+    if (TestingKernelMode) {
+        GTEST_SKIP_("Schannel doesn't support certificate compression");
+    }
+    if (ServerSelfSignedCredConfig.Type != QUIC_CREDENTIAL_TYPE_CERTIFICATE_FILE) {
+        GTEST_SKIP_("Certificate compression is only supported with OpenSSL");
+    }
+
+    //
+    // Repeat the test certificate as its own chain. Uncompressed, the chain is
+    // several times the server's anti-amplification limit.
+    //
+    const uint32_t ChainLength = 8;
+    const QUIC_CERTIFICATE_FILE* CertFile = ServerSelfSignedCredConfig.CertificateFile;
+    std::ifstream CertStream(CertFile->CertificateFile);
+    ASSERT_TRUE(CertStream.is_open());
+    std::string CertPem(
+        (std::istreambuf_iterator<char>(CertStream)),
+        std::istreambuf_iterator<char>());
+    std::string ChainFileName = std::string(CertFile->CertificateFile) + ".chain.pem";
+    {
+        std::ofstream ChainStream(ChainFileName, std::ios::trunc);
+        ASSERT_TRUE(ChainStream.is_open());
+        for (uint32_t i = 0; i < ChainLength; ++i) {
+            ChainStream << CertPem;
+        }
+    }
+
+    QUIC_CERTIFICATE_FILE ChainFile = *CertFile;
+    ChainFile.CertificateFile = ChainFileName.c_str();
+    QUIC_CREDENTIAL_CONFIG CredConfig = ServerSelfSignedCredConfig;
+    CredConfig.CertificateFile = &ChainFile;
+    QuicTestHandshakeNoAmplificationStall(GetParam(), &CredConfig);
+
+    remove(ChainFileName.c_str());
+}
+
+TEST_P(WithFamilyArgs, HandshakeKeySharePool) {
+    TestLoggerT<ParamType> Logger("QuicTestHandshakeKeySharePool", GetParam());
+    if (TestingKernelMode) {
+        ASSERT_TRUE(InvokeKernelTest(FUNC(QuicTestHandshakeKeySharePool), GetParam()));
+    } else {
+        QuicTestHandshakeKeySharePool(GetParam());
+    }
+}
+
 #if QUIC_TEST_DATAPATH_HOOKS_ENABLED
 TEST_P(WithFamilyArgs, RebindPort) {
 #if defined(QUIC_API_ENABLE_PREVIEW_FEATURES)
@@ -2288,6 +2372,24 @@ TEST_P(WithFamilyArgs, AckSendDelay) {
     }
 }
 
+TEST_P(WithBool, SendBufferPressure) {
+    TestLoggerT<ParamType> Logger("QuicTestSendBufferPressure", GetParam());
+    if (TestingKernelMode) {
+        ASSERT_TRUE(InvokeKernelTest(FUNC(QuicTestSendBufferPressure), GetParam()));
+    } else {
+        QuicTestSendBufferPressure(GetParam());
+    }
+}
+
+TEST(Misc, AdaptiveAckFrequency) {
+    TestLogger Logger("QuicTestAdaptiveAckFrequency");
+    if (TestingKernelMode) {
+        ASSERT_TRUE(InvokeKernelTest(FUNC(QuicTestAdaptiveAckFrequency)));
+    } else {
+        QuicTestAdaptiveAckFrequency();
+    }
+}
+
 TEST(Misc, AbortPausedReceive) {
     TestLogger Logger("AbortPausedReceive");
     if (TestingKernelMode) {
@@ -2630,6 +2732,33 @@ TEST_P(WithFamilyArgs, DatagramDrop) {
     }
 }
 
+TEST_P(WithFamilyArgs, DatagramExpire) {
+    TestLoggerT<ParamType> Logger("QuicTestDatagramExpire", GetParam());
+    if (TestingKernelMode) {
+        ASSERT_TRUE(InvokeKernelTest(FUNC(QuicTestDatagramExpire), GetParam()));
+    } else {
+        QuicTestDatagramExpire(GetParam());
+    }
+}
+
+TEST_P(WithFamilyArgs, DatagramFec) {
+    TestLoggerT<ParamType> Logger("QuicTestDatagramFec", GetParam());
+    if (TestingKernelMode) {
+        ASSERT_TRUE(InvokeKernelTest(FUNC(QuicTestDatagramFec), GetParam()));
+    } else {
+        QuicTestDatagramFec(GetParam());
+    }
+}
+
+TEST_P(WithFamilyArgs, DatagramReceiveBatch) {
+    TestLoggerT<ParamType> Logger("QuicTestDatagramReceiveBatch", GetParam());
+    if (TestingKernelMode) {
+        ASSERT_TRUE(InvokeKernelTest(FUNC(QuicTestDatagramReceiveBatch), GetParam()));
+    } else {
+        QuicTestDatagramReceiveBatch(GetParam());
+    }
+}
+
 #ifdef _WIN32 // Storage tests only supported on Windows
 
 static BOOLEAN CanRunStorageTests = FALSE;
@@ -648,6 +648,8 @@ ExecuteTestRequest(
 
     // Register any test functions here
     RegisterTestFunction(QuicTestAckSendDelay);
+    RegisterTestFunction(QuicTestSendBufferPressure);
+    RegisterTestFunction(QuicTestAdaptiveAckFrequency);
     RegisterTestFunction(QuicTestValidateApi);
     RegisterTestFunction(QuicTestValidateRegistration);
     RegisterTestFunction(QuicTestGlobalParam);
@@ -691,6 +693,8 @@ ExecuteTestRequest(
     RegisterTestFunction(QuicTestBindConnectionExplicit);
     RegisterTestFunction(QuicTestAddrFunctions);
     RegisterTestFunction(QuicTestMtuSettings);
+    RegisterTestFunction(QuicTestMtuDiscoveryCache);
+    RegisterTestFunction(QuicTestMtuBlackHole);
     RegisterTestFunction(QuicTestValidAlpnLengths);
     RegisterTestFunction(QuicTestInvalidAlpnLengths);
     RegisterTestFunction(QuicTestChangeAlpn);
@@ -712,6 +716,9 @@ ExecuteTestRequest(
     RegisterTestFunction(QuicTestConnectBadSni);
     RegisterTestFunction(QuicTestConnectServerRejected);
     RegisterTestFunction(QuicTestClientBlockedSourcePort);
+    RegisterTestFunction(QuicTestTlsOffloadHandshake);
+    RegisterTestFunction(QuicTestSessionCacheResumption);
+    RegisterTestFunction(QuicTestHandshakeKeySharePool);
     RegisterTestFunction(QuicTestConnectAndIdleForDestCidChange);
     RegisterTestFunction(QuicTestConnectAndIdle);
     RegisterTestFunction(QuicTestServerDisconnect);
@@ -751,6 +758,9 @@ ExecuteTestRequest(
 #endif
     RegisterTestFunction(QuicTestDatagramSend);
     RegisterTestFunction(QuicTestDatagramDrop);
+    RegisterTestFunction(QuicTestDatagramExpire);
+    RegisterTestFunction(QuicTestDatagramFec);
+    RegisterTestFunction(QuicTestDatagramReceiveBatch);
 #if QUIC_TEST_DATAPATH_HOOKS_ENABLED
     RegisterTestFunction(QuicTestPathValidationTimeout);
 #endif
@@ -941,6 +941,32 @@ void QuicTestValidateConnection()
                 0,
                 QUIC_SEND_FLAG_NONE,
                 nullptr));
+
+        QUIC_DATAGRAM_SEND_INFO Datagrams[2] = {
+            { &DatagramBuffer, 1, QUIC_SEND_FLAG_NONE, 0, 0, nullptr },
+            { &DatagramBuffer, 1, QUIC_SEND_FLAG_NONE, QUIC_DATAGRAM_PRIORITY_CLASS_MAX + 1, 0, nullptr }
+        };
+
+        TEST_QUIC_STATUS(
+            QUIC_STATUS_INVALID_PARAMETER,
+            MsQuic->DatagramSendBatch(
+                Connection.Handle,
+                nullptr,
+                1));
+
+        TEST_QUIC_STATUS(
+            QUIC_STATUS_INVALID_PARAMETER,
+            MsQuic->DatagramSendBatch(
+                Connection.Handle,
+                Datagrams,
+                0));
+
+        TEST_QUIC_STATUS(
+            QUIC_STATUS_INVALID_PARAMETER,
+            MsQuic->DatagramSendBatch(
+                Connection.Handle,
+                Datagrams,
+                2));
     }
 
     //
@@ -966,6 +992,17 @@ void QuicTestValidateConnection()
                 1,
                 QUIC_SEND_FLAG_NONE,
                 nullptr));
+
+        QUIC_DATAGRAM_SEND_INFO Datagrams[2] = {
+            { &DatagramBuffer, 1, QUIC_SEND_FLAG_NONE, QUIC_DATAGRAM_PRIORITY_CLASS_MAX, 0, nullptr },
+            { &DatagramBuffer, 1, QUIC_SEND_FLAG_NONE, 0, 100, nullptr }
+        };
+
+        TEST_QUIC_SUCCEEDED(
+            MsQuic->DatagramSendBatch(
+                Connection.Handle,
+                Datagrams,
+                2));
     }
 
     //
@@ -2720,6 +2757,132 @@ void QuicTestGlobalParam()
         }
     }
 
+#ifdef QUIC_API_ENABLE_PREVIEW_FEATURES
+    //
+    // QUIC_PARAM_GLOBAL_SEND_BUFFER_BUDGET
+    //
+    {
+        TestScopeLogger LogScope0("QUIC_PARAM_GLOBAL_SEND_BUFFER_BUDGET");
+        GlobalSettingScope ParamScope(QUIC_PARAM_GLOBAL_SEND_BUFFER_BUDGET);
+        {
+            TestScopeLogger LogScope1("SetParam with invalid length");
+            uint32_t Budget = 0;
+            TEST_QUIC_STATUS(
+                QUIC_STATUS_INVALID_PARAMETER,
+                MsQuic->SetParam(
+                    nullptr,
+                    QUIC_PARAM_GLOBAL_SEND_BUFFER_BUDGET,
+                    sizeof(Budget),
+                    &Budget));
+        }
+
+        uint64_t Budget = 64 * 1024 * 1024;
+        {
+            TestScopeLogger LogScope1("SetParam");
+            TEST_QUIC_SUCCEEDED(
+                MsQuic->SetParam(
+                    nullptr,
+                    QUIC_PARAM_GLOBAL_SEND_BUFFER_BUDGET,
+                    sizeof(Budget),
+                    &Budget));
+        }
+
+        {
+            TestScopeLogger LogScope1("GetParam");
+            SimpleGetParamTest(nullptr, QUIC_PARAM_GLOBAL_SEND_BUFFER_BUDGET, sizeof(Budget), &Budget);
+        }
+    }
+
+    //
+    // QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT
+    //
+    {
+        TestScopeLogger LogScope0("QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT");
+        GlobalSettingScope ParamScope(QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT);
+        {
+            TestScopeLogger LogScope1("SetParam with invalid length");
+            uint32_t Percent = 0;
+            TEST_QUIC_STATUS(
+                QUIC_STATUS_INVALID_PARAMETER,
+                MsQuic->SetParam(
+                    nullptr,
+                    QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT,
+                    sizeof(Percent),
+                    &Percent));
+        }
+
+        uint16_t Percent = UINT16_MAX / 4;
+        {
+            TestScopeLogger LogScope1("SetParam");
+            TEST_QUIC_SUCCEEDED(
+                MsQuic->SetParam(
+                    nullptr,
+                    QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT,
+                    sizeof(Percent),
+                    &Percent));
+        }
+
+        {
+            TestScopeLogger LogScope1("GetParam");
+            SimpleGetParamTest(nullptr, QUIC_PARAM_GLOBAL_RECV_MEMORY_PERCENT, sizeof(Percent), &Percent);
+        }
+    }
+
+    //
+    // QUIC_PARAM_GLOBAL_CONGESTION_CONTROL_PROVIDER
+    //
+    {
+        TestScopeLogger LogScope0("QUIC_PARAM_GLOBAL_CONGESTION_CONTROL_PROVIDER");
+        QUIC_CONGESTION_CONTROL_PROVIDER Provider;
+        CxPlatZeroMemory(&Provider, sizeof(Provider));
+        {
+            TestScopeLogger LogScope1("SetParam with missing callbacks");
+            TEST_QUIC_STATUS(
+                QUIC_STATUS_INVALID_PARAMETER,
+                MsQuic->SetParam(
+                    nullptr,
+                    QUIC_PARAM_GLOBAL_CONGESTION_CONTROL_PROVIDER,
+                    sizeof(Provider),
+                    &Provider));
+        }
+
+        Provider.Create =
+            [](void*, const QUIC_CONGESTION_CONTROL_STATE*, void** Instance) -> QUIC_STATUS {
+                *Instance = nullptr;
+                return QUIC_STATUS_NOT_SUPPORTED;
+            };
+        Provider.Delete = [](void*) {};
+        Provider.GetCongestionWindow =
+            [](void*, const QUIC_CONGESTION_CONTROL_STATE*) -> uint32_t { return 0; };
+        Provider.OnDataAcknowledged =
+            [](void*, const QUIC_CONGESTION_CONTROL_STATE*, const QUIC_CONGESTION_CONTROL_ACK*) {};
+        Provider.OnDataLost =
+            [](void*, const QUIC_CONGESTION_CONTROL_STATE*, const QUIC_CONGESTION_CONTROL_LOSS*) {};
+        {
+            TestScopeLogger LogScope1("SetParam with invalid length");
+            TEST_QUIC_STATUS(
+                QUIC_STATUS_INVALID_PARAMETER,
+                MsQuic->SetParam(
+                    nullptr,
+                    QUIC_PARAM_GLOBAL_CONGESTION_CONTROL_PROVIDER,
+                    sizeof(Provider) - 1,
+                    &Provider));
+        }
+
+        {
+            TestScopeLogger LogScope1("SetParam after library in use");
+            MsQuicRegistration Registration;
+            TEST_QUIC_STATUS(
+                QUIC_STATUS_INVALID_STATE,
+                MsQuic->SetParam(
+                    nullptr,
+                    QUIC_PARAM_GLOBAL_CONGESTION_CONTROL_PROVIDER,
+                    sizeof(Provider),
+                    &Provider));
+        }
+    }
+#endif
+
 #if DEBUG
     //
     // QUIC_PARAM_GLOBAL_PLATFORM_WORKER_POOL
@@ -2896,7 +3059,11 @@ void QuicTestGlobalParam()
             QUIC_STATISTICS_V2_SIZE_1,
             QUIC_STATISTICS_V2_SIZE_2,
             QUIC_STATISTICS_V2_SIZE_3,
-            QUIC_STATISTICS_V2_SIZE_4
+            QUIC_STATISTICS_V2_SIZE_4,
+            QUIC_STATISTICS_V2_SIZE_5,
+            QUIC_STATISTICS_V2_SIZE_6,
+            QUIC_STATISTICS_V2_SIZE_7,
+            QUIC_STATISTICS_V2_SIZE_8
         };
 
         //
@@ -3070,6 +3237,49 @@ void QuicTestRegistrationParam()
 {
     MsQuicRegistration Registration;
     TEST_TRUE(Registration.IsValid());
+
+#ifdef QUIC_API_ENABLE_PREVIEW_FEATURES
+    //
+    // QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET
+    //
+    {
+        TestScopeLogger LogScope0("QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET");
+        {
+            TestScopeLogger LogScope1("SetParam with invalid length");
+            uint32_t Dummy = 0;
+            TEST_QUIC_STATUS(
+                QUIC_STATUS_INVALID_PARAMETER,
+                MsQuic->SetParam(
+                    Registration.Handle,
+                    QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET,
+                    sizeof(Dummy),
+                    &Dummy));
+        }
+
+        uint64_t Budget = 0;
+        {
+            TestScopeLogger LogScope1("Default is unlimited");
+            SimpleGetParamTest(Registration.Handle, QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET, sizeof(Budget), &Budget);
+        }
+
+        Budget = 4 * 1024 * 1024;
+        {
+            TestScopeLogger LogScope1("SetParam");
+            TEST_QUIC_SUCCEEDED(
+                MsQuic->SetParam(
+                    Registration.Handle,
+                    QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET,
+                    sizeof(Budget),
+                    &Budget));
+        }
+
+        {
+            TestScopeLogger LogScope1("GetParam");
+            SimpleGetParamTest(Registration.Handle, QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET, sizeof(Budget), &Budget);
+        }
+    }
+#endif
+
     //
     // No parameter for Registration
     //
@@ -2470,6 +2470,298 @@ QuicTestAckSendDelay(
     MsQuic->ConnectionShutdown(ClientConnection.Handle, QUIC_CONNECTION_SHUTDOWN_FLAG_NONE, 0);
 }
 
+struct SendBufferPressureTestContext {
+    CxPlatEvent ConnectedEvent;
+    CxPlatEvent PausedEvent;
+    CxPlatEvent ResumedEvent;
+    CxPlatEvent SendCompleteEvent;
+    uint64_t PausedLimit {0};
+
+    _IRQL_requires_max_(PASSIVE_LEVEL)
+    _Function_class_(QUIC_STREAM_CALLBACK)
+    static
+    QUIC_STATUS
+    QUIC_API
+    ClientStreamHandler(
+        _In_ HQUIC /* QuicStream */,
+        _In_opt_ void* Context,
+        _Inout_ QUIC_STREAM_EVENT* Event
+        )
+    {
+        auto* TestContext = static_cast<SendBufferPressureTestContext*>(Context);
+        if (Event->Type == QUIC_STREAM_EVENT_SEND_COMPLETE) {
+            CxPlatEventSet(TestContext->SendCompleteEvent.Handle);
+        }
+        return QUIC_STATUS_SUCCESS;
+    }
+
+    _IRQL_requires_max_(PASSIVE_LEVEL)
+    _Function_class_(QUIC_STREAM_CALLBACK)
+    static
+    QUIC_STATUS
+    QUIC_API
+    ServerStreamHandler(
+        _In_ HQUIC /* QuicStream */,
+        _In_opt_ void* /* Context */,
+        _Inout_ QUIC_STREAM_EVENT* /* Event */
+        )
+    {
+        return QUIC_STATUS_SUCCESS;
+    }
+
+    _IRQL_requires_max_(PASSIVE_LEVEL)
+    _Function_class_(QUIC_CONNECTION_CALLBACK)
+    static
+    QUIC_STATUS
+    QUIC_API
+    ClientConnectionHandler(
+        _In_ HQUIC /* QuicConnection */,
+        _In_opt_ void* Context,
+        _Inout_ QUIC_CONNECTION_EVENT* Event
+        )
+    {
+        auto* TestContext = static_cast<SendBufferPressureTestContext*>(Context);
+        switch (Event->Type) {
+        case QUIC_CONNECTION_EVENT_CONNECTED:
+            CxPlatEventSet(TestContext->ConnectedEvent.Handle);
+            break;
+        case QUIC_CONNECTION_EVENT_SEND_BUFFER_PRESSURE:
+            if (Event->SEND_BUFFER_PRESSURE.Paused) {
+                TestContext->PausedLimit = Event->SEND_BUFFER_PRESSURE.BufferLimit;
+                CxPlatEventSet(TestContext->PausedEvent.Handle);
+            } else {
+                CxPlatEventSet(TestContext->ResumedEvent.Handle);
+            }
+            break;
+        default:
+            break;
+        }
+        return QUIC_STATUS_SUCCESS;
+    }
+
+    _IRQL_requires_max_(PASSIVE_LEVEL)
+    _Function_class_(QUIC_CONNECTION_CALLBACK)
+    static
+    QUIC_STATUS
+    QUIC_API
+    ServerConnectionHandler(
+        _In_ MsQuicConnection* /* QuicConnection */,
+        _In_opt_ void* Context,
+        _Inout_ QUIC_CONNECTION_EVENT* Event
+        )
+    {
+        if (Event->Type == QUIC_CONNECTION_EVENT_PEER_STREAM_STARTED) {
+            MsQuic->SetCallbackHandler(
+                Event->PEER_STREAM_STARTED.Stream,
+                reinterpret_cast<void*>(ServerStreamHandler),
+                Context);
+        }
+        return QUIC_STATUS_SUCCESS;
+    }
+};
+
+void
+QuicTestSendBufferPressure(
+    const bool& SendBuffering
+    )
+{
+    //
+    // A send larger than the registration's send buffer budget pauses the
+    // app's producers, whether the data is copied into the send buffer or
+    // stays in the app's buffer until it is acknowledged. They're resumed
+    // once the data is acknowledged.
+    //
+    const uint32_t TestTimeout = 3000;
+    const uint64_t Budget = 16 * 1024;
+    const uint32_t SendLength = 64 * 1024;
+
+    MsQuicRegistration Registration;
+    TEST_TRUE(Registration.IsValid());
+    TEST_QUIC_SUCCEEDED(
+        MsQuic->SetParam(
+            Registration.Handle,
+            QUIC_PARAM_REGISTRATION_SEND_BUFFER_BUDGET,
+            sizeof(Budget),
+            &Budget));
+
+    MsQuicAlpn Alpn("MsQuicTest");
+
+    MsQuicSettings Settings{};
+    Settings.SetIdleTimeoutMs(TestTimeout);
+    Settings.SetPeerBidiStreamCount(1);
+    Settings.SetSendBufferingEnabled(SendBuffering);
+
+    SendBufferPressureTestContext TestContext{};
+    MsQuicConfiguration ServerConfiguration(Registration, Alpn, Settings, ServerSelfSignedCredConfig);
+    TEST_TRUE(ServerConfiguration.IsValid());
+
+    MsQuicAutoAcceptListener Listener{
+        Registration,
+        ServerConfiguration,
+        SendBufferPressureTestContext::ServerConnectionHandler,
+        &TestContext};
+    TEST_QUIC_SUCCEEDED(Listener.GetInitStatus());
+    TEST_QUIC_SUCCEEDED(Listener.Start(Alpn));
+
+    QuicAddr ServerLocalAddr;
+    TEST_QUIC_SUCCEEDED(Listener.GetLocalAddr(ServerLocalAddr));
+
+    MsQuicCredentialConfig ClientCredConfig;
+    MsQuicConfiguration ClientConfiguration(Registration, Alpn, Settings, ClientCredConfig);
+    TEST_TRUE(ClientConfiguration.IsValid());
+
+    ConnectionScope ClientConnection;
+    TEST_QUIC_SUCCEEDED(
+        MsQuic->ConnectionOpen(
+            Registration,
+            SendBufferPressureTestContext::ClientConnectionHandler,
+            &TestContext,
+            &ClientConnection.Handle));
+    TEST_QUIC_SUCCEEDED(
+        MsQuic->ConnectionStart(
+            ClientConnection.Handle,
+            ClientConfiguration,
+            QUIC_ADDRESS_FAMILY_INET,
+            QUIC_TEST_LOOPBACK_FOR_AF(QUIC_ADDRESS_FAMILY_INET),
+            ServerLocalAddr.GetPort()));
+
+    if (!CxPlatEventWaitWithTimeout(TestContext.ConnectedEvent.Handle, TestTimeout)) {
+        TEST_FAILURE("The connection did not succeed before timeout!");
+        return;
+    }
+
+    StreamScope ClientStream;
+    TEST_QUIC_SUCCEEDED(
+        MsQuic->StreamOpen(
+            ClientConnection.Handle,
+            QUIC_STREAM_OPEN_FLAG_NONE,
+            SendBufferPressureTestContext::ClientStreamHandler,
+            &TestContext,
+            &ClientStream.Handle));
+
+    QuicSendBuffer SendBuffer(1, SendLength);
+    TEST_QUIC_SUCCEEDED(
+        MsQuic->StreamSend(
+            ClientStream.Handle,
+            SendBuffer.Buffers,
+            SendBuffer.BufferCount,
+            QUIC_SEND_FLAG_START,
+            nullptr));
+
+    if (!CxPlatEventWaitWithTimeout(TestContext.PausedEvent.Handle, TestTimeout)) {
+        TEST_FAILURE("Send buffer pressure was not indicated!");
+        return;
+    }
+    TEST_EQUAL(TestContext.PausedLimit, Budget);
+
+    if (!CxPlatEventWaitWithTimeout(TestContext.SendCompleteEvent.Handle, TestTimeout)) {
+        TEST_FAILURE("Send did not complete before timeout!");
+        return;
+    }
+    if (!CxPlatEventWaitWithTimeout(TestContext.ResumedEvent.Handle, TestTimeout)) {
+        TEST_FAILURE("Send buffer pressure was not released!");
+        return;
+    }
+
+    MsQuic->ConnectionShutdown(ClientConnection.Handle, QUIC_CONNECTION_SHUTDOWN_FLAG_NONE, 0);
+}
+
+struct AckFrequencyTestContext {
+    CxPlatEvent SendShutdownComplete;
+
+    static QUIC_STATUS ClientStreamCallback(_In_ MsQuicStream*, _In_opt_ void* Context, _Inout_ QUIC_STREAM_EVENT* Event) {
+        auto TestContext = (AckFrequencyTestContext*)Context;
+        if (Event->Type == QUIC_STREAM_EVENT_SEND_SHUTDOWN_COMPLETE) {
+            TestContext->SendShutdownComplete.Set();
+        }
+        return QUIC_STATUS_SUCCESS;
+    }
+
+    static QUIC_STATUS ConnCallback(_In_ MsQuicConnection*, _In_opt_ void*, _Inout_ QUIC_CONNECTION_EVENT* Event) {
+        if (Event->Type == QUIC_CONNECTION_EVENT_PEER_STREAM_STARTED) {
+            new(std::nothrow) MsQuicStream(Event->PEER_STREAM_STARTED.Stream, CleanUpAutoDelete);
+        }
+        return QUIC_STATUS_SUCCESS;
+    }
+};
+
+//
+// Uploads on a new connection and counts the ACK frames the client received
+// for it.
+//
+static
+void
+QuicTestAckFrequencyUpload(
+    _In_ MsQuicRegistration& Registration,
+    _In_ bool AdaptiveAckFrequency,
+    _Out_ uint64_t* AckFrames
+    )
+{
+    *AckFrames = 0;
+    const uint32_t UploadLength = 16 * 1024 * 1024;
+
+    MsQuicConfiguration ServerConfiguration(Registration, "MsQuicTest", MsQuicSettings().SetPeerUnidiStreamCount(1), ServerSelfSignedCredConfig);
+    TEST_QUIC_SUCCEEDED(ServerConfiguration.GetInitStatus());
+
+    MsQuicConfiguration ClientConfiguration(Registration, "MsQuicTest", MsQuicSettings().SetAdaptiveAckFrequencyEnabled(AdaptiveAckFrequency), MsQuicCredentialConfig());
+    TEST_QUIC_SUCCEEDED(ClientConfiguration.GetInitStatus());
+
+    AckFrequencyTestContext Context;
+    MsQuicAutoAcceptListener Listener(Registration, ServerConfiguration, AckFrequencyTestContext::ConnCallback, &Context);
+    TEST_QUIC_SUCCEEDED(Listener.GetInitStatus());
+    TEST_QUIC_SUCCEEDED(Listener.Start("MsQuicTest"));
+    QuicAddr ServerLocalAddr;
+    TEST_QUIC_SUCCEEDED(Listener.GetLocalAddr(ServerLocalAddr));
+
+    MsQuicConnection Connection(Registration);
+    TEST_QUIC_SUCCEEDED(Connection.GetInitStatus());
+    TEST_QUIC_SUCCEEDED(Connection.Start(ClientConfiguration, ServerLocalAddr.GetFamily(), QUIC_TEST_LOOPBACK_FOR_AF(ServerLocalAddr.GetFamily()), ServerLocalAddr.GetPort()));
+    TEST_TRUE(Connection.HandshakeCompleteEvent.WaitTimeout(TestWaitTimeout));
+    TEST_TRUE(Connection.HandshakeComplete);
+
+    QUIC_STATISTICS_V2 Stats;
+    TEST_QUIC_SUCCEEDED(Connection.GetStatistics(&Stats));
+    const uint64_t HandshakeAckFrames = Stats.RecvValidAckFrames;
+
+    QuicSendBuffer SendBuffer(1, UploadLength);
+    MsQuicStream Stream(Connection, QUIC_STREAM_OPEN_FLAG_UNIDIRECTIONAL, CleanUpManual, AckFrequencyTestContext::ClientStreamCallback, &Context);
+    TEST_QUIC_SUCCEEDED(Stream.GetInitStatus());
+    TEST_QUIC_SUCCEEDED(Stream.Send(SendBuffer.Buffers, SendBuffer.BufferCount, QUIC_SEND_FLAG_START | QUIC_SEND_FLAG_FIN));
+    TEST_TRUE(Context.SendShutdownComplete.WaitTimeout(EstimateTimeoutMs(UploadLength)));
+
+    TEST_QUIC_SUCCEEDED(Connection.GetStatistics(&Stats));
+    TEST_TRUE(Stats.SendTotalStreamBytes >= UploadLength);
+
+    *AckFrames = Stats.RecvValidAckFrames - HandshakeAckFrames;
+    Connection.Shutdown(0);
+}
+
+void
+QuicTestAdaptiveAckFrequency(
+    )
+{
+    //
+    // With adaptive ACK frequency, the client asks the server to acknowledge
+    // a few times per congestion window instead of every other packet, so
+    // the same upload gets fewer ACKs back.
+    //
+    MsQuicRegistration Registration(true);
+    TEST_QUIC_SUCCEEDED(Registration.GetInitStatus());
+
+    uint64_t DefaultAckFrames, AdaptiveAckFrames;
+    QuicTestAckFrequencyUpload(Registration, false, &DefaultAckFrames);
+    QuicTestAckFrequencyUpload(Registration, true, &AdaptiveAckFrames);
+
+    QuicTraceLogInfo(
+        TestAckFrequencyAckFrames,
+        "[test] ACK frames received: %llu default, %llu adaptive",
+        (unsigned long long)DefaultAckFrames,
+        (unsigned long long)AdaptiveAckFrames);
+
+    TEST_NOT_EQUAL(0u, AdaptiveAckFrames);
+    TEST_TRUE(AdaptiveAckFrames < DefaultAckFrames);
+}
+
 struct AbortRecvTestContext {
     QUIC_ABORT_RECEIVE_TYPE Type;
     CxPlatEvent ServerStreamRecv;
@@ -369,3 +369,422 @@ QuicTestDatagramDrop(
         }
     }
 }
+
+void
+QuicTestDatagramExpire(
+    const FamilyArgs& Params
+    )
+{
+    const int Family = Params.Family;
+    MsQuicRegistration Registration;
+    TEST_TRUE(Registration.IsValid());
+
+    MsQuicAlpn Alpn("MsQuicTest");
+
+    MsQuicSettings Settings;
+    Settings.SetDatagramReceiveEnabled(true);
+
+    MsQuicCredentialConfig ClientCredConfig;
+    MsQuicConfiguration ClientConfiguration(Registration, Alpn, Settings, ClientCredConfig);
+    TEST_TRUE(ClientConfiguration.IsValid());
+
+    MsQuicConfiguration ServerConfiguration(Registration, Alpn, Settings, ServerSelfSignedCredConfig);
+    TEST_TRUE(ServerConfiguration.IsValid());
+
+    uint8_t RawBuffer[1100] = {0};
+    QUIC_BUFFER DatagramBuffer = { sizeof(RawBuffer), RawBuffer };
+
+    {
+        TestListener Listener(Registration, ListenerAcceptConnection, ServerConfiguration);
+        TEST_TRUE(Listener.IsValid());
+
+        QUIC_ADDRESS_FAMILY QuicAddrFamily = (Family == 4) ? QUIC_ADDRESS_FAMILY_INET : QUIC_ADDRESS_FAMILY_INET6;
+        QuicAddr ServerLocalAddr(QuicAddrFamily);
+        TEST_QUIC_SUCCEEDED(Listener.Start(Alpn, &ServerLocalAddr.SockAddr));
+        TEST_QUIC_SUCCEEDED(Listener.GetLocalAddr(ServerLocalAddr));
+
+        {
+            UniquePtr<TestConnection> Server;
+            ServerAcceptContext ServerAcceptCtx((TestConnection**)&Server);
+            Listener.Context = &ServerAcceptCtx;
+
+            {
+                TestConnection Client(Registration);
+                TEST_TRUE(Client.IsValid());
+
+                TEST_TRUE(Client.GetDatagramSendEnabled());
+
+                //
+                // Half of the datagrams expire while waiting for the
+                // handshake; the others have no lifetime limit. Both halves
+                // cover every priority class, and each datagram's send
+                // context is its priority class.
+                //
+                QUIC_DATAGRAM_SEND_INFO Datagrams[20];
+                for (uint32_t i = 0; i < ARRAYSIZE(Datagrams); i++) {
+                    Datagrams[i].Buffers = &DatagramBuffer;
+                    Datagrams[i].BufferCount = 1;
+                    Datagrams[i].Flags = QUIC_SEND_FLAG_NONE;
+                    Datagrams[i].PriorityClass = (uint8_t)((i / 2) % (QUIC_DATAGRAM_PRIORITY_CLASS_MAX + 1));
+                    Datagrams[i].LifetimeMs = (i%2 == 0) ? 10 : 0;
+                    Datagrams[i].ClientSendContext = (void*)(size_t)Datagrams[i].PriorityClass;
+                }
+                TEST_QUIC_SUCCEEDED(
+                    MsQuic->DatagramSendBatch(
+                        Client.GetConnection(),
+                        Datagrams,
+                        ARRAYSIZE(Datagrams)));
+
+                CxPlatSleep(100);
+
+                TEST_QUIC_SUCCEEDED(
+                    Client.Start(
+                        ClientConfiguration,
+                        QuicAddrFamily,
+                        QUIC_TEST_LOOPBACK_FOR_AF(QuicAddrFamily),
+                        ServerLocalAddr.GetPort()));
+
+                if (!Client.WaitForConnectionComplete()) {
+                    return;
+                }
+                TEST_TRUE(Client.GetIsConnected());
+
+                TEST_TRUE(Client.GetDatagramSendEnabled());
+
+                TEST_NOT_EQUAL(nullptr, Server);
+                if (!Server->WaitForConnectionComplete()) {
+                    return;
+                }
+                TEST_TRUE(Server->GetIsConnected());
+
+                TEST_TRUE(Server->GetDatagramSendEnabled());
+
+                CxPlatSleep(100);
+
+                uint32_t Tries = 0;
+                while (Client.GetDatagramsSent() + Client.GetDatagramsCanceled() != ARRAYSIZE(Datagrams) && ++Tries < 10) {
+                    CxPlatSleep(100);
+                }
+
+                TEST_EQUAL(10, Client.GetDatagramsCanceled());
+                TEST_EQUAL(10, Client.GetDatagramsSent());
+                TEST_EQUAL(10u, Client.GetStatistics().SendDatagramExpiredCount);
+
+                //
+                // Everything was queued before the handshake, so higher
+                // priority classes are sent before lower ones.
+                //
+                for (uint32_t i = 1; i < Client.GetDatagramsSent(); i++) {
+                    TEST_TRUE(
+                        (size_t)Client.GetSentDatagramContext(i - 1) >=
+                        (size_t)Client.GetSentDatagramContext(i));
+                }
+                TEST_EQUAL(
+                    (size_t)QUIC_DATAGRAM_PRIORITY_CLASS_MAX,
+                    (size_t)Client.GetSentDatagramContext(0));
+
+                Client.Shutdown(QUIC_CONNECTION_SHUTDOWN_FLAG_NONE, QUIC_TEST_NO_ERROR);
+                if (!Client.WaitForShutdownComplete()) {
+                    return;
+                }
+
+                TEST_FALSE(Client.GetPeerClosed());
+                TEST_FALSE(Client.GetTransportClosed());
+            }
+        }
+    }
+}
+
+//
+// Every FEC test datagram starts with its group and index, followed by bytes
+// derived from both, so a wrongly recovered datagram can't go unnoticed.
+//
+static const uint8_t DatagramFecGroupCount = 10;
+static const uint8_t DatagramFecGroupSize = 8;
+static const uint16_t DatagramFecLength = 1000;
+
+static
+uint8_t
+DatagramFecPayloadByte(
+    uint8_t Group,
+    uint8_t Index,
+    uint16_t Offset
+    )
+{
+    return (uint8_t)(Group * DatagramFecGroupSize + Index + Offset);
+}
+
+struct DatagramFecRecvContext {
+    bool Received[DatagramFecGroupCount][DatagramFecGroupSize] {};
+    uint32_t Corrupt {0};
+};
+
+_Function_class_(DATAGRAM_RECEIVED_CALLBACK)
+static
+void
+DatagramFecReceived(
+    _In_ TestConnection* Connection,
+    _In_ const QUIC_BUFFER* Buffer
+    )
+{
+    auto RecvContext = (DatagramFecRecvContext*)Connection->Context;
+    if (Buffer->Length != DatagramFecLength ||
+        Buffer->Buffer[0] >= DatagramFecGroupCount ||
+        Buffer->Buffer[1] >= DatagramFecGroupSize) {
+        RecvContext->Corrupt++;
+        return;
+    }
+    const uint8_t Group = Buffer->Buffer[0];
+    const uint8_t Index = Buffer->Buffer[1];
+    for (uint16_t Offset = 2; Offset < DatagramFecLength; ++Offset) {
+        if (Buffer->Buffer[Offset] != DatagramFecPayloadByte(Group, Index, Offset)) {
+            RecvContext->Corrupt++;
+            return;
+        }
+    }
+    RecvContext->Received[Group][Index] = true;
+}
+
+void
+QuicTestDatagramFec(
+    const FamilyArgs& Params
+    )
+{
+    const int Family = Params.Family;
+    MsQuicRegistration Registration;
+    TEST_TRUE(Registration.IsValid());
+
+    MsQuicAlpn Alpn("MsQuicTest");
+
+    MsQuicSettings Settings;
+    Settings.SetDatagramReceiveEnabled(true).SetDatagramFecEnabled(true);
+
+    MsQuicCredentialConfig ClientCredConfig;
+    MsQuicConfiguration ClientConfiguration(Registration, Alpn, Settings, ClientCredConfig);
+    TEST_TRUE(ClientConfiguration.IsValid());
+
+    MsQuicConfiguration ServerConfiguration(Registration, Alpn, Settings, ServerSelfSignedCredConfig);
+    TEST_TRUE(ServerConfiguration.IsValid());
+
+    uint8_t RawBuffer[DatagramFecLength];
+    QUIC_BUFFER DatagramBuffer = { sizeof(RawBuffer), RawBuffer };
+
+    SelectiveLossHelper LossHelper;
+    DatagramFecRecvContext RecvContext;
+
+    {
+        TestListener Listener(Registration, ListenerAcceptConnection, ServerConfiguration);
+        TEST_TRUE(Listener.IsValid());
+
+        QUIC_ADDRESS_FAMILY QuicAddrFamily = (Family == 4) ? QUIC_ADDRESS_FAMILY_INET : QUIC_ADDRESS_FAMILY_INET6;
+        QuicAddr ServerLocalAddr(QuicAddrFamily);
+        TEST_QUIC_SUCCEEDED(Listener.Start(Alpn, &ServerLocalAddr.SockAddr));
+        TEST_QUIC_SUCCEEDED(Listener.GetLocalAddr(ServerLocalAddr));
+
+        {
+            UniquePtr<TestConnection> Server;
+            ServerAcceptContext ServerAcceptCtx((TestConnection**)&Server);
+            Listener.Context = &ServerAcceptCtx;
+
+            {
+                TestConnection Client(Registration);
+                TEST_TRUE(Client.IsValid());
+
+                TEST_QUIC_SUCCEEDED(
+                    Client.Start(
+                        ClientConfiguration,
+                        QuicAddrFamily,
+                        QUIC_TEST_LOOPBACK_FOR_AF(QuicAddrFamily),
+                        ServerLocalAddr.GetPort()));
+
+                if (!Client.WaitForConnectionComplete()) {
+                    return;
+                }
+                TEST_TRUE(Client.GetIsConnected());
+
+                TEST_NOT_EQUAL(nullptr, Server);
+                if (!Server->WaitForConnectionComplete()) {
+                    return;
+                }
+                TEST_TRUE(Server->GetIsConnected());
+                Server->Context = &RecvContext;
+                Server->SetDatagramReceivedCallback(DatagramFecReceived);
+
+                TEST_TRUE(Client.GetDatagramSendEnabled());
+
+                CxPlatSleep(100);
+
+                //
+                // Send full groups of datagrams, the last one flushing the
+                // group's repair, and drop one packet per group.
+                //
+                uint32_t DatagramsSent = 0;
+                uint8_t Group;
+                for (Group = 0; Group < DatagramFecGroupCount; ++Group) {
+#if QUIC_TEST_DATAPATH_HOOKS_ENABLED
+                    LossHelper.DropPackets(1);
+#endif
+                    for (uint8_t i = 0; i < DatagramFecGroupSize; ++i) {
+                        RawBuffer[0] = Group;
+                        RawBuffer[1] = i;
+                        for (uint16_t Offset = 2; Offset < DatagramFecLength; ++Offset) {
+                            RawBuffer[Offset] = DatagramFecPayloadByte(Group, i, Offset);
+                        }
+                        TEST_QUIC_SUCCEEDED(
+                            MsQuic->DatagramSend(
+                                Client.GetConnection(),
+                                &DatagramBuffer,
+                                1,
+                                i == DatagramFecGroupSize - 1 ?
+                                    QUIC_SEND_FLAG_DGRAM_FEC_FLUSH : QUIC_SEND_FLAG_NONE,
+                                nullptr));
+                        ++DatagramsSent;
+
+                        uint32_t Tries = 0;
+                        while (Client.GetDatagramsSent() != DatagramsSent && ++Tries < 10) {
+                            CxPlatSleep(10);
+                        }
+                    }
+
+                    CxPlatSleep(100);
+#if QUIC_TEST_DATAPATH_HOOKS_ENABLED
+                    if (Server->GetStatistics().RecvDatagramFecRecoveredCount != 0) {
+                        break;
+                    }
+#endif
+                }
+
+                QUIC_STATISTICS_V2 ClientStats = Client.GetStatistics();
+                TEST_NOT_EQUAL(0u, ClientStats.SendDatagramFecRepairCount);
+                TEST_EQUAL(0u, RecvContext.Corrupt);
+#if QUIC_TEST_DATAPATH_HOOKS_ENABLED
+                QUIC_STATISTICS_V2 ServerStats = Server->GetStatistics();
+                TEST_NOT_EQUAL(0u, ServerStats.RecvDatagramFecRecoveredCount);
+
+                //
+                // The group that triggered the recovery lost only the dropped
+                // datagram, so with the recovered one it must be complete.
+                //
+                TEST_TRUE(Group < DatagramFecGroupCount);
+                for (uint8_t i = 0; i < DatagramFecGroupSize; ++i) {
+                    TEST_TRUE(RecvContext.Received[Group][i]);
+                }
+#endif
+
+                Client.Shutdown(QUIC_CONNECTION_SHUTDOWN_FLAG_NONE, QUIC_TEST_NO_ERROR);
+                if (!Client.WaitForShutdownComplete()) {
+                    return;
+                }
+
+                TEST_FALSE(Client.GetPeerClosed());
+                TEST_FALSE(Client.GetTransportClosed());
+            }
+        }
+    }
+}
+
+void
+QuicTestDatagramReceiveBatch(
+    const FamilyArgs& Params
+    )
+{
+    const int Family = Params.Family;
+    MsQuicRegistration Registration;
+    TEST_TRUE(Registration.IsValid());
+
+    MsQuicAlpn Alpn("MsQuicTest");
+
+    MsQuicSettings ClientSettings;
+    ClientSettings.SetDatagramReceiveEnabled(true);
+
+    MsQuicSettings ServerSettings;
+    ServerSettings.SetDatagramReceiveEnabled(true).SetDatagramReceiveBatchEnabled(true);
+
+    MsQuicCredentialConfig ClientCredConfig;
+    MsQuicConfiguration ClientConfiguration(Registration, Alpn, ClientSettings, ClientCredConfig);
+    TEST_TRUE(ClientConfiguration.IsValid());
+
+    MsQuicConfiguration ServerConfiguration(Registration, Alpn, ServerSettings, ServerSelfSignedCredConfig);
+    TEST_TRUE(ServerConfiguration.IsValid());
+
+    uint8_t RawBuffer[100] = {0};
+    QUIC_BUFFER DatagramBuffer = { sizeof(RawBuffer), RawBuffer };
+
+    {
+        TestListener Listener(Registration, ListenerAcceptConnection, ServerConfiguration);
+        TEST_TRUE(Listener.IsValid());
+
+        QUIC_ADDRESS_FAMILY QuicAddrFamily = (Family == 4) ? QUIC_ADDRESS_FAMILY_INET : QUIC_ADDRESS_FAMILY_INET6;
+        QuicAddr ServerLocalAddr(QuicAddrFamily);
+        TEST_QUIC_SUCCEEDED(Listener.Start(Alpn, &ServerLocalAddr.SockAddr));
+        TEST_QUIC_SUCCEEDED(Listener.GetLocalAddr(ServerLocalAddr));
+
+        {
+            UniquePtr<TestConnection> Server;
+            ServerAcceptContext ServerAcceptCtx((TestConnection**)&Server);
+            Listener.Context = &ServerAcceptCtx;
+
+            {
+                TestConnection Client(Registration);
+                TEST_TRUE(Client.IsValid());
+
+                TEST_QUIC_SUCCEEDED(
+                    Client.Start(
+                        ClientConfiguration,
+                        QuicAddrFamily,
+                        QUIC_TEST_LOOPBACK_FOR_AF(QuicAddrFamily),
+                        ServerLocalAddr.GetPort()));
+
+                if (!Client.WaitForConnectionComplete()) {
+                    return;
+                }
+                TEST_TRUE(Client.GetIsConnected());
+
+                TEST_NOT_EQUAL(nullptr, Server);
+                if (!Server->WaitForConnectionComplete()) {
+                    return;
+                }
+                TEST_TRUE(Server->GetIsConnected());
+
+                TEST_TRUE(Client.GetDatagramSendEnabled());
+
+                CxPlatSleep(100);
+
+                //
+                // Several small datagrams fit in each packet, so the server
+                // gets fewer receive events than datagrams.
+                //
+                QUIC_DATAGRAM_SEND_INFO Datagrams[40];
+                for (uint32_t i = 0; i < ARRAYSIZE(Datagrams); i++) {
+                    Datagrams[i].Buffers = &DatagramBuffer;
+                    Datagrams[i].BufferCount = 1;
+                    Datagrams[i].Flags = QUIC_SEND_FLAG_NONE;
+                    Datagrams[i].PriorityClass = 0;
+                    Datagrams[i].LifetimeMs = 0;
+                    Datagrams[i].ClientSendContext = nullptr;
+                }
+                TEST_QUIC_SUCCEEDED(
+                    MsQuic->DatagramSendBatch(
+                        Client.GetConnection(),
+                        Datagrams,
+                        ARRAYSIZE(Datagrams)));
+
+                uint32_t Tries = 0;
+                while (Client.GetDatagramsAcknowledged() != ARRAYSIZE(Datagrams) && ++Tries < 20) {
+                    CxPlatSleep(100);
+                }
+                TEST_EQUAL(ARRAYSIZE(Datagrams), Client.GetDatagramsAcknowledged());
+                TEST_EQUAL(ARRAYSIZE(Datagrams), Server->GetDatagramsReceived());
+                TEST_TRUE(Server->GetDatagramReceiveEvents() < Server->GetDatagramsReceived());
+
+                Client.Shutdown(QUIC_CONNECTION_SHUTDOWN_FLAG_NONE, QUIC_TEST_NO_ERROR);
+                if (!Client.WaitForShutdownComplete()) {
+                    return;
+                }
+
+                TEST_FALSE(Client.GetPeerClosed());
+                TEST_FALSE(Client.GetTransportClosed());
+            }
+        }
+    }
+}
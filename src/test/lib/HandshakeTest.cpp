@@ -3793,6 +3793,249 @@ QuicTestClientBlockedSourcePort(
     TEST_TRUE(ListenerStats.BindingRecvDroppedPackets > 0);
 }
 
+void
+QuicTestTlsOffloadHandshake(
+    const FamilyArgs& Params
+    )
+{
+    const uint32_t ConnectionCount = 8;
+    const int Family = Params.Family;
+    MsQuicRegistration Registration(true);
+    TEST_QUIC_SUCCEEDED(Registration.GetInitStatus());
+
+    MsQuicSettings Settings;
+    Settings.SetTlsOffloadEnabled(true);
+    Settings.SetServerResumptionLevel(QUIC_SERVER_RESUME_ONLY);
+
+    MsQuicConfiguration ServerConfiguration(Registration, "MsQuicTest", Settings, ServerSelfSignedCredConfig);
+    TEST_QUIC_SUCCEEDED(ServerConfiguration.GetInitStatus());
+
+    MsQuicConfiguration ClientConfiguration(Registration, "MsQuicTest", Settings, MsQuicCredentialConfig());
+    TEST_QUIC_SUCCEEDED(ClientConfiguration.GetInitStatus());
+
+    const QUIC_ADDRESS_FAMILY QuicAddrFamily = (Family == 4) ? QUIC_ADDRESS_FAMILY_INET : QUIC_ADDRESS_FAMILY_INET6;
+    QuicAddr ServerLocalAddr(QuicAddrFamily);
+
+    MsQuicAutoAcceptListener Listener(Registration, ServerConfiguration, MsQuicConnection::SendResumptionCallback);
+    TEST_QUIC_SUCCEEDED(Listener.Start("MsQuicTest", &ServerLocalAddr.SockAddr));
+    TEST_QUIC_SUCCEEDED(Listener.GetInitStatus());
+    TEST_QUIC_SUCCEEDED(Listener.GetLocalAddr(ServerLocalAddr));
+
+    //
+    // Start all the handshakes at once so that several are in flight on the
+    // crypto pool at the same time.
+    //
+    UniquePtr<MsQuicConnection> Clients[ConnectionCount];
+    for (uint32_t i = 0; i < ConnectionCount; ++i) {
+        Clients[i].reset(new(std::nothrow) MsQuicConnection(Registration));
+        TEST_NOT_EQUAL(nullptr, Clients[i]);
+        TEST_QUIC_SUCCEEDED(Clients[i]->GetInitStatus());
+        TEST_QUIC_SUCCEEDED(Clients[i]->Start(ClientConfiguration, QuicAddrFamily, QUIC_TEST_LOOPBACK_FOR_AF(QuicAddrFamily), ServerLocalAddr.GetPort()));
+    }
+
+    for (uint32_t i = 0; i < ConnectionCount; ++i) {
+        TEST_TRUE(Clients[i]->HandshakeCompleteEvent.WaitTimeout(TestWaitTimeout));
+        TEST_TRUE(Clients[i]->HandshakeComplete);
+    }
+    TEST_EQUAL(ConnectionCount, Listener.AcceptedConnectionCount);
+
+    //
+    // The ticket is indicated to the client, and validated by the server, on
+    // the worker once the offloaded TLS processing completes.
+    //
+    TEST_TRUE(Clients[0]->ResumptionTicketReceivedEvent.WaitTimeout(TestWaitTimeout));
+    MsQuicConnection Client(Registration);
+    TEST_QUIC_SUCCEEDED(Client.GetInitStatus());
+    TEST_QUIC_SUCCEEDED(Client.SetResumptionTicket(Clients[0]->ResumptionTicket, Clients[0]->ResumptionTicketLength));
+    TEST_QUIC_SUCCEEDED(Client.Start(ClientConfiguration, QuicAddrFamily, QUIC_TEST_LOOPBACK_FOR_AF(QuicAddrFamily), ServerLocalAddr.GetPort()));
+    TEST_TRUE(Client.HandshakeCompleteEvent.WaitTimeout(TestWaitTimeout));
+    TEST_TRUE(Client.HandshakeComplete);
+    TEST_TRUE(Client.HandshakeResumed);
+}
+
+void
+QuicTestSessionCacheResumption(
+    const FamilyArgs& Params
+    )
+{
+    const int Family = Params.Family;
+    MsQuicRegistration Registration(true);
+    TEST_QUIC_SUCCEEDED(Registration.GetInitStatus());
+
+    MsQuicSettings ServerSettings;
+    ServerSettings.SetServerResumptionLevel(QUIC_SERVER_RESUME_ONLY);
+    ServerSettings.SetServerSessionCacheEnabled(true);
+
+    MsQuicConfiguration ServerConfiguration(Registration, "MsQuicTest", ServerSettings, ServerSelfSignedCredConfig);
+    TEST_QUIC_SUCCEEDED(ServerConfiguration.GetInitStatus());
+
+    MsQuicConfiguration ClientConfiguration(Registration, "MsQuicTest", MsQuicCredentialConfig());
+    TEST_QUIC_SUCCEEDED(ClientConfiguration.GetInitStatus());
+
+    const QUIC_ADDRESS_FAMILY QuicAddrFamily = (Family == 4) ? QUIC_ADDRESS_FAMILY_INET : QUIC_ADDRESS_FAMILY_INET6;
+    QuicAddr ServerLocalAddr(QuicAddrFamily);
+
+    MsQuicAutoAcceptListener Listener(Registration, ServerConfiguration, MsQuicConnection::SendResumptionCallback);
+    TEST_QUIC_SUCCEEDED(Listener.Start("MsQuicTest", &ServerLocalAddr.SockAddr));
+    TEST_QUIC_SUCCEEDED(Listener.GetInitStatus());
+    TEST_QUIC_SUCCEEDED(Listener.GetLocalAddr(ServerLocalAddr));
+
+    uint64_t CountersBefore[QUIC_PERF_COUNTER_MAX];
+    uint32_t BufferLength = sizeof(CountersBefore);
+    TEST_QUIC_SUCCEEDED(
+        MsQuic->GetParam(
+            nullptr,
+            QUIC_PARAM_GLOBAL_PERF_COUNTERS,
+            &BufferLength,
+            CountersBefore));
+
+    //
+    // Get a ticket referencing the server's session cache.
+    //
+    UniquePtr<uint8_t[]> Ticket;
+    uint32_t TicketLength = 0;
+    {
+        MsQuicConnection Client(Registration);
+        TEST_QUIC_SUCCEEDED(Client.GetInitStatus());
+        TEST_QUIC_SUCCEEDED(Client.Start(ClientConfiguration, QuicAddrFamily, QUIC_TEST_LOOPBACK_FOR_AF(QuicAddrFamily), ServerLocalAddr.GetPort()));
+        TEST_TRUE(Client.HandshakeCompleteEvent.WaitTimeout(TestWaitTimeout));
+        TEST_TRUE(Client.HandshakeComplete);
+        TEST_TRUE(Client.ResumptionTicketReceivedEvent.WaitTimeout(TestWaitTimeout));
+        TicketLength = Client.ResumptionTicketLength;
+        Ticket.reset(new(std::nothrow) uint8_t[TicketLength]);
+        TEST_NOT_EQUAL(nullptr, Ticket);
+        CxPlatCopyMemory(Ticket.get(), Client.ResumptionTicket, TicketLength);
+    }
+
+    //
+    // The cached session can only be resumed once. Using the same ticket again
+    // falls back to a full handshake.
+    //
+    for (uint32_t i = 0; i < 2; ++i) {
+        MsQuicConnection Client(Registration);
+        TEST_QUIC_SUCCEEDED(Client.GetInitStatus());
+        TEST_QUIC_SUCCEEDED(Client.SetResumptionTicket(Ticket.get(), TicketLength));
+        TEST_QUIC_SUCCEEDED(Client.Start(ClientConfiguration, QuicAddrFamily, QUIC_TEST_LOOPBACK_FOR_AF(QuicAddrFamily), ServerLocalAddr.GetPort()));
+        TEST_TRUE(Client.HandshakeCompleteEvent.WaitTimeout(TestWaitTimeout));
+        TEST_TRUE(Client.HandshakeComplete);
+        TEST_EQUAL(Client.HandshakeResumed, (i == 0));
+    }
+
+    uint64_t CountersAfter[QUIC_PERF_COUNTER_MAX];
+    BufferLength = sizeof(CountersAfter);
+    TEST_QUIC_SUCCEEDED(
+        MsQuic->GetParam(
+            nullptr,
+            QUIC_PARAM_GLOBAL_PERF_COUNTERS,
+            &BufferLength,
+            CountersAfter));
+    TEST_TRUE(CountersAfter[QUIC_PERF_COUNTER_SESSION_CACHE_HIT] > CountersBefore[QUIC_PERF_COUNTER_SESSION_CACHE_HIT]);
+    TEST_TRUE(CountersAfter[QUIC_PERF_COUNTER_SESSION_CACHE_MISS] > CountersBefore[QUIC_PERF_COUNTER_SESSION_CACHE_MISS]);
+}
+
+void
+QuicTestHandshakeNoAmplificationStall(
+    const FamilyArgs& Params,
+    const QUIC_CREDENTIAL_CONFIG* ServerCredConfig
+    )
+{
+    const int Family = Params.Family;
+    MsQuicRegistration Registration(true);
+    TEST_QUIC_SUCCEEDED(Registration.GetInitStatus());
+
+    MsQuicConfiguration ServerConfiguration(Registration, "MsQuicTest", *ServerCredConfig);
+    TEST_QUIC_SUCCEEDED(ServerConfiguration.GetInitStatus());
+
+    MsQuicConfiguration ClientConfiguration(Registration, "MsQuicTest", MsQuicCredentialConfig());
+    TEST_QUIC_SUCCEEDED(ClientConfiguration.GetInitStatus());
+
+    const QUIC_ADDRESS_FAMILY QuicAddrFamily = (Family == 4) ? QUIC_ADDRESS_FAMILY_INET : QUIC_ADDRESS_FAMILY_INET6;
+    QuicAddr ServerLocalAddr(QuicAddrFamily);
+
+    MsQuicAutoAcceptListener Listener(Registration, ServerConfiguration, MsQuicConnection::NoOpCallback);
+    TEST_QUIC_SUCCEEDED(Listener.Start("MsQuicTest", &ServerLocalAddr.SockAddr));
+    TEST_QUIC_SUCCEEDED(Listener.GetInitStatus());
+    TEST_QUIC_SUCCEEDED(Listener.GetLocalAddr(ServerLocalAddr));
+
+    uint64_t CountersBefore[QUIC_PERF_COUNTER_MAX];
+    uint32_t BufferLength = sizeof(CountersBefore);
+    TEST_QUIC_SUCCEEDED(
+        MsQuic->GetParam(
+            nullptr,
+            QUIC_PARAM_GLOBAL_PERF_COUNTERS,
+            &BufferLength,
+            CountersBefore));
+
+    //
+    // The server's certificate chain only fits in its first flight when it's
+    // compressed. Otherwise the server has to wait for more data from the
+    // client before it can send the rest of the chain.
+    //
+    MsQuicConnection Client(Registration);
+    TEST_QUIC_SUCCEEDED(Client.GetInitStatus());
+    TEST_QUIC_SUCCEEDED(Client.Start(ClientConfiguration, QuicAddrFamily, QUIC_TEST_LOOPBACK_FOR_AF(QuicAddrFamily), ServerLocalAddr.GetPort()));
+    TEST_TRUE(Client.HandshakeCompleteEvent.WaitTimeout(TestWaitTimeout));
+    TEST_TRUE(Client.HandshakeComplete);
+    TEST_NOT_EQUAL(nullptr, Listener.LastConnection);
+    TEST_TRUE(Listener.LastConnection->HandshakeCompleteEvent.WaitTimeout(TestWaitTimeout));
+    TEST_TRUE(Listener.LastConnection->HandshakeComplete);
+
+    uint64_t CountersAfter[QUIC_PERF_COUNTER_MAX];
+    BufferLength = sizeof(CountersAfter);
+    TEST_QUIC_SUCCEEDED(
+        MsQuic->GetParam(
+            nullptr,
+            QUIC_PARAM_GLOBAL_PERF_COUNTERS,
+            &BufferLength,
+            CountersAfter));
+    TEST_TRUE(
+        CountersAfter[QUIC_PERF_COUNTER_CONN_HANDSHAKE_NO_AMP_STALL] >
+        CountersBefore[QUIC_PERF_COUNTER_CONN_HANDSHAKE_NO_AMP_STALL]);
+}
+
+void
+QuicTestHandshakeKeySharePool(
+    const FamilyArgs& Params
+    )
+{
+    const int Family = Params.Family;
+    MsQuicRegistration Registration(true);
+    TEST_QUIC_SUCCEEDED(Registration.GetInitStatus());
+
+    MsQuicConfiguration ServerConfiguration(
+        Registration,
+        "MsQuicTest",
+        MsQuicSettings().SetKeySharePoolEnabled(true),
+        ServerSelfSignedCredConfig);
+    TEST_QUIC_SUCCEEDED(ServerConfiguration.GetInitStatus());
+
+    MsQuicConfiguration ClientConfiguration(Registration, "MsQuicTest", MsQuicCredentialConfig());
+    TEST_QUIC_SUCCEEDED(ClientConfiguration.GetInitStatus());
+
+    const QUIC_ADDRESS_FAMILY QuicAddrFamily = (Family == 4) ? QUIC_ADDRESS_FAMILY_INET : QUIC_ADDRESS_FAMILY_INET6;
+    QuicAddr ServerLocalAddr(QuicAddrFamily);
+
+    MsQuicAutoAcceptListener Listener(Registration, ServerConfiguration, MsQuicConnection::NoOpCallback);
+    TEST_QUIC_SUCCEEDED(Listener.Start("MsQuicTest", &ServerLocalAddr.SockAddr));
+    TEST_QUIC_SUCCEEDED(Listener.GetInitStatus());
+    TEST_QUIC_SUCCEEDED(Listener.GetLocalAddr(ServerLocalAddr));
+
+    //
+    // The client only offers a key share for its preferred group, so the
+    // coverage of each pooled group is in the platform's TLS tests.
+    //
+    for (uint32_t i = 0; i < 8; ++i) {
+        MsQuicConnection Client(Registration);
+        TEST_QUIC_SUCCEEDED(Client.GetInitStatus());
+        TEST_QUIC_SUCCEEDED(Client.Start(ClientConfiguration, QuicAddrFamily, QUIC_TEST_LOOPBACK_FOR_AF(QuicAddrFamily), ServerLocalAddr.GetPort()));
+        TEST_TRUE(Client.HandshakeCompleteEvent.WaitTimeout(TestWaitTimeout));
+        TEST_TRUE(Client.HandshakeComplete);
+        TEST_NOT_EQUAL(nullptr, Listener.LastConnection);
+        TEST_TRUE(Listener.LastConnection->HandshakeCompleteEvent.WaitTimeout(TestWaitTimeout));
+        TEST_TRUE(Listener.LastConnection->HandshakeComplete);
+    }
+}
+
 void
 QuicTestChangeAlpn(
     void
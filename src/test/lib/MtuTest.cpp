@@ -48,6 +48,57 @@ struct ResetSettings {
     }
 };
 
+//
+// MTU discovery doesn't indicate any events, so poll the connection's path MTU
+// until it's within [Low, High].
+//
+static
+QUIC_STATUS
+WaitForSendPathMtu(
+    _In_ const MsQuicConnection& Connection,
+    _In_ uint16_t Low,
+    _In_ uint16_t High
+    )
+{
+    return
+        TryUntil(10, TestWaitTimeout, [&]() {
+            QUIC_STATISTICS_V2 Stats;
+            QUIC_STATUS Status = Connection.GetStatistics(&Stats);
+            if (QUIC_FAILED(Status)) {
+                return Status;
+            }
+            if (Stats.SendPathMtu < Low || Stats.SendPathMtu > High) {
+                return QUIC_STATUS_CONTINUE;
+            }
+            return QUIC_STATUS_SUCCESS;
+        });
+}
+
+//
+// Waits for both ends of a connection accepted by Listener to be connected.
+//
+static
+bool
+WaitForConnected(
+    _In_ MsQuicConnection& Connection,
+    _In_ const MsQuicAutoAcceptListener& Listener
+    )
+{
+    if (!Connection.HandshakeCompleteEvent.WaitTimeout(TestWaitTimeout) ||
+        !Connection.HandshakeComplete) {
+        return false;
+    }
+    //
+    // The listener accepted the server connection before the server sent
+    // the handshake data that completed the client's handshake.
+    //
+    MsQuicConnection* Server = Listener.LastConnection;
+    return
+        Server != nullptr &&
+        Server->HandshakeCompleteEvent.WaitTimeout(TestWaitTimeout) &&
+        Server->HandshakeComplete;
+}
+
 void
 QuicTestMtuSettings()
 {
@@ -352,8 +403,9 @@ QuicTestMtuDiscovery(
     TEST_QUIC_SUCCEEDED(Connection.GetInitStatus());
     TEST_QUIC_SUCCEEDED(Connection.Start(ClientConfiguration, ServerLocalAddr.GetFamily(), QUIC_TEST_LOOPBACK_FOR_AF(ServerLocalAddr.GetFamily()), ServerLocalAddr.GetPort()));
 
-    CxPlatSleep(1000); // TODO - Make this event based.
-    TEST_NOT_EQUAL(nullptr, Listener.LastConnection);
+    TEST_TRUE(WaitForConnected(Connection, Listener));
+    TEST_QUIC_SUCCEEDED(WaitForSendPathMtu(Connection, ClientExpectedMtu, ClientExpectedMtu));
+    TEST_QUIC_SUCCEEDED(WaitForSendPathMtu(*Listener.LastConnection, ServerExpectedMtu, ServerExpectedMtu));
 
     QUIC_STATISTICS_V2 ClientStats;
     TEST_QUIC_SUCCEEDED(Connection.GetStatistics(&ClientStats));
@@ -363,3 +415,198 @@ QuicTestMtuDiscovery(
     TEST_QUIC_SUCCEEDED(Listener.LastConnection->GetStatistics(&ServerStats));
     TEST_EQUAL(ServerExpectedMtu, ServerStats.SendPathMtu);
 }
+
+void
+QuicTestMtuDiscoveryCache()
+{
+    MsQuicRegistration Registration(true);
+    TEST_QUIC_SUCCEEDED(Registration.GetInitStatus());
+
+    const uint16_t MinimumMtu = 1248;
+    const uint16_t ServerDropSize = 1400;
+#if defined(QUIC_API_ENABLE_PREVIEW_FEATURES)
+    const uint16_t MaximumMtu = UseQTIP ? 1488 : 1500; // reserve 12B for TCP header
+#else
+    const uint16_t MaximumMtu = 1500;
+#endif
+
+    MsQuicAlpn Alpn("MsQuicTest");
+    MsQuicSettings Settings;
+    Settings.
+        SetMinimumMtu(MinimumMtu).
+        SetMaximumMtu(MaximumMtu).
+        SetMtuDiscoveryMissingProbeCount(1).
+        SetIdleTimeoutMs(30000).
+        SetDisconnectTimeoutMs(30000);
+
+    MsQuicConfiguration ServerConfiguration(Registration, Alpn, Settings, ServerSelfSignedCredConfig);
+    TEST_QUIC_SUCCEEDED(ServerConfiguration.GetInitStatus());
+
+    MsQuicCredentialConfig ClientCredConfig;
+    MsQuicConfiguration ClientConfiguration(Registration, Alpn, Settings, ClientCredConfig);
+    TEST_QUIC_SUCCEEDED(ClientConfiguration.GetInitStatus());
+
+    MsQuicAutoAcceptListener Listener(Registration, ServerConfiguration, MsQuicConnection::NoOpCallback);
+    TEST_QUIC_SUCCEEDED(Listener.GetInitStatus());
+    QuicAddr ServerLocalAddr(QUIC_ADDRESS_FAMILY_INET);
+    TEST_QUIC_SUCCEEDED(Listener.Start(Alpn, &ServerLocalAddr.SockAddr));
+    TEST_QUIC_SUCCEEDED(Listener.GetLocalAddr(ServerLocalAddr));
+
+    uint16_t FirstServerMtu;
+    {
+        //
+        // The server's probes above ServerDropSize are lost, so its search
+        // stops somewhere below that.
+        //
+        MtuDropHelper ServerDropper(ServerDropSize, ServerLocalAddr.GetPort(), 0);
+
+        MsQuicConnection Connection(Registration);
+        TEST_QUIC_SUCCEEDED(Connection.GetInitStatus());
+        TEST_QUIC_SUCCEEDED(Connection.Start(ClientConfiguration, ServerLocalAddr.GetFamily(), QUIC_TEST_LOOPBACK_FOR_AF(ServerLocalAddr.GetFamily()), ServerLocalAddr.GetPort()));
+
+        TEST_TRUE(WaitForConnected(Connection, Listener));
+        TEST_QUIC_SUCCEEDED(WaitForSendPathMtu(Connection, MaximumMtu, MaximumMtu));
+        TEST_QUIC_SUCCEEDED(WaitForSendPathMtu(*Listener.LastConnection, 1281, ServerDropSize));
+
+        //
+        // The binding only caches the MTU once the search is complete, which
+        // is after the server's last probe has been declared lost. Nothing
+        // else is sent, so the search is complete once the server is idle.
+        //
+        uint64_t ServerSentPackets = 0;
+        TEST_QUIC_SUCCEEDED(
+            TryUntil(100, TestWaitTimeout, [&]() {
+                QUIC_STATISTICS_V2 Stats;
+                QUIC_STATUS Status = Listener.LastConnection->GetStatistics(&Stats);
+                if (QUIC_FAILED(Status)) {
+                    return Status;
+                }
+                if (Stats.SendTotalPackets != ServerSentPackets) {
+                    ServerSentPackets = Stats.SendTotalPackets;
+                    return QUIC_STATUS_CONTINUE;
+                }
+                return QUIC_STATUS_SUCCESS;
+            }));
+
+        QUIC_STATISTICS_V2 ServerStats;
+        TEST_QUIC_SUCCEEDED(Listener.LastConnection->GetStatistics(&ServerStats));
+        TEST_TRUE(ServerStats.SendPathMtu > 1280);
+        TEST_TRUE(ServerStats.SendPathMtu <= ServerDropSize);
+        FirstServerMtu = ServerStats.SendPathMtu;
+
+        Connection.Shutdown(1);
+    }
+
+    Listener.LastConnection = nullptr;
+
+    {
+        //
+        // Nothing is dropped anymore, but the listener's binding remembers the
+        // larger probes failed, so the new server connection goes straight to
+        // the same MTU and stops there. The client uses its own binding, so it
+        // still finds the max.
+        //
+        MsQuicConnection Connection(Registration);
+        TEST_QUIC_SUCCEEDED(Connection.GetInitStatus());
+        TEST_QUIC_SUCCEEDED(Connection.Start(ClientConfiguration, ServerLocalAddr.GetFamily(), QUIC_TEST_LOOPBACK_FOR_AF(ServerLocalAddr.GetFamily()), ServerLocalAddr.GetPort()));
+
+        TEST_TRUE(WaitForConnected(Connection, Listener));
+        TEST_QUIC_SUCCEEDED(WaitForSendPathMtu(Connection, MaximumMtu, MaximumMtu));
+        TEST_QUIC_SUCCEEDED(WaitForSendPathMtu(*Listener.LastConnection, 1281, MaximumMtu));
+
+        QUIC_STATISTICS_V2 ServerStats;
+        TEST_QUIC_SUCCEEDED(Listener.LastConnection->GetStatistics(&ServerStats));
+        TEST_EQUAL(FirstServerMtu, ServerStats.SendPathMtu);
+
+        QUIC_STATISTICS_V2 ClientStats;
+        TEST_QUIC_SUCCEEDED(Connection.GetStatistics(&ClientStats));
+        TEST_EQUAL(MaximumMtu, ClientStats.SendPathMtu);
+
+        Connection.Shutdown(1);
+    }
+}
+
+void
+QuicTestMtuBlackHole()
+{
+    MsQuicRegistration Registration(true);
+    TEST_QUIC_SUCCEEDED(Registration.GetInitStatus());
+
+    const uint16_t MinimumMtu = 1248;
+#if defined(QUIC_API_ENABLE_PREVIEW_FEATURES)
+    const uint16_t MaximumMtu = UseQTIP ? 1488 : 1500; // reserve 12B for TCP header
+#else
+    const uint16_t MaximumMtu = 1500;
+#endif
+
+    MsQuicAlpn Alpn("MsQuicTest");
+    MsQuicSettings Settings;
+    Settings.
+        SetMinimumMtu(MinimumMtu).
+        SetMaximumMtu(MaximumMtu).
+        SetPeerUnidiStreamCount(1).
+        SetIdleTimeoutMs(30000).
+        SetDisconnectTimeoutMs(30000);
+
+    MsQuicConfiguration ServerConfiguration(Registration, Alpn, Settings, ServerSelfSignedCredConfig);
+    TEST_QUIC_SUCCEEDED(ServerConfiguration.GetInitStatus());
+
+    MsQuicCredentialConfig ClientCredConfig;
+    MsQuicConfiguration ClientConfiguration(Registration, Alpn, Settings, ClientCredConfig);
+    TEST_QUIC_SUCCEEDED(ClientConfiguration.GetInitStatus());
+
+    MsQuicAutoAcceptListener Listener(Registration, ServerConfiguration, MtuSettingsCallback, nullptr);
+    TEST_QUIC_SUCCEEDED(Listener.GetInitStatus());
+    QuicAddr ServerLocalAddr(QUIC_ADDRESS_FAMILY_INET);
+    TEST_QUIC_SUCCEEDED(Listener.Start(Alpn, &ServerLocalAddr.SockAddr));
+    TEST_QUIC_SUCCEEDED(Listener.GetLocalAddr(ServerLocalAddr));
+
+    //
+    // Nothing is dropped until the MTU has been discovered.
+    //
+    MtuDropHelper ServerDropper(0, ServerLocalAddr.GetPort(), 0xFFFF);
+
+    MsQuicConnection Connection(Registration);
+    TEST_QUIC_SUCCEEDED(Connection.GetInitStatus());
+    TEST_QUIC_SUCCEEDED(Connection.Start(ClientConfiguration, ServerLocalAddr.GetFamily(), QUIC_TEST_LOOPBACK_FOR_AF(ServerLocalAddr.GetFamily()), ServerLocalAddr.GetPort()));
+    MsQuicStream Stream(Connection, QUIC_STREAM_OPEN_FLAG_UNIDIRECTIONAL);
+    TEST_QUIC_SUCCEEDED(Stream.GetInitStatus());
+
+    uint8_t RawBuffer[100];
+    QUIC_BUFFER Buffer { sizeof(RawBuffer), RawBuffer };
+    TEST_QUIC_SUCCEEDED(Stream.Send(&Buffer, 1, QUIC_SEND_FLAG_START));
+    TEST_TRUE(WaitForConnected(Connection, Listener));
+    TEST_QUIC_SUCCEEDED(WaitForSendPathMtu(Connection, MaximumMtu, MaximumMtu));
+
+    QUIC_STATISTICS_V2 Stats;
+    TEST_QUIC_SUCCEEDED(Connection.GetStatistics(&Stats));
+    TEST_EQUAL(MaximumMtu, Stats.SendPathMtu);
+
+    //
+    // Now every packet from the client larger than the minimum MTU is lost,
+    // including all the full sized ones carrying the stream data. The client
+    // must fall back to the minimum MTU to make progress again.
+    //
+    ServerDropper.ClientDropPacketSize = MinimumMtu;
+
+    static uint8_t LargeRawBuffer[0x10000];
+    QUIC_BUFFER LargeBuffer { sizeof(LargeRawBuffer), LargeRawBuffer };
+    TEST_QUIC_SUCCEEDED(Stream.Send(&LargeBuffer, 1, QUIC_SEND_FLAG_FIN));
+    TEST_QUIC_SUCCEEDED(WaitForSendPathMtu(Connection, MinimumMtu, MinimumMtu));
+
+    TEST_QUIC_SUCCEEDED(
+        TryUntil(10, TestWaitTimeout, [&]() {
+            QUIC_STATISTICS_V2 ServerStats;
+            QUIC_STATUS Status = Listener.LastConnection->GetStatistics(&ServerStats);
+            if (QUIC_FAILED(Status)) {
+                return Status;
+            }
+            if (ServerStats.RecvTotalStreamBytes < sizeof(RawBuffer) + sizeof(LargeRawBuffer)) {
+                return QUIC_STATUS_CONTINUE;
+            }
+            return QUIC_STATUS_SUCCESS;
+        }));
+
+    Stream.Shutdown(1);
+    Connection.Shutdown(1);
+}
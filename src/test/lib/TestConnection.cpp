@@ -29,7 +29,8 @@ TestConnection::TestConnection(
     EventDeleted(nullptr),
     NewStreamCallback(NewStreamCallbackHandler), ShutdownCompleteCallback(nullptr),
     DatagramsSent(0), DatagramsCanceled(0), DatagramsSuspectLost(0),
-    DatagramsLost(0), DatagramsAcknowledged(0), NegotiatedAlpn(nullptr),
+    DatagramsLost(0), DatagramsAcknowledged(0), DatagramsReceived(0),
+    DatagramReceiveEvents(0), NegotiatedAlpn(nullptr),
     NegotiatedAlpnLength(0), SslKeyLogFileName(nullptr), Context(nullptr)
 {
     CxPlatEventInitialize(&EventConnectionComplete, TRUE, FALSE);
@@ -63,7 +64,8 @@ TestConnection::TestConnection(
     EventDeleted(nullptr),
     NewStreamCallback(NewStreamCallbackHandler), ShutdownCompleteCallback(nullptr),
     DatagramsSent(0), DatagramsCanceled(0), DatagramsSuspectLost(0),
-    DatagramsLost(0), DatagramsAcknowledged(0), NegotiatedAlpn(nullptr),
+    DatagramsLost(0), DatagramsAcknowledged(0), DatagramsReceived(0),
+    DatagramReceiveEvents(0), NegotiatedAlpn(nullptr),
     NegotiatedAlpnLength(0), SslKeyLogFileName(nullptr), Context(nullptr)
 {
     CxPlatEventInitialize(&EventConnectionComplete, TRUE, FALSE);
@@ -907,6 +909,9 @@ TestConnection::HandleConnectionEvent(
         case QUIC_DATAGRAM_SEND_UNKNOWN:
             break;
         case QUIC_DATAGRAM_SEND_SENT:
+            if (DatagramsSent < MaxSentDatagramContexts) {
+                SentDatagramContexts[DatagramsSent] = Event->DATAGRAM_SEND_STATE_CHANGED.ClientContext;
+            }
             DatagramsSent++;
             break;
         case QUIC_DATAGRAM_SEND_LOST_SUSPECT:
@@ -929,6 +934,24 @@ TestConnection::HandleConnectionEvent(
         // Use This
         break;
 
+    case QUIC_CONNECTION_EVENT_DATAGRAM_RECEIVED:
+        DatagramsReceived++;
+        DatagramReceiveEvents++;
+        if (DatagramReceivedCallback) {
+            DatagramReceivedCallback(this, Event->DATAGRAM_RECEIVED.Buffer);
+        }
+        break;
+
+    case QUIC_CONNECTION_EVENT_DATAGRAMS_RECEIVED:
+        DatagramsReceived += Event->DATAGRAMS_RECEIVED.BufferCount;
+        DatagramReceiveEvents++;
+        if (DatagramReceivedCallback) {
+            for (uint32_t i = 0; i < Event->DATAGRAMS_RECEIVED.BufferCount; ++i) {
+                DatagramReceivedCallback(this, &Event->DATAGRAMS_RECEIVED.Buffers[i]);
+            }
+        }
+        break;
+
     case QUIC_CONNECTION_EVENT_RESUMPTION_TICKET_RECEIVED:
         ResumptionTicket =
             (QUIC_BUFFER*)
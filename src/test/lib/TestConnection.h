@@ -45,6 +45,19 @@ void
 
 typedef CONN_SHUTDOWN_COMPLETE_CALLBACK *CONN_SHUTDOWN_COMPLETE_CALLBACK_HANDLER;
 
+//
+// Callback for processing each received datagram.
+//
+typedef
+_Function_class_(DATAGRAM_RECEIVED_CALLBACK)
+void
+(DATAGRAM_RECEIVED_CALLBACK)(
+    _In_ TestConnection* Connection,
+    _In_ const QUIC_BUFFER* Buffer
+    );
+
+typedef DATAGRAM_RECEIVED_CALLBACK *DATAGRAM_RECEIVED_CALLBACK_HANDLER;
+
 //
 // A C++ Wrapper for the MsQuic Connection handle.
 //
@@ -86,6 +99,7 @@ class TestConnection
 
     NEW_STREAM_CALLBACK_HANDLER NewStreamCallback;
     CONN_SHUTDOWN_COMPLETE_CALLBACK_HANDLER ShutdownCompleteCallback;
+    DATAGRAM_RECEIVED_CALLBACK_HANDLER DatagramReceivedCallback {nullptr};
 
     QUIC_BUFFER* ResumptionTicket {nullptr};
 
@@ -94,6 +108,14 @@ class TestConnection
     uint32_t DatagramsSuspectLost;
     uint32_t DatagramsLost;
     uint32_t DatagramsAcknowledged;
+    uint32_t DatagramsReceived;
+    uint32_t DatagramReceiveEvents;
+
+    //
+    // The client send contexts of the first datagrams sent, in send order.
+    //
+    static const uint32_t MaxSentDatagramContexts = 32;
+    void* SentDatagramContexts[MaxSentDatagramContexts] {};
 
     const uint8_t* NegotiatedAlpn;
     uint8_t NegotiatedAlpnLength;
@@ -187,6 +209,10 @@ public:
         ShutdownCompleteCallback = Handler;
     }
 
+    void SetDatagramReceivedCallback(DATAGRAM_RECEIVED_CALLBACK_HANDLER Handler) {
+        DatagramReceivedCallback = Handler;
+    }
+
     //
     // State
     //
@@ -239,6 +265,9 @@ public:
     uint32_t GetDatagramsSuspectLost() const { return DatagramsSuspectLost; }
     uint32_t GetDatagramsLost() const { return DatagramsLost; }
     uint32_t GetDatagramsAcknowledged() const { return DatagramsAcknowledged; }
+    uint32_t GetDatagramsReceived() const { return DatagramsReceived; }
+    uint32_t GetDatagramReceiveEvents() const { return DatagramReceiveEvents; }
+    void* GetSentDatagramContext(uint32_t Index) const { return SentDatagramContexts[Index]; }
 
     //
     // Parameters
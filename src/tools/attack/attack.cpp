@@ -46,6 +46,8 @@ static uint32_t Version = QUIC_VERSION_1;
 static uint64_t TimeStart;
 static int64_t TotalPacketCount;
 static int64_t TotalByteCount;
+static int64_t TotalRetryCount;
+static int64_t TotalResponseCount;
 
 void PrintUsage()
 {
@@ -64,7 +66,8 @@ void PrintUsageList()
     printf("#1 - Random UDP 1 byte UDP packets.\n");
     printf("#2 - Random UDP full length UDP packets.\n");
     printf("#3 - Random QUIC initial packets.\n");
-    printf("#4 - Valid QUIC initial packets.\n\n");
+    printf("#4 - Valid QUIC initial packets.\n");
+    printf("#5 - Valid QUIC initial packets with forged retry tokens.\n\n");
 }
 
 struct CallbackContext {
@@ -81,6 +84,20 @@ UdpRecvCallback(
     _In_ CXPLAT_RECV_DATA* RecvBufferChain
     )
 {
+    //
+    // Count the datagrams the server sends back, to measure how much of the
+    // attack it answers (e.g. with a source rate limit), and the Retry packets
+    // among them, to measure its Retry rate.
+    //
+    for (CXPLAT_RECV_DATA* Datagram = RecvBufferChain; Datagram != nullptr; Datagram = Datagram->Next) {
+        InterlockedIncrement64(&TotalResponseCount);
+        const QUIC_LONG_HEADER_V1* Header = (const QUIC_LONG_HEADER_V1*)Datagram->Buffer;
+        if (Datagram->BufferLength >= sizeof(QUIC_LONG_HEADER_V1) &&
+            Header->IsLongHeader &&
+            Header->Type == (Version == QUIC_VERSION_2 ? (uint8_t)QUIC_RETRY_V2 : (uint8_t)QUIC_RETRY_V1)) {
+            InterlockedIncrement64(&TotalRetryCount);
+        }
+    }
     CxPlatRecvDataReturn(RecvBufferChain);
 }
 
@@ -203,7 +220,7 @@ void RunAttackRandom(CXPLAT_SOCKET* Binding, uint16_t DatagramLength, bool Valid
     }
 }
 
-void RunAttackValidInitial(CXPLAT_SOCKET* Binding)
+void RunAttackValidInitial(CXPLAT_SOCKET* Binding, bool WithRetryToken = false)
 {
     const StrBuffer InitialSalt("38762cf7f55934b34d179ae6a4c80cadccbb7f0a");
     const uint16_t DatagramLength = QUIC_MIN_INITIAL_LENGTH;
@@ -224,6 +241,14 @@ void RunAttackValidInitial(CXPLAT_SOCKET* Binding)
         }
     }
 
+    //
+    // A forged retry token has a current timestamp, so the server has to
+    // decrypt it to find out it isn't valid.
+    //
+    QUIC_TOKEN_CONTENTS Token;
+    CxPlatRandom(sizeof(Token), &Token);
+    Token.Authenticated.IsNewToken = FALSE;
+
     uint8_t Packet[512] = {0};
     uint16_t PacketLength, HeaderLength;
     Writer->WriteClientInitialPacket(
@@ -232,8 +257,13 @@ void RunAttackValidInitial(CXPLAT_SOCKET* Binding)
         sizeof(Packet),
         Packet,
         &PacketLength,
-        &HeaderLength);
+        &HeaderLength,
+        WithRetryToken ? (uint16_t)sizeof(Token) : 0,
+        WithRetryToken ? (uint8_t*)&Token : nullptr);
     uint16_t PacketNumberOffset = HeaderLength - sizeof(uint32_t);
+    const uint16_t TokenOffset =
+        sizeof(QUIC_LONG_HEADER_V1) + sizeof(uint64_t) + sizeof(uint8_t) + sizeof(uint64_t) +
+        QuicVarIntSize(sizeof(Token));
 
     uint64_t* DestCid = (uint64_t*)(Packet + sizeof(QUIC_LONG_HEADER_V1));
     uint64_t* SrcCid = (uint64_t*)(Packet + sizeof(QUIC_LONG_HEADER_V1) + sizeof(uint64_t) + sizeof(uint8_t));
@@ -283,6 +313,10 @@ void RunAttackValidInitial(CXPLAT_SOCKET* Binding)
             (*DestCid)++; (*SrcCid)++;
             *OrigSrcCid = *SrcCid;
             memcpy(SendBuffer->Buffer, Packet, PacketLength);
+            if (WithRetryToken) {
+                Token.Authenticated.Timestamp = (uint64_t)CxPlatTimeEpochMs64();
+                memcpy(SendBuffer->Buffer + TokenOffset, &Token, sizeof(Token));
+            }
 
             QUIC_PACKET_KEY* WriteKey;
             VERIFY(
@@ -371,6 +405,9 @@ CXPLAT_THREAD_CALLBACK(RunAttackThread, /* Context */)
     case 4:
         RunAttackValidInitial(Binding);
         break;
+    case 5:
+        RunAttackValidInitial(Binding, true);
+        break;
     default:
         break;
     }
@@ -408,6 +445,8 @@ void RunAttack()
     uint64_t TimeEnd = CxPlatTimeMs64();
     printf("Packet Rate: %llu KHz\n", (unsigned long long)(TotalPacketCount) / CxPlatTimeDiff64(TimeStart, TimeEnd));
     printf("Bit Rate: %llu mbps\n", (unsigned long long)(8 * TotalByteCount) / (1000 * CxPlatTimeDiff64(TimeStart, TimeEnd)));
+    printf("Retry Rate: %llu KHz\n", (unsigned long long)(TotalRetryCount) / CxPlatTimeDiff64(TimeStart, TimeEnd));
+    printf("Response Rate: %llu KHz\n", (unsigned long long)(TotalResponseCount) / CxPlatTimeDiff64(TimeStart, TimeEnd));
     CXPLAT_FREE(Threads, QUIC_POOL_TOOL);
 
     delete Writer;
@@ -428,7 +467,7 @@ main(
         PrintUsageList();
         ErrorCode = 0;
     } else if (!TryGetValue(argc, argv, "type", &AttackType) ||
-        (AttackType <= 0 || AttackType > 4)) {
+        (AttackType <= 0 || AttackType > 5)) {
         PrintUsage();
     } else {
         const CXPLAT_UDP_DATAPATH_CALLBACKS DatapathCallbacks = {
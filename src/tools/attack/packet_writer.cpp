@@ -259,7 +259,10 @@ PacketWriter::WriteClientInitialPacket(
     _Out_writes_to_(BufferLength, *PacketLength)
         uint8_t* Buffer,
     _Out_ uint16_t* PacketLength,
-    _Out_ uint16_t* HeaderLength
+    _Out_ uint16_t* HeaderLength,
+    _In_ uint16_t TokenLength,
+    _In_reads_opt_(TokenLength)
+        const uint8_t* Token
     )
 {
     uint8_t CidBuffer[sizeof(QUIC_CID) + 256] = {0};
@@ -276,8 +279,8 @@ PacketWriter::WriteClientInitialPacket(
             1, // Fixed bit must be 1 in this case
             Cid,
             Cid,
-            0,
-            nullptr,
+            TokenLength,
+            Token,
             PacketNumber,
             BufferLength,
             Buffer,
@@ -44,6 +44,9 @@ public:
         _Out_writes_to_(BufferLength, *PacketLength)
             uint8_t* Buffer,
         _Out_ uint16_t* PacketLength,
-        _Out_ uint16_t* HeaderLength
+        _Out_ uint16_t* HeaderLength,
+        _In_ uint16_t TokenLength = 0,
+        _In_reads_opt_(TokenLength)
+            const uint8_t* Token = nullptr
         );
 };
@@ -314,6 +314,30 @@ QuicTraceGlobalEvent(
             case QUIC_PERF_COUNTER_LISTEN_QUEUE_DEPTH:
                 printf("    Current listeners queued for processing:            ");
                 break;
+            case QUIC_PERF_COUNTER_SEND_BUFFER_BYTES:
+                printf("    Current bytes buffered for stream sends:            ");
+                break;
+            case QUIC_PERF_COUNTER_SEND_BUFFER_BUDGET_EXHAUSTED:
+                printf("    Total send buffer budget exhaustions ever:          ");
+                break;
+            case QUIC_PERF_COUNTER_SESSION_CACHE_HIT:
+                printf("    Total session cache hits ever:                      ");
+                break;
+            case QUIC_PERF_COUNTER_SESSION_CACHE_MISS:
+                printf("    Total session cache misses ever:                    ");
+                break;
+            case QUIC_PERF_COUNTER_CONN_HANDSHAKE_NO_AMP_STALL:
+                printf("    Total handshakes without amplification stalls:      ");
+                break;
+            case QUIC_PERF_COUNTER_STATELESS_OPER_COMPLETED:
+                printf("    Total stateless operations completed:               ");
+                break;
+            case QUIC_PERF_COUNTER_STATELESS_OPER_DROPPED:
+                printf("    Total stateless operations dropped:                 ");
+                break;
+            case QUIC_PERF_COUNTER_CONN_INITIAL_RATE_LIMITED:
+                printf("    Total Initials dropped by source prefix rate limit: ");
+                break;
             default:
                 printf("    Unknown:                                            ");
                 break;